@@ -460,6 +460,10 @@ namespace storm {
                 options.setAddOverlappingGuardsLabel(true);
             }
 
+            if (buildSettings.isCompileExpressionsSet()) {
+                options.setCompileExpressions(true);
+            }
+
             return storm::api::buildSparseModel<ValueType>(input.model.get(), options, useJit, storm::settings::getModule<storm::settings::modules::JitBuilderSettings>().isDoctorSet());
         }
         
@@ -493,7 +497,7 @@ namespace storm {
                     result = buildModelSparse<ValueType>(input, buildSettings, builderType == storm::builder::BuilderType::Jit);
                 }
             } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitIMCASet()) {
-                STORM_LOG_THROW(mpi.engine == storm::utility::Engine::Sparse, storm::exceptions::InvalidSettingsException, "Can only use sparse engine with explicit input.");
+                STORM_LOG_THROW(mpi.engine == storm::utility::Engine::Sparse || mpi.engine == storm::utility::Engine::Statistical, storm::exceptions::InvalidSettingsException, "Can only use sparse or statistical engine with explicit input.");
                 result = buildModelExplicit<ValueType>(ioSettings, buildSettings);
             }
             
@@ -535,7 +539,7 @@ namespace storm {
             }
             
             STORM_LOG_INFO("Performing bisimulation minimization...");
-            return storm::api::performBisimulationMinimization<ValueType>(model, createFormulasToRespect(input.properties), bisimType);
+            return storm::api::performBisimulationMinimization<ValueType>(model, createFormulasToRespect(input.properties), bisimType, bisimulationSettings.isSparseSignatureRefinementSet());
         }
         
         template <typename ValueType>
@@ -1058,6 +1062,15 @@ namespace storm {
             }
         }
         
+        template <typename ValueType>
+        void verifyWithStatisticalEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
+            verifyProperties<ValueType>(input, [&model,&mpi] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+                STORM_LOG_THROW(states->isInitialFormula(), storm::exceptions::NotSupportedException, "Statistical model checking can only filter initial states.");
+                auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
+                return storm::api::verifyWithStatisticalEngine<ValueType>(mpi.env, sparseModel, storm::api::createTask<ValueType>(formula, true));
+            });
+        }
+        
         template <storm::dd::DdType DdType, typename ValueType>
         void verifyWithHybridEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
             verifyProperties<ValueType>(input, [&model,&mpi] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
@@ -1130,7 +1143,11 @@ namespace storm {
         template <storm::dd::DdType DdType, typename ValueType>
         void verifyModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
             if (model->isSparseModel()) {
-                verifyWithSparseEngine<ValueType>(model, input, mpi);
+                if (mpi.engine == storm::utility::Engine::Statistical) {
+                    verifyWithStatisticalEngine<ValueType>(model, input, mpi);
+                } else {
+                    verifyWithSparseEngine<ValueType>(model, input, mpi);
+                }
             } else {
                 STORM_LOG_ASSERT(model->isSymbolicModel(), "Unexpected model type.");
                 verifySymbolicModel<DdType, ValueType>(model, input, mpi);
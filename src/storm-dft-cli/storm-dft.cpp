@@ -114,6 +114,20 @@ void processOptions() {
     }
 #endif
 
+    // Estimate the unreliability by simulation
+    if (faultTreeSettings.isMonteCarloSet()) {
+        std::vector<double> timebounds;
+        if (dftIOSettings.usePropTimebound()) {
+            timebounds.push_back(dftIOSettings.getPropTimebound());
+        }
+        if (dftIOSettings.usePropTimepoints()) {
+            std::vector<double> timepoints = dftIOSettings.getPropTimepoints();
+            timebounds.insert(timebounds.end(), timepoints.begin(), timepoints.end());
+        }
+        STORM_LOG_THROW(!timebounds.empty(), storm::exceptions::InvalidSettingsException, "Monte-Carlo simulation requires a timebound or timepoints.");
+        storm::api::simulateDFT<ValueType>(*dft, timebounds, faultTreeSettings.getMonteCarloPrecision(), faultTreeSettings.getMonteCarloConfidence(), faultTreeSettings.getMonteCarloSeed(), true);
+        return;
+    }
 
     // From now on we analyse the DFT via model checking
 
@@ -4,6 +4,8 @@
 #include "storm-dft/settings/modules/DftGspnSettings.h"
 #include "storm-conv/settings/modules/JaniExportSettings.h"
 #include "storm-conv/api/storm-conv.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
     namespace api {
@@ -62,6 +64,32 @@ namespace storm {
                             "Analysis by SMT not supported for this data type.");
         }
 
+        template<>
+        storm::dft::simulator::UnreliabilityEstimate simulateDFT(storm::storage::DFT<double> const& dft, std::vector<double> const& timebounds, double precision, double confidence, uint64_t seed, bool printOutput) {
+            STORM_LOG_THROW(!timebounds.empty(), storm::exceptions::InvalidArgumentException, "Monte-Carlo simulation requires at least one timebound.");
+            // Only the top level element is relevant
+            dft.setRelevantEvents(storm::utility::RelevantEvents(), false);
+            std::map<size_t, std::vector<std::vector<size_t>>> emptySymmetry;
+            storm::storage::DFTIndependentSymmetries symmetries(emptySymmetry);
+            storm::storage::DFTStateGenerationInfo stateGenerationInfo(dft.buildStateGenerationInfo(symmetries));
+
+            storm::dft::simulator::DFTMonteCarloSimulator<double> simulator(dft, stateGenerationInfo, seed);
+            storm::dft::simulator::UnreliabilityEstimate estimate = simulator.estimateUnreliability(timebounds, precision, confidence);
+            if (printOutput) {
+                std::cout << "Simulated " << estimate.nrTraces << " traces." << std::endl;
+                for (size_t i = 0; i < estimate.timebounds.size(); ++i) {
+                    std::cout << "Unreliability at time " << estimate.timebounds[i] << ": " << estimate.unreliabilities[i] << " (" << confidence << " confidence interval ["
+                              << estimate.confidenceIntervals[i].first << ", " << estimate.confidenceIntervals[i].second << "])" << std::endl;
+                }
+            }
+            return estimate;
+        }
+
+        template<>
+        storm::dft::simulator::UnreliabilityEstimate simulateDFT(storm::storage::DFT<storm::RationalFunction> const& dft, std::vector<double> const& timebounds, double precision, double confidence, uint64_t seed, bool printOutput) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Monte-Carlo simulation not supported for this data type.");
+        }
+
         template<>
         std::pair<std::shared_ptr<storm::gspn::GSPN>, uint64_t> transformToGSPN(storm::storage::DFT<double> const& dft) {
             storm::settings::modules::FaultTreeSettings const& ftSettings = storm::settings::getModule<storm::settings::modules::FaultTreeSettings>();
@@ -8,6 +8,7 @@
 #include "storm-dft/storage/dft/DftJsonExporter.h"
 #include "storm-dft/modelchecker/dft/DFTModelChecker.h"
 #include "storm-dft/modelchecker/dft/DFTASFChecker.h"
+#include "storm-dft/simulator/DFTMonteCarloSimulator.h"
 #include "storm-dft/transformations/DftToGspnTransformator.h"
 #include "storm-dft/transformations/DftTransformator.h"
 #include "storm-dft/utility/FDEPConflictFinder.h"
@@ -165,6 +166,21 @@ namespace storm {
             return results;
         }
 
+        /*!
+         * Estimate the unreliability of the DFT for the given timebounds by Monte-Carlo simulation.
+         * In contrast to analyzeDFT(), no state space is built.
+         *
+         * @param dft DFT.
+         * @param timebounds Timebounds for which the unreliability is estimated.
+         * @param precision Maximal half-width of the confidence intervals.
+         * @param confidence Confidence level of the intervals.
+         * @param seed Seed from which the random numbers are derived.
+         * @param printOutput If true, the results are printed.
+         * @return The estimated unreliabilities together with the confidence intervals.
+         */
+        template<typename ValueType>
+        storm::dft::simulator::UnreliabilityEstimate simulateDFT(storm::storage::DFT<ValueType> const& dft, std::vector<double> const& timebounds, double precision, double confidence, uint64_t seed = 0, bool printOutput = false);
+
         /*!
          * Analyze the DFT using the SMT encoding
          *
@@ -12,6 +12,7 @@
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/vector.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/transformer/NonMarkovianChainTransformer.h"
 
@@ -228,7 +229,12 @@ namespace storm {
                 approximationThreshold = ftSettings.getMaxDepth();
             }
 
-            exploreStateSpace(approximationThreshold);
+            if (ftSettings.isParallelExploration() && approximationThreshold == 0.0) {
+                exploreStateSpaceParallel(ftSettings.getParallelExplorationBatchSize());
+            } else {
+                STORM_LOG_WARN_COND(!ftSettings.isParallelExploration(), "Parallel exploration is not supported for approximation. Using sequential exploration.");
+                exploreStateSpace(approximationThreshold);
+            }
 
             size_t stateSize = stateStorage.getNumberOfStates() + (this->uniqueFailedState ? 1 : 0);
             modelComponents.markovianStates.resize(stateSize);
@@ -411,71 +417,7 @@ namespace storm {
                     // Explore the current state
                     ++nrExpandedStates;
                     storm::generator::StateBehavior<ValueType, StateType> behavior = generator.expand(std::bind(&ExplicitDFTModelBuilder::getOrAddStateIndex, this, std::placeholders::_1));
-                    STORM_LOG_ASSERT(!behavior.empty(), "Behavior is empty.");
-                    setMarkovian(behavior.begin()->isMarkovian());
-
-                    // Now add all choices.
-                    for (auto const& choice : behavior) {
-                        // Add the probabilistic behavior to the matrix.
-                        for (auto const& stateProbabilityPair : choice) {
-                            STORM_LOG_ASSERT(!storm::utility::isZero(stateProbabilityPair.second), "Probability zero.");
-                            // Set transition to state id + offset. This helps in only remapping all previously skipped states.
-                            matrixBuilder.addTransition(matrixBuilder.mappingOffset + stateProbabilityPair.first, stateProbabilityPair.second);
-                            // Set heuristic values for reached states
-                            auto iter = statesNotExplored.find(stateProbabilityPair.first);
-                            if (iter != statesNotExplored.end()) {
-                                // Update heuristic values
-                                DFTStatePointer state = iter->second.first;
-                                if (!iter->second.second) {
-                                    // Initialize heuristic values
-                                    ExplorationHeuristicPointer heuristic;
-                                    switch (usedHeuristic) {
-                                        case storm::builder::ApproximationHeuristic::DEPTH:
-                                            heuristic = std::make_shared<DFTExplorationHeuristicDepth<ValueType>>(stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
-                                            break;
-                                        case storm::builder::ApproximationHeuristic::PROBABILITY:
-                                            heuristic = std::make_shared<DFTExplorationHeuristicProbability<ValueType>>(stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
-                                            break;
-                                        case storm::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
-                                            heuristic = std::make_shared<DFTExplorationHeuristicBoundDifference<ValueType>>(stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
-                                            break;
-                                        default:
-                                            STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
-                                    }
-
-                                    iter->second.second = heuristic;
-                                    //if (state->hasFailed(dft.getTopLevelIndex()) || state->isFailsafe(dft.getTopLevelIndex()) || state->getFailableElements().hasDependencies() || (!state->getFailableElements().hasDependencies() && !state->getFailableElements().hasBEs())) {
-                                    if (state->getFailableElements().hasDependencies() || (!state->getFailableElements().hasDependencies() && !state->getFailableElements().hasBEs())) {
-                                            // Do not skip absorbing state or if reached by dependencies
-                                        iter->second.second->markExpand();
-                                    }
-                                    if (usedHeuristic == storm::builder::ApproximationHeuristic::BOUNDDIFFERENCE) {
-                                        // Compute bounds for heuristic now
-                                        if (state->isPseudoState()) {
-                                            // Create concrete state from pseudo state
-                                            state->construct();
-                                        }
-                                        STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
-
-                                        // Initialize bounds
-                                        // TODO: avoid hack
-                                        ValueType lowerBound = getLowerBound(state);
-                                        ValueType upperBound = getUpperBound(state);
-                                        heuristic->setBounds(lowerBound, upperBound);
-                                    }
-
-                                    explorationQueue.push(heuristic);
-                                } else if (!iter->second.second->isExpand()) {
-                                    double oldPriority = iter->second.second->getPriority();
-                                    if (iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass())) {
-                                        // Update priority queue
-                                        explorationQueue.update(iter->second.second, oldPriority);
-                                    }
-                                }
-                            }
-                        }
-                        matrixBuilder.finishRow();
-                    }
+                    addBehavior(behavior, currentExplorationHeuristic);
                 }
                 if (storm::utility::resources::isTerminate()) {
                     break;
@@ -491,6 +433,185 @@ namespace storm {
             STORM_LOG_ASSERT(nrSkippedStates == skippedStates.size(), "Nr skipped states is wrong");
         }
 
+        template<typename ValueType, typename StateType>
+        void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpaceParallel(size_t batchSize) {
+#ifndef STORM_HAVE_INTELTBB
+            STORM_LOG_WARN("Storm was built without support for Intel TBB, states of a batch are expanded sequentially.");
+#endif
+            size_t nrExpandedStates = 0;
+            storm::utility::ProgressMeasurement progress("explored states");
+            progress.startNewMeasurement(0);
+
+            std::vector<std::pair<DFTStatePointer, ExplorationHeuristicPointer>> batch;
+            std::vector<storm::generator::StateBehavior<ValueType, StateType>> batchBehaviors;
+            std::vector<std::vector<DFTStatePointer>> batchSuccessors;
+            while (!explorationQueue.empty()) {
+                // Collect the next states in the order given by the exploration queue
+                batch.clear();
+                while (!explorationQueue.empty() && batch.size() < batchSize) {
+                    ExplorationHeuristicPointer currentExplorationHeuristic = explorationQueue.pop();
+                    StateType currentId = currentExplorationHeuristic->getId();
+                    auto itFind = statesNotExplored.find(currentId);
+                    STORM_LOG_ASSERT(itFind != statesNotExplored.end(), "Id " << currentId << " not found");
+                    STORM_LOG_ASSERT(currentExplorationHeuristic == itFind->second.second, "Exploration heuristics do not match");
+                    STORM_LOG_ASSERT(itFind->second.first->getId() == currentId, "Ids do not match");
+                    batch.push_back(std::move(itFind->second));
+                    // Remove it from the list of not explored states
+                    statesNotExplored.erase(itFind);
+                }
+                batchBehaviors.clear();
+                batchBehaviors.resize(batch.size());
+                batchSuccessors.clear();
+                batchSuccessors.resize(batch.size());
+
+                // Expand all states of the batch concurrently.
+                // The successor states are only collected and get temporary ids. They are registered in the state storage afterwards.
+                auto expandState = [this, &batch, &batchBehaviors, &batchSuccessors] (size_t index) {
+                    DFTStatePointer const& currentState = batch[index].first;
+                    if (currentState->isPseudoState()) {
+                        // Create concrete state from pseudo state
+                        currentState->construct();
+                    }
+                    std::vector<DFTStatePointer>& successors = batchSuccessors[index];
+                    batchBehaviors[index] = generator.expand(currentState, [this, &successors] (DFTStatePointer const& state) {
+                        if (stateGenerationInfo->hasSymmetries()) {
+                            // Order state by symmetry
+                            state->orderBySymmetry();
+                        }
+                        successors.push_back(state);
+                        STORM_LOG_ASSERT(successors.size() <= std::numeric_limits<StateType>::max() - OFFSET_UNREGISTERED_STATE, "Number of successors exceeds the range of temporary ids.");
+                        return static_cast<StateType>(OFFSET_UNREGISTERED_STATE + successors.size() - 1);
+                    });
+                };
+#ifdef STORM_HAVE_INTELTBB
+                tbb::parallel_for(tbb::blocked_range<size_t>(0, batch.size()), [&expandState] (tbb::blocked_range<size_t> const& range) {
+                    for (size_t index = range.begin(); index < range.end(); ++index) {
+                        expandState(index);
+                    }
+                });
+#else
+                for (size_t index = 0; index < batch.size(); ++index) {
+                    expandState(index);
+                }
+#endif
+
+                // Register the successors and add the transitions in the order of the batch
+                std::vector<StateType> successorIds;
+                for (size_t index = 0; index < batch.size(); ++index) {
+                    StateType currentId = batch[index].first->getId();
+                    STORM_LOG_ASSERT(stateStorage.stateToId.getValue(batch[index].first->status()) == currentId, "Ids of states do not coincide.");
+                    // Remember that the current row group was actually filled with the transitions of a different state
+                    matrixBuilder.setRemapping(currentId);
+                    matrixBuilder.newRowGroup();
+
+                    successorIds.clear();
+                    for (DFTStatePointer const& successor : batchSuccessors[index]) {
+                        // The symmetry reduction was already applied, a changed state is therefore a pseudo state
+                        successorIds.push_back(getOrAddOrderedStateIndex(successor, successor->isPseudoState()));
+                    }
+
+                    // Replace the temporary ids by the actual ids. Distinct successors might be mapped to the same id which merges the transitions.
+                    storm::generator::StateBehavior<ValueType, StateType> behavior;
+                    for (auto const& choice : batchBehaviors[index]) {
+                        storm::generator::Choice<ValueType, StateType> resolvedChoice(choice.getActionIndex(), choice.isMarkovian());
+                        for (auto const& stateProbabilityPair : choice) {
+                            StateType successorId = stateProbabilityPair.first;
+                            if (successorId >= OFFSET_UNREGISTERED_STATE) {
+                                STORM_LOG_ASSERT(successorId - OFFSET_UNREGISTERED_STATE < successorIds.size(), "Temporary id " << successorId << " is not known.");
+                                successorId = successorIds[successorId - OFFSET_UNREGISTERED_STATE];
+                            }
+                            resolvedChoice.addProbability(successorId, stateProbabilityPair.second);
+                        }
+                        behavior.addChoice(std::move(resolvedChoice));
+                    }
+                    behavior.setExpanded();
+                    addBehavior(behavior, batch[index].second);
+
+                    ++nrExpandedStates;
+                    // Output number of currently explored states
+                    if (nrExpandedStates % 100 == 0) {
+                        progress.updateProgress(nrExpandedStates);
+                    }
+                }
+                STORM_LOG_ASSERT(newIndex < OFFSET_PSEUDO_STATE, "Number of states exceeds the range of state ids.");
+
+                if (storm::utility::resources::isTerminate()) {
+                    break;
+                }
+            } // end exploration
+
+            STORM_LOG_INFO("Expanded " << nrExpandedStates << " states");
+        }
+
+        template<typename ValueType, typename StateType>
+        void ExplicitDFTModelBuilder<ValueType, StateType>::addBehavior(storm::generator::StateBehavior<ValueType, StateType> const& behavior, ExplorationHeuristicPointer const& currentExplorationHeuristic) {
+            STORM_LOG_ASSERT(!behavior.empty(), "Behavior is empty.");
+            setMarkovian(behavior.begin()->isMarkovian());
+
+            // Now add all choices.
+            for (auto const& choice : behavior) {
+                // Add the probabilistic behavior to the matrix.
+                for (auto const& stateProbabilityPair : choice) {
+                    STORM_LOG_ASSERT(!storm::utility::isZero(stateProbabilityPair.second), "Probability zero.");
+                    // Set transition to state id + offset. This helps in only remapping all previously skipped states.
+                    matrixBuilder.addTransition(matrixBuilder.mappingOffset + stateProbabilityPair.first, stateProbabilityPair.second);
+                    // Set heuristic values for reached states
+                    auto iter = statesNotExplored.find(stateProbabilityPair.first);
+                    if (iter != statesNotExplored.end()) {
+                        // Update heuristic values
+                        DFTStatePointer state = iter->second.first;
+                        if (!iter->second.second) {
+                            // Initialize heuristic values
+                            ExplorationHeuristicPointer heuristic;
+                            switch (usedHeuristic) {
+                                case storm::builder::ApproximationHeuristic::DEPTH:
+                                    heuristic = std::make_shared<DFTExplorationHeuristicDepth<ValueType>>(stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
+                                    break;
+                                case storm::builder::ApproximationHeuristic::PROBABILITY:
+                                    heuristic = std::make_shared<DFTExplorationHeuristicProbability<ValueType>>(stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
+                                    break;
+                                case storm::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
+                                    heuristic = std::make_shared<DFTExplorationHeuristicBoundDifference<ValueType>>(stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
+                                    break;
+                                default:
+                                    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
+                            }
+
+                            iter->second.second = heuristic;
+                            //if (state->hasFailed(dft.getTopLevelIndex()) || state->isFailsafe(dft.getTopLevelIndex()) || state->getFailableElements().hasDependencies() || (!state->getFailableElements().hasDependencies() && !state->getFailableElements().hasBEs())) {
+                            if (state->getFailableElements().hasDependencies() || (!state->getFailableElements().hasDependencies() && !state->getFailableElements().hasBEs())) {
+                                    // Do not skip absorbing state or if reached by dependencies
+                                iter->second.second->markExpand();
+                            }
+                            if (usedHeuristic == storm::builder::ApproximationHeuristic::BOUNDDIFFERENCE) {
+                                // Compute bounds for heuristic now
+                                if (state->isPseudoState()) {
+                                    // Create concrete state from pseudo state
+                                    state->construct();
+                                }
+                                STORM_LOG_ASSERT(!state->isPseudoState(), "State is pseudo state.");
+
+                                // Initialize bounds
+                                // TODO: avoid hack
+                                ValueType lowerBound = getLowerBound(state);
+                                ValueType upperBound = getUpperBound(state);
+                                heuristic->setBounds(lowerBound, upperBound);
+                            }
+
+                            explorationQueue.push(heuristic);
+                        } else if (!iter->second.second->isExpand()) {
+                            double oldPriority = iter->second.second->getPriority();
+                            if (iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass())) {
+                                // Update priority queue
+                                explorationQueue.update(iter->second.second, oldPriority);
+                            }
+                        }
+                    }
+                }
+                matrixBuilder.finishRow();
+            }
+        }
+
         template<typename ValueType, typename StateType>
         void ExplicitDFTModelBuilder<ValueType, StateType>::buildLabeling() {
             bool isAddLabelsClaiming = storm::settings::getModule<storm::settings::modules::FaultTreeSettings>().isAddLabelsClaiming();
@@ -884,7 +1005,6 @@ namespace storm {
 
         template<typename ValueType, typename StateType>
         StateType ExplicitDFTModelBuilder<ValueType, StateType>::getOrAddStateIndex(DFTStatePointer const& state) {
-            StateType stateId;
             bool changed = false;
 
             if (stateGenerationInfo->hasSymmetries()) {
@@ -893,7 +1013,12 @@ namespace storm {
                 changed = state->orderBySymmetry();
                 STORM_LOG_TRACE("State " << (changed ? "changed to " : "did not change") << (changed ? dft.getStateString(state) : ""));
             }
+            return getOrAddOrderedStateIndex(state, changed);
+        }
 
+        template<typename ValueType, typename StateType>
+        StateType ExplicitDFTModelBuilder<ValueType, StateType>::getOrAddOrderedStateIndex(DFTStatePointer const& state, bool changed) {
+            StateType stateId;
             if (stateStorage.stateToId.contains(state->status())) {
                 // State already exists
                 stateId = stateStorage.stateToId.getValue(state->status());
@@ -2,6 +2,7 @@
 
 #include <boost/optional/optional.hpp>
 #include <stack>
+#include <unordered_map>
 #include <unordered_set>
 #include <limits>
 
@@ -193,6 +194,24 @@ namespace storm {
              */
             void exploreStateSpace(double approximationThreshold);
 
+            /*!
+             * Explore the complete state space of the DFT by expanding batches of states concurrently.
+             * The states of a batch are expanded in parallel, afterwards the successors are registered and the transitions are added
+             * sequentially in the order given by the exploration queue. The resulting model coincides with the model obtained by
+             * exploreStateSpace (without approximation) up to the numbering of the states.
+             *
+             * @param batchSize Maximal number of states which are expanded concurrently.
+             */
+            void exploreStateSpaceParallel(size_t batchSize);
+
+            /*!
+             * Add the behavior of the current state to the matrix and update the exploration heuristics of the successor states.
+             *
+             * @param behavior Behavior of the current state. All successor states must be registered already.
+             * @param currentExplorationHeuristic Exploration heuristic of the current state.
+             */
+            void addBehavior(storm::generator::StateBehavior<ValueType, StateType> const& behavior, ExplorationHeuristicPointer const& currentExplorationHeuristic);
+
             /*!
              * Initialize the matrix for a refinement iteration.
              */
@@ -212,6 +231,16 @@ namespace storm {
              */
             StateType getOrAddStateIndex(DFTStatePointer const& state);
 
+            /*!
+             * Add a state which is already ordered by symmetry to the explored states (if not already there).
+             *
+             * @param state The state to add.
+             * @param changed Flag indicating whether the ordering by symmetry changed the state, i.e., whether it is a pseudo state.
+             *
+             * @return Id of state.
+             */
+            StateType getOrAddOrderedStateIndex(DFTStatePointer const& state, bool changed);
+
             /*!
              * Set markovian flag for the current state.
              *
@@ -281,6 +310,9 @@ namespace storm {
             const size_t INITIAL_BITVECTOR_SIZE = 20000;
             // Offset used for pseudo states.
             const StateType OFFSET_PSEUDO_STATE = std::numeric_limits<StateType>::max() / 2;
+            // Offset used for temporary ids of successor states which are not registered yet (parallel exploration).
+            // The temporary ids lie above the range of the pseudo states.
+            const StateType OFFSET_UNREGISTERED_STATE = std::numeric_limits<StateType>::max() / 4 * 3;
 
             // Dft
             storm::storage::DFT<ValueType> const& dft;
@@ -318,7 +350,7 @@ namespace storm {
             storm::storage::BucketPriorityQueue<ExplorationHeuristic> explorationQueue;
 
             // A mapping of not yet explored states from the id to the tuple (state object, heuristic values).
-            std::map<StateType, std::pair<DFTStatePointer, ExplorationHeuristicPointer>> statesNotExplored;
+            std::unordered_map<StateType, std::pair<DFTStatePointer, ExplorationHeuristicPointer>> statesNotExplored;
 
             // Holds all skipped states which were not yet expanded. More concretely it is a mapping from matrix indices
             // to the corresponding skipped states.
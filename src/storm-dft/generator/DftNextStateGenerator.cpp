@@ -95,14 +95,20 @@ namespace storm {
 
         template<typename ValueType, typename StateType>
         StateBehavior<ValueType, StateType> DftNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& stateToIdCallback) {
+            return expand(this->state, stateToIdCallback);
+        }
+
+        template<typename ValueType, typename StateType>
+        StateBehavior<ValueType, StateType> DftNextStateGenerator<ValueType, StateType>::expand(DFTStatePointer const& state, StateToIdCallback const& stateToIdCallback) const {
             STORM_LOG_DEBUG("Explore state: " << mDft.getStateString(state));
+            STORM_LOG_ASSERT(!state->isPseudoState(), "State is pseudo state.");
             // Initialization
             bool hasDependencies = state->getFailableElements().hasDependencies();
-            return exploreState(stateToIdCallback, hasDependencies, mTakeFirstDependency);
+            return exploreState(state, stateToIdCallback, hasDependencies, mTakeFirstDependency);
         }
 
         template<typename ValueType, typename StateType>
-        StateBehavior<ValueType, StateType> DftNextStateGenerator<ValueType, StateType>::exploreState(StateToIdCallback const& stateToIdCallback, bool exploreDependencies, bool takeFirstDependency) {
+        StateBehavior<ValueType, StateType> DftNextStateGenerator<ValueType, StateType>::exploreState(DFTStatePointer const& state, StateToIdCallback const& stateToIdCallback, bool exploreDependencies, bool takeFirstDependency) const {
             // Prepare the result, in case we return early.
             StateBehavior<ValueType, StateType> result;
 
@@ -171,7 +177,8 @@ namespace storm {
                         ValueType remainingProbability = storm::utility::one<ValueType>() - probability;
                         choice.addProbability(unsuccessfulStateId, remainingProbability);
                         STORM_LOG_TRACE("Added transition to " << unsuccessfulStateId << " with remaining probability " << remainingProbability);
-                        STORM_LOG_ASSERT(unsuccessfulStateId != state->getId(), "Self loop was added (through PDEP) for " << unsuccessfulStateId << " and failure of " << nextBE->name());
+                        // Compare the states instead of the ids as the callback might only return temporary ids.
+                        STORM_LOG_ASSERT(unsuccessfulState->status() != state->status(), "Self loop was added (through PDEP) for " << unsuccessfulStateId << " and failure of " << nextBE->name());
                     }
                     result.addChoice(std::move(choice));
                 } else {
@@ -182,7 +189,8 @@ namespace storm {
                     choice.addProbability(newStateId, rate);
                     STORM_LOG_TRACE("Added transition to " << newStateId << " with failure rate " << rate);
                 }
-                STORM_LOG_ASSERT(newStateId != state->getId(), "Self loop was added for " << newStateId << " and failure of " << nextBE->name());
+                // Compare the states instead of the ids as the callback might only return temporary ids.
+                STORM_LOG_ASSERT(newState->status() != state->status(), "Self loop was added for " << newStateId << " and failure of " << nextBE->name());
 
                 // Handle premature stop for dependencies
                 if (iterFailable.isFailureDueToDependency() && !iterFailable.isConflictingDependency()) {
@@ -199,7 +207,7 @@ namespace storm {
                 if (result.empty()) {
                     // Dependencies might have been prevented from sequence enforcer
                     // -> explore BEs now
-                    return exploreState(stateToIdCallback, false, takeFirstDependency);
+                    return exploreState(state, stateToIdCallback, false, takeFirstDependency);
                 }
             } else {
                 if (choice.size() == 0) {
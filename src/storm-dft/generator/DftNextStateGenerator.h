@@ -39,6 +39,16 @@ namespace storm {
              */
             StateBehavior<ValueType, StateType> expand(StateToIdCallback const& stateToIdCallback);
 
+            /*!
+             * Expand and explore the given state without loading it first.
+             * In contrast to the other variant, the generator is not modified. This allows to expand several states in parallel
+             * as long as the callback is thread-safe.
+             * @param state State to expand. The state must not be a pseudo state.
+             * @param stateToIdCallback  Callback function which adds new state and returns the corresponding id.
+             * @return  StateBehavior containing successor choices and distributions.
+             */
+            StateBehavior<ValueType, StateType> expand(DFTStatePointer const& state, StateToIdCallback const& stateToIdCallback) const;
+
             /*!
              * Create unique failed state.
              *
@@ -91,13 +101,14 @@ namespace storm {
         private:
 
             /*!
-             * Explore current state and generate all successor states.
+             * Explore the given state and generate all successor states.
+             * @param state State to explore.
              * @param stateToIdCallback Callback function which adds new state and returns the corresponding id.
              * @param exploreDependencies Flag indicating whether failures due to dependencies or due to BEs should be explored.
              * @param takeFirstDependency If true, instead of exploring all possible orders of dependency failures, a fixed order is explored where always the first dependency is considered.
              * @return StateBehavior containing successor choices and distributions.
              */
-            StateBehavior<ValueType, StateType> exploreState(StateToIdCallback const& stateToIdCallback, bool exploreDependencies, bool takeFirstDependency);
+            StateBehavior<ValueType, StateType> exploreState(DFTStatePointer const& state, StateToIdCallback const& stateToIdCallback, bool exploreDependencies, bool takeFirstDependency) const;
 
             // The dft used for the generation of next states.
             storm::storage::DFT<ValueType> const& mDft;
@@ -15,6 +15,7 @@
 #include "storm-dft/storage/dft/DFTIsomorphism.h"
 #include "storm-dft/settings/modules/DftIOSettings.h"
 #include "storm-dft/settings/modules/FaultTreeSettings.h"
+#include "storm-dft/utility/ModuleSignature.h"
 
 
 namespace storm {
@@ -104,50 +105,59 @@ namespace storm {
             // Perform modularisation
             if (dfts.size() > 1) {
                 STORM_LOG_DEBUG("Modularisation of " << dft.getTopLevelGate()->name() << " into " << dfts.size() << " submodules.");
-                // TODO: compute simultaneously
-                dft_results results;
+                property_vector moduleProperties;
                 for (auto property : properties) {
                     if (!property->isProbabilityOperatorFormula()) {
                         STORM_LOG_WARN("Could not check property: " << *property);
                     } else {
-                        // Recursively call model checking
-                        std::vector<ValueType> res;
-                        for (auto const ft : dfts) {
-                            // TODO: allow approximation in modularisation
-                            dft_results ftResults = checkHelper(ft, {property}, symred, true, relevantEvents, allowDCForRelevant, 0.0);
-                            STORM_LOG_ASSERT(ftResults.size() == 1, "Wrong number of results");
-                            res.push_back(boost::get<ValueType>(ftResults[0]));
-                        }
+                        moduleProperties.push_back(property);
+                    }
+                }
 
-                        // Combine modularisation results
-                        STORM_LOG_TRACE("Combining all results... K=" << nrK << "; M=" << nrM << "; invResults="
-                                                                      << (invResults ? "On" : "Off"));
-                        ValueType result = storm::utility::zero<ValueType>();
-                        int limK = invResults ? -1 : nrM + 1;
-                        int chK = invResults ? -1 : 1;
-                        for (int cK = nrK; cK != limK; cK += chK) {
-                            STORM_LOG_ASSERT(cK >= 0, "ck negative.");
-                            uint64_t permutation = smallestIntWithNBitsSet(static_cast<uint64_t>(cK));
-                            do {
-                                STORM_LOG_TRACE("Permutation=" << permutation);
-                                ValueType permResult = storm::utility::one<ValueType>();
-                                for (size_t i = 0; i < res.size(); ++i) {
-                                    if (permutation & (1ul << i)) {
-                                        permResult *= res[i];
-                                    } else {
-                                        permResult *= storm::utility::one<ValueType>() - res[i];
-                                    }
+                // Analyse each module once for all properties
+                std::vector<dft_results> moduleResults;
+                for (auto const& ft : dfts) {
+                    // Recursively call model checking
+                    // TODO: allow approximation in modularisation
+                    moduleResults.push_back(checkHelper(ft, moduleProperties, symred, true, relevantEvents, allowDCForRelevant, 0.0));
+                    STORM_LOG_ASSERT(moduleResults.back().size() == moduleProperties.size(), "Wrong number of results");
+                }
+
+                dft_results results;
+                for (size_t propertyIndex = 0; propertyIndex < moduleProperties.size(); ++propertyIndex) {
+                    std::vector<ValueType> res;
+                    for (auto const& moduleResult : moduleResults) {
+                        res.push_back(boost::get<ValueType>(moduleResult[propertyIndex]));
+                    }
+
+                    // Combine modularisation results
+                    STORM_LOG_TRACE("Combining all results... K=" << nrK << "; M=" << nrM << "; invResults="
+                                                                  << (invResults ? "On" : "Off"));
+                    ValueType result = storm::utility::zero<ValueType>();
+                    int limK = invResults ? -1 : nrM + 1;
+                    int chK = invResults ? -1 : 1;
+                    for (int cK = nrK; cK != limK; cK += chK) {
+                        STORM_LOG_ASSERT(cK >= 0, "ck negative.");
+                        uint64_t permutation = smallestIntWithNBitsSet(static_cast<uint64_t>(cK));
+                        do {
+                            STORM_LOG_TRACE("Permutation=" << permutation);
+                            ValueType permResult = storm::utility::one<ValueType>();
+                            for (size_t i = 0; i < res.size(); ++i) {
+                                if (permutation & (1ul << i)) {
+                                    permResult *= res[i];
+                                } else {
+                                    permResult *= storm::utility::one<ValueType>() - res[i];
                                 }
-                                STORM_LOG_TRACE("Result for permutation:" << permResult);
-                                permutation = nextBitPermutation(permutation);
-                                result += permResult;
-                            } while (permutation < (1ul << nrM) && permutation != 0);
-                        }
-                        if (invResults) {
-                            result = storm::utility::one<ValueType>() - result;
-                        }
-                        results.push_back(result);
+                            }
+                            STORM_LOG_TRACE("Result for permutation:" << permResult);
+                            permutation = nextBitPermutation(permutation);
+                            result += permResult;
+                        } while (permutation < (1ul << nrM) && permutation != 0);
+                    }
+                    if (invResults) {
+                        result = storm::utility::one<ValueType>() - result;
                     }
+                    results.push_back(result);
                 }
                 return results;
             } else {
@@ -156,6 +166,19 @@ namespace storm {
             }
         }
 
+        template<typename ValueType>
+        boost::optional<std::string> DFTModelChecker<ValueType>::getModelCacheKey(storm::storage::DFT<ValueType> const& dft, property_vector const& properties) const {
+            // Models can only be shared between isomorphic DFTs if the properties do not refer to specific elements
+            for (auto const& property : properties) {
+                for (auto const& labelFormula : property->getAtomicLabelFormulas()) {
+                    if (labelFormula->getLabel() != "failed") {
+                        return boost::none;
+                    }
+                }
+            }
+            return storm::dft::utility::ModuleSignature<ValueType>::getCanonicalSignature(dft);
+        }
+
         template<typename ValueType>
         std::shared_ptr<storm::models::sparse::Ctmc<ValueType>>
         DFTModelChecker<ValueType>::buildModelViaComposition(storm::storage::DFT<ValueType> const &dft, property_vector const &properties, bool symred, bool allowModularisation, storm::utility::RelevantEvents const& relevantEvents, bool allowDCForRelevant) {
@@ -295,6 +318,22 @@ namespace storm {
             auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
             auto dftIOSettings = storm::settings::getModule<storm::settings::modules::DftIOSettings>();
 
+            // Reuse the model of an isomorphic DFT which was already built
+            boost::optional<std::string> cacheKey;
+            if (approximationError == 0.0 && !eliminateChains) {
+                cacheKey = getModelCacheKey(dft, properties);
+            }
+            if (cacheKey) {
+                auto findIt = modelCache.find(*cacheKey);
+                if (findIt != modelCache.end()) {
+                    explorationTimer.stop();
+                    STORM_LOG_DEBUG("Reusing model for DFT with top level element " << dft.getElement(dft.getTopLevelIndex())->name() << ".");
+                    std::shared_ptr<storm::models::sparse::Model<ValueType>> model = findIt->second;
+                    std::vector<ValueType> resultsValue = checkModel(model, properties);
+                    return dft_results(resultsValue.begin(), resultsValue.end());
+                }
+            }
+
             dft.setRelevantEvents(relevantEvents, allowDCForRelevant);
 
             // Find symmetries
@@ -419,6 +458,10 @@ namespace storm {
                     auto ma = std::static_pointer_cast<storm::models::sparse::MarkovAutomaton<ValueType>>(model);
                     model = storm::transformer::NonMarkovianChainTransformer<ValueType>::eliminateNonmarkovianStates(ma, labelBehavior);
                 }
+                if (cacheKey) {
+                    // The model is cached before the property-dependent bisimulation is applied
+                    modelCache.emplace(*cacheKey, model);
+                }
                 explorationTimer.stop();
 
                 // Print model information
@@ -86,6 +86,10 @@ namespace storm {
             storm::utility::Stopwatch modelCheckingTimer;
             storm::utility::Stopwatch totalTimer;
 
+            // Models of already analysed modules indexed by the canonical module signature.
+            // All properties of later check() calls are evaluated on these models as well.
+            std::map<std::string, std::shared_ptr<storm::models::sparse::Model<ValueType>>> modelCache;
+
             /*!
              * Internal helper for model checking a DFT.
              *
@@ -106,6 +110,16 @@ namespace storm {
                                     double approximationError = 0.0, storm::builder::ApproximationHeuristic approximationHeuristic = storm::builder::ApproximationHeuristic::DEPTH,
                                     bool eliminateChains = false, storm::transformer::EliminationLabelBehavior labelBehavior = storm::transformer::EliminationLabelBehavior::KeepLabels);
 
+            /*!
+             * Compute the key under which the model of the given DFT is cached. The model is shared between isomorphic DFTs,
+             * e.g. replicated modules below a static gate, provided the properties only refer to the failure of the top level element.
+             *
+             * @param dft DFT.
+             * @param properties Properties to check for.
+             * @return The canonical signature of the DFT or none if the model can not be shared.
+             */
+            boost::optional<std::string> getModelCacheKey(storm::storage::DFT<ValueType> const& dft, property_vector const& properties) const;
+
             /*!
              * Internal helper for building a CTMC from a DFT via parallel composition.
              *
@@ -28,6 +28,8 @@ namespace storm {
             const std::string FaultTreeSettings::maxDepthOptionName = "maxdepth";
             const std::string FaultTreeSettings::firstDependencyOptionName = "firstdep";
             const std::string FaultTreeSettings::uniqueFailedBEOptionName = "uniquefailedbe";
+            const std::string FaultTreeSettings::parallelExplorationOptionName = "parallel-exploration";
+            const std::string FaultTreeSettings::monteCarloOptionName = "montecarlo";
 #ifdef STORM_HAVE_Z3
             const std::string FaultTreeSettings::solveWithSmtOptionName = "smt";
 #endif
@@ -59,6 +61,17 @@ namespace storm {
                         storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("depth", "The maximal depth.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, uniqueFailedBEOptionName, false,
                                                                "Use a unique constantly failed BE.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, parallelExplorationOptionName, false,
+                                                               "Expand batches of states concurrently during state space exploration (requires Intel TBB).").addArgument(
+                        storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("batchsize", "The maximal number of states expanded concurrently.").setDefaultValueUnsignedInteger(1024).makeOptional().addValidatorUnsignedInteger(
+                                ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, monteCarloOptionName, false,
+                                                               "Estimate the unreliability for the given timebounds by Monte-Carlo simulation instead of building the state space.").addArgument(
+                        storm::settings::ArgumentBuilder::createDoubleArgument("precision", "The maximal half-width of the confidence intervals.").setDefaultValueDouble(0.01).makeOptional().addValidatorDouble(
+                                ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).addArgument(
+                        storm::settings::ArgumentBuilder::createDoubleArgument("confidence", "The confidence level of the intervals.").setDefaultValueDouble(0.95).makeOptional().addValidatorDouble(
+                                ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).addArgument(
+                        storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("seed", "The seed from which the random numbers are derived.").setDefaultValueUnsignedInteger(0).makeOptional().build()).build());
 #ifdef STORM_HAVE_Z3
                 this->addOption(storm::settings::OptionBuilder(moduleName, solveWithSmtOptionName, true, "Solve the DFT with SMT.").build());
 #endif
@@ -129,6 +142,34 @@ namespace storm {
                 return this->getOption(uniqueFailedBEOptionName).getHasOptionBeenSet();
             }
 
+            bool FaultTreeSettings::isParallelExploration() const {
+                return this->getOption(parallelExplorationOptionName).getHasOptionBeenSet();
+            }
+
+            uint_fast64_t FaultTreeSettings::getParallelExplorationBatchSize() const {
+                return this->getOption(parallelExplorationOptionName).getArgumentByName("batchsize").getValueAsUnsignedInteger();
+            }
+
+            std::unique_ptr<storm::settings::SettingMemento> FaultTreeSettings::overrideParallelExplorationSet(bool stateToSet) {
+                return this->overrideOption(parallelExplorationOptionName, stateToSet);
+            }
+
+            bool FaultTreeSettings::isMonteCarloSet() const {
+                return this->getOption(monteCarloOptionName).getHasOptionBeenSet();
+            }
+
+            double FaultTreeSettings::getMonteCarloPrecision() const {
+                return this->getOption(monteCarloOptionName).getArgumentByName("precision").getValueAsDouble();
+            }
+
+            double FaultTreeSettings::getMonteCarloConfidence() const {
+                return this->getOption(monteCarloOptionName).getArgumentByName("confidence").getValueAsDouble();
+            }
+
+            uint_fast64_t FaultTreeSettings::getMonteCarloSeed() const {
+                return this->getOption(monteCarloOptionName).getArgumentByName("seed").getValueAsUnsignedInteger();
+            }
+
 #ifdef STORM_HAVE_Z3
 
             bool FaultTreeSettings::solveWithSMT() const {
@@ -145,6 +186,7 @@ namespace storm {
                 STORM_LOG_THROW(!isDisableDC() || !areRelevantEventsSet(), storm::exceptions::InvalidSettingsException, "DisableDC and relevantSets can not both be set.");
                 STORM_LOG_THROW(!isMaxDepthSet() || getApproximationHeuristic() == storm::builder::ApproximationHeuristic::DEPTH, storm::exceptions::InvalidSettingsException,
                                 "Maximal depth requires approximation heuristic depth.");
+                STORM_LOG_THROW(!isMonteCarloSet() || !isApproximationErrorSet(), storm::exceptions::InvalidSettingsException, "Monte-Carlo simulation and approximation can not both be set.");
                 return true;
             }
 
@@ -117,6 +117,57 @@ namespace storm {
                   */
                 bool isUniqueFailedBE() const;
 
+                /*!
+                 * Retrieves whether the state space should be explored by expanding batches of states in parallel.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isParallelExploration() const;
+
+                /*!
+                 * Retrieves the maximal number of states which are expanded concurrently during parallel exploration.
+                 *
+                 * @return The batch size.
+                 */
+                uint_fast64_t getParallelExplorationBatchSize() const;
+
+                /*!
+                 * Overrides the option to explore the state space in parallel by setting it to the specified value. As soon as the
+                 * returned memento goes out of scope, the original value is restored.
+                 *
+                 * @param stateToSet The value that is to be set for the option.
+                 * @return The memento that will eventually restore the original value.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideParallelExplorationSet(bool stateToSet);
+
+                /*!
+                 * Retrieves whether the unreliability should be estimated by Monte-Carlo simulation.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isMonteCarloSet() const;
+
+                /*!
+                 * Retrieves the maximal half-width of the confidence intervals for Monte-Carlo simulation.
+                 *
+                 * @return The precision.
+                 */
+                double getMonteCarloPrecision() const;
+
+                /*!
+                 * Retrieves the confidence level of the intervals for Monte-Carlo simulation.
+                 *
+                 * @return The confidence level.
+                 */
+                double getMonteCarloConfidence() const;
+
+                /*!
+                 * Retrieves the seed for Monte-Carlo simulation.
+                 *
+                 * @return The seed.
+                 */
+                uint_fast64_t getMonteCarloSeed() const;
+
 #ifdef STORM_HAVE_Z3
 
                 /*!
@@ -150,6 +201,8 @@ namespace storm {
                 static const std::string maxDepthOptionName;
                 static const std::string firstDependencyOptionName;
                 static const std::string uniqueFailedBEOptionName;
+                static const std::string parallelExplorationOptionName;
+                static const std::string monteCarloOptionName;
 #ifdef STORM_HAVE_Z3
                 static const std::string solveWithSmtOptionName;
 #endif
@@ -0,0 +1,165 @@
+#include "DFTMonteCarloSimulator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include <boost/math/special_functions/beta.hpp>
+
+#include "storm-config.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/simulator/BatchSimulation.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/SignalHandler.h"
+
+namespace storm {
+    namespace dft {
+        namespace simulator {
+
+            template<typename ValueType>
+            DFTMonteCarloSimulator<ValueType>::DFTMonteCarloSimulator(storm::storage::DFT<ValueType> const& dft, storm::storage::DFTStateGenerationInfo const& stateGenerationInfo, uint64_t seed) : dft(dft), stateGenerationInfo(stateGenerationInfo), seed(seed), batchSize(1000), maxTraces(100000000) {
+                // Intentionally left empty.
+            }
+
+            template<typename ValueType>
+            void DFTMonteCarloSimulator<ValueType>::setBatchSize(uint64_t batchSize) {
+                STORM_LOG_THROW(batchSize > 0, storm::exceptions::InvalidArgumentException, "Batch size must be positive.");
+                this->batchSize = batchSize;
+            }
+
+            template<typename ValueType>
+            void DFTMonteCarloSimulator<ValueType>::setMaximalNumberOfTraces(uint64_t maxTraces) {
+                STORM_LOG_THROW(maxTraces > 0, storm::exceptions::InvalidArgumentException, "Maximal number of traces must be positive.");
+                this->maxTraces = maxTraces;
+            }
+
+            template<typename ValueType>
+            UnreliabilityEstimate DFTMonteCarloSimulator<ValueType>::estimateUnreliability(std::vector<double> const& timebounds, double precision, double confidence, StoppingCriterion criterion) {
+                STORM_LOG_THROW(!timebounds.empty(), storm::exceptions::InvalidArgumentException, "No timebounds given.");
+                STORM_LOG_THROW(precision > 0 && precision < 1, storm::exceptions::InvalidArgumentException, "Precision " << precision << " must be in (0,1).");
+                STORM_LOG_THROW(confidence > 0 && confidence < 1, storm::exceptions::InvalidArgumentException, "Confidence " << confidence << " must be in (0,1).");
+#ifndef STORM_HAVE_INTELTBB
+                STORM_LOG_WARN("Storm was built without support for Intel TBB, simulating traces sequentially.");
+#endif
+
+                std::vector<double> sortedTimebounds = timebounds;
+                std::sort(sortedTimebounds.begin(), sortedTimebounds.end());
+                sortedTimebounds.erase(std::unique(sortedTimebounds.begin(), sortedTimebounds.end()), sortedTimebounds.end());
+
+                uint64_t maxBatches = (maxTraces + batchSize - 1) / batchSize;
+                if (criterion == StoppingCriterion::CHERNOFF) {
+                    uint64_t requiredTraces = getChernoffBound(precision, confidence);
+                    STORM_LOG_WARN_COND(requiredTraces <= maxTraces, "Chernoff bound requires " << requiredTraces << " traces but only " << maxTraces << " traces are allowed.");
+                    maxBatches = std::min(maxBatches, (requiredTraces + batchSize - 1) / batchSize);
+                }
+
+                // The Clopper-Pearson criterion is checked repeatedly, so a single check needs a higher confidence.
+                double checkConfidence = criterion == StoppingCriterion::CLOPPER_PEARSON ? getCorrectedConfidence(maxBatches, confidence) : confidence;
+
+                std::vector<uint64_t> successes(sortedTimebounds.size(), 0);
+                uint64_t nrBatches = 0;
+                bool precisionReached = false;
+                while (!precisionReached && nrBatches < maxBatches) {
+                    // Simulate the next round of batches. For Clopper-Pearson, the number of batches doubles in each round.
+                    uint64_t roundBatches = storm::simulator::BATCHES_PER_ROUND;
+                    if (criterion == StoppingCriterion::CLOPPER_PEARSON) {
+                        roundBatches = std::max(roundBatches, nrBatches);
+                    }
+                    roundBatches = std::min(roundBatches, maxBatches - nrBatches);
+                    std::vector<std::vector<uint64_t>> batchSuccesses(roundBatches, std::vector<uint64_t>(sortedTimebounds.size(), 0));
+                    storm::simulator::simulateBatches(nrBatches, roundBatches, [&] (uint64_t batchIndex) {
+                        simulateBatch(batchIndex, sortedTimebounds, batchSuccesses[batchIndex - nrBatches]);
+                    });
+                    for (uint64_t batch = 0; batch < roundBatches; ++batch) {
+                        for (uint64_t i = 0; i < successes.size(); ++i) {
+                            successes[i] += batchSuccesses[batch][i];
+                        }
+                    }
+                    nrBatches += roundBatches;
+
+                    if (criterion == StoppingCriterion::CLOPPER_PEARSON) {
+                        uint64_t nrTraces = nrBatches * batchSize;
+                        precisionReached = true;
+                        for (uint64_t i = 0; i < successes.size() && precisionReached; ++i) {
+                            std::pair<double, double> interval = getClopperPearsonInterval(successes[i], nrTraces, checkConfidence);
+                            precisionReached = (interval.second - interval.first) / 2 <= precision;
+                        }
+                        STORM_LOG_DEBUG("Simulated " << nrTraces << " traces, precision " << (precisionReached ? "" : "not ") << "reached.");
+                    }
+                    if (storm::utility::resources::isTerminate()) {
+                        break;
+                    }
+                }
+
+                UnreliabilityEstimate estimate;
+                estimate.timebounds = timebounds;
+                estimate.nrTraces = nrBatches * batchSize;
+                STORM_LOG_WARN_COND(criterion != StoppingCriterion::CLOPPER_PEARSON || precisionReached, "Precision " << precision << " was not reached with " << estimate.nrTraces << " traces.");
+                for (double timebound : timebounds) {
+                    uint64_t index = std::lower_bound(sortedTimebounds.begin(), sortedTimebounds.end(), timebound) - sortedTimebounds.begin();
+                    double unreliability = static_cast<double>(successes[index]) / estimate.nrTraces;
+                    estimate.unreliabilities.push_back(unreliability);
+                    if (criterion == StoppingCriterion::CHERNOFF) {
+                        estimate.confidenceIntervals.emplace_back(std::max(0.0, unreliability - precision), std::min(1.0, unreliability + precision));
+                    } else {
+                        estimate.confidenceIntervals.push_back(getClopperPearsonInterval(successes[index], estimate.nrTraces, checkConfidence));
+                    }
+                }
+                return estimate;
+            }
+
+            template<typename ValueType>
+            double DFTMonteCarloSimulator<ValueType>::getCorrectedConfidence(uint64_t maxBatches, double confidence) {
+                // Count the checks, i.e., the rounds of batches, where each round doubles the number of batches
+                uint64_t nrChecks = 1;
+                for (uint64_t nrBatches = std::min(storm::simulator::BATCHES_PER_ROUND, maxBatches); nrBatches < maxBatches; ++nrChecks) {
+                    nrBatches += std::min(nrBatches, maxBatches - nrBatches);
+                }
+                // Bonferroni correction: the probability that any of the checked intervals does not contain the true value is
+                // at most the sum of the individual error probabilities
+                return 1.0 - (1.0 - confidence) / nrChecks;
+            }
+
+            template<typename ValueType>
+            void DFTMonteCarloSimulator<ValueType>::simulateBatch(uint64_t batchIndex, std::vector<double> const& sortedTimebounds, std::vector<uint64_t>& successes) const {
+                uint64_t batchSeed = storm::simulator::getBatchSeed(seed, batchIndex);
+                std::seed_seq seedSequence{static_cast<uint32_t>(batchSeed), static_cast<uint32_t>(batchSeed >> 32)};
+                boost::mt19937 generator(seedSequence);
+                DFTTraceSimulator<ValueType> simulator(dft, stateGenerationInfo, generator);
+
+                for (uint64_t trace = 0; trace < batchSize; ++trace) {
+                    // Invalid traces are not returned but raise an exception in the trace simulator
+                    std::pair<SimulationResult, double> result = simulator.simulateCompleteTraceWithTime(sortedTimebounds.back());
+                    if (result.first == SimulationResult::SUCCESSFUL) {
+                        // The trace is successful for all timebounds which are at least the failure time
+                        for (auto it = std::lower_bound(sortedTimebounds.begin(), sortedTimebounds.end(), result.second); it != sortedTimebounds.end(); ++it) {
+                            ++successes[it - sortedTimebounds.begin()];
+                        }
+                    }
+                }
+            }
+
+            template<typename ValueType>
+            uint64_t DFTMonteCarloSimulator<ValueType>::getChernoffBound(double precision, double confidence) {
+                return static_cast<uint64_t>(std::ceil(std::log(2.0 / (1.0 - confidence)) / (2.0 * precision * precision)));
+            }
+
+            template<typename ValueType>
+            std::pair<double, double> DFTMonteCarloSimulator<ValueType>::getClopperPearsonInterval(uint64_t successes, uint64_t traces, double confidence) {
+                STORM_LOG_ASSERT(successes <= traces, "More successes than traces.");
+                double alpha = 1.0 - confidence;
+                double lower = 0.0;
+                double upper = 1.0;
+                if (successes > 0) {
+                    lower = boost::math::ibeta_inv(static_cast<double>(successes), static_cast<double>(traces - successes + 1), alpha / 2);
+                }
+                if (successes < traces) {
+                    upper = boost::math::ibeta_inv(static_cast<double>(successes + 1), static_cast<double>(traces - successes), 1 - alpha / 2);
+                }
+                return std::make_pair(lower, upper);
+            }
+
+            template class DFTMonteCarloSimulator<double>;
+        }
+    }
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <vector>
+
+#include "storm-dft/simulator/DFTTraceSimulator.h"
+#include "storm-dft/storage/dft/DFT.h"
+
+namespace storm {
+    namespace dft {
+        namespace simulator {
+
+            /*!
+             * Criterion determining when enough traces have been generated.
+             */
+            enum class StoppingCriterion {
+                // Fixed number of traces given by the Chernoff-Hoeffding bound (Okamoto bound).
+                CHERNOFF,
+                // Stop as soon as the Clopper-Pearson confidence intervals for all timebounds are small enough.
+                // The intervals are checked after 1, 2, 4, ... rounds of batches. As the criterion is evaluated repeatedly on
+                // the growing sample, every check (and the reported interval) uses a Bonferroni-corrected confidence level.
+                CLOPPER_PEARSON
+            };
+
+            /*!
+             * Result of a statistical estimation of the unreliability.
+             */
+            struct UnreliabilityEstimate {
+                // The timebounds for which the unreliability was estimated.
+                std::vector<double> timebounds;
+                // The estimated unreliability for each timebound.
+                std::vector<double> unreliabilities;
+                // The confidence interval for each timebound.
+                std::vector<std::pair<double, double>> confidenceIntervals;
+                // The number of traces used for the estimation.
+                uint64_t nrTraces = 0;
+            };
+
+            /*!
+             * Statistical model checker for DFTs based on Monte-Carlo simulation.
+             * Traces are generated in batches with the DFTTraceSimulator. The batches are simulated in parallel, each one using its own
+             * random number stream derived from the seed and the batch index. The results are therefore independent of the number of threads.
+             * Each trace is used for all given timebounds simultaneously.
+             * Invalid states are not supported by the trace simulator, so every generated trace is valid.
+             */
+            template<typename ValueType>
+            class DFTMonteCarloSimulator {
+            public:
+                /*!
+                 * Constructor.
+                 *
+                 * @param dft DFT. The relevant events must already be set.
+                 * @param stateGenerationInfo Info for state generation.
+                 * @param seed Seed from which the random number streams are derived.
+                 */
+                DFTMonteCarloSimulator(storm::storage::DFT<ValueType> const& dft, storm::storage::DFTStateGenerationInfo const& stateGenerationInfo, uint64_t seed);
+
+                /*!
+                 * Set the number of traces generated by one batch.
+                 *
+                 * @param batchSize Number of traces per batch.
+                 */
+                void setBatchSize(uint64_t batchSize);
+
+                /*!
+                 * Set the maximal number of traces which are generated.
+                 *
+                 * @param maxTraces Maximal number of traces.
+                 */
+                void setMaximalNumberOfTraces(uint64_t maxTraces);
+
+                /*!
+                 * Estimate the unreliability, i.e., the probability that the top level element failed, for all given timebounds.
+                 *
+                 * @param timebounds Timebounds.
+                 * @param precision Maximal half-width of the confidence interval.
+                 * @param confidence Confidence level of the interval, e.g. 0.95.
+                 * @param criterion Criterion determining when to stop generating traces.
+                 * @return The estimated unreliabilities together with the confidence intervals.
+                 */
+                UnreliabilityEstimate estimateUnreliability(std::vector<double> const& timebounds, double precision, double confidence, StoppingCriterion criterion = StoppingCriterion::CLOPPER_PEARSON);
+
+                /*!
+                 * Compute the number of traces necessary to guarantee the given precision with the given confidence according to the Chernoff-Hoeffding bound.
+                 *
+                 * @param precision Maximal absolute error.
+                 * @param confidence Confidence level.
+                 * @return Number of traces.
+                 */
+                static uint64_t getChernoffBound(double precision, double confidence);
+
+                /*!
+                 * Compute the exact (Clopper-Pearson) confidence interval for a binomial proportion.
+                 *
+                 * @param successes Number of successful traces.
+                 * @param traces Number of traces.
+                 * @param confidence Confidence level.
+                 * @return Lower and upper bound of the confidence interval.
+                 */
+                static std::pair<double, double> getClopperPearsonInterval(uint64_t successes, uint64_t traces, double confidence);
+
+            private:
+                /*!
+                 * Compute the confidence level which is used for a single check of the Clopper-Pearson criterion such that the
+                 * given confidence holds for all checks performed while simulating at most the given number of batches.
+                 *
+                 * @param maxBatches Maximal number of batches.
+                 * @param confidence Overall confidence level.
+                 * @return Confidence level of a single check.
+                 */
+                static double getCorrectedConfidence(uint64_t maxBatches, double confidence);
+
+                /*!
+                 * Simulate one batch of traces.
+                 *
+                 * @param batchIndex Index of the batch which determines the random number stream.
+                 * @param sortedTimebounds Timebounds in increasing order.
+                 * @param successes The number of traces failing within each timebound is added here.
+                 */
+                void simulateBatch(uint64_t batchIndex, std::vector<double> const& sortedTimebounds, std::vector<uint64_t>& successes) const;
+
+                // The DFT.
+                storm::storage::DFT<ValueType> const& dft;
+
+                // General information for the state generation.
+                storm::storage::DFTStateGenerationInfo const& stateGenerationInfo;
+
+                // Seed for the random number streams.
+                uint64_t seed;
+
+                // Number of traces per batch.
+                uint64_t batchSize;
+
+                // Maximal number of traces.
+                uint64_t maxTraces;
+            };
+        }
+    }
+}
@@ -119,12 +119,22 @@ namespace storm {
 
             template<typename ValueType>
             SimulationResult DFTTraceSimulator<ValueType>::simulateCompleteTrace(double timebound) {
+                return simulateCompleteTraceWithTime(timebound).first;
+            }
+
+            template<>
+            SimulationResult DFTTraceSimulator<storm::RationalFunction>::simulateCompleteTrace(double timebound) {
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Simulation not support for parametric DFTs.");
+            }
+
+            template<typename ValueType>
+            std::pair<SimulationResult, double> DFTTraceSimulator<ValueType>::simulateCompleteTraceWithTime(double timebound) {
                 resetToInitial();
 
                 // Check whether DFT is initially already failed.
                 if (state->hasFailed(dft.getTopLevelIndex())) {
                     STORM_LOG_TRACE("DFT is initially failed");
-                    return SimulationResult::SUCCESSFUL;
+                    return std::make_pair(SimulationResult::SUCCESSFUL, 0.0);
                 }
 
                 double time = 0;
@@ -137,7 +147,7 @@ namespace storm {
                     if (addTime < 0) {
                         // No next state can be reached, because no element can fail anymore.
                         STORM_LOG_TRACE("No next state possible in state " << dft.getStateString(state) << " because no element can fail anymore");
-                        return SimulationResult::UNSUCCESSFUL;
+                        return std::make_pair(SimulationResult::UNSUCCESSFUL, time);
                     }
 
                     // TODO: exit if time would be up after this failure
@@ -153,7 +163,7 @@ namespace storm {
                         // No next state can be reached, because the state is invalid.
                         STORM_LOG_TRACE("No next state possible in state " << dft.getStateString(state) << " because simulation was invalid");
                         STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Handling of invalid states is not supported for simulation");
-                        return SimulationResult::INVALID;
+                        return std::make_pair(SimulationResult::INVALID, time);
                     }
 
                     // Check whether time is up
@@ -162,23 +172,23 @@ namespace storm {
                     time += addTime;
                     if (time > timebound) {
                         STORM_LOG_TRACE("Time limit" << timebound << " exceeded: " << time);
-                        return SimulationResult::UNSUCCESSFUL;
+                        return std::make_pair(SimulationResult::UNSUCCESSFUL, time);
                     }
 
                     // Check whether DFT is failed
                     if (state->hasFailed(dft.getTopLevelIndex())) {
                         STORM_LOG_TRACE("DFT has failed after " << time);
-                        return SimulationResult::SUCCESSFUL;
+                        return std::make_pair(SimulationResult::SUCCESSFUL, time);
                     }
                 }
                 STORM_LOG_ASSERT(false, "Should not be reachable");
-                return SimulationResult::UNSUCCESSFUL;
+                return std::make_pair(SimulationResult::UNSUCCESSFUL, time);
             }
 
             template<>
-            SimulationResult DFTTraceSimulator<storm::RationalFunction>::simulateCompleteTrace(double timebound) {
+            std::pair<SimulationResult, double> DFTTraceSimulator<storm::RationalFunction>::simulateCompleteTraceWithTime(double timebound) {
                 STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Simulation not support for parametric DFTs.");
-            } 
+            }
 
             template class DFTTraceSimulator<double>;
             template class DFTTraceSimulator<storm::RationalFunction>;
@@ -94,6 +94,16 @@ namespace storm {
                  */
                 SimulationResult simulateCompleteTrace(double timebound);
 
+                /*!
+                 * Perform a complete simulation of a failure trace and additionally return the time of the system failure.
+                 * The simulation is the same as in simulateCompleteTrace. This allows to evaluate one trace for all timebounds up to the given one.
+                 *
+                 * @param timebound Time bound in which the system failure should occur.
+                 * @return Pair of the simulation result (see simulateCompleteTrace) and the time at which the system failure occurred.
+                 *         The time is only meaningful if the simulation was successful.
+                 */
+                std::pair<SimulationResult, double> simulateCompleteTraceWithTime(double timebound);
+
             protected:
 
                 // The DFT used for the generation of next states.
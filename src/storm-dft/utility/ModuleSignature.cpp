@@ -0,0 +1,107 @@
+#include "ModuleSignature.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace dft {
+        namespace utility {
+
+            template<typename ValueType>
+            boost::optional<std::string> ModuleSignature<ValueType>::getCanonicalSignature(storm::storage::DFT<ValueType> const& dft) {
+                std::vector<bool> visited(dft.nrElements(), false);
+                boost::optional<std::string> signature = getSubtreeSignature(dft, dft.getTopLevelIndex(), visited);
+                if (signature && std::all_of(visited.begin(), visited.end(), [](bool value) { return value; })) {
+                    return signature;
+                }
+                // Either the DFT contains shared sub-trees or it contains elements not reachable via gates (dependencies, restrictions)
+                return boost::none;
+            }
+
+            template<typename ValueType>
+            boost::optional<std::string> ModuleSignature<ValueType>::getSubtreeSignature(storm::storage::DFT<ValueType> const& dft, size_t index, std::vector<bool>& visited) {
+                if (visited[index]) {
+                    // Element is shared
+                    return boost::none;
+                }
+                visited[index] = true;
+
+                std::stringstream stream;
+                stream << std::setprecision(std::numeric_limits<double>::max_digits10);
+                auto element = dft.getElement(index);
+                if (element->isBasicElement()) {
+                    auto be = dft.getBasicElement(index);
+                    switch (be->beType()) {
+                        case storm::storage::BEType::CONSTANT: {
+                            auto beConst = std::static_pointer_cast<storm::storage::BEConst<ValueType> const>(be);
+                            stream << "CONST(" << (beConst->failed() ? "1" : "0") << ")";
+                            break;
+                        }
+                        case storm::storage::BEType::EXPONENTIAL: {
+                            auto beExp = std::static_pointer_cast<storm::storage::BEExponential<ValueType> const>(be);
+                            stream << "EXP(" << beExp->activeFailureRate() << "," << beExp->dormancyFactor() << "," << (beExp->isTransient() ? "1" : "0") << ")";
+                            break;
+                        }
+                        default:
+                            // No canonical representation for other BE types
+                            return boost::none;
+                    }
+                    return stream.str();
+                }
+
+                if (!element->isGate()) {
+                    return boost::none;
+                }
+                auto gate = dft.getGate(index);
+                std::vector<std::string> childSignatures;
+                for (auto const& child : gate->children()) {
+                    boost::optional<std::string> childSignature = getSubtreeSignature(dft, child->id(), visited);
+                    if (!childSignature) {
+                        return boost::none;
+                    }
+                    childSignatures.push_back(std::move(*childSignature));
+                }
+
+                stream << gate->typestring();
+                switch (gate->type()) {
+                    case storm::storage::DFTElementType::VOT:
+                        stream << std::static_pointer_cast<storm::storage::DFTVot<ValueType> const>(gate)->threshold();
+                        break;
+                    case storm::storage::DFTElementType::PAND:
+                        stream << (std::static_pointer_cast<storm::storage::DFTPand<ValueType> const>(gate)->isInclusive() ? "i" : "e");
+                        break;
+                    case storm::storage::DFTElementType::POR:
+                        stream << (std::static_pointer_cast<storm::storage::DFTPor<ValueType> const>(gate)->isInclusive() ? "i" : "e");
+                        break;
+                    default:
+                        break;
+                }
+                if (storm::storage::isStaticGateType(gate->type())) {
+                    // Order of children is irrelevant for static gates
+                    std::sort(childSignatures.begin(), childSignatures.end());
+                }
+                stream << "(";
+                for (size_t i = 0; i < childSignatures.size(); ++i) {
+                    if (i > 0) {
+                        stream << ",";
+                    }
+                    stream << childSignatures[i];
+                }
+                stream << ")";
+                return stream.str();
+            }
+
+            // Explicitly instantiate the class.
+            template class ModuleSignature<double>;
+
+#ifdef STORM_HAVE_CARL
+            template class ModuleSignature<storm::RationalFunction>;
+#endif
+
+        }
+    }
+}
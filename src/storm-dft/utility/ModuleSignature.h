@@ -0,0 +1,45 @@
+#pragma once
+
+#include <string>
+#include <boost/optional.hpp>
+
+#include "storm-dft/storage/dft/DFT.h"
+
+namespace storm {
+    namespace dft {
+        namespace utility {
+
+            /*!
+             * Computes signatures of DFT modules which allow to recognize isomorphic modules.
+             */
+            template<typename ValueType>
+            class ModuleSignature {
+            public:
+
+                /*!
+                 * Compute a canonical signature of the given DFT which is independent of the element names.
+                 * Two DFTs with the same signature are isomorphic and therefore have the same failure behaviour of the top level element.
+                 * Static gates are treated as commutative, i.e., their children are ordered canonically.
+                 * The signature is only computed if the DFT is a tree without dependencies and restrictions.
+                 *
+                 * @param dft The DFT.
+                 * @return The signature or none if the DFT does not allow a canonical signature.
+                 */
+                static boost::optional<std::string> getCanonicalSignature(storm::storage::DFT<ValueType> const& dft);
+
+            private:
+
+                /*!
+                 * Compute the signature of the sub-tree rooted in the given element.
+                 *
+                 * @param dft The DFT.
+                 * @param index Index of the root element.
+                 * @param visited Elements visited so far.
+                 * @return The signature or none if the sub-tree is no tree.
+                 */
+                static boost::optional<std::string> getSubtreeSignature(storm::storage::DFT<ValueType> const& dft, size_t index, std::vector<bool>& visited);
+            };
+
+        }
+    }
+}
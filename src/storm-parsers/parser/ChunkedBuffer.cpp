@@ -0,0 +1,65 @@
+#include "storm-parsers/parser/ChunkedBuffer.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <thread>
+
+namespace storm {
+    namespace parser {
+
+        ChunkedBuffer::ChunkedBuffer(char const* begin, char const* end, uint64_t minimalChunkSize) {
+            uint64_t size = begin < end ? static_cast<uint64_t>(end - begin) : 0;
+            uint64_t numberOfChunks = 1;
+#ifdef STORM_HAVE_INTELTBB
+            uint64_t numberOfThreads = std::max(1u, std::thread::hardware_concurrency());
+            numberOfChunks = std::max<uint64_t>(1, std::min<uint64_t>(size / std::max<uint64_t>(minimalChunkSize, 1), 4 * numberOfThreads));
+#endif
+            chunkBegins.resize(numberOfChunks + 1);
+            chunkBegins.front() = begin;
+            chunkBegins.back() = std::max(begin, end);
+
+            // Move every split point to the beginning of the next line. As every chunk has at least the minimal size,
+            // the position before the split point is still within the range.
+            forEachChunk(numberOfChunks - 1, [&] (uint64_t chunk) {
+                char const* splitPoint = begin + size * (chunk + 1) / numberOfChunks;
+                char const* lineEnd = static_cast<char const*>(std::memchr(splitPoint - 1, '\n', end - splitPoint + 1));
+                chunkBegins[chunk + 1] = lineEnd == nullptr ? end : lineEnd + 1;
+            });
+        }
+
+        uint64_t ChunkedBuffer::getNumberOfChunks() const {
+            return chunkBegins.size() - 1;
+        }
+
+        char const* ChunkedBuffer::getChunkBegin(uint64_t chunk) const {
+            return chunkBegins[chunk];
+        }
+
+        char const* ChunkedBuffer::getChunkEnd(uint64_t chunk) const {
+            return chunkBegins[chunk + 1];
+        }
+
+        std::vector<uint64_t> ChunkedBuffer::getRecordOffsets() const {
+            std::vector<uint64_t> offsets(getNumberOfChunks() + 1, 0);
+            forEachChunk(getNumberOfChunks(), [&] (uint64_t chunk) {
+                uint64_t records = 0;
+                bool lineIsEmpty = true;
+                for (char const* position = getChunkBegin(chunk), *chunkEnd = getChunkEnd(chunk); position < chunkEnd && *position != '\0'; ++position) {
+                    if (*position == '\n' || *position == '\r') {
+                        lineIsEmpty = true;
+                    } else if (lineIsEmpty && !isspace(static_cast<unsigned char>(*position))) {
+                        lineIsEmpty = false;
+                        ++records;
+                    }
+                }
+                offsets[chunk + 1] = records;
+            });
+            for (uint64_t chunk = 0; chunk < getNumberOfChunks(); ++chunk) {
+                offsets[chunk + 1] += offsets[chunk];
+            }
+            return offsets;
+        }
+
+    } // namespace parser
+} // namespace storm
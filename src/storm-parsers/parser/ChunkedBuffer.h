@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm-parsers/util/cstring.h"
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+    namespace parser {
+
+        /*!
+         * Calls the given function for all chunks 0, ..., numberOfChunks - 1. If TBB is available, this is done concurrently.
+         */
+        template<typename Function>
+        void forEachChunk(uint64_t numberOfChunks, Function const& function) {
+#ifdef STORM_HAVE_INTELTBB
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfChunks, 1), [&] (tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t chunk = range.begin(); chunk < range.end(); ++chunk) {
+                    function(chunk);
+                }
+            });
+#else
+            for (uint64_t chunk = 0; chunk < numberOfChunks; ++chunk) {
+                function(chunk);
+            }
+#endif
+        }
+
+        /*!
+         * Splits the contents of a (mapped) file into chunks that start at the beginning of a line, such that they can
+         * be parsed concurrently. This is meant for the line-based explicit formats, in which every non-empty line
+         * holds exactly one record (e.g. one transition). Parsing is then done in two passes: the first pass counts the
+         * records of every chunk, which determines the position of its records in the result, and the second pass
+         * parses the records of all chunks into the result.
+         */
+        class ChunkedBuffer {
+        public:
+            /*!
+             * Splits the given range into chunks of at least the given size. Without TBB, there is only one chunk.
+             *
+             * @param begin The beginning of the range. This has to be the beginning of a line or of a record.
+             * @param end The end of the range.
+             * @param minimalChunkSize The minimal size of a chunk (in bytes).
+             */
+            ChunkedBuffer(char const* begin, char const* end, uint64_t minimalChunkSize = 1ull << 20);
+
+            uint64_t getNumberOfChunks() const;
+            char const* getChunkBegin(uint64_t chunk) const;
+            char const* getChunkEnd(uint64_t chunk) const;
+
+            /*!
+             * Counts the records (i.e. the lines that contain a non-whitespace character) of all chunks concurrently.
+             *
+             * @return For every chunk, the number of records in the preceding chunks. The last entry is the total number
+             * of records.
+             */
+            std::vector<uint64_t> getRecordOffsets() const;
+
+            /*!
+             * Parses all records concurrently.
+             *
+             * @param parseRecord A function that parses a record from the given position (which points to its first
+             * non-whitespace character) and advances the position behind the record.
+             * @return The records in the order of the file.
+             */
+            template<typename RecordType, typename ParseFunction>
+            std::vector<RecordType> parseRecords(ParseFunction const& parseRecord) const {
+                std::vector<uint64_t> offsets = getRecordOffsets();
+                std::vector<RecordType> result(offsets.back());
+                forEachChunk(getNumberOfChunks(), [&] (uint64_t chunk) {
+                    char const* buf = storm::utility::cstring::trimWhitespaces(getChunkBegin(chunk));
+                    char const* chunkEnd = getChunkEnd(chunk);
+                    uint64_t index = offsets[chunk];
+                    while (buf < chunkEnd && buf[0] != '\0') {
+                        STORM_LOG_THROW(index < offsets[chunk + 1], storm::exceptions::WrongFormatException, "Found more records than non-empty lines.");
+                        result[index] = parseRecord(buf);
+                        ++index;
+                        buf = storm::utility::cstring::trimWhitespaces(buf);
+                    }
+                    STORM_LOG_THROW(index == offsets[chunk + 1], storm::exceptions::WrongFormatException, "Found fewer records than non-empty lines.");
+                });
+                return result;
+            }
+
+        private:
+            // The beginnings of the chunks followed by the end of the range.
+            std::vector<char const*> chunkBegins;
+        };
+
+    } // namespace parser
+} // namespace storm
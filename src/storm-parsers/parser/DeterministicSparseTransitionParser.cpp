@@ -9,6 +9,7 @@
 
 #include "storm/utility/constants.h"
 #include "storm-parsers/util/cstring.h"
+#include "storm-parsers/parser/ChunkedBuffer.h"
 #include "storm-parsers/parser/MappedFile.h"
 #include "storm/exceptions/FileIoException.h"
 #include "storm/exceptions/WrongFormatException.h"
@@ -45,8 +46,24 @@ namespace storm {
             MappedFile file(filename.c_str());
             char const* buf = file.getData();
 
+            // Skip the format hint if it is there.
+            buf = trimWhitespaces(buf);
+            if (buf[0] < '0' || buf[0] > '9') {
+                buf = forwardToLineEnd(buf);
+                buf = trimWhitespaces(buf);
+            }
+
+            // Parse all transitions. This is done concurrently on chunks of the file.
+            std::vector<Transition> transitions = ChunkedBuffer(buf, file.getDataEnd()).parseRecords<Transition>([] (char const*& position) {
+                Transition transition;
+                transition.row = checked_strtol(position, &position);
+                transition.column = checked_strtol(position, &position);
+                transition.value = checked_strtod(position, &position);
+                return transition;
+            });
+
             // Perform first pass, i.e. count entries that are not zero.
-            DeterministicSparseTransitionParser<ValueType>::FirstPassResult firstPass = DeterministicSparseTransitionParser<ValueType>::firstPass(file.getData(), !isRewardFile);
+            DeterministicSparseTransitionParser<ValueType>::FirstPassResult firstPass = DeterministicSparseTransitionParser<ValueType>::firstPass(transitions, !isRewardFile);
 
             STORM_LOG_TRACE("First pass on " << filename << " shows " << firstPass.numberOfNonzeroEntries << " non-zeros.");
 
@@ -58,13 +75,6 @@ namespace storm {
 
             // Perform second pass.
 
-            // Skip the format hint if it is there.
-            buf = trimWhitespaces(buf);
-            if (buf[0] < '0' || buf[0] > '9') {
-                buf = forwardToLineEnd(buf);
-                buf = trimWhitespaces(buf);
-            }
-
             if (isRewardFile) {
                 // The reward matrix should match the size of the transition matrix.
                 if (firstPass.highestStateIndex + 1 > transitionMatrix.getRowCount() || firstPass.highestStateIndex + 1 > transitionMatrix.getColumnCount()) {
@@ -80,8 +90,7 @@ namespace storm {
             // The actual matrix will be build once all contents are inserted.
             storm::storage::SparseMatrixBuilder<ValueType> resultMatrix(firstPass.highestStateIndex + 1, firstPass.highestStateIndex + 1, firstPass.numberOfNonzeroEntries);
 
-            uint_fast64_t row, col, lastRow = 0;
-            double val;
+            uint_fast64_t lastRow = 0;
             bool dontFixDeadlocks = storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet();
             bool hadDeadlocks = false;
 
@@ -91,20 +100,12 @@ namespace storm {
 
             // Different parsing routines for transition systems and transition rewards.
             if (isRewardFile) {
-                while (buf[0] != '\0') {
-
-                    // Read next transition.
-                    row = checked_strtol(buf, &buf);
-                    col = checked_strtol(buf, &buf);
-                    val = checked_strtod(buf, &buf);
-
-                    resultMatrix.addNextValue(row, col, val);
-                    buf = trimWhitespaces(buf);
+                for (auto const& transition : transitions) {
+                    resultMatrix.addNextValue(transition.row, transition.column, transition.value);
                 }
             } else {
                 // Read first row and add self-loops if necessary.
-                char const* tmp;
-                row = checked_strtol(buf, &tmp);
+                uint_fast64_t row = transitions.front().row;
 
                 if (row > 0) {
                     for (uint_fast64_t skippedRow = 0; skippedRow < row; ++skippedRow) {
@@ -119,12 +120,8 @@ namespace storm {
                     }
                 }
 
-                while (buf[0] != '\0') {
-
-                    // Read next transition.
-                    row = checked_strtol(buf, &buf);
-                    col = checked_strtol(buf, &buf);
-                    val = checked_strtod(buf, &buf);
+                for (auto const& transition : transitions) {
+                    row = transition.row;
 
                     // Test if we moved to a new row.
                     // Handle all incomplete or skipped rows.
@@ -142,8 +139,7 @@ namespace storm {
                         lastRow = row;
                     }
 
-                    resultMatrix.addNextValue(row, col, val);
-                    buf = trimWhitespaces(buf);
+                    resultMatrix.addNextValue(row, transition.column, transition.value);
                 }
 
                 // If we encountered deadlock and did not fix them, now is the time to throw the exception.
@@ -163,41 +159,30 @@ namespace storm {
         }
 
         template<typename ValueType>
-        typename DeterministicSparseTransitionParser<ValueType>::FirstPassResult DeterministicSparseTransitionParser<ValueType>::firstPass(char const* buf, bool reserveDiagonalElements) {
+        typename DeterministicSparseTransitionParser<ValueType>::FirstPassResult DeterministicSparseTransitionParser<ValueType>::firstPass(std::vector<Transition> const& transitions, bool reserveDiagonalElements) {
 
             DeterministicSparseTransitionParser<ValueType>::FirstPassResult result;
-
-            // Skip the format hint if it is there.
-            buf = trimWhitespaces(buf);
-            if (buf[0] < '0' || buf[0] > '9') {
-                buf = forwardToLineEnd(buf);
-                buf = trimWhitespaces(buf);
+            if (transitions.empty()) {
+                return result;
             }
 
             // Check all transitions for non-zero diagonal entries and deadlock states.
             uint_fast64_t row, col, lastRow = 0, lastCol = -1;
 
             // Read first row and reserve space for self-loops if necessary.
-            char const* tmp;
-            row = checked_strtol(buf, &tmp);
+            row = transitions.front().row;
             if (row > 0 && reserveDiagonalElements) {
-                for (uint_fast64_t skippedRow = 0; skippedRow < row; ++skippedRow) {
-                    ++result.numberOfNonzeroEntries;
-                }
+                result.numberOfNonzeroEntries += row;
             }
 
-            while (buf[0] != '\0') {
+            for (auto const& transition : transitions) {
                 // Read the transition.
-                row = checked_strtol(buf, &buf);
-                col = checked_strtol(buf, &buf);
-                // The actual read value is not needed here.
-                checked_strtod(buf, &buf);
+                row = transition.row;
+                col = transition.column;
 
-                if (lastRow != row && reserveDiagonalElements) {
+                if (lastRow != row && reserveDiagonalElements && row > lastRow + 1) {
                     // Compensate for missing rows.
-                    for (uint_fast64_t skippedRow = lastRow + 1; skippedRow < row; ++skippedRow) {
-                        ++result.numberOfNonzeroEntries;
-                    }
+                    result.numberOfNonzeroEntries += row - lastRow - 1;
                 }
                 
                 // Check if a higher state id was found.
@@ -214,14 +199,10 @@ namespace storm {
 
                 lastRow = row;
                 lastCol = col;
-
-                buf = trimWhitespaces(buf);
             }
 
-            if (reserveDiagonalElements) {
-                for (uint_fast64_t skippedRow = (uint_fast64_t) (lastRow + 1); skippedRow <= result.highestStateIndex; ++skippedRow) {
-                    ++result.numberOfNonzeroEntries;
-                }
+            if (reserveDiagonalElements && result.highestStateIndex > lastRow) {
+                result.numberOfNonzeroEntries += result.highestStateIndex - lastRow;
             }
         
             return result;
@@ -9,9 +9,9 @@ namespace storm {
         /*!
          *	This class can be used to parse a file containing either transitions or transition rewards of a deterministic model.
          *
-         *	The file is parsed in two passes.
-         *	The first pass tests the file format and collects statistical data needed for the second pass.
-         *	The second pass then parses the file data and constructs a SparseMatrix representing it.
+         *	The transitions are first read from the file, which is done concurrently on chunks of the file.
+         *	Then, a first pass tests the format and collects statistical data needed for the second pass.
+         *	The second pass then constructs a SparseMatrix representing the transitions.
          */
         template<typename ValueType = double>
         class DeterministicSparseTransitionParser {
@@ -60,16 +60,25 @@ namespace storm {
 
         private:
 
+            /*!
+             * A transition (or transition reward) as it is given in the file.
+             */
+            struct Transition {
+                uint_fast64_t row;
+                uint_fast64_t column;
+                double value;
+            };
+
             /*
-             * Performs the first pass on the input pointed to by the given buffer to obtain the number of
+             * Performs the first pass on the given transitions to obtain the number of
              * transitions and the maximum node id.
              *
-             * @param buffer The buffer that contains the input.
+             * @param transitions The transitions read from the file.
              * @param reserveDiagonalElements A flag indicating whether the diagonal elements should be counted as if they
              * were present to enable fixes later.
              * @return A structure representing the result of the first pass.
              */
-            static FirstPassResult firstPass(char const* buffer, bool reserveDiagonalElements);
+            static FirstPassResult firstPass(std::vector<Transition> const& transitions, bool reserveDiagonalElements);
 
             /*
              * The main parsing routine.
@@ -1,11 +1,18 @@
 #include "storm-parsers/parser/DirectEncodingParser.h"
 
+#include <cstring>
 #include <iostream>
 #include <string>
 #include <regex>
+#include <thread>
+#include <tuple>
+#include <type_traits>
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/predicate.hpp>
 
+#include "storm-parsers/parser/ChunkedBuffer.h"
+#include "storm-parsers/parser/MappedFile.h"
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/exceptions/AbortException.h"
@@ -31,6 +38,89 @@
 namespace storm {
     namespace parser {
 
+        namespace {
+            /*!
+             * Parses the labels of a state, which are separated by whitespace and can optionally be enclosed in quotation marks.
+             */
+            std::vector<std::string> parseLabels(std::string const& line) {
+                std::vector<std::string> labels;
+                // Regex for labels with two cases:
+                // * Enclosed in quotation marks: \"([^\"]+?)\"(?=(\s|$|\"))
+                //   - First part matches string enclosed in quotation marks with no quotation mark inbetween (\"([^\"]+?)\")
+                //   - second part is lookahead which ensures that after the matched part either whitespace, end of line or a new quotation mark follows (?=(\s|$|\"))
+                // * Separated by whitespace: [^\s\"]+?(?=(\s|$))
+                //   - First part matches string without whitespace and quotation marks [^\s\"]+?
+                //   - Second part is again lookahead matching whitespace or end of line (?=(\s|$))
+                static const std::regex labelRegex(R"(\"([^\"]+?)\"(?=(\s|$|\"))|([^\s\"]+?(?=(\s|$))))");
+
+                // Iterate over matches
+                auto match_begin = std::sregex_iterator(line.begin(), line.end(), labelRegex);
+                auto match_end = std::sregex_iterator();
+                for (std::sregex_iterator i = match_begin; i != match_end; ++i) {
+                    std::smatch match = *i;
+                    // Find matched group and add as label
+                    if (match.length(1) > 0) {
+                        labels.push_back(match.str(1));
+                    } else {
+                        labels.push_back(match.str(3));
+                    }
+                }
+                return labels;
+            }
+
+            /*!
+             * Retrieves the beginning of the first line that starts with a state declaration and begins after the given position.
+             */
+            char const* findNextStateDeclaration(char const* position, char const* end) {
+                while (position < end) {
+                    position = static_cast<char const*>(std::memchr(position, '\n', end - position));
+                    if (position == nullptr) {
+                        return end;
+                    }
+                    ++position;
+                    if (end - position >= 6 && std::memcmp(position, "state ", 6) == 0) {
+                        return position;
+                    }
+                }
+                return end;
+            }
+
+            /*!
+             * Counts the lines in the given range that start with a state declaration. The range has to start at the beginning of a line.
+             */
+            uint64_t countStateDeclarations(char const* begin, char const* end) {
+                uint64_t result = 0;
+                if (end - begin >= 6 && std::memcmp(begin, "state ", 6) == 0) {
+                    ++result;
+                }
+                for (char const* position = findNextStateDeclaration(begin, end); position < end; position = findNextStateDeclaration(position, end)) {
+                    ++result;
+                }
+                return result;
+            }
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        struct DirectEncodingParser<ValueType, RewardModelType>::Segment {
+            uint64_t numberOfStates = 0;
+            // For every (local) row, the index of its first entry.
+            std::vector<uint64_t> rowIndications;
+            // For every state, the (local) row at which its row group starts.
+            std::vector<uint64_t> rowGroupIndices;
+            std::vector<storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>> entries;
+            // Pairs of label and (global) state.
+            std::vector<std::pair<std::string, uint64_t>> stateLabels;
+            std::vector<uint64_t> markovianStates;
+            // The number of reward models for which state rewards were declared and the nonzero rewards (reward model, global state, value).
+            uint64_t numberOfStateRewardModels = 0;
+            std::vector<std::tuple<uint64_t, uint64_t, ValueType>> stateRewards;
+            // The number of reward models for which action rewards were declared and the nonzero rewards (reward model, local row, value).
+            uint64_t numberOfActionRewardModels = 0;
+            std::vector<std::tuple<uint64_t, uint64_t, ValueType>> actionRewards;
+            // Pairs of label and (local) row.
+            std::vector<std::pair<std::string, uint64_t>> choiceLabels;
+        };
+
         template<typename ValueType, typename RewardModelType>
         std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseModel(std::string const& filename, DirectEncodingParserOptions const& options) {
 
@@ -119,7 +209,10 @@ namespace storm {
                     STORM_LOG_THROW(!options.buildChoiceLabeling || nrChoices != 0, storm::exceptions::WrongFormatException, "No. of actions (@nr_choices) has to be declared before model.");
                     STORM_LOG_WARN_COND(nrChoices != 0, "No. of actions has to be declared. We may continue now, but future versions might not support this.");
                     // Construct model components
-                    modelComponents = parseStates(file, type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
+                    std::streamoff offset = file.tellg();
+                    MappedFile mappedFile(filename.c_str());
+                    char const* begin = offset < 0 ? mappedFile.getDataEnd() : mappedFile.getData() + offset;
+                    modelComponents = parseStates(begin, mappedFile.getDataEnd(), type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
                     break;
                 } else {
                     STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Could not parse line '" << line << "'.");
@@ -134,22 +227,19 @@ namespace storm {
 
         template<typename ValueType, typename RewardModelType>
         std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>
-        DirectEncodingParser<ValueType, RewardModelType>::parseStates(std::istream& file, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
+        DirectEncodingParser<ValueType, RewardModelType>::parseStates(char const* begin, char const* end, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
                                                                       std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
                                                                       std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options) {
             // Initialize
             auto modelComponents = std::make_shared<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>();
             bool nonDeterministic = (type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp);
             bool continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
-            storm::storage::SparseMatrixBuilder<ValueType> builder = storm::storage::SparseMatrixBuilder<ValueType>(0, 0, 0, false, nonDeterministic, 0);
             modelComponents->stateLabeling = storm::models::sparse::StateLabeling(stateSize);
             modelComponents->observabilityClasses = std::vector<uint32_t>();
             modelComponents->observabilityClasses->resize(stateSize);
             if (options.buildChoiceLabeling) {
                 modelComponents->choiceLabeling = storm::models::sparse::ChoiceLabeling(nrChoices);
             }
-            std::vector<std::vector<ValueType>> stateRewards;
-            std::vector<std::vector<ValueType>> actionRewards;
             if (continuousTime) {
                 modelComponents->exitRates = std::vector<ValueType>(stateSize);
                 if (type == storm::models::ModelType::MarkovAutomaton) {
@@ -161,26 +251,181 @@ namespace storm {
                 modelComponents->rateTransitions = true;
             }
 
+            // Split the file into chunks that start with a state declaration. Sequential parsing uses a single chunk.
+            uint64_t numberOfChunks = 1;
+#ifdef STORM_HAVE_INTELTBB
+            // Rational functions are parsed with the expression parser of the value parser, which can not be used concurrently.
+            if (options.concurrentParsing && !std::is_same<ValueType, storm::RationalFunction>::value) {
+                uint64_t numberOfThreads = std::max(1u, std::thread::hardware_concurrency());
+                numberOfChunks = std::max<uint64_t>(1, std::min<uint64_t>(static_cast<uint64_t>(end - begin) / std::max<uint64_t>(options.minimalChunkSize, 1), 4 * numberOfThreads));
+            }
+#endif
+            std::vector<char const*> chunkBegins(numberOfChunks + 1);
+            chunkBegins.front() = begin;
+            chunkBegins.back() = end;
+            // Each chunk has at least the minimal size, so the position before the split point is still within the range.
+            forEachChunk(numberOfChunks - 1, [&] (uint64_t chunk) {
+                char const* splitPoint = begin + static_cast<uint64_t>(end - begin) * (chunk + 1) / numberOfChunks;
+                chunkBegins[chunk + 1] = findNextStateDeclaration(splitPoint - 1, end);
+            });
+
+            // Count the states of each chunk to obtain the index of the first state of every chunk.
+            std::vector<uint64_t> firstStateOfChunk(numberOfChunks + 1, 0);
+            forEachChunk(numberOfChunks, [&] (uint64_t chunk) {
+                firstStateOfChunk[chunk + 1] = countStateDeclarations(chunkBegins[chunk], chunkBegins[chunk + 1]);
+            });
+            for (uint64_t chunk = 0; chunk < numberOfChunks; ++chunk) {
+                firstStateOfChunk[chunk + 1] += firstStateOfChunk[chunk];
+            }
+            STORM_LOG_THROW(firstStateOfChunk.back() <= stateSize, storm::exceptions::WrongFormatException, "Found " << firstStateOfChunk.back() << " states, but only " << stateSize << " states were declared.");
+            STORM_LOG_TRACE("Parsing states in " << numberOfChunks << " chunks.");
+
+            // Parse the chunks.
+            std::vector<Segment> segments(numberOfChunks);
+            forEachChunk(numberOfChunks, [&] (uint64_t chunk) {
+                parseSegment(chunkBegins[chunk], chunkBegins[chunk + 1], firstStateOfChunk[chunk], type, stateSize, placeholders, valueParser, options, *modelComponents, segments[chunk]);
+                STORM_LOG_ASSERT(segments[chunk].numberOfStates == firstStateOfChunk[chunk + 1] - firstStateOfChunk[chunk], "Unexpected number of states in chunk.");
+            });
+            STORM_LOG_TRACE("Finished parsing");
+
+            // Build transition matrix. The entries are added in the order of the file.
+            uint64_t numberOfRows = 0;
+            uint64_t numberOfEntries = 0;
+            for (auto const& segment : segments) {
+                numberOfRows += segment.rowIndications.size();
+                numberOfEntries += segment.entries.size();
+            }
+            // There is always at least one row.
+            numberOfRows = std::max<uint64_t>(numberOfRows, 1);
+            storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfRows, stateSize, numberOfEntries, false, nonDeterministic, nonDeterministic ? stateSize : 0);
+            std::vector<uint64_t> firstRowOfSegment;
+            firstRowOfSegment.reserve(segments.size());
+            uint64_t rowOffset = 0;
+            for (auto const& segment : segments) {
+                firstRowOfSegment.push_back(rowOffset);
+                auto rowGroupIt = segment.rowGroupIndices.begin();
+                for (uint64_t row = 0; row < segment.rowIndications.size(); ++row) {
+                    if (nonDeterministic && rowGroupIt != segment.rowGroupIndices.end() && *rowGroupIt == row) {
+                        builder.newRowGroup(rowOffset + row);
+                        ++rowGroupIt;
+                    }
+                    uint64_t rowEnd = row + 1 < segment.rowIndications.size() ? segment.rowIndications[row + 1] : segment.entries.size();
+                    for (uint64_t entry = segment.rowIndications[row]; entry < rowEnd; ++entry) {
+                        builder.addNextValue(rowOffset + row, segment.entries[entry].getColumn(), segment.entries[entry].getValue());
+                    }
+                }
+                rowOffset += segment.rowIndications.size();
+            }
+            modelComponents->transitionMatrix = builder.build(numberOfRows, stateSize, nonDeterministic ? stateSize : 0);
+            STORM_LOG_TRACE("Built matrix");
+
+            // Merge the remaining information of the segments.
+            uint64_t numberOfStateRewardModels = 0;
+            uint64_t numberOfActionRewardModels = 0;
+            for (auto const& segment : segments) {
+                numberOfStateRewardModels = std::max(numberOfStateRewardModels, segment.numberOfStateRewardModels);
+                numberOfActionRewardModels = std::max(numberOfActionRewardModels, segment.numberOfActionRewardModels);
+            }
+            std::vector<std::vector<ValueType>> stateRewards(numberOfStateRewardModels);
+            std::vector<std::vector<ValueType>> actionRewards(numberOfActionRewardModels);
+            for (uint64_t segmentIndex = 0; segmentIndex < segments.size(); ++segmentIndex) {
+                Segment& segment = segments[segmentIndex];
+                for (auto const& labelStatePair : segment.stateLabels) {
+                    if (!modelComponents->stateLabeling.containsLabel(labelStatePair.first)) {
+                        modelComponents->stateLabeling.addLabel(labelStatePair.first);
+                    }
+                    modelComponents->stateLabeling.addLabelToState(labelStatePair.first, labelStatePair.second);
+                }
+                for (auto const& state : segment.markovianStates) {
+                    modelComponents->markovianStates.get().set(state);
+                }
+                for (auto& reward : segment.stateRewards) {
+                    std::vector<ValueType>& rewardVector = stateRewards[std::get<0>(reward)];
+                    if (rewardVector.empty()) {
+                        rewardVector.resize(stateSize, storm::utility::zero<ValueType>());
+                    }
+                    rewardVector[std::get<1>(reward)] = std::move(std::get<2>(reward));
+                }
+                for (auto& reward : segment.actionRewards) {
+                    std::vector<ValueType>& rewardVector = actionRewards[std::get<0>(reward)];
+                    if (rewardVector.empty()) {
+                        rewardVector.resize(numberOfRows, storm::utility::zero<ValueType>());
+                    }
+                    rewardVector[firstRowOfSegment[segmentIndex] + std::get<1>(reward)] = std::move(std::get<2>(reward));
+                }
+                for (auto const& labelRowPair : segment.choiceLabels) {
+                    if (!modelComponents->choiceLabeling.get().containsLabel(labelRowPair.first)) {
+                        modelComponents->choiceLabeling.get().addLabel(labelRowPair.first);
+                    }
+                    modelComponents->choiceLabeling.get().addLabelToChoice(labelRowPair.first, firstRowOfSegment[segmentIndex] + labelRowPair.second);
+                }
+                // Free the memory of the segment early.
+                segment = Segment();
+            }
+
+            // Build reward models
+            uint64_t numRewardModels = std::max(numberOfStateRewardModels, numberOfActionRewardModels);
+            for (uint64_t i = 0; i < numRewardModels; ++i) {
+                std::string rewardModelName;
+                if (rewardModelNames.size() <= i) {
+                    rewardModelName = "rew" + std::to_string(i);
+                } else {
+                    rewardModelName = rewardModelNames[i];
+                }
+                boost::optional<std::vector<ValueType>> stateRewardVector, actionRewardVector;
+                if (i < stateRewards.size() && !stateRewards[i].empty()) {
+                    stateRewardVector = std::move(stateRewards[i]);
+                }
+                if (i < actionRewards.size() && !actionRewards[i].empty()) {
+                    actionRewardVector = std::move(actionRewards[i]);
+                }
+                modelComponents->rewardModels.emplace(rewardModelName,
+                                                      storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewardVector), std::move(actionRewardVector)));
+            }
+            STORM_LOG_TRACE("Built reward models");
+            return modelComponents;
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void DirectEncodingParser<ValueType, RewardModelType>::parseSegment(char const* begin, char const* end, uint64_t firstState, storm::models::ModelType type, size_t stateSize,
+                                                                            std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+                                                                            DirectEncodingParserOptions const& options, storm::storage::sparse::ModelComponents<ValueType, RewardModelType>& modelComponents,
+                                                                            Segment& segment) {
+            bool continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
+
             // Iterate over all lines
             std::string line;
-            size_t row = 0;
-            size_t state = 0;
-            bool firstState = true;
+            size_t state = firstState;
+            bool firstStateOfSegment = true;
             bool firstActionForState = true;
-            while (storm::utility::getline(file, line)) {
+            char const* position = begin;
+            while (position < end) {
+                char const* lineEnd = static_cast<char const*>(std::memchr(position, '\n', end - position));
+                if (lineEnd == nullptr) {
+                    lineEnd = end;
+                }
+                line.assign(position, lineEnd);
+                position = lineEnd == end ? end : lineEnd + 1;
+                // Remove linebreaks
+                while (!line.empty() && line.back() == '\r') {
+                    line.pop_back();
+                }
+
                 if (boost::starts_with(line, "//")) {
                     continue;
                 }
                 STORM_LOG_TRACE("Parsing: " << line);
                 if (boost::starts_with(line, "state ")) {
                     // New state
-                    if (firstState) {
-                        firstState = false;
+                    if (firstStateOfSegment) {
+                        firstStateOfSegment = false;
                     } else {
                         ++state;
-                        ++row;
                     }
                     firstActionForState = true;
+                    segment.rowGroupIndices.push_back(segment.rowIndications.size());
+                    segment.rowIndications.push_back(segment.entries.size());
+                    ++segment.numberOfStates;
                     STORM_LOG_TRACE("New state " << state);
 
                     // Parse state id
@@ -195,10 +440,6 @@ namespace storm {
                     }
                     size_t parsedId = parseNumber<size_t>(curString);
                     STORM_LOG_ASSERT(state == parsedId, "State ids do not correspond.");
-                    if (nonDeterministic) {
-                        STORM_LOG_TRACE("new Row Group starts at " << row << ".");
-                        builder.newRowGroup(row);
-                    }
 
                     if (continuousTime) {
                         // Parse exit rate for CTMC or MA
@@ -214,10 +455,11 @@ namespace storm {
                         }
                         ValueType exitRate = parseValue(curString, placeholders, valueParser);
                         if (type == storm::models::ModelType::MarkovAutomaton && !storm::utility::isZero<ValueType>(exitRate)) {
-                            modelComponents->markovianStates.get().set(state);
+                            segment.markovianStates.push_back(state);
                         }
                         STORM_LOG_TRACE("Exit rate " << exitRate);
-                        modelComponents->exitRates.get()[state] = exitRate;
+                        // Distinct chunks write distinct entries.
+                        modelComponents.exitRates.get()[state] = exitRate;
                     }
 
                     if (boost::starts_with(line, "[")) {
@@ -228,30 +470,22 @@ namespace storm {
                         STORM_LOG_TRACE("State rewards: " << rewardsStr);
                         std::vector<std::string> rewards;
                         boost::split(rewards, rewardsStr, boost::is_any_of(","));
-                        if (stateRewards.size() < rewards.size()) {
-                            stateRewards.resize(rewards.size());
-                        }
-                        auto stateRewardsIt = stateRewards.begin();
-                        for (auto const& rew : rewards) {
-                            auto rewardValue = parseValue(rew, placeholders, valueParser);
+                        segment.numberOfStateRewardModels = std::max<uint64_t>(segment.numberOfStateRewardModels, rewards.size());
+                        for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewards.size(); ++rewardModelIndex) {
+                            auto rewardValue = parseValue(rewards[rewardModelIndex], placeholders, valueParser);
                             if (!storm::utility::isZero(rewardValue)) {
-                                if (stateRewardsIt->empty()) {
-                                    stateRewardsIt->resize(stateSize, storm::utility::zero<ValueType>());
-                                }
-                                (*stateRewardsIt)[state] = std::move(rewardValue);
+                                segment.stateRewards.emplace_back(rewardModelIndex, state, std::move(rewardValue));
                             }
-                            ++stateRewardsIt;
                         }
                         line = line.substr(posEndReward + 1);
                     }
 
-
                     if (type == storm::models::ModelType::Pomdp) {
                         if (boost::starts_with(line, "{")) {
                             size_t posEndObservation = line.find("}");
                             std::string observation = line.substr(1, posEndObservation - 1);
                             STORM_LOG_TRACE("State observation " << observation);
-                            modelComponents->observabilityClasses.get()[state] = std::stoi(observation);
+                            modelComponents.observabilityClasses.get()[state] = std::stoi(observation);
                             line = line.substr(posEndObservation + 1);
                         } else {
                             STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Expected an observation for state " << state << ".");
@@ -260,47 +494,21 @@ namespace storm {
 
                     // Parse labels
                     if (!line.empty()) {
-                        std::vector<std::string> labels;
-                        // Labels are separated by whitespace and can optionally be enclosed in quotation marks
-                        // Regex for labels with two cases:
-                        // * Enclosed in quotation marks: \"([^\"]+?)\"(?=(\s|$|\"))
-                        //   - First part matches string enclosed in quotation marks with no quotation mark inbetween (\"([^\"]+?)\")
-                        //   - second part is lookahead which ensures that after the matched part either whitespace, end of line or a new quotation mark follows (?=(\s|$|\"))
-                        // * Separated by whitespace: [^\s\"]+?(?=(\s|$))
-                        //   - First part matches string without whitespace and quotation marks [^\s\"]+?
-                        //   - Second part is again lookahead matching whitespace or end of line (?=(\s|$))
-                        std::regex labelRegex(R"(\"([^\"]+?)\"(?=(\s|$|\"))|([^\s\"]+?(?=(\s|$))))");
-
-                        // Iterate over matches
-                        auto match_begin = std::sregex_iterator(line.begin(), line.end(), labelRegex);
-                        auto match_end = std::sregex_iterator();
-                        for (std::sregex_iterator i = match_begin; i != match_end; ++i) {
-                            std::smatch match = *i;
-                            // Find matched group and add as label
-                            if (match.length(1) > 0) {
-                                labels.push_back(match.str(1));
-                            } else {
-                                labels.push_back(match.str(3));
-                            }
-                        }
-
-                        for (std::string const& label : labels) {
-                            if (!modelComponents->stateLabeling.containsLabel(label)) {
-                                modelComponents->stateLabeling.addLabel(label);
-                            }
-                            modelComponents->stateLabeling.addLabelToState(label, state);
+                        for (std::string& label : parseLabels(line)) {
                             STORM_LOG_TRACE("New label: '" << label << "'");
+                            segment.stateLabels.emplace_back(std::move(label), state);
                         }
                     }
 
                 } else if (boost::starts_with(line, "\taction ")) {
                     // New action
+                    STORM_LOG_THROW(!segment.rowIndications.empty(), storm::exceptions::WrongFormatException, "Action declared before the first state.");
                     if (firstActionForState) {
                         firstActionForState = false;
                     } else {
-                        ++row;
+                        segment.rowIndications.push_back(segment.entries.size());
                     }
-                    STORM_LOG_TRACE("New action: " << row);
+                    uint64_t row = segment.rowIndications.size() - 1;
                     line = line.substr(8); //Remove "\taction "
                     std::string curString = line;
                     size_t posEnd = line.find(" ");
@@ -314,10 +522,7 @@ namespace storm {
                     // curString contains action name.
                     if (options.buildChoiceLabeling) {
                         if (curString != "__NOLABEL__") {
-                            if (!modelComponents->choiceLabeling.get().containsLabel(curString)) {
-                                modelComponents->choiceLabeling.get().addLabel(curString);
-                            }
-                            modelComponents->choiceLabeling.get().addLabelToChoice(curString, row);
+                            segment.choiceLabels.emplace_back(curString, row);
                         }
                     }
                     // Check for rewards
@@ -329,19 +534,12 @@ namespace storm {
                         STORM_LOG_TRACE("Action rewards: " << rewardsStr);
                         std::vector<std::string> rewards;
                         boost::split(rewards, rewardsStr, boost::is_any_of(","));
-                        if (actionRewards.size() < rewards.size()) {
-                            actionRewards.resize(rewards.size());
-                        }
-                        auto actionRewardsIt = actionRewards.begin();
-                        for (auto const& rew : rewards) {
-                            auto rewardValue = parseValue(rew, placeholders, valueParser);
+                        segment.numberOfActionRewardModels = std::max<uint64_t>(segment.numberOfActionRewardModels, rewards.size());
+                        for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewards.size(); ++rewardModelIndex) {
+                            auto rewardValue = parseValue(rewards[rewardModelIndex], placeholders, valueParser);
                             if (!storm::utility::isZero(rewardValue)) {
-                                if (actionRewardsIt->size() <= row) {
-                                    actionRewardsIt->resize(std::max(row + 1, stateSize), storm::utility::zero<ValueType>());
-                                }
-                                (*actionRewardsIt)[row] = std::move(rewardValue);
+                                segment.actionRewards.emplace_back(rewardModelIndex, row, std::move(rewardValue));
                             }
-                            ++actionRewardsIt;
                         }
                         line = line.substr(posEndReward + 1);
                     }
@@ -350,49 +548,17 @@ namespace storm {
                     // New transition
                     size_t posColon = line.find(':');
                     STORM_LOG_THROW(posColon != std::string::npos, storm::exceptions::WrongFormatException, "':' not found in '" << line << "'.");
+                    STORM_LOG_THROW(!segment.rowIndications.empty(), storm::exceptions::WrongFormatException, "Transition declared before the first state.");
                     size_t target = parseNumber<size_t>(line.substr(2, posColon - 3));
                     std::string valueStr = line.substr(posColon + 2);
                     ValueType value = parseValue(valueStr, placeholders, valueParser);
-                    STORM_LOG_TRACE("Transition " << row << " -> " << target << ": " << value);
+                    STORM_LOG_TRACE("Transition " << segment.rowIndications.size() - 1 << " -> " << target << ": " << value);
                     STORM_LOG_THROW(target < stateSize, storm::exceptions::WrongFormatException, "Target state " << target << " is greater than state size " << stateSize);
-                    builder.addNextValue(row, target, value);
+                    segment.entries.emplace_back(target, std::move(value));
                 }
 
-                if (storm::utility::resources::isTerminate()) {
-                    std::cout << "Parsed " << state << "/" << stateSize << " states before abort." << std::endl;
-                    STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
-                    break;
-                }
-
-            } // end state iteration
-            STORM_LOG_TRACE("Finished parsing");
-
-            // Build transition matrix
-            modelComponents->transitionMatrix = builder.build(row + 1, stateSize, nonDeterministic ? stateSize : 0);
-            STORM_LOG_TRACE("Built matrix");
-
-            // Build reward models
-            uint64_t numRewardModels = std::max(stateRewards.size(), actionRewards.size());
-            for (uint64_t i = 0; i < numRewardModels; ++i) {
-                std::string rewardModelName;
-                if (rewardModelNames.size() <= i) {
-                    rewardModelName = "rew" + std::to_string(i);
-                } else {
-                    rewardModelName = rewardModelNames[i];
-                }
-                boost::optional<std::vector<ValueType>> stateRewardVector, actionRewardVector;
-                if (i < stateRewards.size() && !stateRewards[i].empty()) {
-                    stateRewardVector = std::move(stateRewards[i]);
-                }
-                if (i < actionRewards.size() && !actionRewards[i].empty()) {
-                    actionRewards[i].resize(row + 1, storm::utility::zero<ValueType>());
-                    actionRewardVector = std::move(actionRewards[i]);
-                }
-                modelComponents->rewardModels.emplace(rewardModelName,
-                                                      storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewardVector), std::move(actionRewardVector)));
+                STORM_LOG_THROW(!storm::utility::resources::isTerminate(), storm::exceptions::AbortException, "Aborted in state space exploration.");
             }
-            STORM_LOG_TRACE("Built reward models");
-            return modelComponents;
         }
 
         template<typename ValueType, typename RewardModelType>
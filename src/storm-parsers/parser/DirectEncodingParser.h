@@ -11,6 +11,11 @@ namespace storm {
 
         struct DirectEncodingParserOptions {
             bool buildChoiceLabeling = false;
+            // If set, the states are parsed in chunks concurrently (if TBB is available). Otherwise, they are parsed as a single chunk.
+            // The resulting model is the same in both cases.
+            bool concurrentParsing = true;
+            // The minimal size (in bytes) of the chunks that are parsed concurrently.
+            uint64_t minimalChunkSize = 1ull << 20;
         };
         /*!
          *	Parser for models in the DRN format with explicit encoding.
@@ -31,9 +36,12 @@ namespace storm {
         private:
 
             /*!
-             * Parse states and return transition matrix.
+             * Parse states from the given (memory-mapped) character range and return the model components. For concurrent
+             * parsing, the range is split into chunks at state boundaries which are parsed concurrently and merged afterwards.
+             * Otherwise, the whole range is parsed as a single chunk.
              *
-             * @param file Input file stream.
+             * @param begin Start of the states in the file.
+             * @param end End of the file.
              * @param type Model type.
              * @param stateSize No. of states
              * @param placeholders Placeholders for values.
@@ -43,9 +51,24 @@ namespace storm {
              * @return Transition matrix.
              */
             static std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>
-            parseStates(std::istream& file, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::unordered_map<std::string, ValueType> const& placeholders,
+            parseStates(char const* begin, char const* end, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::unordered_map<std::string, ValueType> const& placeholders,
                         ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
 
+            // The part of the model that is parsed from one chunk of the file.
+            struct Segment;
+
+            /*!
+             * Parses the states in the given chunk. Everything that only depends on the state index is directly written
+             * to the model components, the remaining information is stored in the segment.
+             *
+             * @param begin Start of the chunk. This has to be the beginning of a line.
+             * @param end End of the chunk.
+             * @param firstState Index of the first state of the chunk.
+             */
+            static void parseSegment(char const* begin, char const* end, uint64_t firstState, storm::models::ModelType type, size_t stateSize, std::unordered_map<std::string, ValueType> const& placeholders,
+                                     ValueParser<ValueType> const& valueParser, DirectEncodingParserOptions const& options,
+                                     storm::storage::sparse::ModelComponents<ValueType, RewardModelType>& modelComponents, Segment& segment);
+
             /*!
              * Parse value from string while using placeholders.
              * @param valueStr String.
@@ -2,6 +2,7 @@
 
 #include <string>
 
+#include "storm-parsers/parser/ChunkedBuffer.h"
 #include "storm-parsers/parser/MappedFile.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/BuildSettings.h"
@@ -43,8 +44,29 @@ namespace storm {
             MappedFile file(filename.c_str());
             char const* buf = file.getData();
 
+            // Skip the format hint if it is there.
+            buf = trimWhitespaces(buf);
+            if (buf[0] < '0' || buf[0] > '9') {
+                buf = forwardToLineEnd(buf);
+                buf = trimWhitespaces(buf);
+            }
+
+            // Parse all transitions. This is done concurrently on chunks of the file.
+            std::vector<Transition> transitions = ChunkedBuffer(buf, file.getDataEnd()).parseRecords<Transition>([] (char const*& position) {
+                Transition transition;
+                transition.source = checked_strtol(position, &position);
+                transition.choice = checked_strtol(position, &position);
+                transition.target = checked_strtol(position, &position);
+                transition.value = checked_strtod(position, &position);
+
+                // The PRISM output format lists the name of the transition in the fourth column,
+                // but omits the fourth column if it is an internal action. In either case we can skip to the end of the line.
+                position = forwardToLineEnd(position);
+                return transition;
+            });
+
             // Perform first pass, i.e. obtain number of columns, rows and non-zero elements.
-            NondeterministicSparseTransitionParser::FirstPassResult firstPass = NondeterministicSparseTransitionParser::firstPass(file.getData(), isRewardFile, modelInformation);
+            NondeterministicSparseTransitionParser::FirstPassResult firstPass = NondeterministicSparseTransitionParser::firstPass(transitions, isRewardFile, modelInformation);
 
             // If first pass returned zero, the file format was wrong.
             if (firstPass.numberOfNonzeroEntries == 0) {
@@ -54,13 +76,6 @@ namespace storm {
 
             // Perform second pass.
 
-            // Skip the format hint if it is there.
-            buf = trimWhitespaces(buf);
-            if (buf[0] < '0' || buf[0] > '9') {
-                buf = forwardToLineEnd(buf);
-                buf = trimWhitespaces(buf);
-            }
-
             if (isRewardFile) {
                 // The reward matrix should match the size of the transition matrix.
                 if (firstPass.choices > modelInformation.getRowCount() || (uint_fast64_t) (firstPass.highestStateIndex + 1) > modelInformation.getColumnCount()) {
@@ -89,20 +104,17 @@ namespace storm {
             }
 
             // Initialize variables for the parsing run.
-            uint_fast64_t source = 0, target = 0, lastSource = 0, choice = 0, lastChoice = 0, curRow = 0;
-            double val = 0.0;
+            uint_fast64_t source = 0, lastSource = 0, choice = 0, lastChoice = 0, curRow = 0;
             bool dontFixDeadlocks = storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet();
             bool hadDeadlocks = false;
 
             // The first state already starts a new row group of the matrix.
             matrixBuilder.newRowGroup(0);
 
-            // Read all transitions from file.
-            while (buf[0] != '\0') {
-
-                // Read source state and choice.
-                source = checked_strtol(buf, &buf);
-                choice = checked_strtol(buf, &buf);
+            // Insert all transitions into the matrix.
+            for (auto const& transition : transitions) {
+                source = transition.source;
+                choice = transition.choice;
 
                 if (isRewardFile) {
                     // If we have switched the source state, we possibly need to insert the rows of the last
@@ -157,18 +169,11 @@ namespace storm {
                     }
                 }
 
-                // Read target and value and write it to the matrix.
-                target = checked_strtol(buf, &buf);
-                val = checked_strtod(buf, &buf);
-                matrixBuilder.addNextValue(curRow, target, val);
+                // Write target and value to the matrix.
+                matrixBuilder.addNextValue(curRow, transition.target, transition.value);
 
                 lastSource = source;
                 lastChoice = choice;
-
-                // Proceed to beginning of next line in file and next row in matrix.
-                buf = forwardToLineEnd(buf);
-
-                buf = trimWhitespaces(buf);
             }
 
             if (dontFixDeadlocks && hadDeadlocks && !isRewardFile) throw storm::exceptions::WrongFormatException() << "Some of the states do not have outgoing transitions.";
@@ -194,17 +199,8 @@ namespace storm {
 
         template<typename ValueType>
         template<typename MatrixValueType>
-        typename NondeterministicSparseTransitionParser<ValueType>::FirstPassResult NondeterministicSparseTransitionParser<ValueType>::firstPass(char const* buf, bool isRewardFile, storm::storage::SparseMatrix<MatrixValueType> const& modelInformation) {
-            // Check file header and extract number of transitions.
-
-            // Skip the format hint if it is there.
-            buf = trimWhitespaces(buf);
-            if (buf[0] < '0' || buf[0] > '9') {
-                buf = forwardToLineEnd(buf);
-                buf = trimWhitespaces(buf);
-            }
-
-            // Read all transitions.
+        typename NondeterministicSparseTransitionParser<ValueType>::FirstPassResult NondeterministicSparseTransitionParser<ValueType>::firstPass(std::vector<Transition> const& transitions, bool isRewardFile, storm::storage::SparseMatrix<MatrixValueType> const& modelInformation) {
+            // Check all transitions.
             uint_fast64_t source = 0, target = 0, choice = 0, lastChoice = 0, lastSource = 0, lastTarget = -1;
             double val = 0.0;
             typename NondeterministicSparseTransitionParser<ValueType>::FirstPassResult result;
@@ -212,13 +208,9 @@ namespace storm {
             // Since the first line is already a new choice but is not covered below, that has to be covered here.
             result.choices = 1;
 
-            while (buf[0] != '\0') {
-
-                // Read source state and choice.
-                source = checked_strtol(buf, &buf);
-
-                // Read the name of the nondeterministic choice.
-                choice = checked_strtol(buf, &buf);
+            for (auto const& transition : transitions) {
+                source = transition.source;
+                choice = transition.choice;
 
                 if (source < lastSource) {
                     STORM_LOG_ERROR("The current source state " << source << " is smaller than the last one " << lastSource << ".");
@@ -274,8 +266,8 @@ namespace storm {
                     }
                 }
 
-                // Read target and check if we encountered a state index that is bigger than all previously seen.
-                target = checked_strtol(buf, &buf);
+                // Check if we encountered a target state index that is bigger than all previously seen.
+                target = transition.target;
 
                 if (target > result.highestStateIndex) {
                     result.highestStateIndex = target;
@@ -287,14 +279,14 @@ namespace storm {
                     throw storm::exceptions::InvalidArgumentException() << "The same transition (" << source << ", " << choice << ", " << target << ") is given twice.";
                 }
 
-                // Read value and check whether it's positive.
-                val = checked_strtod(buf, &buf);
+                // Check whether the value is positive.
+                val = transition.value;
                 if (!isRewardFile && (val < 0.0 || val > 1.0)) {
-                    STORM_LOG_ERROR("Expected a positive probability but got \"" << std::string(buf, 0, 16) << "\".");
+                    STORM_LOG_ERROR("Expected a positive probability but got \"" << val << "\".");
                     NondeterministicSparseTransitionParser::FirstPassResult nullResult;
                     return nullResult;
                 } else if (val < 0.0) {
-                    STORM_LOG_ERROR("Expected a positive reward value but got \"" << std::string(buf, 0, 16) << "\".");
+                    STORM_LOG_ERROR("Expected a positive reward value but got \"" << val << "\".");
                     NondeterministicSparseTransitionParser::FirstPassResult nullResult;
                     return nullResult;
                 }
@@ -305,12 +297,6 @@ namespace storm {
 
                 // Increase number of non-zero values.
                 result.numberOfNonzeroEntries++;
-
-                // The PRISM output format lists the name of the transition in the fourth column,
-                // but omits the fourth column if it is an internal action. In either case we can skip to the end of the line.
-                buf = forwardToLineEnd(buf);
-
-                buf = trimWhitespaces(buf);
             }
 
             if (isRewardFile) {
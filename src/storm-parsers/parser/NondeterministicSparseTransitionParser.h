@@ -11,9 +11,9 @@ namespace storm {
         /*!
          * A class providing the functionality to parse the transitions of a nondeterministic model.
          *
-         * The file is parsed in two passes.
-         * The first pass tests the file format and collects statistical data needed for the second pass.
-         * The second pass then collects the actual file data and compiles it into a Result.
+         * The transitions are first read from the file, which is done concurrently on chunks of the file.
+         * Then, a first pass tests the format and collects statistical data needed for the second pass.
+         * The second pass then compiles the transitions into a Result.
          */
         template<typename ValueType = double>
         class NondeterministicSparseTransitionParser {
@@ -63,7 +63,17 @@ namespace storm {
         private:
 
             /*!
-             * This method does the first pass through the buffer containing the content of some transition file.
+             * A transition (or transition reward) as it is given in the file.
+             */
+            struct Transition {
+                uint_fast64_t source;
+                uint_fast64_t choice;
+                uint_fast64_t target;
+                double value;
+            };
+
+            /*!
+             * This method does the first pass through the transitions read from some transition file.
              *
              * It computes the overall number of nondeterministic choices, i.e. the
              * number of rows in the matrix that should be created.
@@ -71,12 +81,12 @@ namespace storm {
              * of elements the matrix has to hold, and the maximum node id, i.e. the
              * number of columns of the matrix.
              *
-             * @param buffer Buffer containing the data to scan. This is expected to be some char array.
+             * @param transitions The transitions read from the file.
              * @param insertDiagonalEntriesIfMissing A flag set iff entries on the primary diagonal of the matrix should be added in case they are missing in the parsed file.
              * @return A structure representing the result of the first pass.
              */
             template<typename MatrixValueType>
-            static FirstPassResult firstPass(char const* buffer, bool isRewardFile, storm::storage::SparseMatrix<MatrixValueType> const& modelInformation);
+            static FirstPassResult firstPass(std::vector<Transition> const& transitions, bool isRewardFile, storm::storage::SparseMatrix<MatrixValueType> const& modelInformation);
 
             /*!
              * The main parsing routine.
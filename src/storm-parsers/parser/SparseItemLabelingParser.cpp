@@ -3,13 +3,16 @@
 #include <cstring>
 #include <string>
 #include <iostream>
+#include <unordered_map>
 
 #include "storm-parsers/util/cstring.h"
+#include "storm-parsers/parser/ChunkedBuffer.h"
 #include "storm-parsers/parser/MappedFile.h"
 
 #include "storm/utility/macros.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/OutOfRangeException.h"
 
 namespace storm {
 	namespace parser {
@@ -30,7 +33,7 @@ namespace storm {
 			parseLabelNames(filename, labeling, buf);
 			
 			// Now parse the assignments of labels to states.
-			parseDeterministicLabelAssignments(filename, labeling, buf);
+			parseDeterministicLabelAssignments(filename, labeling, buf, file.getDataEnd());
 
 			return labeling;
 		}
@@ -52,7 +55,7 @@ namespace storm {
 			if (nondeterministicChoiceIndices) {
 				parseNonDeterministicLabelAssignments(filename, labeling, nondeterministicChoiceIndices.get(), buf);
 			} else {
-				parseDeterministicLabelAssignments(filename, labeling, buf);
+				parseDeterministicLabelAssignments(filename, labeling, buf, file.getDataEnd());
 			}
 
 			return labeling;
@@ -141,56 +144,65 @@ namespace storm {
 			buf = trimWhitespaces(buf);
 		}
 
-		void SparseItemLabelingParser::parseDeterministicLabelAssignments(std::string const & filename, storm::models::sparse::ItemLabeling& labeling, char const*& buf) {
-			uint_fast64_t state = 0;
-			uint_fast64_t lastState = (uint_fast64_t)-1;
-			uint_fast64_t const startIndexComparison = lastState;
-			size_t cnt = 0;
-			char proposition[128];
-
-			while (buf[0] != '\0') {
+		void SparseItemLabelingParser::parseDeterministicLabelAssignments(std::string const & filename, storm::models::sparse::ItemLabeling& labeling, char const* buf, char const* end) {
+			// Assign indices to the labels.
+			std::vector<std::string> labelNames;
+			std::unordered_map<std::string, uint_fast64_t> labelIndices;
+			for (auto const& label : labeling.getLabels()) {
+				labelIndices.emplace(label, labelNames.size());
+				labelNames.push_back(label);
+			}
 
-				// Parse the state number and iterate over its labels (atomic propositions).
+			// Parse the assignments of labels to items. This is done concurrently on chunks of the file.
+			struct LabelAssignment {
+				uint_fast64_t item;
+				std::vector<uint_fast64_t> labels;
+			};
+			std::vector<LabelAssignment> assignments = ChunkedBuffer(buf, end).parseRecords<LabelAssignment>([&] (char const*& position) {
+				// Parse the item number and iterate over its labels (atomic propositions).
 				// Stop at the end of the line.
-				state = checked_strtol(buf, &buf);
-
-				// If the state has already been read or skipped once there might be a problem with the file (doubled lines, or blocks).
-				if (state <= lastState && lastState != startIndexComparison) {
-					STORM_LOG_ERROR("Error while parsing " << filename << ": State " << state << " was found but has already been read or skipped previously.");
-					throw storm::exceptions::WrongFormatException() << "Error while parsing " << filename << ": State " << state << " was found but has already been read or skipped previously.";
-				}
-
-				while ((buf[0] != '\r') && (buf[0] != '\n') && (buf[0] != '\0')) {
-					cnt = skipWord(buf) - buf;
+				LabelAssignment assignment;
+				assignment.item = checked_strtol(position, &position);
+				while ((position[0] != '\r') && (position[0] != '\n') && (position[0] != '\0')) {
+					size_t cnt = skipWord(position) - position;
 					if (cnt == 0) {
-
-						// The next character is a separator.
-						// If it is a line separator, we continue with next node.
-						// Otherwise, we skip it and try again.
-						if (buf[0] == '\n' || buf[0] == '\r') break;
-						buf++;
+						// The next character is a separator (but not a line separator), so we skip it and try again.
+						position++;
 					} else {
-
-						// Copy the label to the buffer, null terminate it and add it to labeling.
-						strncpy(proposition, buf, cnt);
-						proposition[cnt] = '\0';
-
 						// Has the label been declared in the header?
-						if(!labeling.containsLabel(proposition)) {
-							STORM_LOG_ERROR("Error while parsing " << filename << ": Atomic proposition" << proposition << " was found but not declared.");
-							throw storm::exceptions::WrongFormatException() << "Error while parsing " << filename << ": Atomic proposition" << proposition << " was found but not declared.";
-						}
-                        if (labeling.isStateLabeling()) {
-						    labeling.asStateLabeling().addLabelToState(proposition, state);
-                        } else {
-                            STORM_LOG_ASSERT(labeling.isChoiceLabeling(), "Unexpected labeling type");
-                            labeling.asChoiceLabeling().addLabelToChoice(proposition, state);
-                        }
-						buf += cnt;
+						std::string proposition(position, cnt);
+						auto labelIt = labelIndices.find(proposition);
+						STORM_LOG_THROW(labelIt != labelIndices.end(), storm::exceptions::WrongFormatException, "Error while parsing " << filename << ": Atomic proposition" << proposition << " was found but not declared.");
+						assignment.labels.push_back(labelIt->second);
+						position += cnt;
 					}
 				}
-				buf = trimWhitespaces(buf);
-				lastState = state;
+				return assignment;
+			});
+
+			// Now add the assignments to the labeling.
+			std::vector<storm::storage::BitVector> labelings(labelNames.size(), storm::storage::BitVector(labeling.getNumberOfItems()));
+			uint_fast64_t lastItem = (uint_fast64_t)-1;
+			uint_fast64_t const startIndexComparison = lastItem;
+			for (auto const& assignment : assignments) {
+				// If the item has already been read or skipped once there might be a problem with the file (doubled lines, or blocks).
+				if (assignment.item <= lastItem && lastItem != startIndexComparison) {
+					STORM_LOG_ERROR("Error while parsing " << filename << ": State " << assignment.item << " was found but has already been read or skipped previously.");
+					throw storm::exceptions::WrongFormatException() << "Error while parsing " << filename << ": State " << assignment.item << " was found but has already been read or skipped previously.";
+				}
+				for (auto const& label : assignment.labels) {
+					STORM_LOG_THROW(assignment.item < labeling.getNumberOfItems(), storm::exceptions::OutOfRangeException, "Item index out of range.");
+					labelings[label].set(assignment.item, true);
+				}
+				lastItem = assignment.item;
+			}
+			for (uint_fast64_t label = 0; label < labelNames.size(); ++label) {
+				if (labeling.isStateLabeling()) {
+					labeling.asStateLabeling().setStates(labelNames[label], std::move(labelings[label]));
+				} else {
+					STORM_LOG_ASSERT(labeling.isChoiceLabeling(), "Unexpected labeling type");
+					labeling.asChoiceLabeling().setChoices(labelNames[label], std::move(labelings[label]));
+				}
 			}
 		}
 
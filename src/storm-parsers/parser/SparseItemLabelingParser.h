@@ -59,11 +59,13 @@ namespace storm {
 			/*!
 			 * Parses the label assignments assuming that each item is uniquely specified by a single index, e.g.,
 			 *  * 42 label1 label2 label3
+			 * The lines are parsed concurrently on chunks of the file.
 			 *
 			 * @param labeling the labeling to which file assignments are added
-			 * @param buf the reference to the file contents
+			 * @param buf the beginning of the assignments in the file contents
+			 * @param end the end of the file contents
 			 */
-			static void parseDeterministicLabelAssignments(std::string const & filename, storm::models::sparse::ItemLabeling& labeling, char const*& buf);
+			static void parseDeterministicLabelAssignments(std::string const & filename, storm::models::sparse::ItemLabeling& labeling, char const* buf, char const* end);
 			
 			/*!
 			 * Parses the label assignments assuming that each item is specified by a tuple of indices, e.g.,
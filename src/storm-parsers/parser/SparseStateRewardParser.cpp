@@ -5,6 +5,7 @@
 #include "storm/exceptions/OutOfRangeException.h"
 #include "storm/exceptions/FileIoException.h"
 #include "storm-parsers/util/cstring.h"
+#include "storm-parsers/parser/ChunkedBuffer.h"
 #include "storm-parsers/parser/MappedFile.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -18,22 +19,24 @@ namespace storm {
         std::vector<ValueType> SparseStateRewardParser<ValueType>::parseSparseStateReward(uint_fast64_t stateCount, std::string const& filename) {
             // Open file.
             MappedFile file(filename.c_str());
-            char const* buf = file.getData();
+
+            // Parse all state reward assignments. This is done concurrently on chunks of the file.
+            std::vector<std::pair<uint_fast64_t, double>> assignments = ChunkedBuffer(file.getData(), file.getDataEnd()).parseRecords<std::pair<uint_fast64_t, double>>([] (char const*& position) {
+                uint_fast64_t state = checked_strtol(position, &position);
+                double reward = checked_strtod(position, &position);
+                return std::make_pair(state, reward);
+            });
 
             // Create state reward vector with given state count.
             std::vector<ValueType> stateRewards(stateCount);
 
-            // Now parse state reward assignments.
-            uint_fast64_t state = 0;
+            // Now check the state reward assignments.
             uint_fast64_t lastState = (uint_fast64_t) - 1;
             uint_fast64_t const startIndexComparison = lastState;
-            double reward;
 
             // Iterate over states.
-            while (buf[0] != '\0') {
-
-                // Parse state.
-                state = checked_strtol(buf, &buf);
+            for (auto const& assignment : assignments) {
+                uint_fast64_t state = assignment.first;
 
                 // If the state has already been read or skipped once there might be a problem with the file (doubled lines, or blocks).
                 // Note: The value -1 shows that lastState has not yet been set, i.e. this is the first run of the loop (state index (2^64)-1 is a really bad starting index).
@@ -47,17 +50,13 @@ namespace storm {
                     throw storm::exceptions::OutOfRangeException() << "Error while parsing " << filename << ": Found reward for a state of an invalid index \"" << state << "\"";
                 }
 
-                // Parse reward value.
-                reward = checked_strtod(buf, &buf);
-
+                double reward = assignment.second;
                 if (reward < 0.0) {
                     STORM_LOG_ERROR("Error while parsing " << filename << ": Expected positive reward value but got \"" << reward << "\".");
                     throw storm::exceptions::WrongFormatException() << "Error while parsing " << filename << ": State reward file specifies illegal reward value.";
                 }
 
                 stateRewards[state] = reward;
-
-                buf = trimWhitespaces(buf);
                 lastState = state;
             }
             return stateRewards;
@@ -10,8 +10,107 @@ namespace utility {
 
 namespace cstring {
 
+namespace {
+
+// The powers of ten that can be represented exactly as a double.
+double const exactPowersOfTen[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+bool isDigit(char c) {
+	return c >= '0' && c <= '9';
+}
+
+/*!
+ *	Tries to parse a non-negative decimal integer with at most 18 digits (which can not overflow).
+ *	Everything else (signs, longer numbers, ...) is left to strtol().
+ *	@return True iff the number was parsed.
+ */
+bool tryParseInteger(char const* str, char const** end, uint_fast64_t& result) {
+	char const* position = str;
+	while (isspace(static_cast<unsigned char>(*position))) position++;
+	char const* digitsBegin = position;
+	uint_fast64_t value = 0;
+	for (; isDigit(*position); position++) {
+		if (position - digitsBegin >= 18) return false;
+		value = 10 * value + static_cast<uint_fast64_t>(*position - '0');
+	}
+	if (position == digitsBegin) return false;
+	result = value;
+	*end = position;
+	return true;
+}
+
+/*!
+ *	Tries to parse a decimal floating point number without calling strtod().
+ *	This is only done if the significand has at most 19 significant digits, does not exceed 2^53 and the decimal
+ *	exponent is within [-22, 22]. Then, the significand and the power of ten are exactly representable and the result
+ *	is obtained by a single (correctly rounded) multiplication or division, i.e. it coincides with the result of strtod().
+ *	Everything else (hexadecimal numbers, infinity, long significands, ...) is left to strtod().
+ *	@return True iff the number was parsed.
+ */
+bool tryParseDouble(char const* str, char const** end, double& result) {
+	char const* position = str;
+	while (isspace(static_cast<unsigned char>(*position))) position++;
+	bool negative = false;
+	if (*position == '-' || *position == '+') {
+		negative = *position == '-';
+		position++;
+	}
+
+	uint_fast64_t significand = 0;
+	int_fast64_t exponent = 0;
+	uint_fast64_t significantDigits = 0;
+	bool sawDigit = false;
+	for (; isDigit(*position); position++) {
+		sawDigit = true;
+		if (significand != 0 || *position != '0') {
+			if (++significantDigits > 19) return false;
+		}
+		significand = 10 * significand + static_cast<uint_fast64_t>(*position - '0');
+	}
+	if (*position == '.') {
+		position++;
+		for (; isDigit(*position); position++) {
+			sawDigit = true;
+			if (significand != 0 || *position != '0') {
+				if (++significantDigits > 19) return false;
+			}
+			significand = 10 * significand + static_cast<uint_fast64_t>(*position - '0');
+			exponent--;
+		}
+	}
+	if (!sawDigit) return false;
+
+	// The exponent is only consumed if there are digits, as in strtod().
+	if (*position == 'e' || *position == 'E') {
+		char const* exponentPosition = position + 1;
+		bool negativeExponent = false;
+		if (*exponentPosition == '-' || *exponentPosition == '+') {
+			negativeExponent = *exponentPosition == '-';
+			exponentPosition++;
+		}
+		if (isDigit(*exponentPosition)) {
+			int_fast64_t explicitExponent = 0;
+			for (; isDigit(*exponentPosition); exponentPosition++) {
+				if (explicitExponent < 100000) explicitExponent = 10 * explicitExponent + (*exponentPosition - '0');
+			}
+			exponent += negativeExponent ? -explicitExponent : explicitExponent;
+			position = exponentPosition;
+		}
+	}
+	if (*position == 'x' || *position == 'X') return false;
+	if (significand > (1ull << 53) || exponent < -22 || exponent > 22) return false;
+
+	double value = static_cast<double>(significand);
+	value = exponent < 0 ? value / exactPowersOfTen[-exponent] : value * exactPowersOfTen[exponent];
+	result = negative ? -value : value;
+	*end = position;
+	return true;
+}
+
+} // anonymous namespace
+
 /*!
- *	Calls strtol() internally and checks if the new pointer is different
+ *	Parses short non-negative numbers directly and calls strtol() otherwise. Checks if the new pointer is different
  *	from the original one, i.e. if str != *end. If they are the same, a
  *	storm::exceptions::WrongFormatException will be thrown.
  *	@param str String to parse
@@ -19,7 +118,9 @@ namespace cstring {
  *	@return Result of strtol()
  */
 uint_fast64_t checked_strtol(char const* str, char const** end) {
-	uint_fast64_t res = strtol(str, const_cast<char**>(end), 10);
+	uint_fast64_t res;
+	if (tryParseInteger(str, end, res)) return res;
+	res = strtol(str, const_cast<char**>(end), 10);
 	if (str == *end) {
 		STORM_LOG_ERROR("Error while parsing integer. Next input token is not a number.");
 		STORM_LOG_ERROR("\tUpcoming input is: \"" << std::string(str, 0, 16) << "\"");
@@ -29,7 +130,7 @@ uint_fast64_t checked_strtol(char const* str, char const** end) {
 }
 
 /*!
- *	Calls strtod() internally and checks if the new pointer is different
+ *	Parses short decimal numbers directly and calls strtod() otherwise. Checks if the new pointer is different
  *	from the original one, i.e. if str != *end. If they are the same, a
  *	storm::exceptions::WrongFormatException will be thrown.
  *	@param str String to parse
@@ -37,7 +138,9 @@ uint_fast64_t checked_strtol(char const* str, char const** end) {
  *	@return Result of strtod()
  */
 double checked_strtod(char const* str, char const** end) {
-	double res = strtod(str, const_cast<char**>(end));
+	double res;
+	if (tryParseDouble(str, end, res)) return res;
+	res = strtod(str, const_cast<char**>(end));
 	if (str == *end) {
 		STORM_LOG_ERROR("Error while parsing floating point. Next input token is not a number.");
 		STORM_LOG_ERROR("\tUpcoming input is: \"" << std::string(str, 0, 16) << "\"");
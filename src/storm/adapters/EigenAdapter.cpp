@@ -1,22 +1,34 @@
 #include "storm/adapters/EigenAdapter.h"
 
+#include <limits>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/NotSupportedException.h"
+
 namespace storm {
     namespace adapters {
      
         template<typename ValueType>
         std::unique_ptr<Eigen::SparseMatrix<ValueType>> EigenAdapter::toEigenSparseMatrix(storm::storage::SparseMatrix<ValueType> const& matrix) {
-            // Build a list of triplets and let Eigen care about the insertion.
-            std::vector<Eigen::Triplet<ValueType>> triplets;
-            triplets.reserve(matrix.getNonzeroEntryCount());
+            typedef typename Eigen::SparseMatrix<ValueType>::StorageIndex StorageIndex;
+            STORM_LOG_THROW(matrix.getEntryCount() <= static_cast<uint64_t>(std::numeric_limits<StorageIndex>::max()), storm::exceptions::NotSupportedException, "The matrix has too many entries to be converted to Eigen format.");
+            
+            // Count the entries of each column, so the storage can be reserved exactly. As the rows are visited in
+            // ascending order, every entry is then appended at the end of its column, which avoids building (and
+            // sorting) an intermediate list of triplets.
+            Eigen::Matrix<StorageIndex, Eigen::Dynamic, 1> entriesPerColumn = Eigen::Matrix<StorageIndex, Eigen::Dynamic, 1>::Zero(matrix.getColumnCount());
+            for (auto const& element : matrix) {
+                ++entriesPerColumn(element.getColumn());
+            }
             
+            std::unique_ptr<Eigen::SparseMatrix<ValueType>> result = std::make_unique<Eigen::SparseMatrix<ValueType>>(matrix.getRowCount(), matrix.getColumnCount());
+            result->reserve(entriesPerColumn);
             for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
                 for (auto const& element : matrix.getRow(row)) {
-                    triplets.emplace_back(row, element.getColumn(), element.getValue());
+                    result->insert(row, element.getColumn()) = element.getValue();
                 }
             }
-            
-            std::unique_ptr<Eigen::SparseMatrix<ValueType>> result = std::make_unique<Eigen::SparseMatrix<ValueType>>(matrix.getRowCount(), matrix.getColumnCount());
-            result->setFromTriplets(triplets.begin(), triplets.end());
+            result->makeCompressed();
             return result;
         }
 
@@ -14,8 +14,8 @@ namespace storm {
         class EigenAdapter {
         public:
             /*!
-             * Converts a sparse matrix into a sparse matrix in the gmm++ format.
-             * @return A pointer to a row-major sparse matrix in gmm++ format.
+             * Converts a sparse matrix into a sparse matrix in the Eigen format.
+             * @return A pointer to a column-major sparse matrix in Eigen format.
              */
             template<class ValueType>
             static std::unique_ptr<Eigen::SparseMatrix<ValueType>> toEigenSparseMatrix(storm::storage::SparseMatrix<ValueType> const& matrix);
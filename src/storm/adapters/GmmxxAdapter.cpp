@@ -1,11 +1,13 @@
 #include "storm/adapters/GmmxxAdapter.h"
 
 #include <algorithm>
+#include <limits>
 
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/utility/macros.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
     namespace adapters {
@@ -15,28 +17,27 @@ namespace storm {
             uint_fast64_t realNonZeros = matrix.getEntryCount();
             STORM_LOG_TRACE("Converting " << matrix.getRowCount() << "x" << matrix.getColumnCount() << " matrix with " << realNonZeros << " non-zeros to gmm++ format.");
             
+            // gmm++ stores the row indications and the columns with 32-bit indices.
+            STORM_LOG_THROW(realNonZeros <= std::numeric_limits<typename gmm::csr_matrix<T>::IND_TYPE>::max(), storm::exceptions::NotSupportedException, "The matrix has too many entries to be converted to gmm++ format.");
+            
             // Prepare the resulting matrix.
             std::unique_ptr<gmm::csr_matrix<T>> result(new gmm::csr_matrix<T>(matrix.getRowCount(), matrix.getColumnCount()));
             
             // Copy Row Indications
             std::copy(matrix.rowIndications.begin(), matrix.rowIndications.end(), result->jc.begin());
             
-            // Copy columns and values.
-            std::vector<T> values;
-            values.reserve(matrix.getEntryCount());
-            
-            // To match the correct vector type for gmm, we create the vector with the exact same type.
-            decltype(result->ir) columns;
-            columns.reserve(matrix.getEntryCount());
-            
+            // Copy columns and values directly into the storage of the result to avoid intermediate vectors.
+            result->ir.resize(realNonZeros);
+            result->pr.resize(realNonZeros);
+            auto columnIt = result->ir.begin();
+            auto valueIt = result->pr.begin();
             for (auto const& entry : matrix) {
-                columns.emplace_back(entry.getColumn());
-                values.emplace_back(entry.getValue());
+                *columnIt = entry.getColumn();
+                *valueIt = entry.getValue();
+                ++columnIt;
+                ++valueIt;
             }
             
-            std::swap(result->ir, columns);
-            std::swap(result->pr, values);
-            
             STORM_LOG_TRACE("Done converting matrix to gmm++ format.");
             
             return result;
@@ -22,6 +22,8 @@
 #include "tbb/parallel_for.h"
 #include "tbb/blocked_range.h"
 #include "tbb/tbb_stddef.h"
+#include "tbb/enumerable_thread_specific.h"
+#include "tbb/task_arena.h"
 #endif
 
 #ifdef TRUE
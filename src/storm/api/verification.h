@@ -17,6 +17,7 @@
 #include "storm/modelchecker/abstraction/GameBasedMdpModelChecker.h"
 #include "storm/modelchecker/abstraction/BisimulationAbstractionRefinementModelChecker.h"
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
+#include "storm/modelchecker/statistical/SparseStatisticalModelChecker.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 #include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
 
@@ -157,6 +158,39 @@ namespace storm {
             return verifyWithExplorationEngine(env, model, task);
         }
 
+        //
+        // Verifying with Statistical engine
+        //
+        template<typename ValueType>
+        typename std::enable_if<std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithStatisticalEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+            std::unique_ptr<storm::modelchecker::CheckResult> result;
+            if (model->getType() == storm::models::ModelType::Dtmc) {
+                storm::modelchecker::SparseStatisticalModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(*model->template as<storm::models::sparse::Dtmc<ValueType>>());
+                if (checker.canHandle(task)) {
+                    result = checker.check(env, task);
+                }
+            } else if (model->getType() == storm::models::ModelType::Mdp) {
+                storm::modelchecker::SparseStatisticalModelChecker<storm::models::sparse::Mdp<ValueType>> checker(*model->template as<storm::models::sparse::Mdp<ValueType>>());
+                if (checker.canHandle(task)) {
+                    result = checker.check(env, task);
+                }
+            } else {
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The model type " << model->getType() << " is not supported by the statistical engine.");
+            }
+            return result;
+        }
+
+        template<typename ValueType>
+        typename std::enable_if<!std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithStatisticalEngine(storm::Environment const&, std::shared_ptr<storm::models::sparse::Model<ValueType>> const&, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const&) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Statistical engine does not support data type.");
+        }
+
+        template<typename ValueType>
+        std::unique_ptr<storm::modelchecker::CheckResult> verifyWithStatisticalEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+            Environment env;
+            return verifyWithStatisticalEngine(env, model, task);
+        }
+
         //
         // Verifying with Sparse engine
         //
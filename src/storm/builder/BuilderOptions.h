@@ -117,6 +117,7 @@ namespace storm {
             bool isAddOutOfBoundsStateSet() const;
             uint64_t getReservedBitsForUnboundedVariables() const;
             bool isAddOverlappingGuardLabelSet() const;
+            bool isCompileExpressionsSet() const;
             uint64_t getShowProgressDelay() const;
 
             /**
@@ -206,6 +207,12 @@ namespace storm {
              */
             BuilderOptions& setAddOverlappingGuardsLabel(bool newValue = true);
 
+            /**
+             * Should the expressions of the model be compiled such that they can be evaluated directly on the states (if possible)
+             * @param newValue the new value (default true)
+             */
+            BuilderOptions& setCompileExpressions(bool newValue = true);
+
             /**
              * Sets the number of bits that will be reserved for unbounded integer variables.
              */
@@ -268,6 +275,9 @@ namespace storm {
             /// A flag indicating that the an additional state for out of bounds should be created.
             bool addOutOfBoundsState;
 
+            /// A flag indicating whether expressions are compiled such that they can be evaluated directly on the states.
+            bool compileExpressions;
+
             /// Indicates the number of bits that are reserved for the storage of unbounded integer variables.
             uint64_t reservedBitsForUnboundedVariables;
 
@@ -34,6 +34,7 @@
 #include "storm/utility/macros.h"
 #include "storm/utility/jani.h"
 #include "storm/utility/dd.h"
+#include "storm/utility/Stopwatch.h"
 #include "storm/utility/math.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/exceptions/InvalidSettingsException.h"
@@ -98,18 +99,18 @@ namespace storm {
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdJaniModelBuilder<Type, ValueType>::Options::Options(bool buildAllLabels, bool buildAllRewardModels, bool applyMaximumProgressAssumption) : buildAllLabels(buildAllLabels), buildAllRewardModels(buildAllRewardModels), applyMaximumProgressAssumption(applyMaximumProgressAssumption), rewardModelsToBuild(), constantDefinitions() {
+        DdJaniModelBuilder<Type, ValueType>::Options::Options(bool buildAllLabels, bool buildAllRewardModels, bool applyMaximumProgressAssumption) : buildAllLabels(buildAllLabels), buildAllRewardModels(buildAllRewardModels), applyMaximumProgressAssumption(applyMaximumProgressAssumption), rewardModelsToBuild(), constantDefinitions(), variableOrdering(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrdering()) {
             // Intentionally left empty.
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdJaniModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula) : buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions() {
+        DdJaniModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula) : buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions(), variableOrdering(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrdering()) {
             this->preserveFormula(formula);
             this->setTerminalStatesFromFormula(formula);
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdJaniModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) : buildAllLabels(false), buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions() {
+        DdJaniModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) : buildAllLabels(false), buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions(), variableOrdering(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrdering()) {
             if (!formulas.empty()) {
                 for (auto const& formula : formulas) {
                     this->preserveFormula(*formula);
@@ -287,7 +288,7 @@ namespace storm {
         template <storm::dd::DdType Type, typename ValueType>
         class CompositionVariableCreator : public storm::jani::CompositionVisitor {
         public:
-            CompositionVariableCreator(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation) : model(model), automata(), actionInformation(actionInformation) {
+            CompositionVariableCreator(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation, storm::builder::DdVariableOrdering variableOrdering = storm::builder::DdVariableOrdering::Declaration) : model(model), automata(), actionInformation(actionInformation), variableOrdering(variableOrdering) {
                 // Intentionally left empty.
             }
             
@@ -353,41 +354,54 @@ namespace storm {
                     result.allNondeterminismVariables.insert(result.probabilisticNondeterminismVariable);
                 }
                 
+                // Collect the variables (starting with the location variables) in the order of their declaration.
+                std::vector<storm::expressions::Variable> declaredVariables;
+                std::map<storm::expressions::Variable, storm::jani::Automaton const*> locationVariableToAutomaton;
+                std::map<storm::expressions::Variable, storm::jani::Variable const*> expressionVariableToVariable;
                 for (auto const& automatonName : this->automata) {
                     storm::jani::Automaton const& automaton =  this->model.getAutomaton(automatonName);
-                    
-                    // Start by creating a meta variable for the location of the automaton.
-                    storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1);
-                    result.automatonToLocationDdVariableMap[automaton.getName()] = variablePair;
-                    result.rowColumnMetaVariablePairs.push_back(variablePair);
-
-                    result.variableToRowMetaVariableMap->emplace(locationExpressionVariable, variablePair.first);
-                    result.variableToColumnMetaVariableMap->emplace(locationExpressionVariable, variablePair.second);
-                    
-                    // Add the location variable to the row/column variables.
-                    result.rowMetaVariables.insert(variablePair.first);
-                    result.columnMetaVariables.insert(variablePair.second);
-                    
-                    // Add the legal range for the location variables.
-                    result.variableToRangeMap.emplace(variablePair.first, result.manager->getRange(variablePair.first));
-                    result.variableToRangeMap.emplace(variablePair.second, result.manager->getRange(variablePair.second));
+                    declaredVariables.push_back(automaton.getLocationExpressionVariable());
+                    locationVariableToAutomaton.emplace(automaton.getLocationExpressionVariable(), &automaton);
+                }
+                for (auto const& variable : this->model.getGlobalVariables()) {
+                    // Only create the variable if it's non-transient.
+                    if (!variable.isTransient()) {
+                        declaredVariables.push_back(variable.getExpressionVariable());
+                        expressionVariableToVariable.emplace(variable.getExpressionVariable(), &variable);
+                    }
+                }
+                for (auto const& automaton : this->model.getAutomata()) {
+                    for (auto const& variable : automaton.getVariables()) {
+                        if (!variable.isTransient()) {
+                            declaredVariables.push_back(variable.getExpressionVariable());
+                            expressionVariableToVariable.emplace(variable.getExpressionVariable(), &variable);
+                        }
+                    }
+                }
+                
+                // Create the meta variables. The order in which they are created is the order in which they appear in
+                // the decision diagrams.
+                for (auto const& variable : storm::builder::orderDdVariables(this->model, declaredVariables, variableOrdering)) {
+                    auto locationIt = locationVariableToAutomaton.find(variable);
+                    if (locationIt != locationVariableToAutomaton.end()) {
+                        createLocationVariable(*locationIt->second, result);
+                    } else {
+                        createVariable(*expressionVariableToVariable.at(variable), result);
+                    }
                 }
                 
-                // Create global variables.
+                // Compute the ranges of the global variables.
                 storm::dd::Bdd<Type> globalVariableRanges = result.manager->getBddOne();
                 for (auto const& variable : this->model.getGlobalVariables()) {
-                    // Only create the variable if it's non-transient.
                     if (variable.isTransient()) {
                         continue;
                     }
                     
-                    createVariable(variable, result);
                     globalVariableRanges &= result.manager->getRange(result.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
                 }
                 result.globalVariableRanges = globalVariableRanges.template toAdd<ValueType>();
                 
-                // Create the variables for the individual automata.
+                // Compute the identities and ranges of the individual automata.
                 for (auto const& automaton : this->model.getAutomata()) {
                     storm::dd::Bdd<Type> identity = result.manager->getBddOne();
                     storm::dd::Bdd<Type> range = result.manager->getBddOne();
@@ -398,14 +412,12 @@ namespace storm {
                     identity &= variableIdentity;
                     range &= result.manager->getRange(locationVariables.first);
                     
-                    // Then create variables for the variables of the automaton.
+                    // Then add the ones of the variables of the automaton.
                     for (auto const& variable : automaton.getVariables()) {
-                        // Only create the variable if it's non-transient.
                         if (variable.isTransient()) {
                             continue;
                         }
                         
-                        createVariable(variable, result);
                         identity &= result.variableToIdentityMap.at(variable.getExpressionVariable()).toBdd();
                         range &= result.manager->getRange(result.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
                     }
@@ -423,6 +435,25 @@ namespace storm {
                 return result;
             }
             
+            void createLocationVariable(storm::jani::Automaton const& automaton, CompositionVariables<Type, ValueType>& result) {
+                // Create a meta variable for the location of the automaton.
+                storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
+                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1);
+                result.automatonToLocationDdVariableMap[automaton.getName()] = variablePair;
+                result.rowColumnMetaVariablePairs.push_back(variablePair);
+                
+                result.variableToRowMetaVariableMap->emplace(locationExpressionVariable, variablePair.first);
+                result.variableToColumnMetaVariableMap->emplace(locationExpressionVariable, variablePair.second);
+                
+                // Add the location variable to the row/column variables.
+                result.rowMetaVariables.insert(variablePair.first);
+                result.columnMetaVariables.insert(variablePair.second);
+                
+                // Add the legal range for the location variables.
+                result.variableToRangeMap.emplace(variablePair.first, result.manager->getRange(variablePair.first));
+                result.variableToRangeMap.emplace(variablePair.second, result.manager->getRange(variablePair.second));
+            }
+            
             void createVariable(storm::jani::Variable const& variable, CompositionVariables<Type, ValueType>& result) {
                 if (variable.isBooleanVariable()) {
                     createVariable(variable.asBooleanVariable(), result);
@@ -479,19 +510,27 @@ namespace storm {
             storm::jani::Model const& model;
             std::set<std::string> automata;
             storm::jani::CompositionInformation actionInformation;
+            storm::builder::DdVariableOrdering variableOrdering;
         };
         
         template <storm::dd::DdType Type, typename ValueType>
         struct ComposerResult {
-            ComposerResult(storm::dd::Add<Type, ValueType> const& transitions, std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> const& transientLocationAssignments, std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> const& transientEdgeAssignments, storm::dd::Bdd<Type> const& illegalFragment, uint64_t numberOfNondeterminismVariables = 0) : transitions(transitions), transientLocationAssignments(transientLocationAssignments), transientEdgeAssignments(transientEdgeAssignments), illegalFragment(illegalFragment), numberOfNondeterminismVariables(numberOfNondeterminismVariables) {
+            ComposerResult(std::vector<storm::dd::Add<Type, ValueType>> const& actionTransitions, std::vector<storm::dd::Bdd<Type>> const& transitionPartitions, std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> const& transientLocationAssignments, std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> const& transientEdgeAssignments, storm::dd::Bdd<Type> const& illegalFragment, uint64_t numberOfNondeterminismVariables = 0) : actionTransitions(actionTransitions), transientLocationAssignments(transientLocationAssignments), transientEdgeAssignments(transientEdgeAssignments), illegalFragment(illegalFragment), numberOfNondeterminismVariables(numberOfNondeterminismVariables), transitionPartitions(transitionPartitions) {
                 // Intentionally left empty.
             }
             
+            // The transitions of the individual actions. They are only summed up once the reachable states are known.
+            std::vector<storm::dd::Add<Type, ValueType>> actionTransitions;
+            
+            // The transitions of the system restricted to the reachable states.
             storm::dd::Add<Type, ValueType> transitions;
             std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientLocationAssignments;
             std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
             storm::dd::Bdd<Type> illegalFragment;
             uint64_t numberOfNondeterminismVariables;
+            
+            // The supports of the actions (the silent one split by automaton) whose union is the support of all transitions.
+            std::vector<storm::dd::Bdd<Type>> transitionPartitions;
         };
         
         // A class that is responsible for performing the actual composition. This
@@ -1829,6 +1868,21 @@ namespace storm {
                 action.transitions *= missingIdentities;
             }
             
+            void addTransitionPartitions(uint64_t actionIndex, storm::dd::Bdd<Type> const& transitions, std::vector<storm::dd::Bdd<Type>>& transitionPartitions) const {
+                if (actionIndex == storm::jani::Model::SILENT_ACTION_INDEX) {
+                    // The transitions of the silent action stem from any of the automata. To allow exploring the state
+                    // space automaton by automaton, they are split by the automaton whose variables they change.
+                    std::vector<storm::dd::Bdd<Type>> automatonIdentities;
+                    for (auto const& automatonIdentity : this->variables.automatonToIdentityMap) {
+                        automatonIdentities.push_back(automatonIdentity.second.notZero());
+                    }
+                    std::vector<storm::dd::Bdd<Type>> partitions = storm::utility::dd::splitTransitionsByChangedVariables(transitions, automatonIdentities);
+                    transitionPartitions.insert(transitionPartitions.end(), partitions.begin(), partitions.end());
+                } else {
+                    transitionPartitions.push_back(transitions);
+                }
+            }
+            
             ComposerResult<Type, ValueType> buildSystemFromAutomaton(AutomatonDd& automaton) {
                 STORM_LOG_TRACE("Building system from final automaton.");
 
@@ -1836,7 +1890,7 @@ namespace storm {
                 
                 // If the model is an MDP, we need to encode the nondeterminism using additional variables.
                 if (modelType == storm::jani::ModelType::MDP || modelType == storm::jani::ModelType::MA || modelType == storm::jani::ModelType::LTS) {
-                    storm::dd::Add<Type, ValueType> result = this->variables.manager->template getAddZero<ValueType>();
+                    std::vector<storm::dd::Add<Type, ValueType>> actionTransitions;
                     storm::dd::Bdd<Type> illegalFragment = this->variables.manager->getBddZero();
                     
                     // First, determine the highest number of nondeterminism variables that is used in any action and make
@@ -1846,6 +1900,7 @@ namespace storm {
                     
                     // Add missing global variable identities, action and nondeterminism encodings.
                     std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
+                    std::vector<storm::dd::Bdd<Type>> transitionPartitions;
                     std::unordered_set<ActionIdentification, ActionIdentificationHash> containedActions;
                     for (auto& action : automaton.actions) {
                         STORM_LOG_TRACE("Treating action with index " << action.first.actionIndex << (action.first.isMarkovian() ? " (Markovian)" : "") << ".");
@@ -1866,16 +1921,18 @@ namespace storm {
                             addToTransientAssignmentMap(transientEdgeAssignments, transientAssignment.first, actionEncoding * missingNondeterminismEncoding * transientAssignment.second);
                         }
                         
-                        result += extendedTransitions;
+                        addTransitionPartitions(actionIndex, extendedTransitions.notZero(), transitionPartitions);
+                        actionTransitions.push_back(std::move(extendedTransitions));
                     }
                     
-                    return ComposerResult<Type, ValueType>(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, numberOfUsedNondeterminismVariables);
+                    return ComposerResult<Type, ValueType>(actionTransitions, transitionPartitions, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, numberOfUsedNondeterminismVariables);
                 } else if (modelType == storm::jani::ModelType::DTMC || modelType == storm::jani::ModelType::CTMC) {
-                    // Simply add all actions, but make sure to include the missing global variable identities.
+                    // Simply collect all actions, but make sure to include the missing global variable identities.
 
-                    storm::dd::Add<Type, ValueType> result = this->variables.manager->template getAddZero<ValueType>();
+                    std::vector<storm::dd::Add<Type, ValueType>> actionTransitions;
                     storm::dd::Bdd<Type> illegalFragment = this->variables.manager->getBddZero();
                     std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
+                    std::vector<storm::dd::Bdd<Type>> transitionPartitions;
                     std::unordered_set<uint64_t> actionIndices;
                     for (auto& action : automaton.actions) {
                         STORM_LOG_THROW(actionIndices.find(action.first.actionIndex) == actionIndices.end(), storm::exceptions::WrongFormatException, "Duplication action " << actionInformation.getActionName(action.first.actionIndex));
@@ -1883,10 +1940,11 @@ namespace storm {
                         illegalFragment |= action.second.illegalFragment;
                         addMissingGlobalVariableIdentities(action.second);
                         addToTransientAssignmentMap(transientEdgeAssignments, action.second.transientEdgeAssignments);
-                        result += action.second.transitions;
+                        addTransitionPartitions(action.first.actionIndex, action.second.transitions.notZero(), transitionPartitions);
+                        actionTransitions.push_back(action.second.transitions);
                     }
 
-                    return ComposerResult<Type, ValueType>(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, 0);
+                    return ComposerResult<Type, ValueType>(actionTransitions, transitionPartitions, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, 0);
                 } else {
                     STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Model type '" << this->model.getModelType() << "' not supported.");
                 }
@@ -1926,19 +1984,7 @@ namespace storm {
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        void postprocessVariables(storm::jani::ModelType const& modelType, ComposerResult<Type, ValueType>& system, CompositionVariables<Type, ValueType>& variables) {
-            // Add all action/row/column variables to the DD. If we omitted multiplying edges in the construction, this will
-            // introduce the variables so they can later be abstracted without raising an error.
-            system.transitions.addMetaVariables(variables.rowMetaVariables);
-            system.transitions.addMetaVariables(variables.columnMetaVariables);
-            
-            // If the model is an MDP, we also add all action variables.
-            if (modelType == storm::jani::ModelType::MDP || modelType == storm::jani::ModelType::LTS ) {
-                for (auto const& actionVariablePair : variables.actionVariablesMap) {
-                    system.transitions.addMetaVariable(actionVariablePair.second);
-                }
-            }
-            
+        void postprocessVariables(ComposerResult<Type, ValueType> const& system, CompositionVariables<Type, ValueType>& variables) {
             // Get rid of the local nondeterminism variables that were not used.
             for (uint64_t index = system.numberOfNondeterminismVariables; index < variables.localNondeterminismVariables.size(); ++index) {
                 variables.allNondeterminismVariables.erase(variables.localNondeterminismVariables[index]);
@@ -1947,19 +1993,8 @@ namespace storm {
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        storm::dd::Bdd<Type> postprocessSystem(storm::jani::Model const& model, ComposerResult<Type, ValueType>& system, CompositionVariables<Type, ValueType> const& variables, typename DdJaniModelBuilder<Type, ValueType>::Options const& options, std::map<std::string, storm::expressions::Expression> const& labelsToExpressionMap) {
-            // For DTMCs, we normalize each row to 1 (to account for non-determinism).
-            if (model.getModelType() == storm::jani::ModelType::DTMC) {
-                storm::dd::Add<Type, ValueType> stateToNumberOfChoices = system.transitions.sumAbstract(variables.columnMetaVariables);
-                system.transitions = system.transitions / stateToNumberOfChoices;
-                
-                // Scale all state-action rewards.
-                for (auto& entry : system.transientEdgeAssignments) {
-                    entry.second = entry.second / stateToNumberOfChoices;
-                }
-            }
-            
-            // If we were asked to treat some states as terminal states, we cut away their transitions now.
+        storm::dd::Bdd<Type> computeTerminalStates(storm::jani::Model const& model, CompositionVariables<Type, ValueType> const& variables, typename DdJaniModelBuilder<Type, ValueType>::Options const& options, std::map<std::string, storm::expressions::Expression> const& labelsToExpressionMap) {
+            // Determine the states that we were asked to treat as terminal states.
             storm::dd::Bdd<Type> terminalStatesBdd = variables.manager->getBddZero();
             if (!options.terminalStates.empty()) {
                 storm::expressions::Expression terminalExpression = options.terminalStates.asExpression([&model, &labelsToExpressionMap](std::string const& labelName) {
@@ -1974,11 +2009,49 @@ namespace storm {
                 });
                 terminalExpression = terminalExpression.substitute(model.getConstantsSubstitution());
                 terminalStatesBdd = variables.rowExpressionAdapter->translateExpression(terminalExpression).toBdd();
-                system.transitions *= (!terminalStatesBdd).template toAdd<ValueType>();
             }
             return terminalStatesBdd;
         }
         
+        template <storm::dd::DdType Type, typename ValueType>
+        void composeReachableTransitions(storm::jani::Model const& model, ComposerResult<Type, ValueType>& system, CompositionVariables<Type, ValueType> const& variables, storm::dd::Add<Type, ValueType> const& reachableStatesAdd, storm::dd::Bdd<Type> const& terminalStates) {
+            // Restrict the transitions of each action to the reachable states before summing them up, so the
+            // relation of the full system is never built on the unreachable part of the state space.
+            system.transitions = variables.manager->template getAddZero<ValueType>();
+            for (auto const& actionTransitions : system.actionTransitions) {
+                system.transitions += actionTransitions * reachableStatesAdd;
+            }
+            system.actionTransitions.clear();
+            
+            // Add all action/row/column variables to the DD. If we omitted multiplying edges in the construction, this will
+            // introduce the variables so they can later be abstracted without raising an error.
+            system.transitions.addMetaVariables(variables.rowMetaVariables);
+            system.transitions.addMetaVariables(variables.columnMetaVariables);
+            
+            // If the model is an MDP, we also add all action variables.
+            if (model.getModelType() == storm::jani::ModelType::MDP || model.getModelType() == storm::jani::ModelType::LTS) {
+                for (auto const& actionVariablePair : variables.actionVariablesMap) {
+                    system.transitions.addMetaVariable(actionVariablePair.second);
+                }
+            }
+            
+            // For DTMCs, we normalize each row to 1 (to account for non-determinism).
+            if (model.getModelType() == storm::jani::ModelType::DTMC) {
+                storm::dd::Add<Type, ValueType> stateToNumberOfChoices = system.transitions.sumAbstract(variables.columnMetaVariables);
+                system.transitions = system.transitions / stateToNumberOfChoices;
+                
+                // Scale all state-action rewards.
+                for (auto& entry : system.transientEdgeAssignments) {
+                    entry.second = entry.second * reachableStatesAdd / stateToNumberOfChoices;
+                }
+            }
+            
+            // Cut away the transitions of the terminal states.
+            if (!terminalStates.isZero()) {
+                system.transitions *= (!terminalStates).template toAdd<ValueType>();
+            }
+        }
+        
         template <storm::dd::DdType Type, typename ValueType>
         storm::dd::Bdd<Type> computeInitialStates(storm::jani::Model const& model, CompositionVariables<Type, ValueType> const& variables) {
             std::vector<std::reference_wrapper<storm::jani::Automaton const>> allAutomata;
@@ -2166,8 +2239,10 @@ namespace storm {
             storm::jani::CompositionInformationVisitor visitor(preparedModel, preparedModel.getSystemComposition());
             storm::jani::CompositionInformation actionInformation = visitor.getInformation();
             
+            storm::utility::Stopwatch buildWatch(true);
+            
             // Create all necessary variables.
-            CompositionVariableCreator<Type, ValueType> variableCreator(preparedModel, actionInformation);
+            CompositionVariableCreator<Type, ValueType> variableCreator(preparedModel, actionInformation, options.variableOrdering);
             CompositionVariables<Type, ValueType> variables = variableCreator.create();
             
             // Determine which transient assignments need to be considered in the building process.
@@ -2179,13 +2254,13 @@ namespace storm {
             ComposerResult<Type, ValueType> system = composer.compose();
 
             // Postprocess the variables in place.
-            postprocessVariables(preparedModel.getModelType(), system, variables);
+            postprocessVariables(system, variables);
 
             // Build the label to expressions mapping.
             auto labelsToExpressionMap = buildLabelExpressions(preparedModel, variables, options);
             
-            // Postprocess the system in place and get the states that were terminal (i.e. whose transitions were cut off).
-            storm::dd::Bdd<Type> terminalStates = postprocessSystem(preparedModel, system, variables, options, labelsToExpressionMap);
+            // Get the states that are terminal (i.e. whose transitions are cut off).
+            storm::dd::Bdd<Type> terminalStates = computeTerminalStates(preparedModel, variables, options, labelsToExpressionMap);
             
             // Start creating the model components.
             ModelComponents<Type, ValueType> modelComponents;
@@ -2196,20 +2271,29 @@ namespace storm {
             // Build initial states.
             modelComponents.initialStates = computeInitialStates(preparedModel, variables);
             
-            // Perform reachability analysis to obtain reachable states.
-            storm::dd::Bdd<Type> transitionMatrixBdd = system.transitions.notZero();
-            if (preparedModel.getModelType() == storm::jani::ModelType::MDP || preparedModel.getModelType() == storm::jani::ModelType::LTS || preparedModel.getModelType() == storm::jani::ModelType::MA) {
-                transitionMatrixBdd = transitionMatrixBdd.existsAbstract(variables.allNondeterminismVariables);
+            // Perform reachability analysis to obtain reachable states. The state space is explored using the transitions
+            // of the actions separately, as this avoids the images wrt. the (typically much larger) relation of the full system.
+            for (auto& partition : system.transitionPartitions) {
+                partition &= !terminalStates;
+                if (preparedModel.getModelType() == storm::jani::ModelType::MDP || preparedModel.getModelType() == storm::jani::ModelType::LTS || preparedModel.getModelType() == storm::jani::ModelType::MA) {
+                    partition = partition.existsAbstract(variables.allNondeterminismVariables);
+                }
             }
-            modelComponents.reachableStates = storm::utility::dd::computeReachableStates(modelComponents.initialStates, transitionMatrixBdd, variables.rowMetaVariables, variables.columnMetaVariables).first;
+            modelComponents.reachableStates = storm::utility::dd::computeReachableStates(modelComponents.initialStates, system.transitionPartitions, variables.rowMetaVariables, variables.columnMetaVariables, variables.rowColumnMetaVariablePairs).first;
             
             // Check that the reachable fragment does not overlap with the illegal fragment.
             storm::dd::Bdd<Type> reachableIllegalFragment = modelComponents.reachableStates && system.illegalFragment;
             STORM_LOG_THROW(reachableIllegalFragment.isZero(), storm::exceptions::WrongFormatException, "There are reachable states in the model that have synchronizing edges enabled that write the same global variable.");
             
-            // Cut transitions to reachable states.
+            // Compose the transitions of the reachable states.
             storm::dd::Add<Type, ValueType> reachableStatesAdd = modelComponents.reachableStates.template toAdd<ValueType>();
-            modelComponents.transitionMatrix = system.transitions * reachableStatesAdd;
+            composeReachableTransitions(preparedModel, system, variables, reachableStatesAdd, terminalStates);
+            modelComponents.transitionMatrix = system.transitions;
+            
+            storm::dd::Bdd<Type> transitionMatrixBdd = modelComponents.transitionMatrix.notZero();
+            if (preparedModel.getModelType() == storm::jani::ModelType::MDP || preparedModel.getModelType() == storm::jani::ModelType::LTS || preparedModel.getModelType() == storm::jani::ModelType::MA) {
+                transitionMatrixBdd = transitionMatrixBdd.existsAbstract(variables.allNondeterminismVariables);
+            }
 
             // Fix deadlocks if existing.
             modelComponents.deadlockStates = fixDeadlocks(preparedModel.getModelType(), modelComponents.transitionMatrix, transitionMatrixBdd, modelComponents.reachableStates, variables);
@@ -2221,7 +2305,12 @@ namespace storm {
             modelComponents.rewardModels = buildRewardModels(reachableStatesAdd, modelComponents.transitionMatrix, preparedModel.getModelType(), variables, system, rewardVariables);
             
             // Finally, create the model.
-            return createModel(preparedModel.getModelType(), variables, modelComponents);
+            std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> result = createModel(preparedModel.getModelType(), variables, modelComponents);
+            
+            buildWatch.stop();
+            STORM_LOG_INFO("Built symbolic model using the " << options.variableOrdering << " variable ordering in " << buildWatch << " (peak number of DD nodes: " << variables.manager->getPeakNumberOfNodes() << ", nodes of the transition matrix: " << modelComponents.transitionMatrix.getNodeCount() << ").");
+            
+            return result;
         }
         
         template class DdJaniModelBuilder<storm::dd::DdType::CUDD, double>;
@@ -7,6 +7,7 @@
 
 #include "storm/logic/Formula.h"
 #include "storm/builder/TerminalStatesGetter.h"
+#include "storm/builder/DdVariableOrdering.h"
 
 
 namespace storm {
@@ -119,6 +120,8 @@ namespace storm {
                 // If this is set, the outgoing transitions of these states are replaced with a self-loop.
                 storm::builder::TerminalStates terminalStates;
                 
+                // The heuristic that determines the order of the variables in the decision diagrams.
+                storm::builder::DdVariableOrdering variableOrdering;
             };
                         
             /*!
@@ -16,6 +16,7 @@
 #include "storm/utility/prism.h"
 #include "storm/utility/math.h"
 #include "storm/utility/dd.h"
+#include "storm/utility/Stopwatch.h"
 
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/prism/Program.h"
@@ -92,10 +93,10 @@ namespace storm {
         template <storm::dd::DdType Type, typename ValueType>
         class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
         public:
-            GenerationInformation(storm::prism::Program const& program) : program(program), manager(std::make_shared<storm::dd::DdManager<Type>>()), rowMetaVariables(), variableToRowMetaVariableMap(std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>()), rowExpressionAdapter(std::make_shared<storm::adapters::AddExpressionAdapter<Type, ValueType>>(manager, variableToRowMetaVariableMap)), columnMetaVariables(), variableToColumnMetaVariableMap((std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>())), rowColumnMetaVariablePairs(), nondeterminismMetaVariables(), variableToIdentityMap(), allGlobalVariables(), moduleToIdentityMap(), parameters() {
+            GenerationInformation(storm::prism::Program const& program, storm::builder::DdVariableOrdering variableOrdering = storm::builder::DdVariableOrdering::Declaration) : program(program), manager(std::make_shared<storm::dd::DdManager<Type>>()), rowMetaVariables(), variableToRowMetaVariableMap(std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>()), rowExpressionAdapter(std::make_shared<storm::adapters::AddExpressionAdapter<Type, ValueType>>(manager, variableToRowMetaVariableMap)), columnMetaVariables(), variableToColumnMetaVariableMap((std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>())), rowColumnMetaVariablePairs(), nondeterminismMetaVariables(), variableToIdentityMap(), allGlobalVariables(), moduleToIdentityMap(), parameters() {
                 
                 // Initializes variables and identity DDs.
-                createMetaVariablesAndIdentities();
+                createMetaVariablesAndIdentities(variableOrdering);
                 
                 // Initialize the parameters (if any).
                 ParameterCreator<Type, ValueType> parameterCreator;
@@ -154,8 +155,10 @@ namespace storm {
         private:
             /*!
              * Creates the required meta variables and variable/module identities.
+             *
+             * @param variableOrdering The heuristic that determines the order of the meta variables of the program variables.
              */
-            void createMetaVariablesAndIdentities() {
+            void createMetaVariablesAndIdentities(storm::builder::DdVariableOrdering variableOrdering) {
                 // Add synchronization variables.
                 for (auto const& actionIndex : program.getSynchronizingActionIndices()) {
                     std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(program.getActionName(actionIndex));
@@ -175,84 +178,72 @@ namespace storm {
                     allNondeterminismVariables.insert(variablePair.first);
                 }
                 
-                // Create meta variables for global program variables.
+                // Create meta variables for the program variables. The order in which they are created is the order
+                // in which they appear in the decision diagrams.
+                std::vector<storm::expressions::Variable> declaredVariables;
+                std::map<storm::expressions::Variable, std::pair<int_fast64_t, int_fast64_t>> variableToBounds;
+                auto declareIntegerVariable = [&] (storm::prism::IntegerVariable const& integerVariable) {
+                    declaredVariables.push_back(integerVariable.getExpressionVariable());
+                    variableToBounds.emplace(integerVariable.getExpressionVariable(), std::make_pair(integerVariable.getLowerBoundExpression().evaluateAsInt(), integerVariable.getUpperBoundExpression().evaluateAsInt()));
+                };
                 for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
-                    int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-                    int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
-                    
-                    STORM_LOG_TRACE("Created meta variables for global integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
-                    
-                    rowMetaVariables.insert(variablePair.first);
-                    variableToRowMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.first);
-                    
-                    columnMetaVariables.insert(variablePair.second);
-                    variableToColumnMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.second);
-                    
-                    storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                    variableToIdentityMap.emplace(integerVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                    rowColumnMetaVariablePairs.push_back(variablePair);
-                    
-                    allGlobalVariables.insert(integerVariable.getExpressionVariable());
+                    declareIntegerVariable(integerVariable);
                 }
                 for (storm::prism::BooleanVariable const& booleanVariable : program.getGlobalBooleanVariables()) {
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
-                    
-                    STORM_LOG_TRACE("Created meta variables for global boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
+                    declaredVariables.push_back(booleanVariable.getExpressionVariable());
+                }
+                for (storm::prism::Module const& module : program.getModules()) {
+                    for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
+                        declareIntegerVariable(integerVariable);
+                    }
+                    for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
+                        declaredVariables.push_back(booleanVariable.getExpressionVariable());
+                    }
+                }
+                
+                std::map<storm::expressions::Variable, storm::dd::Bdd<Type>> variableToIdentityBddMap;
+                for (auto const& variable : storm::builder::orderDdVariables(program, declaredVariables, variableOrdering)) {
+                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair;
+                    auto boundsIt = variableToBounds.find(variable);
+                    if (boundsIt != variableToBounds.end()) {
+                        variablePair = manager->addMetaVariable(variable.getName(), boundsIt->second.first, boundsIt->second.second);
+                    } else {
+                        variablePair = manager->addMetaVariable(variable.getName());
+                    }
+                    STORM_LOG_TRACE("Created meta variables for variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
                     
                     rowMetaVariables.insert(variablePair.first);
-                    variableToRowMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.first);
+                    variableToRowMetaVariableMap->emplace(variable, variablePair.first);
                     
                     columnMetaVariables.insert(variablePair.second);
-                    variableToColumnMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.second);
+                    variableToColumnMetaVariableMap->emplace(variable, variablePair.second);
                     
                     storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                    variableToIdentityMap.emplace(booleanVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
+                    variableToIdentityMap.emplace(variable, variableIdentity.template toAdd<ValueType>());
+                    variableToIdentityBddMap.emplace(variable, variableIdentity);
                     
                     rowColumnMetaVariablePairs.push_back(variablePair);
+                }
+                
+                for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
+                    allGlobalVariables.insert(integerVariable.getExpressionVariable());
+                }
+                for (storm::prism::BooleanVariable const& booleanVariable : program.getGlobalBooleanVariables()) {
                     allGlobalVariables.insert(booleanVariable.getExpressionVariable());
                 }
                 
-                // Create meta variables for each of the modules' variables.
+                // Create the identities and ranges of the modules.
                 for (storm::prism::Module const& module : program.getModules()) {
                     storm::dd::Bdd<Type> moduleIdentity = manager->getBddOne();
                     storm::dd::Bdd<Type> moduleRange = manager->getBddOne();
                     
                     for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
-                        int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-                        int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-                        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
-                        STORM_LOG_TRACE("Created meta variables for integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
-                        
-                        rowMetaVariables.insert(variablePair.first);
-                        variableToRowMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.first);
-                        
-                        columnMetaVariables.insert(variablePair.second);
-                        variableToColumnMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.second);
-                        
-                        storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                        variableToIdentityMap.emplace(integerVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                        moduleIdentity &= variableIdentity;
-                        moduleRange &= manager->getRange(variablePair.first);
-                        
-                        rowColumnMetaVariablePairs.push_back(variablePair);
+                        moduleIdentity &= variableToIdentityBddMap.at(integerVariable.getExpressionVariable());
+                        moduleRange &= manager->getRange(variableToRowMetaVariableMap->at(integerVariable.getExpressionVariable()));
                     }
                     for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
-                        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
-                        STORM_LOG_TRACE("Created meta variables for boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
-                        
-                        rowMetaVariables.insert(variablePair.first);
-                        variableToRowMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.first);
-                        
-                        columnMetaVariables.insert(variablePair.second);
-                        variableToColumnMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.second);
-                        
-                        storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                        variableToIdentityMap.emplace(booleanVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                        moduleIdentity &= variableIdentity;
-                        moduleRange &= manager->getRange(variablePair.first);
-                        
-                        rowColumnMetaVariablePairs.push_back(variablePair);
+                        moduleIdentity &= variableToIdentityBddMap.at(booleanVariable.getExpressionVariable());
+                        moduleRange &= manager->getRange(variableToRowMetaVariableMap->at(booleanVariable.getExpressionVariable()));
                     }
                     moduleToIdentityMap[module.getName()] = moduleIdentity.template toAdd<ValueType>();
                     moduleToRangeMap[module.getName()] = moduleRange.template toAdd<ValueType>();
@@ -545,18 +536,18 @@ namespace storm {
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdPrismModelBuilder<Type, ValueType>::Options::Options() : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(), terminalStates() {
+        DdPrismModelBuilder<Type, ValueType>::Options::Options() : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(), terminalStates(), variableOrdering(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrdering()) {
             // Intentionally left empty.
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdPrismModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula) : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(std::set<std::string>()) {
+        DdPrismModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula) : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(std::set<std::string>()), variableOrdering(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrdering()) {
             this->preserveFormula(formula);
             this->setTerminalStatesFromFormula(formula);
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdPrismModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild() {
+        DdPrismModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(), variableOrdering(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrdering()) {
             for (auto const& formula : formulas) {
                 this->preserveFormula(*formula);
             }
@@ -593,11 +584,16 @@ namespace storm {
         
         template <storm::dd::DdType Type, typename ValueType>
         struct DdPrismModelBuilder<Type, ValueType>::SystemResult {
-            SystemResult(storm::dd::Add<Type, ValueType> const& allTransitionsDd, DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram const& globalModule, boost::optional<storm::dd::Add<Type, ValueType>> const& stateActionDd) : allTransitionsDd(allTransitionsDd), globalModule(globalModule), stateActionDd(stateActionDd) {
+            SystemResult(std::vector<storm::dd::Add<Type, ValueType>> const& actionTransitionsDds, std::vector<storm::dd::Bdd<Type>> const& transitionPartitions, DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram const& globalModule) : actionTransitionsDds(actionTransitionsDds), transitionPartitions(transitionPartitions), globalModule(globalModule) {
                 // Intentionally left empty.
             }
             
-            storm::dd::Add<Type, ValueType> allTransitionsDd;
+            // The transitions of the (independent and synchronizing) actions. They are only summed up once the
+            // reachable states are known.
+            std::vector<storm::dd::Add<Type, ValueType>> actionTransitionsDds;
+            
+            // The supports of the (independent and synchronizing) actions whose union is the support of all transitions.
+            std::vector<storm::dd::Bdd<Type>> transitionPartitions;
             typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram globalModule;
             boost::optional<storm::dd::Add<Type, ValueType>> stateActionDd;
         };
@@ -1032,8 +1028,19 @@ namespace storm {
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        storm::dd::Add<Type, ValueType> DdPrismModelBuilder<Type, ValueType>::createSystemFromModule(GenerationInformation& generationInfo, ModuleDecisionDiagram& module) {
-            storm::dd::Add<Type, ValueType> result;
+        std::vector<storm::dd::Add<Type, ValueType>> DdPrismModelBuilder<Type, ValueType>::createSystemFromModule(GenerationInformation& generationInfo, ModuleDecisionDiagram& module, std::vector<storm::dd::Bdd<Type>>& transitionPartitions) {
+            std::vector<storm::dd::Add<Type, ValueType>> result;
+            
+            // The transitions of the independent action stem from any of the modules. To allow exploring the state
+            // space module by module, they are split by the module whose variables they change.
+            auto addIndependentActionPartitions = [&generationInfo, &transitionPartitions] (storm::dd::Bdd<Type> const& independentTransitions) {
+                std::vector<storm::dd::Bdd<Type>> moduleIdentities;
+                for (auto const& moduleIdentity : generationInfo.moduleToIdentityMap) {
+                    moduleIdentities.push_back(moduleIdentity.second.notZero());
+                }
+                std::vector<storm::dd::Bdd<Type>> partitions = storm::utility::dd::splitTransitionsByChangedVariables(independentTransitions, moduleIdentities);
+                transitionPartitions.insert(transitionPartitions.end(), partitions.begin(), partitions.end());
+            };
             
             // Make sure all actions contain all necessary meta variables.
             module.independentAction.ensureContainsVariables(generationInfo.rowMetaVariables, generationInfo.columnMetaVariables);
@@ -1046,8 +1053,6 @@ namespace storm {
             
             // If the model is an MDP, we need to encode the nondeterminism using additional variables.
             if (generationInfo.program.getModelType() == storm::prism::Program::ModelType::MDP) {
-                result = generationInfo.manager->template getAddZero<ValueType>();
-                
                 // First, determine the highest number of nondeterminism variables that is used in any action and make
                 // all actions use the same amout of nondeterminism variables.
                 uint_fast64_t numberOfUsedNondeterminismVariables = module.numberOfUsedNondeterminismVariables;
@@ -1067,7 +1072,7 @@ namespace storm {
                     nondeterminismEncoding *= generationInfo.manager->getEncoding(generationInfo.nondeterminismMetaVariables[i], 0).template toAdd<ValueType>();
                 }
 
-                result = identityEncoding * module.independentAction.transitionsDd * nondeterminismEncoding;
+                storm::dd::Add<Type, ValueType> independentActionDd = identityEncoding * module.independentAction.transitionsDd * nondeterminismEncoding;
                 
                 // Add variables to synchronized action DDs.
                 std::map<uint_fast64_t, storm::dd::Add<Type, ValueType>> synchronizingActionToDdMap;
@@ -1089,18 +1094,21 @@ namespace storm {
                 }
                 
                 // Add variables for synchronization.
-                result *= getSynchronizationDecisionDiagram(generationInfo);
+                independentActionDd *= getSynchronizationDecisionDiagram(generationInfo);
+                addIndependentActionPartitions(independentActionDd.notZero());
+                result.push_back(std::move(independentActionDd));
                 
                 for (auto& synchronizingAction : synchronizingActionToDdMap) {
                     synchronizingAction.second *= getSynchronizationDecisionDiagram(generationInfo, synchronizingAction.first);
                 }
                 
-                // Now, we can simply add all synchronizing actions to the result.
-                for (auto const& synchronizingAction : synchronizingActionToDdMap) {
-                    result += synchronizingAction.second;
+                // Now, we can simply collect all synchronizing actions.
+                for (auto& synchronizingAction : synchronizingActionToDdMap) {
+                    transitionPartitions.push_back(synchronizingAction.second.notZero());
+                    result.push_back(std::move(synchronizingAction.second));
                 }
             } else if (generationInfo.program.getModelType() == storm::prism::Program::ModelType::DTMC || generationInfo.program.getModelType() == storm::prism::Program::ModelType::CTMC) {
-                // Simply add all actions, but make sure to include the missing global variable identities.
+                // Simply collect all actions, but make sure to include the missing global variable identities.
                 
                 // Compute missing global variable identities in independent action.
                 std::set<storm::expressions::Variable> missingIdentities;
@@ -1111,7 +1119,9 @@ namespace storm {
                     identityEncoding *= generationInfo.variableToIdentityMap.at(variable);
                 }
 
-                result = identityEncoding * module.independentAction.transitionsDd;
+                storm::dd::Add<Type, ValueType> independentActionDd = identityEncoding * module.independentAction.transitionsDd;
+                addIndependentActionPartitions(independentActionDd.notZero());
+                result.push_back(std::move(independentActionDd));
                 for (auto const& synchronizingAction : module.synchronizingActionToDecisionDiagramMap) {
                     // Compute missing global variable identities in synchronizing actions.
                     missingIdentities = std::set<storm::expressions::Variable>();
@@ -1122,7 +1132,9 @@ namespace storm {
                         identityEncoding *= generationInfo.variableToIdentityMap.at(variable);
                     }
                     
-                    result += identityEncoding * synchronizingAction.second.transitionsDd;
+                    storm::dd::Add<Type, ValueType> synchronizingActionDd = identityEncoding * synchronizingAction.second.transitionsDd;
+                    transitionPartitions.push_back(synchronizingActionDd.notZero());
+                    result.push_back(std::move(synchronizingActionDd));
                 }
             } else {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Illegal model type.");
@@ -1135,16 +1147,10 @@ namespace storm {
             ModuleComposer<Type, ValueType> composer(generationInfo);
             ModuleDecisionDiagram system = composer.compose(generationInfo.program.specifiesSystemComposition() ? generationInfo.program.getSystemCompositionConstruct().getSystemComposition() : *generationInfo.program.getDefaultSystemComposition());
 
-            storm::dd::Add<Type, ValueType> result = createSystemFromModule(generationInfo, system);
+            std::vector<storm::dd::Bdd<Type>> transitionPartitions;
+            std::vector<storm::dd::Add<Type, ValueType>> actionTransitionsDds = createSystemFromModule(generationInfo, system, transitionPartitions);
 
-            // Create an auxiliary DD that is used later during the construction of reward models.
-            boost::optional<storm::dd::Add<Type, ValueType>> stateActionDd;
-            
-            // For DTMCs, we normalize each row to 1 (to account for non-determinism).
-            if (generationInfo.program.getModelType() == storm::prism::Program::ModelType::DTMC) {
-                stateActionDd = result.sumAbstract(generationInfo.columnMetaVariables);
-                result = result / stateActionDd.get();
-            } else if (generationInfo.program.getModelType() == storm::prism::Program::ModelType::MDP) {
+            if (generationInfo.program.getModelType() == storm::prism::Program::ModelType::MDP) {
                 // For MDPs, we need to throw away the nondeterminism variables from the generation information that
                 // were never used.
                 for (uint_fast64_t index = system.numberOfUsedNondeterminismVariables; index < generationInfo.nondeterminismMetaVariables.size(); ++index) {
@@ -1153,7 +1159,7 @@ namespace storm {
                 generationInfo.nondeterminismMetaVariables.resize(system.numberOfUsedNondeterminismVariables);
             }
             
-            return SystemResult(result, system, stateActionDd);
+            return SystemResult(actionTransitionsDds, transitionPartitions, system);
         }
         
         template <storm::dd::DdType Type, typename ValueType>
@@ -1315,16 +1321,17 @@ namespace storm {
             
             STORM_LOG_TRACE("Building representation of program:" << std::endl << program << std::endl);
             
+            storm::utility::Stopwatch buildWatch(true);
+            
             // Start by initializing the structure used for storing all information needed during the model generation.
             // In particular, this creates the meta variables used to encode the model.
-            GenerationInformation generationInfo(program);
+            GenerationInformation generationInfo(program, options.variableOrdering);
             
             SystemResult system = createSystemDecisionDiagram(generationInfo);
-            storm::dd::Add<Type, ValueType> transitionMatrix = system.allTransitionsDd;
             
             ModuleDecisionDiagram const& globalModule = system.globalModule;
             
-            // If we were asked to treat some states as terminal states, we cut away their transitions now.
+            // Determine the states that we were asked to treat as terminal states.
             storm::dd::Bdd<Type> terminalStatesBdd = generationInfo.manager->getBddZero();
             if (!options.terminalStates.empty()) {
                 storm::expressions::Expression terminalExpression = options.terminalStates.asExpression([&program](std::string const& labelName) {
@@ -1338,24 +1345,47 @@ namespace storm {
                 });
                 terminalExpression = terminalExpression.substitute(program.getConstantsSubstitution());
                 terminalStatesBdd = generationInfo.rowExpressionAdapter->translateExpression(terminalExpression).toBdd();
-                transitionMatrix *= (!terminalStatesBdd).template toAdd<ValueType>();
             }
             
-            // Cut the transitions and rewards to the reachable fragment of the state space.
+            // Compute the reachable fragment of the state space.
             storm::dd::Bdd<Type> initialStates = createInitialStatesDecisionDiagram(generationInfo);
             
+            // Explore the state space using the transitions of the actions separately, as this avoids the images wrt.
+            // the (typically much larger) relation of the full system.
+            for (auto& partition : system.transitionPartitions) {
+                partition &= !terminalStatesBdd;
+                if (program.getModelType() == storm::prism::Program::ModelType::MDP) {
+                    partition = partition.existsAbstract(generationInfo.allNondeterminismVariables);
+                }
+            }
+            storm::dd::Bdd<Type> reachableStates = storm::utility::dd::computeReachableStates<Type>(initialStates, system.transitionPartitions, generationInfo.rowMetaVariables, generationInfo.columnMetaVariables, generationInfo.rowColumnMetaVariablePairs).first;
+            storm::dd::Add<Type, ValueType> reachableStatesAdd = reachableStates.template toAdd<ValueType>();
+            
+            // Restrict the transitions of each action to the reachable states before summing them up, so the relation
+            // of the full system is never built on the unreachable part of the state space.
+            storm::dd::Add<Type, ValueType> transitionMatrix = generationInfo.manager->template getAddZero<ValueType>();
+            for (auto const& actionTransitionsDd : system.actionTransitionsDds) {
+                transitionMatrix += actionTransitionsDd * reachableStatesAdd;
+            }
+            system.actionTransitionsDds.clear();
+            
+            // For DTMCs, we normalize each row to 1 (to account for non-determinism). The auxiliary DD is used later
+            // during the construction of reward models.
+            if (program.getModelType() == storm::prism::Program::ModelType::DTMC) {
+                system.stateActionDd = transitionMatrix.sumAbstract(generationInfo.columnMetaVariables);
+                transitionMatrix = transitionMatrix / system.stateActionDd.get();
+            }
+            
+            // If we were asked to treat some states as terminal states, we cut away their transitions now.
+            if (!options.terminalStates.empty()) {
+                transitionMatrix *= (!terminalStatesBdd).template toAdd<ValueType>();
+            }
+            
             storm::dd::Bdd<Type> transitionMatrixBdd = transitionMatrix.notZero();
             if (program.getModelType() == storm::prism::Program::ModelType::MDP) {
                 transitionMatrixBdd = transitionMatrixBdd.existsAbstract(generationInfo.allNondeterminismVariables);
             }
             
-            storm::dd::Bdd<Type> reachableStates = storm::utility::dd::computeReachableStates<Type>(initialStates, transitionMatrixBdd, generationInfo.rowMetaVariables, generationInfo.columnMetaVariables).first;
-            storm::dd::Add<Type, ValueType> reachableStatesAdd = reachableStates.template toAdd<ValueType>();
-            transitionMatrix *= reachableStatesAdd;
-            if (system.stateActionDd) {
-                system.stateActionDd.get() *= reachableStatesAdd;
-            }
-            
             // Detect deadlocks and 1) fix them if requested 2) throw an error otherwise.
             storm::dd::Bdd<Type> statesWithTransition = transitionMatrixBdd.existsAbstract(generationInfo.columnMetaVariables);
             storm::dd::Bdd<Type> deadlockStates = reachableStates && !statesWithTransition;
@@ -1445,6 +1475,9 @@ namespace storm {
                 result->addParameters(generationInfo.parameters);
             }
             
+            buildWatch.stop();
+            STORM_LOG_INFO("Built symbolic model using the " << options.variableOrdering << " variable ordering in " << buildWatch << " (peak number of DD nodes: " << generationInfo.manager->getPeakNumberOfNodes() << ", nodes of the transition matrix: " << transitionMatrix.getNodeCount() << ").");
+            
             return result;
         }
         
@@ -8,6 +8,7 @@
 #include "storm/storage/prism/Program.h"
 
 #include "storm/builder/TerminalStatesGetter.h"
+#include "storm/builder/DdVariableOrdering.h"
 
 #include "storm/logic/Formulas.h"
 #include "storm/adapters/AddExpressionAdapter.h"
@@ -93,6 +94,9 @@ namespace storm {
                 // An optional set of expression or labels that characterizes (a subset of) the terminal states of the model.
                 // If this is set, the outgoing transitions of these states are replaced with a self-loop.
                 storm::builder::TerminalStates terminalStates;
+                
+                // The heuristic that determines the order of the variables in the decision diagrams.
+                storm::builder::DdVariableOrdering variableOrdering;
             };
             
             /*!
@@ -240,7 +244,7 @@ namespace storm {
 
             static storm::dd::Add<Type, ValueType> getSynchronizationDecisionDiagram(GenerationInformation& generationInfo, uint_fast64_t actionIndex = 0);
             
-            static storm::dd::Add<Type, ValueType> createSystemFromModule(GenerationInformation& generationInfo, ModuleDecisionDiagram& module);
+            static std::vector<storm::dd::Add<Type, ValueType>> createSystemFromModule(GenerationInformation& generationInfo, ModuleDecisionDiagram& module, std::vector<storm::dd::Bdd<Type>>& transitionPartitions);
             
             static std::unordered_map<std::string, storm::models::symbolic::StandardRewardModel<Type, ValueType>> createRewardModelDecisionDiagrams(std::vector<std::reference_wrapper<storm::prism::RewardModel const>> const& selectedRewardModels, SystemResult& system, GenerationInformation& generationInfo, ModuleDecisionDiagram const& globalModule, storm::dd::Add<Type, ValueType> const& reachableStatesAdd, storm::dd::Add<Type, ValueType> const& transitionMatrix);
 
@@ -0,0 +1,215 @@
+#include "storm/builder/DdVariableOrdering.h"
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <set>
+
+#include "storm/storage/prism/Program.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/jani/Automaton.h"
+#include "storm/storage/jani/Edge.h"
+#include "storm/storage/jani/EdgeDestination.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace builder {
+        
+        std::ostream& operator<<(std::ostream& out, DdVariableOrdering const& ordering) {
+            switch (ordering) {
+                case DdVariableOrdering::Declaration:
+                    out << "declaration";
+                    break;
+                case DdVariableOrdering::Force:
+                    out << "FORCE";
+                    break;
+                default:
+                    out << "undefined";
+                    break;
+            }
+            return out;
+        }
+        
+        namespace detail {
+            uint64_t getTotalSpan(std::vector<std::vector<uint64_t>> const& hyperedges, std::vector<uint64_t> const& positions) {
+                uint64_t result = 0;
+                for (auto const& hyperedge : hyperedges) {
+                    if (hyperedge.empty()) {
+                        continue;
+                    }
+                    auto minMax = std::minmax_element(hyperedge.begin(), hyperedge.end(), [&positions] (uint64_t a, uint64_t b) { return positions[a] < positions[b]; });
+                    result += positions[*minMax.second] - positions[*minMax.first];
+                }
+                return result;
+            }
+        }
+        
+        std::vector<uint64_t> computeForceOrder(uint64_t numberOfVariables, std::vector<std::vector<uint64_t>> const& hyperedges, uint64_t maximalNumberOfIterations) {
+            std::vector<uint64_t> order(numberOfVariables);
+            std::iota(order.begin(), order.end(), 0);
+            
+            // The position of each variable in the current order.
+            std::vector<uint64_t> positions = order;
+            uint64_t bestSpan = detail::getTotalSpan(hyperedges, positions);
+            
+            std::vector<double> centersOfGravity(hyperedges.size());
+            std::vector<double> newPositions(numberOfVariables);
+            std::vector<uint64_t> numberOfHyperedges(numberOfVariables);
+            for (uint64_t iteration = 0; iteration < maximalNumberOfIterations; ++iteration) {
+                // Compute the center of gravity of each hyperedge.
+                for (uint64_t hyperedgeIndex = 0; hyperedgeIndex < hyperedges.size(); ++hyperedgeIndex) {
+                    auto const& hyperedge = hyperedges[hyperedgeIndex];
+                    double sum = 0;
+                    for (auto const& variable : hyperedge) {
+                        sum += positions[variable];
+                    }
+                    centersOfGravity[hyperedgeIndex] = hyperedge.empty() ? 0 : sum / hyperedge.size();
+                }
+                
+                // Move each variable to the average of the centers of gravity of its hyperedges. Variables that do not
+                // occur in any hyperedge keep their position.
+                std::fill(newPositions.begin(), newPositions.end(), 0.0);
+                std::fill(numberOfHyperedges.begin(), numberOfHyperedges.end(), 0);
+                for (uint64_t hyperedgeIndex = 0; hyperedgeIndex < hyperedges.size(); ++hyperedgeIndex) {
+                    for (auto const& variable : hyperedges[hyperedgeIndex]) {
+                        newPositions[variable] += centersOfGravity[hyperedgeIndex];
+                        ++numberOfHyperedges[variable];
+                    }
+                }
+                for (uint64_t variable = 0; variable < numberOfVariables; ++variable) {
+                    newPositions[variable] = numberOfHyperedges[variable] == 0 ? positions[variable] : newPositions[variable] / numberOfHyperedges[variable];
+                }
+                
+                // Derive the new order. Ties are broken by the current positions, which makes the result deterministic.
+                std::vector<uint64_t> newOrder = order;
+                std::stable_sort(newOrder.begin(), newOrder.end(), [&newPositions] (uint64_t a, uint64_t b) { return newPositions[a] < newPositions[b]; });
+                std::vector<uint64_t> newPositionsOfVariables(numberOfVariables);
+                for (uint64_t position = 0; position < numberOfVariables; ++position) {
+                    newPositionsOfVariables[newOrder[position]] = position;
+                }
+                
+                uint64_t span = detail::getTotalSpan(hyperedges, newPositionsOfVariables);
+                STORM_LOG_TRACE("FORCE iteration " << iteration << " yields a total span of " << span << ".");
+                if (span >= bestSpan) {
+                    break;
+                }
+                bestSpan = span;
+                order = std::move(newOrder);
+                positions = std::move(newPositionsOfVariables);
+            }
+            return order;
+        }
+        
+        namespace detail {
+            class HyperedgeCollector {
+            public:
+                HyperedgeCollector(std::vector<storm::expressions::Variable> const& variables) {
+                    for (uint64_t index = 0; index < variables.size(); ++index) {
+                        variableToIndex.emplace(variables[index], index);
+                    }
+                }
+            
+                void add(std::set<storm::expressions::Variable>& hyperedge, storm::expressions::Expression const& expression) const {
+                    std::set<storm::expressions::Variable> containedVariables = expression.getVariables();
+                    hyperedge.insert(containedVariables.begin(), containedVariables.end());
+                }
+            
+                void addHyperedge(std::set<storm::expressions::Variable> const& hyperedge) {
+                    std::vector<uint64_t> indices;
+                    for (auto const& variable : hyperedge) {
+                        auto it = variableToIndex.find(variable);
+                        if (it != variableToIndex.end()) {
+                            indices.push_back(it->second);
+                        }
+                    }
+                    if (indices.size() > 1) {
+                        hyperedges.push_back(std::move(indices));
+                    }
+                }
+            
+                std::vector<storm::expressions::Variable> getOrder(std::vector<storm::expressions::Variable> const& variables) const {
+                    std::vector<storm::expressions::Variable> result;
+                    for (auto const& index : computeForceOrder(variables.size(), hyperedges)) {
+                        result.push_back(variables[index]);
+                    }
+                    return result;
+                }
+            
+            private:
+                std::map<storm::expressions::Variable, uint64_t> variableToIndex;
+                std::vector<std::vector<uint64_t>> hyperedges;
+            };
+        }
+        
+        std::vector<storm::expressions::Variable> orderDdVariables(storm::prism::Program const& program, std::vector<storm::expressions::Variable> const& variables, DdVariableOrdering ordering) {
+            if (ordering == DdVariableOrdering::Declaration) {
+                return variables;
+            }
+            STORM_LOG_ASSERT(ordering == DdVariableOrdering::Force, "Unexpected variable ordering.");
+            
+            detail::HyperedgeCollector collector(variables);
+            std::map<uint64_t, std::set<storm::expressions::Variable>> actionIndexToHyperedge;
+            for (auto const& module : program.getModules()) {
+                for (auto const& command : module.getCommands()) {
+                    std::set<storm::expressions::Variable> hyperedge;
+                    collector.add(hyperedge, command.getGuardExpression());
+                    for (auto const& update : command.getUpdates()) {
+                        collector.add(hyperedge, update.getLikelihoodExpression());
+                        for (auto const& assignment : update.getAssignments()) {
+                            hyperedge.insert(assignment.getVariable());
+                            collector.add(hyperedge, assignment.getExpression());
+                        }
+                    }
+                    
+                    if (command.isLabeled()) {
+                        actionIndexToHyperedge[command.getActionIndex()].insert(hyperedge.begin(), hyperedge.end());
+                    } else {
+                        collector.addHyperedge(hyperedge);
+                    }
+                }
+            }
+            for (auto const& actionHyperedge : actionIndexToHyperedge) {
+                collector.addHyperedge(actionHyperedge.second);
+            }
+            
+            return collector.getOrder(variables);
+        }
+        
+        std::vector<storm::expressions::Variable> orderDdVariables(storm::jani::Model const& model, std::vector<storm::expressions::Variable> const& variables, DdVariableOrdering ordering) {
+            if (ordering == DdVariableOrdering::Declaration) {
+                return variables;
+            }
+            STORM_LOG_ASSERT(ordering == DdVariableOrdering::Force, "Unexpected variable ordering.");
+            
+            detail::HyperedgeCollector collector(variables);
+            std::map<uint64_t, std::set<storm::expressions::Variable>> actionIndexToHyperedge;
+            for (auto const& automaton : model.getAutomata()) {
+                for (auto const& edge : automaton.getEdges()) {
+                    std::set<storm::expressions::Variable> hyperedge;
+                    hyperedge.insert(automaton.getLocationExpressionVariable());
+                    collector.add(hyperedge, edge.getGuard());
+                    for (auto const& destination : edge.getDestinations()) {
+                        collector.add(hyperedge, destination.getProbability());
+                        for (auto const& assignment : destination.getOrderedAssignments().getNonTransientAssignments()) {
+                            hyperedge.insert(assignment.getExpressionVariable());
+                            collector.add(hyperedge, assignment.getAssignedExpression());
+                        }
+                    }
+                    
+                    if (edge.getActionIndex() != storm::jani::Model::SILENT_ACTION_INDEX) {
+                        actionIndexToHyperedge[edge.getActionIndex()].insert(hyperedge.begin(), hyperedge.end());
+                    } else {
+                        collector.addHyperedge(hyperedge);
+                    }
+                }
+            }
+            for (auto const& actionHyperedge : actionIndexToHyperedge) {
+                collector.addHyperedge(actionHyperedge.second);
+            }
+            
+            return collector.getOrder(variables);
+        }
+        
+    }
+}
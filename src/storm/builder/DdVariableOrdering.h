@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    namespace prism {
+        class Program;
+    }
+    
+    namespace jani {
+        class Model;
+    }
+    
+    namespace builder {
+        
+        // An enum that contains all currently supported heuristics for ordering the variables of symbolic models.
+        enum class DdVariableOrdering { Declaration, Force };
+        
+        std::ostream& operator<<(std::ostream& out, DdVariableOrdering const& ordering);
+        
+        /*!
+         * Orders variables using the FORCE heuristic: Every variable is repeatedly moved to the average of the centers
+         * of gravity of the hyperedges it belongs to, as long as the sum of the spans of all hyperedges decreases.
+         *
+         * @param numberOfVariables The number of variables. The initial order is given by their indices.
+         * @param hyperedges The hyperedges, each of which is a set of (indices of) variables that interact.
+         * @param maximalNumberOfIterations The maximal number of times the variables are moved.
+         * @return The indices of the variables in the computed order.
+         */
+        std::vector<uint64_t> computeForceOrder(uint64_t numberOfVariables, std::vector<std::vector<uint64_t>> const& hyperedges, uint64_t maximalNumberOfIterations = 100);
+        
+        /*!
+         * Orders the given variables of the program according to the given heuristic. For FORCE, the variables that
+         * are read or written by a command (or by all commands with the same synchronizing action) form a hyperedge.
+         *
+         * @param variables The variables in the order in which they are declared.
+         * @return The variables in the order in which they are to appear in the decision diagrams.
+         */
+        std::vector<storm::expressions::Variable> orderDdVariables(storm::prism::Program const& program, std::vector<storm::expressions::Variable> const& variables, DdVariableOrdering ordering);
+        
+        /*!
+         * Orders the given variables of the model according to the given heuristic. For FORCE, the location variable of
+         * an automaton and the variables that are read or written by an edge (or by all edges with the same non-silent
+         * action) form a hyperedge.
+         *
+         * @param variables The variables (including the location variables) in the order in which they are declared.
+         * @return The variables in the order in which they are to appear in the decision diagrams.
+         */
+        std::vector<storm::expressions::Variable> orderDdVariables(storm::jani::Model const& model, std::vector<storm::expressions::Variable> const& variables, DdVariableOrdering ordering);
+        
+    }
+}
@@ -1,5 +1,7 @@
 #include "storm/builder/jit/Choice.h"
 
+#include <algorithm>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/utility/constants.h"
@@ -36,6 +38,9 @@ namespace storm {
             template <typename IndexType, typename ValueType>
             void Choice<IndexType, ValueType>::add(Choice<IndexType, ValueType>&& choice) {
                 distribution.add(std::move(choice.getMutableDistribution()));
+                for (auto const& actionIndex : choice.getLabels()) {
+                    addLabel(actionIndex);
+                }
             }
             
             template <typename IndexType, typename ValueType>
@@ -88,6 +93,19 @@ namespace storm {
                 distribution.compress();
             }
 
+            template <typename IndexType, typename ValueType>
+            void Choice<IndexType, ValueType>::addLabel(uint64_t actionIndex) {
+                auto position = std::lower_bound(labels.begin(), labels.end(), actionIndex);
+                if (position == labels.end() || *position != actionIndex) {
+                    labels.insert(position, actionIndex);
+                }
+            }
+            
+            template <typename IndexType, typename ValueType>
+            std::vector<uint64_t> const& Choice<IndexType, ValueType>::getLabels() const {
+                return labels;
+            }
+            
             template <typename IndexType, typename ValueType>
             Distribution<IndexType, ValueType>& Choice<IndexType, ValueType>::getMutableDistribution() {
                 return distribution;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 
 #include "storm/builder/jit/Distribution.h"
 
@@ -73,6 +74,16 @@ namespace storm {
                  */
                 void compress();
                 
+                /*!
+                 * Labels this choice with the action of the given index.
+                 */
+                void addLabel(uint64_t actionIndex);
+                
+                /*!
+                 * Retrieves the (ascending) indices of the actions this choice is labeled with.
+                 */
+                std::vector<uint64_t> const& getLabels() const;
+                
             private:
                 Distribution<IndexType, ValueType>& getMutableDistribution();
 
@@ -82,6 +93,9 @@ namespace storm {
                 /// The reward values associated with this choice.
                 std::vector<ValueType> rewards;
                 
+                /// The indices of the actions this choice is labeled with.
+                std::vector<uint64_t> labels;
+                
                 /// A flag storing whether this choice is Markovian.
                 bool markovian;
             };
@@ -4,6 +4,7 @@
 #include <cstdio>
 #include <chrono>
 #include <errno.h>
+#include <iomanip>
 
 #include "storm/solver/SmtSolver.h"
 
@@ -37,6 +38,7 @@
 
 #include "storm/utility/OsDetection.h"
 #include "storm-config.h"
+#include "storm-version-info/storm-version.h"
 
 namespace storm {
     namespace builder {
@@ -137,6 +139,10 @@ namespace storm {
                 gmpIncludeDirectory = "";
 #endif
                 sparseppIncludeDirectory = STORM_BUILD_DIR "/include/resources/3rdparty/sparsepp/";
+                if (settings.isCacheDirectorySet()) {
+                    cacheDirectory = settings.getCacheDirectory();
+                }
+                libraryReusedFromCache = false;
                 
                 // Register all transient variables as transient.
                 for (auto const& variable : this->model.getGlobalVariables().getTransientVariables()) {
@@ -524,20 +530,42 @@ namespace storm {
                 }
                 STORM_LOG_TRACE("Successfully created source code for model generation: " << source);
                 
-                // (2) Write the source code to a temporary file.
-                boost::filesystem::path temporarySourceFile = writeToTemporaryFile(source);
-                
-                // (3) Compile the source code to a shared library.
-                boost::filesystem::path dynamicLibraryPath = compileToSharedLibrary(temporarySourceFile);
-                STORM_LOG_TRACE("Successfully compiled shared library.");
+                // (2) If there is a cache, look for a shared library that was compiled from the same source code.
+                boost::filesystem::path dynamicLibraryPath;
+                bool libraryIsCached = false;
+                if (cacheDirectory) {
+                    dynamicLibraryPath = getCachedLibraryPath(source);
+                    libraryIsCached = boost::filesystem::exists(dynamicLibraryPath);
+                    if (libraryIsCached) {
+                        STORM_LOG_INFO("Reusing the cached shared library " << dynamicLibraryPath << ".");
+                    }
+                }
+                libraryReusedFromCache = libraryIsCached;
                 
-                // (4) Remove the source code of the shared library we just compiled.
-                boost::filesystem::remove(temporarySourceFile);
+                if (!libraryIsCached) {
+                    // (3) Write the source code to a temporary file.
+                    boost::filesystem::path temporarySourceFile = writeToTemporaryFile(source);
+                    
+                    // (4) Compile the source code to a shared library.
+                    boost::filesystem::path compiledLibraryPath = compileToSharedLibrary(temporarySourceFile);
+                    STORM_LOG_TRACE("Successfully compiled shared library.");
+                    
+                    // (5) Remove the source code of the shared library we just compiled.
+                    boost::filesystem::remove(temporarySourceFile);
+                    
+                    // (6) Move the shared library into the cache (if any).
+                    if (cacheDirectory) {
+                        libraryIsCached = storeInCache(compiledLibraryPath, dynamicLibraryPath);
+                    }
+                    if (!libraryIsCached) {
+                        dynamicLibraryPath = compiledLibraryPath;
+                    }
+                }
                 
-                // (5) Create the builder from the shared library.
+                // (7) Create the builder from the shared library.
                 createBuilder(dynamicLibraryPath);
                 
-                // (6) Execute the build function of the builder in the shared library and build the actual model.
+                // (8) Execute the build function of the builder in the shared library and build the actual model.
                 auto start = std::chrono::high_resolution_clock::now();
                 
                 std::shared_ptr<storm::models::sparse::Model<ValueType, storm::models::sparse::StandardRewardModel<ValueType>>> sparseModel(nullptr);
@@ -553,8 +581,10 @@ namespace storm {
                 auto end = std::chrono::high_resolution_clock::now();
                 STORM_LOG_TRACE("Building model took " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
                 
-                // (7) Delete the shared library.
-                boost::filesystem::remove(dynamicLibraryPath);
+                // (9) Delete the shared library unless it is kept in the cache.
+                if (!libraryIsCached) {
+                    boost::filesystem::remove(dynamicLibraryPath);
+                }
                 
                 STORM_LOG_THROW(!error, storm::exceptions::WrongFormatException, "Model building failed. Reason: " << error.get());
                 
@@ -605,6 +635,20 @@ namespace storm {
                     list.push_back(cpptempl::data_map());
                 }
                 modelData["dontFixDeadlocks"] = cpptempl::make_data(list);
+                
+                list = cpptempl::data_list();
+                if (options.isBuildChoiceLabelsSet()) {
+                    list.push_back(cpptempl::data_map());
+                    std::map<uint64_t, std::string> actionIndexToName = model.getActionIndexToNameMap();
+                    actionIndexToName.erase(storm::jani::Model::SILENT_ACTION_INDEX);
+                    modelComponentsBuilder.registerChoiceLabels(actionIndexToName);
+                }
+                modelData["choice_labels"] = cpptempl::make_data(list);
+                list = cpptempl::data_list();
+                if (options.isBuildStateValuationsSet()) {
+                    list.push_back(cpptempl::data_map());
+                }
+                modelData["state_valuations"] = cpptempl::make_data(list);
 
                 // If we are building a possibly parametric model, we need to create the parameters.
                 if (std::is_same<storm::RationalFunction, ValueType>::value) {
@@ -713,12 +757,20 @@ namespace storm {
                 cpptempl::data_list transientRealVariables;
                 cpptempl::data_list locationVariables;
                 
+                // The non-transient variables in the order in which the generated code provides their values for the state valuations.
+                std::vector<storm::expressions::Variable> stateValuationBooleanVariables;
+                std::vector<storm::expressions::Variable> stateValuationBoundedIntegerVariables;
+                std::vector<storm::expressions::Variable> stateValuationUnboundedIntegerVariables;
+                std::vector<storm::expressions::Variable> stateValuationRealVariables;
+                std::vector<storm::expressions::Variable> stateValuationLocationVariables;
+                
                 for (auto const& variable : model.getGlobalVariables().getBooleanVariables()) {
                     cpptempl::data_map newBooleanVariable = generateBooleanVariable(variable.asBooleanVariable());
                     if (variable.isTransient()) {
                         transientBooleanVariables.push_back(newBooleanVariable);
                     } else {
                         nonTransientBooleanVariables.push_back(newBooleanVariable);
+                        stateValuationBooleanVariables.push_back(variable.getExpressionVariable());
                     }
                 }
                 for (auto const& variable : model.getGlobalVariables().getBoundedIntegerVariables()) {
@@ -727,6 +779,7 @@ namespace storm {
                         transientBoundedIntegerVariables.push_back(newBoundedIntegerVariable);
                     } else {
                         nonTransientBoundedIntegerVariables.push_back(newBoundedIntegerVariable);
+                        stateValuationBoundedIntegerVariables.push_back(variable.getExpressionVariable());
                     }
                 }
                 for (auto const& variable : model.getGlobalVariables().getUnboundedIntegerVariables()) {
@@ -735,6 +788,7 @@ namespace storm {
                         transientUnboundedIntegerVariables.push_back(newUnboundedIntegerVariable);
                     } else {
                         nonTransientUnboundedIntegerVariables.push_back(newUnboundedIntegerVariable);
+                        stateValuationUnboundedIntegerVariables.push_back(variable.getExpressionVariable());
                     }
                 }
                 for (auto const& variable : model.getGlobalVariables().getRealVariables()) {
@@ -743,6 +797,7 @@ namespace storm {
                         transientRealVariables.push_back(newRealVariable);
                     } else {
                         nonTransientRealVariables.push_back(newRealVariable);
+                        stateValuationRealVariables.push_back(variable.getExpressionVariable());
                     }
                 }
                 for (auto const& automatonRef : parallelAutomata) {
@@ -753,6 +808,7 @@ namespace storm {
                             transientBooleanVariables.push_back(newBooleanVariable);
                         } else {
                             nonTransientBooleanVariables.push_back(newBooleanVariable);
+                            stateValuationBooleanVariables.push_back(variable.getExpressionVariable());
                         }
                     }
                     for (auto const& variable : automaton.getVariables().getBoundedIntegerVariables()) {
@@ -761,6 +817,7 @@ namespace storm {
                             transientBoundedIntegerVariables.push_back(newBoundedIntegerVariable);
                         } else {
                             nonTransientBoundedIntegerVariables.push_back(newBoundedIntegerVariable);
+                            stateValuationBoundedIntegerVariables.push_back(variable.getExpressionVariable());
                         }
                     }
                     for (auto const& variable : automaton.getVariables().getUnboundedIntegerVariables()) {
@@ -769,6 +826,7 @@ namespace storm {
                             transientUnboundedIntegerVariables.push_back(newUnboundedIntegerVariable);
                         } else {
                             nonTransientUnboundedIntegerVariables.push_back(newUnboundedIntegerVariable);
+                            stateValuationUnboundedIntegerVariables.push_back(variable.getExpressionVariable());
                         }
                     }
                     for (auto const& variable : automaton.getVariables().getRealVariables()) {
@@ -777,12 +835,14 @@ namespace storm {
                             transientRealVariables.push_back(newRealVariable);
                         } else {
                             nonTransientRealVariables.push_back(newRealVariable);
+                            stateValuationRealVariables.push_back(variable.getExpressionVariable());
                         }
                     }
                     
                     // Only generate a location variable if there is more than one location for the automaton.
                     if (automaton.getNumberOfLocations() > 1) {
                         locationVariables.push_back(generateLocationVariable(automaton));
+                        stateValuationLocationVariables.push_back(getLocationVariable(automaton));
                     }
                 }
                 
@@ -800,6 +860,13 @@ namespace storm {
                 transientVariables["unboundedInteger"] = cpptempl::make_data(transientUnboundedIntegerVariables);
                 transientVariables["real"] = cpptempl::make_data(transientRealVariables);
                 modelData["transient_variables"] = transientVariables;
+                
+                if (options.isBuildStateValuationsSet()) {
+                    std::vector<storm::expressions::Variable> stateValuationIntegerVariables = std::move(stateValuationBoundedIntegerVariables);
+                    stateValuationIntegerVariables.insert(stateValuationIntegerVariables.end(), stateValuationUnboundedIntegerVariables.begin(), stateValuationUnboundedIntegerVariables.end());
+                    stateValuationIntegerVariables.insert(stateValuationIntegerVariables.end(), stateValuationLocationVariables.begin(), stateValuationLocationVariables.end());
+                    modelComponentsBuilder.registerStateValuationVariables(stateValuationBooleanVariables, stateValuationIntegerVariables, stateValuationRealVariables);
+                }
             }
             
             template <typename ValueType, typename RewardModelType>
@@ -1207,6 +1274,9 @@ namespace storm {
                         vectorSource << "rate * edge" << index << ".get().rate(in));" << std::endl;
                     } else {
                         indent(vectorSource, indentLevel + 2) << "Choice<IndexType, ValueType>& choice = behaviour.addChoice();" << std::endl;
+                        if (options.isBuildChoiceLabelsSet()) {
+                            indent(vectorSource, indentLevel + 2) << "choice.addLabel(" << model.getActionIndex(synchronizationVector.getOutput()) << "ull);" << std::endl;
+                        }
                         
                         std::stringstream tmp;
                         indent(tmp, indentLevel + 2) << "choice.resizeRewards({$edge_destination_rewards_count});" << std::endl;
@@ -1407,6 +1477,7 @@ namespace storm {
                 edgeData["name"] = automaton.getName() + "_" + std::to_string(edgeIndex);
                 edgeData["transient_assignments"] = cpptempl::make_data(edgeAssignments);
                 edgeData["markovian"] = asString(edge.hasRate());
+                edgeData["action_index"] = std::to_string(edge.getActionIndex());
                 if (edge.hasRate()) {
                     if (std::is_same<double, ValueType>::value) {
                         edgeData["rate"] = expressionTranslator.translate(shiftVariablesWrtLowerBound(edge.getRate()), storm::expressions::ToCppTranslationOptions(variablePrefixes, variableToName, storm::expressions::ToCppTranslationMode::CastDouble));
@@ -2301,6 +2372,8 @@ namespace storm {
 #ifndef NDEBUG
                                     std::cout << "finished building labeling" << std::endl;
 #endif
+                                    {% if state_valuations %}valuate();
+                                    {% endif %}
                                     
                                     return this->modelComponentsBuilder.build(stateIds.size());
                                 }
@@ -2333,6 +2406,26 @@ namespace storm {
                                     }
                                 }
                                 
+                                void valuate() {
+                                    for (auto const& stateEntry : stateIds) {
+                                        auto const& in = stateEntry.first;
+                                        std::vector<bool> booleanValues;
+                                        std::vector<int64_t> integerValues;
+                                        std::vector<double> realValues;
+                                        {% for variable in nontransient_variables.boolean %}booleanValues.push_back(in.{$variable.name});
+                                        {% endfor %}
+                                        {% for variable in nontransient_variables.boundedInteger %}integerValues.push_back(static_cast<int64_t>(in.{$variable.name}) + {$variable.lower});
+                                        {% endfor %}
+                                        {% for variable in nontransient_variables.unboundedInteger %}integerValues.push_back(static_cast<int64_t>(in.{$variable.name}));
+                                        {% endfor %}
+                                        {% for variable in nontransient_variables.locations %}integerValues.push_back(static_cast<int64_t>(in.{$variable.name}));
+                                        {% endfor %}
+                                        {% for variable in nontransient_variables.real %}realValues.push_back(static_cast<double>(in.{$variable.name}));
+                                        {% endfor %}
+                                        this->modelComponentsBuilder.addStateValuation(stateEntry.second, std::move(booleanValues), std::move(integerValues), std::move(realValues));
+                                    }
+                                }
+                                
                                 void explore(std::vector<StateType> const& initialStates) {
                                     for (auto const& state : initialStates) {
                                         explore(state);
@@ -2416,6 +2509,8 @@ namespace storm {
 #endif
                                         if ({$edge.guard}) {
                                             Choice<IndexType, ValueType>& choice = behaviour.addChoice(!model_is_deterministic() && !model_is_discrete_time() && {$edge.markovian});
+                                            {% if choice_labels %}choice.addLabel({$edge.action_index}ull);
+                                            {% endif %}
                                             choice.resizeRewards({$edge_destination_rewards_count});
                                             {
                                                 {% if exploration_checks %}VariableWrites variableWrites;
@@ -2548,6 +2643,63 @@ namespace storm {
                 return dynamicLibraryPath;
             }
             
+            template <typename ValueType, typename RewardModelType>
+            void ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::setCacheDirectory(std::string const& directory) {
+                cacheDirectory = directory;
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            bool ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::isLibraryReusedFromCache() const {
+                return libraryReusedFromCache;
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            boost::filesystem::path ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::getCachedLibraryPath(std::string const& source) const {
+                // The source code is derived from the model and the builder options, so together with the compiler
+                // invocation and the build of Storm whose headers are included, it determines the shared library. We
+                // hash all of them with 64-bit FNV-1a.
+#ifdef NDEBUG
+                std::string buildType = "release";
+#else
+                std::string buildType = "debug";
+#endif
+                uint64_t hash = 14695981039346656037ull;
+                for (std::string const& part : {source, compiler, compilerFlags, stormIncludeDirectory, sparseppIncludeDirectory, boostIncludeDirectory, carlIncludeDirectory, clnIncludeDirectory, gmpIncludeDirectory, storm::StormVersion::shortVersionString(), storm::StormVersion::gitRevisionHash, buildType}) {
+                    for (char const& character : part) {
+                        hash ^= static_cast<uint8_t>(character);
+                        hash *= 1099511628211ull;
+                    }
+                    // Separate the parts such that moving characters between them changes the hash.
+                    hash ^= 0xff;
+                    hash *= 1099511628211ull;
+                }
+                std::stringstream filename;
+                filename << "storm-jit-" << std::hex << std::setw(16) << std::setfill('0') << hash << DYLIB_EXTENSION;
+                return boost::filesystem::path(cacheDirectory.get()) / filename.str();
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            bool ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::storeInCache(boost::filesystem::path const& dynamicLibraryPath, boost::filesystem::path const& cachedLibraryPath) const {
+                // Copy the library to a unique file in the cache directory first and then rename it, so concurrent
+                // runs never load a partially written library.
+                boost::system::error_code errorCode;
+                boost::filesystem::create_directories(cachedLibraryPath.parent_path(), errorCode);
+                boost::filesystem::path temporaryPath = cachedLibraryPath.parent_path() / boost::filesystem::unique_path("%%%%-%%%%-%%%%-%%%%" + DYLIB_EXTENSION);
+                if (!errorCode) {
+                    boost::filesystem::copy_file(dynamicLibraryPath, temporaryPath, errorCode);
+                }
+                if (!errorCode) {
+                    boost::filesystem::rename(temporaryPath, cachedLibraryPath, errorCode);
+                }
+                if (errorCode) {
+                    STORM_LOG_WARN("Could not store the shared library in the cache directory: " << errorCode.message() << ".");
+                    boost::filesystem::remove(temporaryPath, errorCode);
+                    return false;
+                }
+                boost::filesystem::remove(dynamicLibraryPath);
+                return true;
+            }
+            
             template<typename RationalFunctionType, typename TP = typename RationalFunctionType::PolyType, carl::EnableIf<carl::needs_cache<TP>> = carl::dummy>
             RationalFunctionType convertVariableToPolynomial(storm::RationalFunctionVariable const& variable, std::shared_ptr<storm::RawPolynomialCache> cache) {
                 return RationalFunctionType(typename RationalFunctionType::PolyType(typename RationalFunctionType::PolyType::PolyType(variable), cache));
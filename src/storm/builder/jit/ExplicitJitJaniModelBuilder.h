@@ -76,6 +76,17 @@ namespace storm {
                  * general infrastructure for the model builder appears to be working.
                  */
                 bool doctor() const;
+                
+                /*!
+                 * Sets the directory in which the compiled shared libraries are kept, overriding the settings.
+                 */
+                void setCacheDirectory(std::string const& directory);
+                
+                /*!
+                 * Retrieves whether the last call to build() loaded a shared library from the cache instead of
+                 * compiling it.
+                 */
+                bool isLibraryReusedFromCache() const;
 
             private:
                 // Helper methods for the doctor() procedure.
@@ -152,6 +163,18 @@ namespace storm {
                  * binary file.
                  */
                 boost::filesystem::path compileToSharedLibrary(boost::filesystem::path const& sourceFile);
+                
+                /*!
+                 * Retrieves the path under which the shared library compiled from the given source code is cached.
+                 */
+                boost::filesystem::path getCachedLibraryPath(std::string const& source) const;
+                
+                /*!
+                 * Moves the given shared library to the given path in the cache.
+                 *
+                 * @return True iff the library was stored in the cache.
+                 */
+                bool storeInCache(boost::filesystem::path const& dynamicLibraryPath, boost::filesystem::path const& cachedLibraryPath) const;
 
                 /*!
                  * Loads the given shared library and creates the builder from it.
@@ -213,6 +236,12 @@ namespace storm {
                 /// The include directory for gmp
                 std::string gmpIncludeDirectory;
                 
+                /// The directory in which compiled shared libraries are kept (if any).
+                boost::optional<std::string> cacheDirectory;
+                
+                /// Whether the last build reused a shared library from the cache.
+                bool libraryReusedFromCache;
+                
                 /// A cache that is used by carl.
                 std::shared_ptr<storm::RawPolynomialCache> cache;
             };
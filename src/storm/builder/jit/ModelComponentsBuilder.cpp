@@ -6,9 +6,13 @@
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/storage/sparse/StateValuations.h"
 
 #include "storm/builder/RewardModelBuilder.h"
 
+#include "storm/adapters/RationalNumberAdapter.h"
+
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/BuildSettings.h"
 
@@ -61,6 +65,12 @@ namespace storm {
                             transitionMatrixBuilder->addNextValue(currentRow, element.getState(), element.getValue());
                         }
                         
+                        if (actionIndexToName) {
+                            for (auto const& actionIndex : choice.getLabels()) {
+                                choiceLabels.emplace_back(currentRow, actionIndex);
+                            }
+                        }
+                        
                         // Add state-action reward entries.
                         auto stateActionRewardIt = choice.getRewards().begin();
                         for (auto& rewardModelBuilder : rewardModelBuilders) {
@@ -112,29 +122,51 @@ namespace storm {
             
             template <typename IndexType, typename ValueType>
             storm::models::sparse::Model<ValueType, storm::models::sparse::StandardRewardModel<ValueType>>* ModelComponentsBuilder<IndexType, ValueType>::build(IndexType const& stateCount) {
-                storm::storage::SparseMatrix<ValueType> transitionMatrix = this->transitionMatrixBuilder->build();
+                storm::storage::sparse::ModelComponents<ValueType, storm::models::sparse::StandardRewardModel<ValueType>> components(this->transitionMatrixBuilder->build());
+                components.rateTransitions = modelType == storm::jani::ModelType::CTMC || modelType == storm::jani::ModelType::MA;
+                storm::storage::SparseMatrix<ValueType> const& transitionMatrix = components.transitionMatrix;
                 
                 // Start by building the labeling object.
-                storm::models::sparse::StateLabeling stateLabeling(stateCount);
+                components.stateLabeling = storm::models::sparse::StateLabeling(stateCount);
                 for (auto& label : labels) {
-                    stateLabeling.addLabel(label.first, std::move(label.second));
+                    components.stateLabeling.addLabel(label.first, std::move(label.second));
                 }
                 
                 // Then build all reward models.
-                std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> rewardModels;
                 for (auto& rewardModelBuilder : rewardModelBuilders) {
-                    rewardModels.emplace(rewardModelBuilder.getName(), rewardModelBuilder.build(transitionMatrix.getRowCount(), transitionMatrix.getColumnCount(), transitionMatrix.getRowGroupCount()));
+                    components.rewardModels.emplace(rewardModelBuilder.getName(), rewardModelBuilder.build(transitionMatrix.getRowCount(), transitionMatrix.getColumnCount(), transitionMatrix.getRowGroupCount()));
+                }
+                
+                if (actionIndexToName) {
+                    storm::models::sparse::ChoiceLabeling choiceLabeling(transitionMatrix.getRowCount());
+                    for (auto const& rowAndActionIndex : choiceLabels) {
+                        // Actions without a name (i.e. the silent action) do not yield a label.
+                        auto nameIt = actionIndexToName->find(rowAndActionIndex.second);
+                        if (nameIt == actionIndexToName->end()) {
+                            continue;
+                        }
+                        if (!choiceLabeling.containsLabel(nameIt->second)) {
+                            choiceLabeling.addLabel(nameIt->second);
+                        }
+                        choiceLabeling.addLabelToChoice(nameIt->second, rowAndActionIndex.first);
+                    }
+                    components.choiceLabeling = std::move(choiceLabeling);
+                }
+                
+                if (stateValuationsBuilder) {
+                    components.stateValuations = stateValuationsBuilder->build(stateCount);
                 }
                 
                 if (modelType == storm::jani::ModelType::DTMC) {
-                    return new storm::models::sparse::Dtmc<ValueType, storm::models::sparse::StandardRewardModel<ValueType>>(std::move(transitionMatrix), std::move(stateLabeling), std::move(rewardModels));
+                    return new storm::models::sparse::Dtmc<ValueType, storm::models::sparse::StandardRewardModel<ValueType>>(std::move(components));
                 } else if (modelType == storm::jani::ModelType::CTMC) {
-                    return new storm::models::sparse::Ctmc<ValueType, storm::models::sparse::StandardRewardModel<ValueType>>(std::move(transitionMatrix), std::move(stateLabeling), std::move(rewardModels));
+                    return new storm::models::sparse::Ctmc<ValueType, storm::models::sparse::StandardRewardModel<ValueType>>(std::move(components));
                 } else if (modelType == storm::jani::ModelType::MDP || modelType == storm::jani::ModelType::LTS) {
-                    return new storm::models::sparse::Mdp<ValueType, storm::models::sparse::StandardRewardModel<ValueType>>(std::move(transitionMatrix), std::move(stateLabeling), std::move(rewardModels));
+                    return new storm::models::sparse::Mdp<ValueType, storm::models::sparse::StandardRewardModel<ValueType>>(std::move(components));
                 } else if (modelType == storm::jani::ModelType::MA) {
                     markovianStates->resize(transitionMatrix.getRowGroupCount());
-                    return new storm::models::sparse::MarkovAutomaton<ValueType, storm::models::sparse::StandardRewardModel<ValueType>>(std::move(transitionMatrix), std::move(stateLabeling), std::move(*markovianStates), std::move(rewardModels));
+                    components.markovianStates = std::move(*markovianStates);
+                    return new storm::models::sparse::MarkovAutomaton<ValueType, storm::models::sparse::StandardRewardModel<ValueType>>(std::move(components));
                 } else {
                     STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Model type unsupported by JIT builder.");
                 }
@@ -155,6 +187,35 @@ namespace storm {
                 labels[labelIndex].second.set(stateId);
             }
             
+            template <typename IndexType, typename ValueType>
+            void ModelComponentsBuilder<IndexType, ValueType>::registerChoiceLabels(std::map<uint64_t, std::string> const& actionIndexToName) {
+                this->actionIndexToName = actionIndexToName;
+            }
+            
+            template <typename IndexType, typename ValueType>
+            void ModelComponentsBuilder<IndexType, ValueType>::registerStateValuationVariables(std::vector<storm::expressions::Variable> const& booleanVariables, std::vector<storm::expressions::Variable> const& integerVariables, std::vector<storm::expressions::Variable> const& realVariables) {
+                stateValuationsBuilder = std::make_unique<storm::storage::sparse::StateValuationsBuilder>();
+                for (auto const& variable : booleanVariables) {
+                    stateValuationsBuilder->addVariable(variable);
+                }
+                for (auto const& variable : integerVariables) {
+                    stateValuationsBuilder->addVariable(variable);
+                }
+                for (auto const& variable : realVariables) {
+                    stateValuationsBuilder->addVariable(variable);
+                }
+            }
+            
+            template <typename IndexType, typename ValueType>
+            void ModelComponentsBuilder<IndexType, ValueType>::addStateValuation(IndexType const& stateId, std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues, std::vector<double>&& realValues) {
+                std::vector<storm::RationalNumber> rationalValues;
+                rationalValues.reserve(realValues.size());
+                for (auto const& value : realValues) {
+                    rationalValues.push_back(storm::utility::convertNumber<storm::RationalNumber>(value));
+                }
+                stateValuationsBuilder->addState(stateId, std::move(booleanValues), std::move(integerValues), std::move(rationalValues));
+            }
+            
             template class ModelComponentsBuilder<uint32_t, double>;
             template class ModelComponentsBuilder<uint32_t, storm::RationalNumber>;
             template class ModelComponentsBuilder<uint32_t, storm::RationalFunction>;
@@ -1,6 +1,11 @@
 #pragma once
 
+#include <map>
 #include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/optional.hpp>
 
 #include "storm/builder/jit/StateBehaviour.h"
 
@@ -12,6 +17,14 @@ namespace storm {
         class SparseMatrixBuilder;
         
         class BitVector;
+        
+        namespace sparse {
+            class StateValuationsBuilder;
+        }
+    }
+    
+    namespace expressions {
+        class Variable;
     }
     
     namespace models {
@@ -49,6 +62,20 @@ namespace storm {
                 void registerLabel(std::string const& name, IndexType const& stateCount);
                 void addLabel(IndexType const& stateId, IndexType const& labelIndex);
                 
+                /*!
+                 * Enables the choice labeling. Choices are labeled with the names of the actions whose indices are
+                 * attached to them.
+                 */
+                void registerChoiceLabels(std::map<uint64_t, std::string> const& actionIndexToName);
+                
+                /*!
+                 * Enables the state valuations over the given variables. The values of every state have to be given
+                 * in the same order.
+                 */
+                void registerStateValuationVariables(std::vector<storm::expressions::Variable> const& booleanVariables, std::vector<storm::expressions::Variable> const& integerVariables, std::vector<storm::expressions::Variable> const& realVariables);
+                
+                void addStateValuation(IndexType const& stateId, std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues, std::vector<double>&& realValues);
+                
             private:
                 storm::jani::ModelType modelType;
                 bool isDeterministicModel;
@@ -61,6 +88,12 @@ namespace storm {
                 std::unique_ptr<storm::storage::SparseMatrixBuilder<ValueType>> transitionMatrixBuilder;
                 std::vector<storm::builder::RewardModelBuilder<ValueType>> rewardModelBuilders;
                 std::vector<std::pair<std::string, storm::storage::BitVector>> labels;
+                
+                // The names of the actions (if choice labels are built) and the pairs of rows and action indices.
+                boost::optional<std::map<uint64_t, std::string>> actionIndexToName;
+                std::vector<std::pair<IndexType, uint64_t>> choiceLabels;
+                
+                std::unique_ptr<storm::storage::sparse::StateValuationsBuilder> stateValuationsBuilder;
             };
             
         }
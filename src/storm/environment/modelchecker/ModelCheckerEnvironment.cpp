@@ -3,6 +3,7 @@
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BisimulationSettings.h"
 #include "storm/utility/macros.h"
 
 #include "storm/exceptions/InvalidEnvironmentException.h"
@@ -12,7 +13,7 @@
 namespace storm {
     
     ModelCheckerEnvironment::ModelCheckerEnvironment() {
-        // Intentionally left empty
+        useQuotientView = storm::settings::getModule<storm::settings::modules::BisimulationSettings>().isQuotientViewSet();
     }
     
     ModelCheckerEnvironment::~ModelCheckerEnvironment() {
@@ -26,6 +27,14 @@ namespace storm {
     MultiObjectiveModelCheckerEnvironment const& ModelCheckerEnvironment::multi() const {
         return multiObjectiveModelCheckerEnvironment.get();
     }
+    
+    bool ModelCheckerEnvironment::isUseQuotientViewSet() const {
+        return useQuotientView;
+    }
+    
+    void ModelCheckerEnvironment::setUseQuotientView(bool value) {
+        useQuotientView = value;
+    }
 }
     
 
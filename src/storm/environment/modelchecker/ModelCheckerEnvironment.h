@@ -19,10 +19,16 @@ namespace storm {
         
         MultiObjectiveModelCheckerEnvironment& multi();
         MultiObjectiveModelCheckerEnvironment const& multi() const;
-
+        
+        /*!
+         * Whether reachability probabilities on sparse models are computed on an implicit view of the bisimulation quotient.
+         */
+        bool isUseQuotientViewSet() const;
+        void setUseQuotientView(bool value);
     
     private:
         SubEnvironment<MultiObjectiveModelCheckerEnvironment> multiObjectiveModelCheckerEnvironment;
+        bool useQuotientView;
     };
 }
 
@@ -22,6 +22,7 @@ namespace storm {
         STORM_LOG_ASSERT(considerRelativeTerminationCriterion || minMaxSettings.getConvergenceCriterion() == storm::settings::modules::MinMaxEquationSolverSettings::ConvergenceCriterion::Absolute, "Unknown convergence criterion");
         multiplicationStyle = minMaxSettings.getValueIterationMultiplicationStyle();
         symmetricUpdates = minMaxSettings.isForceIntervalIterationSymmetricUpdatesSet();
+        topologicalPolicyIteration = minMaxSettings.isTopologicalPolicyIterationSet();
     }
 
     MinMaxSolverEnvironment::~MinMaxSolverEnvironment() {
@@ -81,4 +82,12 @@ namespace storm {
         symmetricUpdates = value;
     }
     
+    bool MinMaxSolverEnvironment::isTopologicalPolicyIterationSet() const {
+        return topologicalPolicyIteration;
+    }
+    
+    void MinMaxSolverEnvironment::setTopologicalPolicyIteration(bool value) {
+        topologicalPolicyIteration = value;
+    }
+    
 }
@@ -22,6 +22,8 @@ namespace storm {
         STORM_LOG_ASSERT(considerRelativeTerminationCriterion || nativeSettings.getConvergenceCriterion() == storm::settings::modules::NativeEquationSolverSettings::ConvergenceCriterion::Absolute, "Unknown convergence criterion");
         powerMethodMultiplicationStyle = nativeSettings.getPowerMethodMultiplicationStyle();
         sorOmega = storm::utility::convertNumber<storm::RationalNumber>(nativeSettings.getOmega());
+        restartThreshold = nativeSettings.getRestartIterationCount();
+        preconditioner = nativeSettings.getPreconditioningMethod();
         symmetricUpdates = nativeSettings.isForceIntervalIterationSymmetricUpdatesSet();
 
     }
@@ -83,6 +85,22 @@ namespace storm {
         sorOmega = value;
     }
 
+    uint64_t const& NativeSolverEnvironment::getRestartThreshold() const {
+        return restartThreshold;
+    }
+    
+    void NativeSolverEnvironment::setRestartThreshold(uint64_t value) {
+        restartThreshold = value;
+    }
+    
+    storm::solver::NativeLinearEquationSolverPreconditioner const& NativeSolverEnvironment::getPreconditioner() const {
+        return preconditioner;
+    }
+    
+    void NativeSolverEnvironment::setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner value) {
+        preconditioner = value;
+    }
+    
     bool NativeSolverEnvironment::isSymmetricUpdatesSet() const {
         return symmetricUpdates;
     }
@@ -27,6 +27,10 @@ namespace storm {
         void setPowerMethodMultiplicationStyle(storm::solver::MultiplicationStyle value);
         storm::RationalNumber const& getSorOmega() const;
         void setSorOmega(storm::RationalNumber const& value);
+        uint64_t const& getRestartThreshold() const;
+        void setRestartThreshold(uint64_t value);
+        storm::solver::NativeLinearEquationSolverPreconditioner const& getPreconditioner() const;
+        void setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner value);
         bool isSymmetricUpdatesSet() const;
         void setSymmetricUpdates(bool value);
         
@@ -38,6 +42,8 @@ namespace storm {
         bool considerRelativeTerminationCriterion;
         storm::solver::MultiplicationStyle powerMethodMultiplicationStyle;
         storm::RationalNumber sorOmega;
+        uint64_t restartThreshold;
+        storm::solver::NativeLinearEquationSolverPreconditioner preconditioner;
         bool symmetricUpdates;
     };
 }
@@ -0,0 +1,273 @@
+#include "storm/generator/CompiledStateExpression.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace generator {
+
+        bool CompiledStateExpression::evaluateAsBool(CompressedState const& state) const {
+            return execute(state, 0, instructions.size(), 0) == 1.0;
+        }
+
+        int64_t CompiledStateExpression::evaluateAsInt(CompressedState const& state) const {
+            return static_cast<int64_t>(execute(state, 0, instructions.size(), 0));
+        }
+
+        double CompiledStateExpression::evaluateAsDouble(CompressedState const& state) const {
+            return execute(state, 0, instructions.size(), 0);
+        }
+
+        uint64_t CompiledStateExpression::getNumberOfInstructions() const {
+            return instructions.size();
+        }
+
+        double CompiledStateExpression::execute(CompressedState const& state, uint64_t begin, uint64_t end, uint64_t resultRegister) const {
+            double stackRegisters[MAXIMAL_NUMBER_OF_STACK_REGISTERS];
+            double* reg = stackRegisters;
+            if (numberOfRegisters > MAXIMAL_NUMBER_OF_STACK_REGISTERS) {
+                // Deeply nested expressions use a buffer of the calling thread instead.
+                thread_local std::vector<double> heapRegisters;
+                if (heapRegisters.size() < numberOfRegisters) {
+                    heapRegisters.resize(numberOfRegisters);
+                }
+                reg = heapRegisters.data();
+            }
+            uint64_t position = begin;
+            while (position < end) {
+                Instruction const& instruction = instructions[position];
+                ++position;
+                switch (instruction.opCode) {
+                    case OpCode::LoadConstant: reg[instruction.target] = instruction.value; break;
+                    case OpCode::LoadBoolean: reg[instruction.target] = state.get(instruction.first) ? 1.0 : 0.0; break;
+                    case OpCode::LoadInteger: reg[instruction.target] = static_cast<double>(state.getAsInt(instruction.first, instruction.second)) + instruction.value; break;
+                    case OpCode::Not: reg[instruction.target] = reg[instruction.first] == 0.0 ? 1.0 : 0.0; break;
+                    case OpCode::Negate: reg[instruction.target] = -reg[instruction.first]; break;
+                    case OpCode::Floor: reg[instruction.target] = std::floor(reg[instruction.first]); break;
+                    case OpCode::Ceil: reg[instruction.target] = std::ceil(reg[instruction.first]); break;
+                    case OpCode::Add: reg[instruction.target] = reg[instruction.first] + reg[instruction.second]; break;
+                    case OpCode::Subtract: reg[instruction.target] = reg[instruction.first] - reg[instruction.second]; break;
+                    case OpCode::Multiply: reg[instruction.target] = reg[instruction.first] * reg[instruction.second]; break;
+                    case OpCode::Divide: reg[instruction.target] = reg[instruction.first] / reg[instruction.second]; break;
+                    case OpCode::Modulo: reg[instruction.target] = std::fmod(reg[instruction.first], reg[instruction.second]); break;
+                    case OpCode::Power: reg[instruction.target] = std::pow(reg[instruction.first], reg[instruction.second]); break;
+                    case OpCode::Minimum: reg[instruction.target] = std::min(reg[instruction.first], reg[instruction.second]); break;
+                    case OpCode::Maximum: reg[instruction.target] = std::max(reg[instruction.first], reg[instruction.second]); break;
+                    case OpCode::Equal: reg[instruction.target] = reg[instruction.first] == reg[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::NotEqual: reg[instruction.target] = reg[instruction.first] != reg[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::Less: reg[instruction.target] = reg[instruction.first] < reg[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::LessOrEqual: reg[instruction.target] = reg[instruction.first] <= reg[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::Greater: reg[instruction.target] = reg[instruction.first] > reg[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::GreaterOrEqual: reg[instruction.target] = reg[instruction.first] >= reg[instruction.second] ? 1.0 : 0.0; break;
+                    case OpCode::Xor: reg[instruction.target] = (reg[instruction.first] != 0.0) != (reg[instruction.second] != 0.0) ? 1.0 : 0.0; break;
+                    case OpCode::Jump: position = instruction.first; break;
+                    case OpCode::JumpIfZero: if (reg[instruction.target] == 0.0) { position = instruction.first; } break;
+                    case OpCode::JumpIfNonZero: if (reg[instruction.target] != 0.0) { position = instruction.first; } break;
+                }
+            }
+            return reg[resultRegister];
+        }
+
+        StateExpressionCompiler::StateExpressionCompiler(VariableInformation const& variableInformation) {
+            for (auto const& locationVariable : variableInformation.locationVariables) {
+                variableLocations[locationVariable.variable] = {false, locationVariable.bitOffset, locationVariable.bitWidth, 0};
+            }
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                variableLocations[booleanVariable.variable] = {true, booleanVariable.bitOffset, 1, 0};
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                variableLocations[integerVariable.variable] = {false, integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound};
+            }
+        }
+
+        bool StateExpressionCompiler::canCompile(storm::expressions::Expression const& expression) const {
+            for (auto const& variable : expression.getVariables()) {
+                if (variableLocations.count(variable) == 0) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        CompiledStateExpression StateExpressionCompiler::compile(storm::expressions::Expression const& expression) {
+            result = CompiledStateExpression();
+            compileInto(expression.getBaseExpression(), 0);
+            return std::move(result);
+        }
+
+        bool StateExpressionCompiler::compileInto(storm::expressions::BaseExpression const& expression, uint32_t targetRegister) {
+            uint64_t begin = result.instructions.size();
+            bool readsVariable = boost::any_cast<bool>(expression.accept(*this, targetRegister));
+            if (!readsVariable && result.instructions.size() > begin + 1) {
+                // Fold the subexpression into a single constant.
+                double value = result.execute(CompressedState(), begin, result.instructions.size(), targetRegister);
+                result.instructions.resize(begin);
+                addInstruction(OpCode::LoadConstant, targetRegister, 0, 0, value);
+            }
+            return readsVariable;
+        }
+
+        bool StateExpressionCompiler::compileBinary(OpCode opCode, storm::expressions::BaseExpression const& firstOperand, storm::expressions::BaseExpression const& secondOperand, uint32_t targetRegister) {
+            bool readsVariable = compileInto(firstOperand, targetRegister);
+            readsVariable |= compileInto(secondOperand, targetRegister + 1);
+            addInstruction(opCode, targetRegister, targetRegister, targetRegister + 1);
+            return readsVariable;
+        }
+
+        void StateExpressionCompiler::addInstruction(OpCode opCode, uint32_t target, uint64_t first, uint64_t second, double value) {
+            result.instructions.push_back({opCode, target, first, second, value});
+            // Binary operations also access the register after the target register.
+            result.numberOfRegisters = std::max<uint64_t>(result.numberOfRegisters, target + 2);
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::IfThenElseExpression const& expression, boost::any const& data) {
+            uint32_t targetRegister = boost::any_cast<uint32_t>(data);
+            bool readsVariable = compileInto(*expression.getCondition(), targetRegister);
+            uint64_t jumpToElse = result.instructions.size();
+            addInstruction(OpCode::JumpIfZero, targetRegister);
+            readsVariable |= compileInto(*expression.getThenExpression(), targetRegister);
+            uint64_t jumpToEnd = result.instructions.size();
+            addInstruction(OpCode::Jump, targetRegister);
+            result.instructions[jumpToElse].first = result.instructions.size();
+            readsVariable |= compileInto(*expression.getElseExpression(), targetRegister);
+            result.instructions[jumpToEnd].first = result.instructions.size();
+            return readsVariable;
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const& data) {
+            uint32_t targetRegister = boost::any_cast<uint32_t>(data);
+            typedef storm::expressions::BinaryBooleanFunctionExpression::OperatorType OperatorType;
+            switch (expression.getOperatorType()) {
+                case OperatorType::And:
+                case OperatorType::Or:
+                case OperatorType::Implies: {
+                    // These operators are evaluated lazily: The second operand is skipped if the first one determines the result.
+                    bool readsVariable = compileInto(*expression.getFirstOperand(), targetRegister);
+                    if (expression.getOperatorType() == OperatorType::Implies) {
+                        addInstruction(OpCode::Not, targetRegister, targetRegister);
+                    }
+                    uint64_t jump = result.instructions.size();
+                    addInstruction(expression.getOperatorType() == OperatorType::And ? OpCode::JumpIfZero : OpCode::JumpIfNonZero, targetRegister);
+                    readsVariable |= compileInto(*expression.getSecondOperand(), targetRegister);
+                    result.instructions[jump].first = result.instructions.size();
+                    return readsVariable;
+                }
+                case OperatorType::Xor:
+                    return compileBinary(OpCode::Xor, *expression.getFirstOperand(), *expression.getSecondOperand(), targetRegister);
+                case OperatorType::Iff:
+                    return compileBinary(OpCode::Equal, *expression.getFirstOperand(), *expression.getSecondOperand(), targetRegister);
+                default:
+                    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Unknown boolean operator in expression " << expression << ".");
+            }
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const& data) {
+            uint32_t targetRegister = boost::any_cast<uint32_t>(data);
+            typedef storm::expressions::BinaryNumericalFunctionExpression::OperatorType OperatorType;
+            OpCode opCode;
+            switch (expression.getOperatorType()) {
+                case OperatorType::Plus: opCode = OpCode::Add; break;
+                case OperatorType::Minus: opCode = OpCode::Subtract; break;
+                case OperatorType::Times: opCode = OpCode::Multiply; break;
+                case OperatorType::Divide: opCode = OpCode::Divide; break;
+                case OperatorType::Min: opCode = OpCode::Minimum; break;
+                case OperatorType::Max: opCode = OpCode::Maximum; break;
+                case OperatorType::Power: opCode = OpCode::Power; break;
+                case OperatorType::Modulo: opCode = OpCode::Modulo; break;
+                default: STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Unknown numerical operator in expression " << expression << ".");
+            }
+            return compileBinary(opCode, *expression.getFirstOperand(), *expression.getSecondOperand(), targetRegister);
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const& data) {
+            uint32_t targetRegister = boost::any_cast<uint32_t>(data);
+            typedef storm::expressions::BinaryRelationExpression::RelationType RelationType;
+            OpCode opCode;
+            switch (expression.getRelationType()) {
+                case RelationType::Equal: opCode = OpCode::Equal; break;
+                case RelationType::NotEqual: opCode = OpCode::NotEqual; break;
+                case RelationType::Less: opCode = OpCode::Less; break;
+                case RelationType::LessOrEqual: opCode = OpCode::LessOrEqual; break;
+                case RelationType::Greater: opCode = OpCode::Greater; break;
+                case RelationType::GreaterOrEqual: opCode = OpCode::GreaterOrEqual; break;
+                default: STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Unknown relation in expression " << expression << ".");
+            }
+            return compileBinary(opCode, *expression.getFirstOperand(), *expression.getSecondOperand(), targetRegister);
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::VariableExpression const& expression, boost::any const& data) {
+            uint32_t targetRegister = boost::any_cast<uint32_t>(data);
+            auto locationIt = variableLocations.find(expression.getVariable());
+            STORM_LOG_THROW(locationIt != variableLocations.end(), storm::exceptions::NotSupportedException, "Variable '" << expression.getVariableName() << "' is not stored in the state and can therefore not be compiled.");
+            VariableLocation const& location = locationIt->second;
+            if (location.isBoolean) {
+                addInstruction(OpCode::LoadBoolean, targetRegister, location.bitOffset);
+            } else if (location.bitWidth == 0) {
+                // Variables without bits (e.g. the location variable of an automaton with a single location) are always zero.
+                addInstruction(OpCode::LoadConstant, targetRegister, 0, 0, 0.0);
+            } else {
+                addInstruction(OpCode::LoadInteger, targetRegister, location.bitOffset, location.bitWidth, static_cast<double>(location.lowerBound));
+            }
+            return true;
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const& data) {
+            uint32_t targetRegister = boost::any_cast<uint32_t>(data);
+            bool readsVariable = compileInto(*expression.getOperand(), targetRegister);
+            addInstruction(OpCode::Not, targetRegister, targetRegister);
+            return readsVariable;
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const& data) {
+            uint32_t targetRegister = boost::any_cast<uint32_t>(data);
+            typedef storm::expressions::UnaryNumericalFunctionExpression::OperatorType OperatorType;
+            bool readsVariable = compileInto(*expression.getOperand(), targetRegister);
+            switch (expression.getOperatorType()) {
+                case OperatorType::Minus: addInstruction(OpCode::Negate, targetRegister, targetRegister); break;
+                case OperatorType::Floor: addInstruction(OpCode::Floor, targetRegister, targetRegister); break;
+                case OperatorType::Ceil: addInstruction(OpCode::Ceil, targetRegister, targetRegister); break;
+            }
+            return readsVariable;
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::BooleanLiteralExpression const& expression, boost::any const& data) {
+            addInstruction(OpCode::LoadConstant, boost::any_cast<uint32_t>(data), 0, 0, expression.getValue() ? 1.0 : 0.0);
+            return false;
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const& data) {
+            addInstruction(OpCode::LoadConstant, boost::any_cast<uint32_t>(data), 0, 0, static_cast<double>(expression.getValue()));
+            return false;
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::RationalLiteralExpression const& expression, boost::any const& data) {
+            addInstruction(OpCode::LoadConstant, boost::any_cast<uint32_t>(data), 0, 0, expression.getValueAsDouble());
+            return false;
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::PredicateExpression const& expression, boost::any const& data) {
+            uint32_t targetRegister = boost::any_cast<uint32_t>(data);
+            // Count the operands that are true and compare the count with one.
+            bool readsVariable = false;
+            addInstruction(OpCode::LoadConstant, targetRegister, 0, 0, 0.0);
+            for (uint64_t operand = 0; operand < expression.getArity(); ++operand) {
+                readsVariable |= compileInto(*expression.getOperand(operand), targetRegister + 1);
+                addInstruction(OpCode::Add, targetRegister, targetRegister, targetRegister + 1);
+            }
+            addInstruction(OpCode::LoadConstant, targetRegister + 1, 0, 0, 1.0);
+            typedef storm::expressions::PredicateExpression::PredicateType PredicateType;
+            switch (expression.getPredicateType()) {
+                case PredicateType::AtLeastOneOf: addInstruction(OpCode::GreaterOrEqual, targetRegister, targetRegister, targetRegister + 1); break;
+                case PredicateType::AtMostOneOf: addInstruction(OpCode::LessOrEqual, targetRegister, targetRegister, targetRegister + 1); break;
+                case PredicateType::ExactlyOneOf: addInstruction(OpCode::Equal, targetRegister, targetRegister, targetRegister + 1); break;
+            }
+            return readsVariable;
+        }
+    }
+}
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/any.hpp>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/ExpressionVisitor.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    namespace generator {
+        struct VariableInformation;
+
+        /*!
+         * An expression that was compiled to a register-based bytecode which reads the values of the variables directly
+         * from a compressed state. Hence, evaluating the expression does not require unpacking the state into an evaluator.
+         *
+         * All values are represented as doubles (booleans as 0 and 1) and the operators are evaluated like the Exprtk-based
+         * ExpressionEvaluator<double> does, so both yield the same results.
+         */
+        class CompiledStateExpression {
+        public:
+            CompiledStateExpression() = default;
+
+            /*!
+             * Evaluates the (boolean) expression in the given state.
+             */
+            bool evaluateAsBool(CompressedState const& state) const;
+
+            /*!
+             * Evaluates the (integer) expression in the given state.
+             */
+            int64_t evaluateAsInt(CompressedState const& state) const;
+
+            /*!
+             * Evaluates the expression in the given state.
+             */
+            double evaluateAsDouble(CompressedState const& state) const;
+
+            /*!
+             * Retrieves the number of instructions of the bytecode.
+             */
+            uint64_t getNumberOfInstructions() const;
+
+        private:
+            friend class StateExpressionCompiler;
+
+            enum class OpCode : uint8_t {
+                LoadConstant, LoadBoolean, LoadInteger,
+                Not, Negate, Floor, Ceil,
+                Add, Subtract, Multiply, Divide, Modulo, Power, Minimum, Maximum,
+                Equal, NotEqual, Less, LessOrEqual, Greater, GreaterOrEqual, Xor,
+                Jump, JumpIfZero, JumpIfNonZero
+            };
+
+            struct Instruction {
+                OpCode opCode;
+                // The register the result is written to.
+                uint32_t target;
+                // The operand registers. For loads, these are the bit offset and width. For jumps, the first one is the jump target.
+                uint64_t first;
+                uint64_t second;
+                // The constant for LoadConstant and the lower bound for LoadInteger.
+                double value;
+            };
+
+            /*!
+             * Executes the instructions in the range [begin, end) and returns the value of the given register.
+             */
+            double execute(CompressedState const& state, uint64_t begin, uint64_t end, uint64_t resultRegister) const;
+
+            // Expressions using at most this many registers are evaluated with registers on the stack.
+            static const uint64_t MAXIMAL_NUMBER_OF_STACK_REGISTERS = 64;
+
+            std::vector<Instruction> instructions;
+            // The number of registers that are used. The result is always stored in the first one. The registers only
+            // exist during an evaluation, so evaluations may run concurrently.
+            uint64_t numberOfRegisters = 1;
+        };
+
+        /*!
+         * Compiles expressions over the variables of a model to bytecode that operates on the compressed states of the model.
+         */
+        class StateExpressionCompiler : public storm::expressions::ExpressionVisitor {
+        public:
+            /*!
+             * Creates a compiler for states whose variables are packed as described by the given variable information.
+             */
+            StateExpressionCompiler(VariableInformation const& variableInformation);
+
+            /*!
+             * Checks whether the given expression can be compiled, i.e., whether all its variables are stored in the states.
+             */
+            bool canCompile(storm::expressions::Expression const& expression) const;
+
+            /*!
+             * Compiles the given expression. Subexpressions without variables are folded into constants.
+             * @pre canCompile(expression)
+             */
+            CompiledStateExpression compile(storm::expressions::Expression const& expression);
+
+            virtual boost::any visit(storm::expressions::IfThenElseExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::VariableExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::BooleanLiteralExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::RationalLiteralExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::PredicateExpression const& expression, boost::any const& data) override;
+
+        private:
+            typedef CompiledStateExpression::OpCode OpCode;
+
+            // Describes where the value of a variable is stored in the state.
+            struct VariableLocation {
+                bool isBoolean;
+                uint64_t bitOffset;
+                uint64_t bitWidth;
+                int64_t lowerBound;
+            };
+
+            /*!
+             * Compiles the given subexpression such that its value is stored in the given register. Registers with larger
+             * indices may be used for intermediate results.
+             * @return True iff the subexpression reads a variable.
+             */
+            bool compileInto(storm::expressions::BaseExpression const& expression, uint32_t targetRegister);
+
+            /*!
+             * Compiles a binary operation on the two given operands.
+             */
+            bool compileBinary(OpCode opCode, storm::expressions::BaseExpression const& firstOperand, storm::expressions::BaseExpression const& secondOperand, uint32_t targetRegister);
+
+            void addInstruction(OpCode opCode, uint32_t target, uint64_t first = 0, uint64_t second = 0, double value = 0.0);
+
+            std::unordered_map<storm::expressions::Variable, VariableLocation> variableLocations;
+
+            // The expression that is currently compiled.
+            CompiledStateExpression result;
+        };
+    }
+}
@@ -0,0 +1,245 @@
+#include "storm/generator/GuardIndex.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace generator {
+
+        // Only variables with at most this many values are branched over.
+        static const uint64_t maximalNumberOfValues = 1024;
+        // Sets of at most this many guards are not split any further.
+        static const uint64_t minimalNumberOfGuardsToSplit = 8;
+        static const uint64_t maximalDepth = 4;
+        static const uint64_t maximalNumberOfNodes = 1ull << 14;
+        // A split is only performed if the expected number of candidates drops below this fraction.
+        static const double splitThreshold = 0.75;
+
+        GuardIndex::GuardIndex(VariableInformation const& variableInformation, std::vector<storm::expressions::Expression> const& guards) {
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                variableToSplitVariableIndex.emplace(booleanVariable.variable, splitVariables.size());
+                splitVariables.push_back(SplitVariable{true, booleanVariable.bitOffset, 1, 0, 1});
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                if (integerVariable.upperBound >= integerVariable.lowerBound && static_cast<uint64_t>(integerVariable.upperBound - integerVariable.lowerBound) < maximalNumberOfValues) {
+                    variableToSplitVariableIndex.emplace(integerVariable.variable, splitVariables.size());
+                    splitVariables.push_back(SplitVariable{false, integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound, integerVariable.upperBound});
+                }
+            }
+
+            guardConstraints.resize(guards.size());
+            std::vector<uint64_t> satisfiableGuards;
+            for (uint64_t guardIndex = 0; guardIndex < guards.size(); ++guardIndex) {
+                addConstraints(guards[guardIndex], guardConstraints[guardIndex]);
+                bool satisfiable = true;
+                for (auto const& constraint : guardConstraints[guardIndex]) {
+                    satisfiable &= constraint.second.lower <= constraint.second.upper;
+                }
+                if (satisfiable) {
+                    satisfiableGuards.push_back(guardIndex);
+                }
+            }
+
+            // The first candidate set contains all guards and is shared by the children for values outside the variable ranges.
+            candidateSets.push_back(satisfiableGuards);
+            nodes.resize(1);
+            std::vector<bool> usedVariables(splitVariables.size(), false);
+            buildNode(satisfiableGuards, usedVariables, 0, 0);
+
+            // The constraints are no longer needed.
+            guardConstraints.clear();
+            guardConstraints.shrink_to_fit();
+            STORM_LOG_TRACE("Built guard index with " << nodes.size() << " nodes for " << guards.size() << " guards.");
+        }
+
+        std::vector<uint64_t> const& GuardIndex::getCandidates(CompressedState const& state) const {
+            STORM_LOG_ASSERT(!nodes.empty(), "Guard index is not initialized.");
+            Node const* node = &nodes.front();
+            while (!node->isLeaf) {
+                SplitVariable const& variable = node->variable;
+                int64_t value = variable.isBoolean ? (state.get(variable.bitOffset) ? 1 : 0) : static_cast<int64_t>(state.getAsInt(variable.bitOffset, variable.bitWidth)) + variable.lowerBound;
+                uint64_t childOffset = static_cast<uint64_t>(variable.upperBound - variable.lowerBound) + 1;
+                if (value >= variable.lowerBound && value <= variable.upperBound) {
+                    childOffset = static_cast<uint64_t>(value - variable.lowerBound);
+                }
+                node = &nodes[node->firstChild + childOffset];
+            }
+            return candidateSets[node->candidateSet];
+        }
+
+        uint64_t GuardIndex::getNumberOfNodes() const {
+            return nodes.size();
+        }
+
+        void GuardIndex::addConstraints(storm::expressions::Expression const& guard, std::unordered_map<uint64_t, Interval>& constraints) const {
+            if (guard.isVariable()) {
+                auto variableIt = variableToSplitVariableIndex.find(guard.getBaseExpression().asVariableExpression().getVariable());
+                if (variableIt != variableToSplitVariableIndex.end() && splitVariables[variableIt->second].isBoolean) {
+                    restrict(constraints, variableIt->second, 1, 1);
+                }
+                return;
+            }
+            if (!guard.isFunctionApplication()) {
+                return;
+            }
+
+            storm::expressions::OperatorType op = guard.getOperator();
+            if (op == storm::expressions::OperatorType::And) {
+                addConstraints(guard.getOperand(0), constraints);
+                addConstraints(guard.getOperand(1), constraints);
+            } else if (op == storm::expressions::OperatorType::Not) {
+                storm::expressions::Expression operand = guard.getOperand(0);
+                if (operand.isVariable()) {
+                    auto variableIt = variableToSplitVariableIndex.find(operand.getBaseExpression().asVariableExpression().getVariable());
+                    if (variableIt != variableToSplitVariableIndex.end() && splitVariables[variableIt->second].isBoolean) {
+                        restrict(constraints, variableIt->second, 0, 0);
+                    }
+                }
+            } else if (guard.getArity() == 2 && (guard.isRelationalExpression() || op == storm::expressions::OperatorType::Iff)) {
+                // Bring the relation into the form 'variable op constant'.
+                storm::expressions::Expression variableOperand = guard.getOperand(0);
+                storm::expressions::Expression constantOperand = guard.getOperand(1);
+                if (!variableOperand.isVariable()) {
+                    std::swap(variableOperand, constantOperand);
+                    switch (op) {
+                        case storm::expressions::OperatorType::Less: op = storm::expressions::OperatorType::Greater; break;
+                        case storm::expressions::OperatorType::LessOrEqual: op = storm::expressions::OperatorType::GreaterOrEqual; break;
+                        case storm::expressions::OperatorType::Greater: op = storm::expressions::OperatorType::Less; break;
+                        case storm::expressions::OperatorType::GreaterOrEqual: op = storm::expressions::OperatorType::LessOrEqual; break;
+                        default: break;
+                    }
+                }
+                if (!variableOperand.isVariable() || constantOperand.containsVariables()) {
+                    return;
+                }
+                auto variableIt = variableToSplitVariableIndex.find(variableOperand.getBaseExpression().asVariableExpression().getVariable());
+                if (variableIt == variableToSplitVariableIndex.end()) {
+                    return;
+                }
+
+                int64_t const minValue = std::numeric_limits<int64_t>::min();
+                int64_t const maxValue = std::numeric_limits<int64_t>::max();
+                if (splitVariables[variableIt->second].isBoolean) {
+                    if (!constantOperand.hasBooleanType()) {
+                        return;
+                    }
+                    int64_t value = constantOperand.evaluateAsBool() ? 1 : 0;
+                    if (op == storm::expressions::OperatorType::Equal || op == storm::expressions::OperatorType::Iff) {
+                        restrict(constraints, variableIt->second, value, value);
+                    } else if (op == storm::expressions::OperatorType::NotEqual) {
+                        restrict(constraints, variableIt->second, 1 - value, 1 - value);
+                    }
+                } else {
+                    if (!constantOperand.hasIntegerType()) {
+                        return;
+                    }
+                    int64_t value = constantOperand.evaluateAsInt();
+                    switch (op) {
+                        case storm::expressions::OperatorType::Equal: restrict(constraints, variableIt->second, value, value); break;
+                        case storm::expressions::OperatorType::Less: restrict(constraints, variableIt->second, minValue, value - 1); break;
+                        case storm::expressions::OperatorType::LessOrEqual: restrict(constraints, variableIt->second, minValue, value); break;
+                        case storm::expressions::OperatorType::Greater: restrict(constraints, variableIt->second, value + 1, maxValue); break;
+                        case storm::expressions::OperatorType::GreaterOrEqual: restrict(constraints, variableIt->second, value, maxValue); break;
+                        default: break;
+                    }
+                }
+            }
+        }
+
+        void GuardIndex::restrict(std::unordered_map<uint64_t, Interval>& constraints, uint64_t variableIndex, int64_t lower, int64_t upper) const {
+            SplitVariable const& variable = splitVariables[variableIndex];
+            auto constraintIt = constraints.emplace(variableIndex, Interval{variable.lowerBound, variable.upperBound}).first;
+            constraintIt->second.lower = std::max(constraintIt->second.lower, lower);
+            constraintIt->second.upper = std::min(constraintIt->second.upper, upper);
+        }
+
+        GuardIndex::Interval GuardIndex::getInterval(uint64_t guardIndex, uint64_t variableIndex) const {
+            auto const& constraints = guardConstraints[guardIndex];
+            auto constraintIt = constraints.find(variableIndex);
+            if (constraintIt == constraints.end()) {
+                return Interval{splitVariables[variableIndex].lowerBound, splitVariables[variableIndex].upperBound};
+            }
+            return constraintIt->second;
+        }
+
+        void GuardIndex::buildNode(std::vector<uint64_t> const& guards, std::vector<bool>& usedVariables, uint64_t depth, uint64_t nodeIndex) {
+            if (guards.size() < minimalNumberOfGuardsToSplit || depth >= maximalDepth || nodes.size() >= maximalNumberOfNodes) {
+                makeLeaf(guards, nodeIndex);
+                return;
+            }
+
+            // Pick the variable that minimizes the number of candidates, averaged over the values of the variable.
+            uint64_t bestVariable = splitVariables.size();
+            double bestCost = splitThreshold * static_cast<double>(guards.size());
+            std::vector<int64_t> numberOfCandidatesChange;
+            for (uint64_t variableIndex = 0; variableIndex < splitVariables.size(); ++variableIndex) {
+                if (usedVariables[variableIndex]) {
+                    continue;
+                }
+                SplitVariable const& variable = splitVariables[variableIndex];
+                uint64_t numberOfValues = static_cast<uint64_t>(variable.upperBound - variable.lowerBound) + 1;
+                numberOfCandidatesChange.assign(numberOfValues + 1, 0);
+                for (auto guard : guards) {
+                    Interval interval = getInterval(guard, variableIndex);
+                    if (interval.lower <= interval.upper) {
+                        ++numberOfCandidatesChange[interval.lower - variable.lowerBound];
+                        --numberOfCandidatesChange[interval.upper - variable.lowerBound + 1];
+                    }
+                }
+                int64_t numberOfCandidates = 0;
+                int64_t totalNumberOfCandidates = 0;
+                for (uint64_t valueOffset = 0; valueOffset < numberOfValues; ++valueOffset) {
+                    numberOfCandidates += numberOfCandidatesChange[valueOffset];
+                    totalNumberOfCandidates += numberOfCandidates;
+                }
+                double cost = static_cast<double>(totalNumberOfCandidates) / static_cast<double>(numberOfValues);
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestVariable = variableIndex;
+                }
+            }
+
+            if (bestVariable == splitVariables.size()) {
+                makeLeaf(guards, nodeIndex);
+                return;
+            }
+
+            SplitVariable const variable = splitVariables[bestVariable];
+            uint64_t numberOfValues = static_cast<uint64_t>(variable.upperBound - variable.lowerBound) + 1;
+            uint64_t firstChild = nodes.size();
+            nodes[nodeIndex].isLeaf = false;
+            nodes[nodeIndex].variable = variable;
+            nodes[nodeIndex].firstChild = firstChild;
+            nodes.resize(nodes.size() + numberOfValues + 1);
+
+            usedVariables[bestVariable] = true;
+            std::vector<uint64_t> childGuards;
+            for (uint64_t valueOffset = 0; valueOffset < numberOfValues; ++valueOffset) {
+                int64_t value = variable.lowerBound + static_cast<int64_t>(valueOffset);
+                childGuards.clear();
+                for (auto guard : guards) {
+                    Interval interval = getInterval(guard, bestVariable);
+                    if (interval.lower <= value && value <= interval.upper) {
+                        childGuards.push_back(guard);
+                    }
+                }
+                buildNode(childGuards, usedVariables, depth + 1, firstChild + valueOffset);
+            }
+            usedVariables[bestVariable] = false;
+
+            // Values outside of the range of the variable only occur in out-of-bounds states, which are not explored anyway.
+            nodes[firstChild + numberOfValues].isLeaf = true;
+            nodes[firstChild + numberOfValues].candidateSet = 0;
+        }
+
+        void GuardIndex::makeLeaf(std::vector<uint64_t> const& guards, uint64_t nodeIndex) {
+            nodes[nodeIndex].isLeaf = true;
+            nodes[nodeIndex].candidateSet = candidateSets.size();
+            candidateSets.push_back(guards);
+        }
+    }
+}
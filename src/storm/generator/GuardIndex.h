@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    namespace generator {
+        struct VariableInformation;
+
+        /*!
+         * A decision tree over the values of the state variables that narrows down which of a given list of guards can
+         * possibly be satisfied in a state. It is built from the conjuncts of the guards that bound a single variable by a
+         * constant (e.g. s=3, x<=N or !b). Each inner node branches over all values of one variable with a small range
+         * and each leaf stores the indices of the guards that are consistent with the values on its path.
+         *
+         * The index is conservative: every guard that is satisfied in a state is among the candidates for that state, but
+         * the candidates still need to be evaluated.
+         */
+        class GuardIndex {
+        public:
+            /*!
+             * Creates an empty index. It needs to be built before it can be queried.
+             */
+            GuardIndex() = default;
+
+            /*!
+             * Builds the index for the given guards over states whose variables are packed as described by the given
+             * variable information.
+             */
+            GuardIndex(VariableInformation const& variableInformation, std::vector<storm::expressions::Expression> const& guards);
+
+            /*!
+             * Retrieves the (ascending) indices of the guards that are possibly satisfied in the given state.
+             */
+            std::vector<uint64_t> const& getCandidates(CompressedState const& state) const;
+
+            /*!
+             * Retrieves the number of nodes of the decision tree.
+             */
+            uint64_t getNumberOfNodes() const;
+
+        private:
+            struct Interval {
+                int64_t lower;
+                int64_t upper;
+            };
+
+            // A variable the tree may branch over.
+            struct SplitVariable {
+                bool isBoolean;
+                uint64_t bitOffset;
+                uint64_t bitWidth;
+                int64_t lowerBound;
+                int64_t upperBound;
+            };
+
+            struct Node {
+                bool isLeaf;
+                // The variable that is tested by an inner node.
+                SplitVariable variable;
+                // The children for the values lowerBound, ..., upperBound are stored consecutively starting at this index,
+                // followed by a child for values outside the range.
+                uint64_t firstChild;
+                // The candidates of a leaf.
+                uint64_t candidateSet;
+            };
+
+            /*!
+             * Restricts the given constraints by the conjuncts of the given guard that bound a single variable.
+             */
+            void addConstraints(storm::expressions::Expression const& guard, std::unordered_map<uint64_t, Interval>& constraints) const;
+
+            /*!
+             * Restricts the value of the given split variable to the given interval.
+             */
+            void restrict(std::unordered_map<uint64_t, Interval>& constraints, uint64_t variableIndex, int64_t lower, int64_t upper) const;
+
+            /*!
+             * Retrieves the values of the given split variable that the given guard admits.
+             */
+            Interval getInterval(uint64_t guardIndex, uint64_t variableIndex) const;
+
+            /*!
+             * Builds the subtree for the given guards and stores its root at the given position.
+             */
+            void buildNode(std::vector<uint64_t> const& guards, std::vector<bool>& usedVariables, uint64_t depth, uint64_t nodeIndex);
+
+            void makeLeaf(std::vector<uint64_t> const& guards, uint64_t nodeIndex);
+
+            std::vector<SplitVariable> splitVariables;
+            std::unordered_map<storm::expressions::Variable, uint64_t> variableToSplitVariableIndex;
+
+            // For each guard the bounds on the split variables (only needed while building the tree).
+            std::vector<std::unordered_map<uint64_t, Interval>> guardConstraints;
+
+            std::vector<Node> nodes;
+            std::vector<std::vector<uint64_t>> candidateSets;
+        };
+    }
+}
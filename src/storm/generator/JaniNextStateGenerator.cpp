@@ -93,6 +93,15 @@ namespace storm {
             
             // Build the information structs for the reward models.
             buildRewardModelInformation();
+
+            // Build the indices that narrow down the edges whose guards need to be evaluated.
+            buildEdgeGuardIndices();
+
+            // Compile the guards and probabilities of the edges such that they can be evaluated on the compressed states.
+            // Compiled expressions are evaluated with floating point arithmetic and can therefore only be used for double.
+            if (std::is_same<ValueType, double>::value && options.isCompileExpressionsSet()) {
+                compileEdgeExpressions();
+            }
             
             // If there are terminal states we need to handle, we now need to translate all labels to expressions.
             if (this->options.hasTerminalStates()) {
@@ -115,6 +124,80 @@ namespace storm {
             }
         }
 
+        template<typename ValueType, typename StateType>
+        void JaniNextStateGenerator<ValueType, StateType>::compileEdgeExpressions() {
+            // Assignments are not compiled: With assignment levels, they are evaluated in intermediate states and they may
+            // write to transient variables and array entries, which are all handled by the evaluator.
+            StateExpressionCompiler compiler(this->variableInformation);
+            for (auto const& automaton : parallelAutomata) {
+                compiledEdges.emplace_back();
+                for (auto const& edge : automaton.get().getEdges()) {
+                    CompiledEdge compiledEdge;
+                    if (compiler.canCompile(edge.getGuard())) {
+                        compiledEdge.hasGuard = true;
+                        compiledEdge.guard = compiler.compile(edge.getGuard());
+                    }
+                    bool allProbabilitiesCompilable = true;
+                    for (auto const& destination : edge.getDestinations()) {
+                        allProbabilitiesCompilable &= compiler.canCompile(destination.getProbability());
+                    }
+                    if (allProbabilitiesCompilable) {
+                        for (auto const& destination : edge.getDestinations()) {
+                            compiledEdge.probabilities.push_back(compiler.compile(destination.getProbability()));
+                        }
+                    }
+                    compiledEdges.back().push_back(std::move(compiledEdge));
+                }
+            }
+        }
+
+        template<typename ValueType, typename StateType>
+        void JaniNextStateGenerator<ValueType, StateType>::buildEdgeGuardIndices() {
+            for (auto const& outputAndEdges : edges) {
+                edgeGuardIndices.emplace_back();
+                for (auto const& automatonAndEdges : outputAndEdges.second) {
+                    edgeGuardIndices.back().emplace_back();
+                    for (auto const& locationAndEdges : automatonAndEdges.second) {
+                        std::vector<storm::expressions::Expression> guards;
+                        for (auto const& indexAndEdge : locationAndEdges.second) {
+                            guards.push_back(indexAndEdge.second->getGuard());
+                        }
+                        edgeGuardIndices.back().back().emplace(locationAndEdges.first, GuardIndex(this->variableInformation, guards));
+                    }
+                }
+            }
+        }
+
+        template<typename ValueType, typename StateType>
+        std::vector<uint64_t> const& JaniNextStateGenerator<ValueType, StateType>::getCandidateEdges(uint64_t outputIndex, uint64_t automatonPosition, uint64_t location) const {
+            auto const& locationGuardIndices = edgeGuardIndices[outputIndex][automatonPosition];
+            auto guardIndexIt = locationGuardIndices.find(location);
+            STORM_LOG_ASSERT(guardIndexIt != locationGuardIndices.end(), "No guard index for the given edge set.");
+            return guardIndexIt->second.getCandidates(*this->state);
+        }
+
+        template<typename ValueType, typename StateType>
+        bool JaniNextStateGenerator<ValueType, StateType>::isGuardSatisfied(uint64_t automatonIndex, uint64_t edgeIndex, storm::jani::Edge const& edge) const {
+            if (!compiledEdges.empty()) {
+                CompiledEdge const& compiledEdge = compiledEdges[automatonIndex][edgeIndex];
+                if (compiledEdge.hasGuard) {
+                    return compiledEdge.guard.evaluateAsBool(*this->state);
+                }
+            }
+            return this->evaluator->asBool(edge.getGuard());
+        }
+
+        template<typename ValueType, typename StateType>
+        ValueType JaniNextStateGenerator<ValueType, StateType>::getDestinationProbability(uint64_t automatonIndex, uint64_t edgeIndex, uint64_t destinationIndex, storm::jani::EdgeDestination const& destination) const {
+            if (!compiledEdges.empty()) {
+                CompiledEdge const& compiledEdge = compiledEdges[automatonIndex][edgeIndex];
+                if (!compiledEdge.probabilities.empty()) {
+                    return storm::utility::convertNumber<ValueType>(compiledEdge.probabilities[destinationIndex].evaluateAsDouble(*this->state));
+                }
+            }
+            return this->evaluator->asRational(destination.getProbability());
+        }
+
         template<typename ValueType, typename StateType>
         storm::jani::ModelFeatures JaniNextStateGenerator<ValueType, StateType>::getSupportedJaniFeatures() {
             storm::jani::ModelFeatures features;
@@ -656,7 +739,7 @@ namespace storm {
         }
 
         template<typename ValueType, typename StateType>
-        Choice<ValueType> JaniNextStateGenerator<ValueType, StateType>::expandNonSynchronizingEdge(storm::jani::Edge const& edge, uint64_t outputActionIndex, uint64_t automatonIndex, CompressedState const& state, StateToIdCallback stateToIdCallback) {
+        Choice<ValueType> JaniNextStateGenerator<ValueType, StateType>::expandNonSynchronizingEdge(storm::jani::Edge const& edge, uint64_t outputActionIndex, uint64_t automatonIndex, uint64_t edgeIndex, CompressedState const& state, StateToIdCallback stateToIdCallback) {
             // Determine the exit rate if it's a Markovian edge.
             boost::optional<ValueType> exitRate = boost::none;
             if (edge.hasRate()) {
@@ -682,8 +765,9 @@ namespace storm {
             
             // Iterate over all updates of the current command.
             ValueType probabilitySum = storm::utility::zero<ValueType>();
-            for (auto const& destination : edge.getDestinations()) {
-                ValueType probability = this->evaluator->asRational(destination.getProbability());
+            for (uint64_t destinationIndex = 0; destinationIndex < edge.getNumberOfDestinations(); ++destinationIndex) {
+                storm::jani::EdgeDestination const& destination = edge.getDestination(destinationIndex);
+                ValueType probability = getDestinationProbability(automatonIndex, edgeIndex, destinationIndex, destination);
                 
                 if (probability != storm::utility::zero<ValueType>()) {
                     bool evaluatorChanged = false;
@@ -811,7 +895,7 @@ namespace storm {
                     destinations.push_back(&edge.getDestination(localDestinationIndex));
                     locationVars.push_back(&this->variableInformation.locationVariables[edgeCombination[i].first]);
                     destinationIndex /= edge.getNumberOfDestinations();
-                    ValueType probability = this->evaluator->asRational(destinations.back()->getProbability());
+                    ValueType probability = getDestinationProbability(edgeCombination[i].first, iteratorList[i]->first, localDestinationIndex, *destinations.back());
                     if (edge.hasRate()) {
                         successorProbability *= probability * this->evaluator->asRational(edge.getRate());
                     } else {
@@ -945,10 +1029,13 @@ namespace storm {
             // To avoid reallocations, we declare some memory here here.
             // This vector will store for each automaton the set of edges with the current output and the current source location
             std::vector<EdgeSetWithIndices const*> edgeSetsMemory;
+            // This vector will store for each automaton the positions of the edges (within the set above) whose guards are possibly satisfied.
+            std::vector<std::vector<uint64_t> const*> edgeCandidatesMemory;
             // This vector will store the 'first' combination of edges that is productive.
-            std::vector<typename EdgeSetWithIndices::const_iterator> edgeIteratorMemory;
+            std::vector<typename std::vector<uint64_t>::const_iterator> edgeIteratorMemory;
             
-            for (OutputAndEdges const& outputAndEdges : edges) {
+            for (uint64_t outputIndex = 0; outputIndex < edges.size(); ++outputIndex) {
+                OutputAndEdges const& outputAndEdges = edges[outputIndex];
                 auto const& edges = outputAndEdges.second;
                 if (edges.size() == 1) {
                     // If the synch consists of just one element, it's non-synchronizing.
@@ -957,18 +1044,19 @@ namespace storm {
 
                     auto edgesIt = nonsychingEdges.second.find(locations[automatonIndex]);
                     if (edgesIt != nonsychingEdges.second.end()) {
-                        for (auto const& indexAndEdge : edgesIt->second) {
+                        for (uint64_t edgePosition : getCandidateEdges(outputIndex, 0, edgesIt->first)) {
+                            auto const& indexAndEdge = edgesIt->second[edgePosition];
                             if (edgeFilter != EdgeFilter::All) {
                                 STORM_LOG_ASSERT(edgeFilter == EdgeFilter::WithRate || edgeFilter == EdgeFilter::WithoutRate, "Unexpected edge filter.");
                                 if ((edgeFilter == EdgeFilter::WithRate) != indexAndEdge.second->hasRate()) {
                                     continue;
                                 }
                             }
-                            if (!this->evaluator->asBool(indexAndEdge.second->getGuard())) {
+                            if (!isGuardSatisfied(automatonIndex, indexAndEdge.first, *indexAndEdge.second)) {
                                 continue;
                             }
                         
-                            result.push_back(expandNonSynchronizingEdge(*indexAndEdge.second, outputAndEdges.first ? outputAndEdges.first.get() : indexAndEdge.second->getActionIndex(), automatonIndex, state, stateToIdCallback));
+                            result.push_back(expandNonSynchronizingEdge(*indexAndEdge.second, outputAndEdges.first ? outputAndEdges.first.get() : indexAndEdge.second->getActionIndex(), automatonIndex, indexAndEdge.first, state, stateToIdCallback));
 
                             if (this->getOptions().isBuildChoiceOriginsSet()) {
                                 EdgeIndexSet edgeIndex { model.encodeAutomatonAndEdgeIndices(automatonIndex, indexAndEdge.first) };
@@ -1000,11 +1088,16 @@ namespace storm {
                     
                     if (productiveCombination) {
                         // second, check whether each automaton has at least one enabled action
+                        edgeCandidatesMemory.clear();
                         edgeIteratorMemory.clear(); // Store the first enabled edge in each automaton.
-                        for (auto const& edgesIt : edgeSetsMemory) {
+                        for (uint64_t automatonPosition = 0; automatonPosition < edgeSetsMemory.size(); ++automatonPosition) {
+                            uint64_t automatonIndex = outputAndEdges.second[automatonPosition].first;
                             bool atLeastOneEdge = false;
-                            EdgeSetWithIndices const& edgeSetWithIndices = *edgesIt;
-                            for (auto indexAndEdgeIt = edgeSetWithIndices.begin(), indexAndEdgeIte = edgeSetWithIndices.end(); indexAndEdgeIt != indexAndEdgeIte; ++indexAndEdgeIt) {
+                            EdgeSetWithIndices const& edgeSetWithIndices = *edgeSetsMemory[automatonPosition];
+                            std::vector<uint64_t> const& candidateEdges = getCandidateEdges(outputIndex, automatonPosition, locations[automatonIndex]);
+                            edgeCandidatesMemory.push_back(&candidateEdges);
+                            for (auto edgePositionIt = candidateEdges.begin(), edgePositionIte = candidateEdges.end(); edgePositionIt != edgePositionIte; ++edgePositionIt) {
+                                auto indexAndEdgeIt = edgeSetWithIndices.begin() + *edgePositionIt;
                                 // check whether we do not consider this edge
                                 if (edgeFilter != EdgeFilter::All) {
                                     STORM_LOG_ASSERT(edgeFilter == EdgeFilter::WithRate || edgeFilter == EdgeFilter::WithoutRate, "Unexpected edge filter.");
@@ -1013,13 +1106,13 @@ namespace storm {
                                     }
                                 }
                             
-                                if (!this->evaluator->asBool(indexAndEdgeIt->second->getGuard())) {
+                                if (!isGuardSatisfied(automatonIndex, indexAndEdgeIt->first, *indexAndEdgeIt->second)) {
                                     continue;
                                 }
                             
                                 // If we reach this point, the edge is considered enabled.
                                 atLeastOneEdge = true;
-                                edgeIteratorMemory.push_back(indexAndEdgeIt);
+                                edgeIteratorMemory.push_back(edgePositionIt);
                                 break;
                             }
                             
@@ -1038,16 +1131,18 @@ namespace storm {
                         STORM_LOG_ASSERT(edgeSetsMemory.size() == outputAndEdges.second.size(), "Unexpected number of edge sets stored.");
                         STORM_LOG_ASSERT(edgeIteratorMemory.size() == outputAndEdges.second.size(), "Unexpected number of edge iterators stored.");
                         auto edgeSetIt = edgeSetsMemory.begin();
+                        auto edgeCandidatesIt = edgeCandidatesMemory.begin();
                         auto edgeIteratorIt = edgeIteratorMemory.begin();
                         for (auto const& automatonAndEdges : outputAndEdges.second) {
                             EdgeSetWithIndices enabledEdgesOfAutomaton;
                             uint64_t automatonIndex = automatonAndEdges.first;
                             EdgeSetWithIndices const& edgeSetWithIndices = **edgeSetIt;
-                            auto indexAndEdgeIt = *edgeIteratorIt;
+                            auto edgePositionIt = *edgeIteratorIt;
                             // The first edge where the edgeIterator points to is always enabled.
-                            enabledEdgesOfAutomaton.emplace_back(*indexAndEdgeIt);
-                            auto indexAndEdgeIte = edgeSetWithIndices.end();
-                            for (++indexAndEdgeIt; indexAndEdgeIt != indexAndEdgeIte; ++indexAndEdgeIt) {
+                            enabledEdgesOfAutomaton.emplace_back(edgeSetWithIndices[*edgePositionIt]);
+                            auto edgePositionIte = (*edgeCandidatesIt)->end();
+                            for (++edgePositionIt; edgePositionIt != edgePositionIte; ++edgePositionIt) {
+                                auto indexAndEdgeIt = edgeSetWithIndices.begin() + *edgePositionIt;
                                 // check whether we do not consider this edge
                                 if (edgeFilter != EdgeFilter::All) {
                                     STORM_LOG_ASSERT(edgeFilter == EdgeFilter::WithRate || edgeFilter == EdgeFilter::WithoutRate, "Unexpected edge filter.");
@@ -1056,7 +1151,7 @@ namespace storm {
                                     }
                                 }
                                 
-                                if (!this->evaluator->asBool(indexAndEdgeIt->second->getGuard())) {
+                                if (!isGuardSatisfied(automatonIndex, indexAndEdgeIt->first, *indexAndEdgeIt->second)) {
                                     continue;
                                 }
                                 // If we reach this point, the edge is considered enabled.
@@ -1064,6 +1159,7 @@ namespace storm {
                             }
                             automataEdgeSets.emplace_back(std::move(automatonIndex), std::move(enabledEdgesOfAutomaton));
                             ++edgeSetIt;
+                            ++edgeCandidatesIt;
                             ++edgeIteratorIt;
                         }
                         // insert choices in the result vector.
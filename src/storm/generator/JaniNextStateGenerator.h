@@ -2,6 +2,8 @@
 
 #include "storm/generator/NextStateGenerator.h"
 #include "storm/generator/TransientVariableInformation.h"
+#include "storm/generator/CompiledStateExpression.h"
+#include "storm/generator/GuardIndex.h"
 
 #include "storm/storage/jani/Model.h"
 #include "storm/storage/jani/ArrayEliminator.h"
@@ -147,9 +149,9 @@ namespace storm {
             std::vector<Choice<ValueType>> getActionChoices(std::vector<uint64_t> const& locations, CompressedState const& state, StateToIdCallback stateToIdCallback, EdgeFilter const& edgeFilter = EdgeFilter::All);
             
             /*!
-             * Retrieves the choice generated by the given edge.
+             * Retrieves the choice generated by the given edge, which has the given index in the given automaton.
              */
-            Choice<ValueType> expandNonSynchronizingEdge(storm::jani::Edge const& edge, uint64_t outputActionIndex, uint64_t automatonIndex, CompressedState const& state, StateToIdCallback stateToIdCallback);
+            Choice<ValueType> expandNonSynchronizingEdge(storm::jani::Edge const& edge, uint64_t outputActionIndex, uint64_t automatonIndex, uint64_t edgeIndex, CompressedState const& state, StateToIdCallback stateToIdCallback);
             
             typedef std::vector<std::pair<uint64_t, storm::jani::Edge const*>> EdgeSetWithIndices;
             typedef std::unordered_map<uint64_t, EdgeSetWithIndices> LocationsAndEdges;
@@ -191,6 +193,37 @@ namespace storm {
              * Checks the underlying model for validity for this next-state generator.
              */
             void checkValid() const;
+
+            /*!
+             * Builds the guard indices of all edge sets.
+             */
+            void buildEdgeGuardIndices();
+
+            /*!
+             * Retrieves the positions of the edges (within their edge set) with the given output, automaton and source location whose
+             * guards are possibly satisfied in the currently loaded state.
+             *
+             * @param outputIndex The position of the output and its edges in the edges of this generator.
+             * @param automatonPosition The position of the automaton within the automata of the output.
+             * @param location The source location.
+             */
+            std::vector<uint64_t> const& getCandidateEdges(uint64_t outputIndex, uint64_t automatonPosition, uint64_t location) const;
+
+            /*!
+             * Compiles the guards and destination probabilities of all edges that only refer to variables stored in the states.
+             */
+            void compileEdgeExpressions();
+
+            /*!
+             * Evaluates the guard of the given edge (with the given index in the given automaton) in the currently loaded state.
+             */
+            bool isGuardSatisfied(uint64_t automatonIndex, uint64_t edgeIndex, storm::jani::Edge const& edge) const;
+
+            /*!
+             * Evaluates the probability of the given destination of the given edge (with the given index in the given automaton)
+             * in the currently loaded state.
+             */
+            ValueType getDestinationProbability(uint64_t automatonIndex, uint64_t edgeIndex, uint64_t destinationIndex, storm::jani::EdgeDestination const& destination) const;
                         
             /// The model used for the generation of next states.
             storm::jani::Model model;
@@ -221,6 +254,22 @@ namespace storm {
             
             /// Information about the transient variables of the model.
             TransientVariableInformation<ValueType> transientVariableInformation;
+
+            /// For each set of edges (with the same output action and source location) an index that narrows down the edges whose guards are possibly satisfied.
+            /// The indices are stored in the same order as the edges, i.e., by output, position of the automaton and source location.
+            std::vector<std::vector<std::unordered_map<uint64_t, GuardIndex>>> edgeGuardIndices;
+
+            /// The compiled expressions of an edge.
+            struct CompiledEdge {
+                /// Whether the guard was compiled. Guards that refer to transient variables are not compiled.
+                bool hasGuard = false;
+                CompiledStateExpression guard;
+                /// The probabilities of the destinations. Empty if not all of them could be compiled.
+                std::vector<CompiledStateExpression> probabilities;
+            };
+
+            /// For each of the parallel automata, the compiled expressions of its edges (indexed by the edge index). Empty if expressions are not compiled.
+            std::vector<std::vector<CompiledEdge>> compiledEdges;
         };
         
     }
@@ -32,7 +32,7 @@ namespace storm {
         }
 
         template<typename ValueType, typename StateType>
-        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, VariableInformation const& variableInformation, NextStateGeneratorOptions const& options, std::shared_ptr<ActionMask<ValueType,StateType>> const& mask) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(variableInformation), evaluator(nullptr), state(nullptr), actionMask(mask) {
+        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, VariableInformation const& variableInformation, NextStateGeneratorOptions const& options, std::shared_ptr<ActionMask<ValueType,StateType>> const& mask) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(variableInformation), evaluator(nullptr), state(nullptr), unpackStatesOnDemand(false), stateIsUnpacked(false), actionMask(mask) {
             if(variableInformation.hasOutOfBoundsBit()) {
                 outOfBoundsState = createOutOfBoundsState(variableInformation);
             }
@@ -42,7 +42,7 @@ namespace storm {
         }
         
         template<typename ValueType, typename StateType>
-        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, NextStateGeneratorOptions const& options, std::shared_ptr<ActionMask<ValueType,StateType>> const& mask) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(), evaluator(nullptr), state(nullptr), actionMask(mask)  {
+        NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, NextStateGeneratorOptions const& options, std::shared_ptr<ActionMask<ValueType,StateType>> const& mask) : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(), evaluator(nullptr), state(nullptr), unpackStatesOnDemand(false), stateIsUnpacked(false), actionMask(mask)  {
             if(variableInformation.hasOutOfBoundsBit()) {
                 outOfBoundsState = createOutOfBoundsState(variableInformation);
             }
@@ -97,11 +97,22 @@ namespace storm {
         
         template<typename ValueType, typename StateType>
         void NextStateGenerator<ValueType, StateType>::load(CompressedState const& state) {
-            // Since almost all subsequent operations are based on the evaluator, we load the state into it now.
-            unpackStateIntoEvaluator(state, variableInformation, *evaluator);
-            
-            // Also, we need to store a pointer to the state itself, because we need to be able to access it when expanding it.
+            // We need to store a pointer to the state itself, because we need to be able to access it when expanding it.
             this->state = &state;
+            stateIsUnpacked = false;
+
+            // Since almost all subsequent operations are based on the evaluator, we load the state into it now (unless this is deferred).
+            if (!unpackStatesOnDemand) {
+                unpackStateIntoEvaluatorIfNecessary();
+            }
+        }
+
+        template<typename ValueType, typename StateType>
+        void NextStateGenerator<ValueType, StateType>::unpackStateIntoEvaluatorIfNecessary() const {
+            if (!stateIsUnpacked) {
+                unpackStateIntoEvaluator(*state, variableInformation, *evaluator);
+                stateIsUnpacked = true;
+            }
         }
         
         template<typename ValueType, typename StateType>
@@ -109,6 +120,7 @@ namespace storm {
             if (expression.isTrue()) {
                 return true;
             }
+            unpackStateIntoEvaluatorIfNecessary();
             return evaluator->asBool(expression);
         }
 
@@ -192,6 +204,8 @@ namespace storm {
                     }
                 }
             }
+            // The evaluator no longer holds the values of the loaded state.
+            stateIsUnpacked = false;
             
             if (!result.containsLabel("init")) {
                 // Also label the initial state with the special label "init".
@@ -156,6 +156,11 @@ namespace storm {
 
             virtual void extendStateInformation(storm::json<ValueType>& stateInfo) const;
 
+            /*!
+             * Unpacks the currently loaded state into the evaluator unless this has already been done.
+             */
+            void unpackStateIntoEvaluatorIfNecessary() const;
+
             virtual storm::storage::sparse::StateValuationsBuilder initializeObservationValuationsBuilder() const;
 
             void postprocess(StateBehavior<ValueType, StateType>& result);
@@ -178,6 +183,13 @@ namespace storm {
             /// The currently loaded state.
             CompressedState const* state;
 
+            /// If set, the loaded state is only unpacked into the evaluator once the evaluator is needed. This can be used by
+            /// generators that evaluate their expressions directly on the compressed states.
+            bool unpackStatesOnDemand;
+
+            /// A flag indicating whether the currently loaded state has been unpacked into the evaluator.
+            mutable bool stateIsUnpacked;
+
             /// A comparator used to compare constants.
             storm::utility::ConstantsComparator<ValueType> comparator;
 
@@ -27,7 +27,7 @@ namespace storm {
         }
 
         template<typename ValueType, typename StateType>
-        PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options,  std::shared_ptr<ActionMask<ValueType,StateType>> const& mask, bool) : NextStateGenerator<ValueType, StateType>(program.getManager(), options, mask), program(program), rewardModels(), hasStateActionRewards(false) {
+        PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options,  std::shared_ptr<ActionMask<ValueType,StateType>> const& mask, bool) : NextStateGenerator<ValueType, StateType>(program.getManager(), options, mask), program(program), rewardModels(), hasStateActionRewards(false), useCompiledExpressions(false) {
             STORM_LOG_TRACE("Creating next-state generator for PRISM program: " << program);
             STORM_LOG_THROW(!this->program.specifiesSystemComposition(), storm::exceptions::WrongFormatException, "The explicit next-state generator currently does not support custom system compositions.");
 
@@ -85,6 +85,35 @@ namespace storm {
                 moduleIndexToPlayerIndexMap = program.buildModuleIndexToPlayerIndexMap();
                 actionIndexToPlayerIndexMap = program.buildActionIndexToPlayerIndexMap();
             }
+
+            // Build the indices that narrow down the commands of each module whose guards need to be evaluated.
+            for (auto const& module : this->program.getModules()) {
+                std::vector<storm::expressions::Expression> guards;
+                for (auto const& command : module.getCommands()) {
+                    guards.push_back(command.getGuardExpression());
+                }
+                moduleGuardIndices.emplace_back(this->variableInformation, guards);
+
+                std::unordered_map<uint64_t, ActionGuardIndex> actionGuardIndices;
+                for (auto const& actionIndex : module.getSynchronizingActionIndices()) {
+                    std::set<uint_fast64_t> const& commandIndices = module.getCommandIndicesByActionIndex(actionIndex);
+                    ActionGuardIndex actionGuardIndex;
+                    actionGuardIndex.commandIndices.assign(commandIndices.begin(), commandIndices.end());
+                    std::vector<storm::expressions::Expression> actionGuards;
+                    for (auto const& commandIndex : commandIndices) {
+                        actionGuards.push_back(module.getCommand(commandIndex).getGuardExpression());
+                    }
+                    actionGuardIndex.index = GuardIndex(this->variableInformation, actionGuards);
+                    actionGuardIndices.emplace(actionIndex, std::move(actionGuardIndex));
+                }
+                moduleActionGuardIndices.push_back(std::move(actionGuardIndices));
+            }
+
+            // Compiled expressions are evaluated with floating point arithmetic and can therefore only be used for double.
+            if (std::is_same<ValueType, double>::value && this->options.isCompileExpressionsSet()) {
+                useCompiledExpressions = compileExpressions();
+            }
+            this->unpackStatesOnDemand = useCompiledExpressions;
         }
 
         template<typename ValueType, typename StateType>
@@ -269,12 +298,18 @@ namespace storm {
 
             // First, construct the state rewards, as we may return early if there are no choices later and we already
             // need the state rewards then.
-            for (auto const& rewardModel : rewardModels) {
+            for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModels.size(); ++rewardModelIndex) {
                 ValueType stateRewardValue = storm::utility::zero<ValueType>();
-                if (rewardModel.get().hasStateRewards()) {
-                    for (auto const& stateReward : rewardModel.get().getStateRewards()) {
-                        if (this->evaluator->asBool(stateReward.getStatePredicateExpression())) {
-                            stateRewardValue += ValueType(this->evaluator->asRational(stateReward.getRewardValueExpression()));
+                if (rewardModels[rewardModelIndex].get().hasStateRewards()) {
+                    auto const& stateRewards = rewardModels[rewardModelIndex].get().getStateRewards();
+                    for (uint64_t rewardIndex = 0; rewardIndex < stateRewards.size(); ++rewardIndex) {
+                        if (useCompiledExpressions) {
+                            auto const& compiledReward = compiledStateRewards[rewardModelIndex][rewardIndex];
+                            if (compiledReward.first.evaluateAsBool(*this->state)) {
+                                stateRewardValue += storm::utility::convertNumber<ValueType>(compiledReward.second.evaluateAsDouble(*this->state));
+                            }
+                        } else if (this->evaluator->asBool(stateRewards[rewardIndex].getStatePredicateExpression())) {
+                            stateRewardValue += ValueType(this->evaluator->asRational(stateRewards[rewardIndex].getRewardValueExpression()));
                         }
                     }
                 }
@@ -283,8 +318,10 @@ namespace storm {
 
             // If a terminal expression was set and we must not expand this state, return now.
             if (!this->terminalStates.empty()) {
-                for (auto const& expressionBool : this->terminalStates) {
-                    if (this->evaluator->asBool(expressionBool.first) == expressionBool.second) {
+                for (uint64_t terminalIndex = 0; terminalIndex < this->terminalStates.size(); ++terminalIndex) {
+                    auto const& expressionBool = this->terminalStates[terminalIndex];
+                    bool value = useCompiledExpressions ? compiledTerminalStates[terminalIndex].evaluateAsBool(*this->state) : this->evaluator->asBool(expressionBool.first);
+                    if (value == expressionBool.second) {
                         return result;
                     }
                 }
@@ -352,13 +389,14 @@ namespace storm {
                 }
 
                 // Now construct the state-action reward for all selected reward models.
-                for (auto const& rewardModel : rewardModels) {
+                for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModels.size(); ++rewardModelIndex) {
                     ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
-                    if (rewardModel.get().hasStateActionRewards()) {
-                        for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+                    if (rewardModels[rewardModelIndex].get().hasStateActionRewards()) {
+                        auto const& stateActionRewards = rewardModels[rewardModelIndex].get().getStateActionRewards();
+                        for (uint64_t rewardIndex = 0; rewardIndex < stateActionRewards.size(); ++rewardIndex) {
                             for (auto const& choice : allChoices) {
-                                if (stateActionReward.getActionIndex() == choice.getActionIndex() && this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
-                                    stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression())) * choice.getTotalMass();
+                                if (stateActionRewards[rewardIndex].getActionIndex() == choice.getActionIndex() && isStateActionRewardEnabled(rewardModelIndex, rewardIndex)) {
+                                    stateActionRewardValue += getStateActionRewardValue(rewardModelIndex, rewardIndex) * choice.getTotalMass();
                                 }
                             }
 
@@ -409,13 +447,19 @@ namespace storm {
             auto assignmentIt = update.getAssignments().begin();
             auto assignmentIte = update.getAssignments().end();
 
+            // Just like the evaluator, the compiled assignments are evaluated in the currently loaded state (and not in the given one).
+            std::vector<CompiledStateExpression>::const_iterator compiledAssignmentIt;
+            if (useCompiledExpressions) {
+                compiledAssignmentIt = compiledUpdates[update.getGlobalIndex()].assignments.begin();
+            }
+
             // Iterate over all boolean assignments and carry them out.
             auto boolIt = this->variableInformation.booleanVariables.begin();
             for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasBooleanType(); ++assignmentIt) {
                 while (assignmentIt->getVariable() != boolIt->variable) {
                     ++boolIt;
                 }
-                newState.set(boolIt->bitOffset, this->evaluator->asBool(assignmentIt->getExpression()));
+                newState.set(boolIt->bitOffset, useCompiledExpressions ? (compiledAssignmentIt++)->evaluateAsBool(*this->state) : this->evaluator->asBool(assignmentIt->getExpression()));
             }
 
             // Iterate over all integer assignments and carry them out.
@@ -424,7 +468,7 @@ namespace storm {
                 while (assignmentIt->getVariable() != integerIt->variable) {
                     ++integerIt;
                 }
-                int_fast64_t assignedValue = this->evaluator->asInt(assignmentIt->getExpression());
+                int_fast64_t assignedValue = useCompiledExpressions ? (compiledAssignmentIt++)->evaluateAsInt(*this->state) : this->evaluator->asInt(assignmentIt->getExpression());
                 if (this->options.isAddOutOfBoundsStateSet()) {
                     if (assignedValue < integerIt->lowerBound || assignedValue > integerIt->upperBound) {
                         return this->outOfBoundsState;
@@ -443,13 +487,117 @@ namespace storm {
             return newState;
         }
 
+        template<typename ValueType, typename StateType>
+        bool PrismNextStateGenerator<ValueType, StateType>::compileExpressions() {
+            StateExpressionCompiler compiler(this->variableInformation);
+            bool allCompilable = true;
+            auto compile = [&compiler, &allCompilable] (storm::expressions::Expression const& expression) {
+                if (allCompilable && compiler.canCompile(expression)) {
+                    return compiler.compile(expression);
+                }
+                allCompilable = false;
+                return CompiledStateExpression();
+            };
+
+            // The compiled expressions of commands and updates are accessed via their global indices, so these need to be unique.
+            uint64_t numberOfCommands = 0;
+            uint64_t numberOfUpdates = 0;
+            for (auto const& module : program.getModules()) {
+                for (auto const& command : module.getCommands()) {
+                    numberOfCommands = std::max<uint64_t>(numberOfCommands, command.getGlobalIndex() + 1);
+                    for (auto const& update : command.getUpdates()) {
+                        numberOfUpdates = std::max<uint64_t>(numberOfUpdates, update.getGlobalIndex() + 1);
+                    }
+                }
+            }
+            storm::storage::BitVector compiledCommandIndices(numberOfCommands);
+            storm::storage::BitVector compiledUpdateIndices(numberOfUpdates);
+            compiledGuards.resize(numberOfCommands);
+            compiledUpdates.resize(numberOfUpdates);
+            for (auto const& module : program.getModules()) {
+                for (auto const& command : module.getCommands()) {
+                    if (compiledCommandIndices.get(command.getGlobalIndex())) {
+                        return false;
+                    }
+                    compiledCommandIndices.set(command.getGlobalIndex());
+                    compiledGuards[command.getGlobalIndex()] = compile(command.getGuardExpression());
+                    for (auto const& update : command.getUpdates()) {
+                        if (compiledUpdateIndices.get(update.getGlobalIndex())) {
+                            return false;
+                        }
+                        compiledUpdateIndices.set(update.getGlobalIndex());
+                        CompiledUpdate& compiledUpdate = compiledUpdates[update.getGlobalIndex()];
+                        compiledUpdate.likelihood = compile(update.getLikelihoodExpression());
+                        for (auto const& assignment : update.getAssignments()) {
+                            compiledUpdate.assignments.push_back(compile(assignment.getExpression()));
+                        }
+                    }
+                }
+            }
+
+            for (auto const& rewardModel : rewardModels) {
+                compiledStateRewards.emplace_back();
+                for (auto const& stateReward : rewardModel.get().getStateRewards()) {
+                    compiledStateRewards.back().emplace_back(compile(stateReward.getStatePredicateExpression()), compile(stateReward.getRewardValueExpression()));
+                }
+                compiledStateActionRewards.emplace_back();
+                for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+                    compiledStateActionRewards.back().emplace_back(compile(stateActionReward.getStatePredicateExpression()), compile(stateActionReward.getRewardValueExpression()));
+                }
+            }
+
+            for (auto const& expressionBool : this->terminalStates) {
+                compiledTerminalStates.push_back(compile(expressionBool.first));
+            }
+
+            if (!allCompilable) {
+                STORM_LOG_DEBUG("Not all expressions of the program can be evaluated directly on the states. Falling back to the expression evaluator.");
+            }
+            return allCompilable;
+        }
+
+        template<typename ValueType, typename StateType>
+        bool PrismNextStateGenerator<ValueType, StateType>::isGuardSatisfied(storm::prism::Command const& command) const {
+            if (useCompiledExpressions) {
+                return compiledGuards[command.getGlobalIndex()].evaluateAsBool(*this->state);
+            }
+            return this->evaluator->asBool(command.getGuardExpression());
+        }
+
+        template<typename ValueType, typename StateType>
+        ValueType PrismNextStateGenerator<ValueType, StateType>::getLikelihood(storm::prism::Update const& update) const {
+            if (useCompiledExpressions) {
+                return storm::utility::convertNumber<ValueType>(compiledUpdates[update.getGlobalIndex()].likelihood.evaluateAsDouble(*this->state));
+            }
+            return this->evaluator->asRational(update.getLikelihoodExpression());
+        }
+
+        template<typename ValueType, typename StateType>
+        bool PrismNextStateGenerator<ValueType, StateType>::isStateActionRewardEnabled(uint64_t rewardModelIndex, uint64_t rewardIndex) const {
+            if (useCompiledExpressions) {
+                return compiledStateActionRewards[rewardModelIndex][rewardIndex].first.evaluateAsBool(*this->state);
+            }
+            return this->evaluator->asBool(rewardModels[rewardModelIndex].get().getStateActionRewards()[rewardIndex].getStatePredicateExpression());
+        }
+
+        template<typename ValueType, typename StateType>
+        ValueType PrismNextStateGenerator<ValueType, StateType>::getStateActionRewardValue(uint64_t rewardModelIndex, uint64_t rewardIndex) const {
+            if (useCompiledExpressions) {
+                return storm::utility::convertNumber<ValueType>(compiledStateActionRewards[rewardModelIndex][rewardIndex].second.evaluateAsDouble(*this->state));
+            }
+            return ValueType(this->evaluator->asRational(rewardModels[rewardModelIndex].get().getStateActionRewards()[rewardIndex].getRewardValueExpression()));
+        }
+
         struct ActiveCommandData {
-            ActiveCommandData(storm::prism::Module const* modulePtr, std::set<uint_fast64_t> const* commandIndicesPtr, typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt) : modulePtr(modulePtr), commandIndicesPtr(commandIndicesPtr), currentCommandIndexIt(currentCommandIndexIt) {
+            ActiveCommandData(storm::prism::Module const* modulePtr, std::vector<uint64_t> const* commandIndicesPtr, std::vector<uint64_t> const* candidatesPtr, typename std::vector<uint64_t>::const_iterator currentCandidateIt) : modulePtr(modulePtr), commandIndicesPtr(commandIndicesPtr), candidatesPtr(candidatesPtr), currentCandidateIt(currentCandidateIt) {
                 // Intentionally left empty
             }
             storm::prism::Module const* modulePtr;
-            std::set<uint_fast64_t> const* commandIndicesPtr;
-            typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt;
+            // The indices of the commands labeled with the action.
+            std::vector<uint64_t> const* commandIndicesPtr;
+            // The positions (within the command indices) of the commands whose guards are possibly satisfied.
+            std::vector<uint64_t> const* candidatesPtr;
+            typename std::vector<uint64_t>::const_iterator currentCandidateIt;
         };
 
         template<typename ValueType, typename StateType>
@@ -478,10 +626,12 @@ namespace storm {
                     return boost::none;
                 }
 
-                // Look up commands by their indices and check if the guard evaluates to true in the given state.
+                // Look up the commands with this action whose guards are possibly satisfied and check if the guard evaluates to true in the given state.
+                ActionGuardIndex const& actionGuardIndex = moduleActionGuardIndices[i].at(actionIndex);
+                std::vector<uint64_t> const& candidates = actionGuardIndex.index.getCandidates(*this->state);
                 bool hasOneEnabledCommand = false;
-                for (auto commandIndexIt = commandIndices.begin(), commandIndexIte = commandIndices.end(); commandIndexIt != commandIndexIte; ++commandIndexIt) {
-                    storm::prism::Command const& command = module.getCommand(*commandIndexIt);
+                for (auto candidateIt = candidates.begin(), candidateIte = candidates.end(); candidateIt != candidateIte; ++candidateIt) {
+                    storm::prism::Command const& command = module.getCommand(actionGuardIndex.commandIndices[*candidateIt]);
                     if (!isCommandPotentiallySynchronizing(command)) {
                         continue;
                     }
@@ -491,10 +641,10 @@ namespace storm {
                             continue;
                         }
                     }
-                    if (this->evaluator->asBool(command.getGuardExpression())) {
+                    if (isGuardSatisfied(command)) {
                         // Found the first enabled command for this module.
                         hasOneEnabledCommand = true;
-                        activeCommands.emplace_back(&module, &commandIndices, commandIndexIt);
+                        activeCommands.emplace_back(&module, &actionGuardIndex.commandIndices, &candidates, candidateIt);
                         break;
                     }
                 }
@@ -511,21 +661,21 @@ namespace storm {
             for (auto const& activeCommand : activeCommands) {
                 std::vector<std::reference_wrapper<storm::prism::Command const>> commands;
 
-                auto commandIndexIt = activeCommand.currentCommandIndexIt;
+                auto candidateIt = activeCommand.currentCandidateIt;
                 // The command at the current position is already known to be enabled
-                commands.push_back(activeCommand.modulePtr->getCommand(*commandIndexIt));
+                commands.push_back(activeCommand.modulePtr->getCommand((*activeCommand.commandIndicesPtr)[*candidateIt]));
 
                 // Look up commands by their indices and add them if the guard evaluates to true in the given state.
-                auto commandIndexIte = activeCommand.commandIndicesPtr->end();
-                for (++commandIndexIt; commandIndexIt != commandIndexIte; ++commandIndexIt) {
-                    storm::prism::Command const& command = activeCommand.modulePtr->getCommand(*commandIndexIt);
+                auto candidateIte = activeCommand.candidatesPtr->end();
+                for (++candidateIt; candidateIt != candidateIte; ++candidateIt) {
+                    storm::prism::Command const& command = activeCommand.modulePtr->getCommand((*activeCommand.commandIndicesPtr)[*candidateIt]);
                     if (commandFilter != CommandFilter::All) {
                         STORM_LOG_ASSERT(commandFilter == CommandFilter::Markovian || commandFilter == CommandFilter::Probabilistic, "Unexpected command filter.");
                         if ((commandFilter == CommandFilter::Markovian) != command.isMarkovian()) {
                             continue;
                         }
                     }
-                    if (this->evaluator->asBool(command.getGuardExpression())) {
+                    if (isGuardSatisfied(command)) {
                         commands.push_back(command);
                     }
                 }
@@ -545,8 +695,8 @@ namespace storm {
             for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
                 storm::prism::Module const& module = program.getModule(i);
 
-                // Iterate over all commands.
-                for (uint_fast64_t j = 0; j < module.getNumberOfCommands(); ++j) {
+                // Iterate over all commands whose guards are possibly satisfied.
+                for (uint64_t j : moduleGuardIndices[i].getCandidates(state)) {
                     storm::prism::Command const& command = module.getCommand(j);
 
                     // Only consider commands that are not possibly synchronizing.
@@ -565,7 +715,7 @@ namespace storm {
                     }
 
                     // Skip the command, if it is not enabled.
-                    if (!this->evaluator->asBool(command.getGuardExpression())) {
+                    if (!isGuardSatisfied(command)) {
                         continue;
                     }
 
@@ -583,7 +733,7 @@ namespace storm {
                     for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
                         storm::prism::Update const& update = command.getUpdate(k);
 
-                        ValueType probability = this->evaluator->asRational(update.getLikelihoodExpression());
+                        ValueType probability = getLikelihood(update);
                         if (probability != storm::utility::zero<ValueType>()) {
                             // Obtain target state index and add it to the list of known states. If it has not yet been
                             // seen, we also add it to the set of states that have yet to be explored.
@@ -598,12 +748,13 @@ namespace storm {
                     }
 
                     // Create the state-action reward for the newly created choice.
-                    for (auto const& rewardModel : rewardModels) {
+                    for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModels.size(); ++rewardModelIndex) {
                         ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
-                        if (rewardModel.get().hasStateActionRewards()) {
-                            for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
-                                if (stateActionReward.getActionIndex() == choice.getActionIndex() && this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
-                                    stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
+                        if (rewardModels[rewardModelIndex].get().hasStateActionRewards()) {
+                            auto const& stateActionRewards = rewardModels[rewardModelIndex].get().getStateActionRewards();
+                            for (uint64_t rewardIndex = 0; rewardIndex < stateActionRewards.size(); ++rewardIndex) {
+                                if (stateActionRewards[rewardIndex].getActionIndex() == choice.getActionIndex() && isStateActionRewardEnabled(rewardModelIndex, rewardIndex)) {
+                                    stateActionRewardValue += getStateActionRewardValue(rewardModelIndex, rewardIndex);
                                 }
                             }
                         }
@@ -644,7 +795,7 @@ namespace storm {
                 storm::prism::Command const& command = *iteratorList[position];
                 for (uint_fast64_t j = 0; j < command.getNumberOfUpdates(); ++j) {
                     storm::prism::Update const& update = command.getUpdate(j);
-                    generateSynchronizedDistribution(applyUpdate(state, update), probability * this->evaluator->asRational(update.getLikelihoodExpression()), position + 1, iteratorList, distribution, stateToIdCallback);
+                    generateSynchronizedDistribution(applyUpdate(state, update), probability * getLikelihood(update), position + 1, iteratorList, distribution, stateToIdCallback);
                 }
             }
         }
@@ -721,12 +872,13 @@ namespace storm {
                         }
 
                         // Create the state-action reward for the newly created choice.
-                        for (auto const& rewardModel : rewardModels) {
+                        for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModels.size(); ++rewardModelIndex) {
                             ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
-                            if (rewardModel.get().hasStateActionRewards()) {
-                                for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
-                                    if (stateActionReward.getActionIndex() == choice.getActionIndex() && this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
-                                        stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
+                            if (rewardModels[rewardModelIndex].get().hasStateActionRewards()) {
+                                auto const& stateActionRewards = rewardModels[rewardModelIndex].get().getStateActionRewards();
+                                for (uint64_t rewardIndex = 0; rewardIndex < stateActionRewards.size(); ++rewardIndex) {
+                                    if (stateActionRewards[rewardIndex].getActionIndex() == choice.getActionIndex() && isStateActionRewardEnabled(rewardModelIndex, rewardIndex)) {
+                                        stateActionRewardValue += getStateActionRewardValue(rewardModelIndex, rewardIndex);
                                     }
                                 }
                             }
@@ -786,6 +938,7 @@ namespace storm {
                 return result;
             }
             unpackStateIntoEvaluator(state, this->variableInformation, *this->evaluator);
+            this->stateIsUnpacked = false;
             for (uint64_t i = 0; i < program.getNumberOfObservationLabels(); ++i) {
                 result.setFromInt(64*i,64,this->evaluator->asInt(program.getObservationLabels()[i].getStatePredicateExpression()));
             }
@@ -794,7 +947,7 @@ namespace storm {
 
         template<typename ValueType, typename StateType>
         void PrismNextStateGenerator<ValueType, StateType>::extendStateInformation(storm::json<ValueType>& result) const {
-
+            this->unpackStateIntoEvaluatorIfNecessary();
             for (uint64_t i = 0; i < program.getNumberOfObservationLabels(); ++i) {
                 result[program.getObservationLabels()[i].getName()] = this->evaluator->asInt(program.getObservationLabels()[i].getStatePredicateExpression());
             }
@@ -1,7 +1,11 @@
 #ifndef STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 #define STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 
+#include <unordered_map>
+
 #include "storm/generator/NextStateGenerator.h"
+#include "storm/generator/CompiledStateExpression.h"
+#include "storm/generator/GuardIndex.h"
 
 #include "storm/storage/prism/Program.h"
 #include "storm/storage/BoostTypes.h"
@@ -120,6 +124,34 @@ namespace storm {
 
             bool isCommandPotentiallySynchronizing(prism::Command const& command) const;
 
+            /*!
+             * Compiles all expressions that are evaluated while expanding a state, such that they can be evaluated directly
+             * on the compressed state instead of the evaluator.
+             *
+             * @return True iff all expressions could be compiled.
+             */
+            bool compileExpressions();
+
+            /*!
+             * Evaluates the guard of the given command in the currently loaded state.
+             */
+            bool isGuardSatisfied(storm::prism::Command const& command) const;
+
+            /*!
+             * Evaluates the likelihood of the given update in the currently loaded state.
+             */
+            ValueType getLikelihood(storm::prism::Update const& update) const;
+
+            /*!
+             * Evaluates the state predicate of the given state-action reward of the given reward model in the currently loaded state.
+             */
+            bool isStateActionRewardEnabled(uint64_t rewardModelIndex, uint64_t rewardIndex) const;
+
+            /*!
+             * Evaluates the value of the given state-action reward of the given reward model in the currently loaded state.
+             */
+            ValueType getStateActionRewardValue(uint64_t rewardModelIndex, uint64_t rewardIndex) const;
+
             // The program used for the generation of next states.
             storm::prism::Program program;
 
@@ -132,6 +164,39 @@ namespace storm {
             // Mappings from module/action indices to the programs players
             std::vector<storm::storage::PlayerIndex> moduleIndexToPlayerIndexMap;
             std::map<uint_fast64_t, storm::storage::PlayerIndex> actionIndexToPlayerIndexMap;
+
+            // For each module an index that narrows down the commands whose guards are possibly satisfied in a state.
+            std::vector<GuardIndex> moduleGuardIndices;
+
+            // An index over the commands of a module that are labeled with one synchronizing action. The candidates
+            // of the index are positions in the (ascending) list of command indices.
+            struct ActionGuardIndex {
+                std::vector<uint64_t> commandIndices;
+                GuardIndex index;
+            };
+
+            // For each module the guard indices of its synchronizing actions.
+            std::vector<std::unordered_map<uint64_t, ActionGuardIndex>> moduleActionGuardIndices;
+
+            // A flag that stores whether the compiled expressions are used instead of the evaluator.
+            bool useCompiledExpressions;
+
+            struct CompiledUpdate {
+                CompiledStateExpression likelihood;
+                // The compiled assignments in the order of the assignments of the update.
+                std::vector<CompiledStateExpression> assignments;
+            };
+
+            // The compiled guards and updates, indexed by the global indices of the commands and updates, respectively.
+            std::vector<CompiledStateExpression> compiledGuards;
+            std::vector<CompiledUpdate> compiledUpdates;
+
+            // The compiled state predicates and values of the state (action) rewards for each of the considered reward models.
+            std::vector<std::vector<std::pair<CompiledStateExpression, CompiledStateExpression>>> compiledStateRewards;
+            std::vector<std::vector<std::pair<CompiledStateExpression, CompiledStateExpression>>> compiledStateActionRewards;
+
+            // The compiled expressions of the terminal states.
+            std::vector<CompiledStateExpression> compiledTerminalStates;
         };
 
     }
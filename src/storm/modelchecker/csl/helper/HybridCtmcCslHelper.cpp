@@ -57,7 +57,7 @@ namespace storm {
                 if (env.solver().isForceSoundness() && env.solver().timeBounded().getRelativeTerminationCriterion()) {
                     // Forward this query to the sparse engine
                     storm::utility::Stopwatch conversionWatch(true);
-                    storm::dd::Odd odd = model.getReachableStates().createOdd();
+                    storm::dd::Odd odd = model.getReachableStatesOdd();
                     storm::storage::SparseMatrix<ValueType> explicitRateMatrix = rateMatrix.toMatrix(odd, odd);
                     std::vector<ValueType> explicitExitRateVector = exitRateVector.toVector(odd);
                     storm::solver::SolveGoal<ValueType> goal;
@@ -285,7 +285,7 @@ namespace storm {
                 
                 // Create ODD for the translation.
                 conversionWatch.start();
-                storm::dd::Odd odd = model.getReachableStates().createOdd();
+                storm::dd::Odd odd = model.getReachableStatesOdd();
                 conversionWatch.stop();
                 
                 // Initialize result to state rewards of the model.
@@ -356,7 +356,7 @@ namespace storm {
                 
                 // Create ODD for the translation.
                 conversionWatch.start();
-                storm::dd::Odd odd = model.getReachableStates().createOdd();
+                storm::dd::Odd odd = model.getReachableStatesOdd();
                 conversionWatch.stop();
                 
                 // Compute the uniformized matrix.
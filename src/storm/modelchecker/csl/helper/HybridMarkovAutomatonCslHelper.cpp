@@ -61,7 +61,7 @@ namespace storm {
                 // If we reach this point, we convert this query to an instance for the sparse engine.
                 storm::utility::Stopwatch conversionWatch(true);
                 // Create ODD for the translation.
-                storm::dd::Odd odd = model.getReachableStates().createOdd();
+                storm::dd::Odd odd = model.getReachableStatesOdd();
                 storm::storage::SparseMatrix<ValueType> explicitTransitionMatrix = transitionMatrix.toMatrix(model.getNondeterminismVariables(), odd, odd);
                 std::vector<ValueType> explicitExitRateVector = exitRateVector.toVector(odd);
                 conversionWatch.stop();
@@ -12,7 +12,7 @@ namespace storm {
                 if (index == explorationInformation.getUnexploredMarker()) {
                     return std::make_pair(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
                 } else {
-                    return boundsPerState[index];
+                    return std::make_pair(getLowerBoundForRowGroup(index), getUpperBoundForRowGroup(index));
                 }
             }
                         
@@ -27,8 +27,8 @@ namespace storm {
             }
             
             template<typename StateType, typename ValueType>
-            ValueType const& Bounds<StateType, ValueType>::getLowerBoundForRowGroup(StateType const& rowGroup) const {
-                return boundsPerState[rowGroup].first;
+            ValueType Bounds<StateType, ValueType>::getLowerBoundForRowGroup(StateType const& rowGroup) const {
+                return boundsPerState[rowGroup].lower.load(std::memory_order_relaxed);
             }
             
             template<typename StateType, typename ValueType>
@@ -42,27 +42,27 @@ namespace storm {
             }
             
             template<typename StateType, typename ValueType>
-            ValueType const& Bounds<StateType, ValueType>::getUpperBoundForRowGroup(StateType const& rowGroup) const {
-                return boundsPerState[rowGroup].second;
+            ValueType Bounds<StateType, ValueType>::getUpperBoundForRowGroup(StateType const& rowGroup) const {
+                return boundsPerState[rowGroup].upper.load(std::memory_order_relaxed);
             }
             
             template<typename StateType, typename ValueType>
-            std::pair<ValueType, ValueType> const& Bounds<StateType, ValueType>::getBoundsForAction(ActionType const& action) const {
-                return boundsPerAction[action];
+            std::pair<ValueType, ValueType> Bounds<StateType, ValueType>::getBoundsForAction(ActionType const& action) const {
+                return std::make_pair(getLowerBoundForAction(action), getUpperBoundForAction(action));
             }
             
             template<typename StateType, typename ValueType>
-            ValueType const& Bounds<StateType, ValueType>::getLowerBoundForAction(ActionType const& action) const {
-                return boundsPerAction[action].first;
+            ValueType Bounds<StateType, ValueType>::getLowerBoundForAction(ActionType const& action) const {
+                return boundsPerAction[action].lower.load(std::memory_order_relaxed);
             }
             
             template<typename StateType, typename ValueType>
-            ValueType const& Bounds<StateType, ValueType>::getUpperBoundForAction(ActionType const& action) const {
-                return boundsPerAction[action].second;
+            ValueType Bounds<StateType, ValueType>::getUpperBoundForAction(ActionType const& action) const {
+                return boundsPerAction[action].upper.load(std::memory_order_relaxed);
             }
             
             template<typename StateType, typename ValueType>
-            ValueType const& Bounds<StateType, ValueType>::getBoundForAction(storm::OptimizationDirection const& direction, ActionType const& action) const {
+            ValueType Bounds<StateType, ValueType>::getBoundForAction(storm::OptimizationDirection const& direction, ActionType const& action) const {
                 if (direction == storm::OptimizationDirection::Maximize) {
                     return getUpperBoundForAction(action);
                 } else {
@@ -78,12 +78,12 @@ namespace storm {
             
             template<typename StateType, typename ValueType>
             void Bounds<StateType, ValueType>::initializeBoundsForNextState(std::pair<ValueType, ValueType> const& vals) {
-                boundsPerState.push_back(vals);
+                boundsPerState.emplace_back(vals);
             }
             
             template<typename StateType, typename ValueType>
             void Bounds<StateType, ValueType>::initializeBoundsForNextAction(std::pair<ValueType, ValueType> const& vals) {
-                boundsPerAction.push_back(vals);
+                boundsPerAction.emplace_back(vals);
             }
             
             template<typename StateType, typename ValueType>
@@ -93,7 +93,7 @@ namespace storm {
             
             template<typename StateType, typename ValueType>
             void Bounds<StateType, ValueType>::setLowerBoundForRowGroup(StateType const& group, ValueType const& value) {
-                boundsPerState[group].first = value;
+                boundsPerState[group].lower.store(value, std::memory_order_relaxed);
             }
             
             template<typename StateType, typename ValueType>
@@ -103,12 +103,13 @@ namespace storm {
             
             template<typename StateType, typename ValueType>
             void Bounds<StateType, ValueType>::setUpperBoundForRowGroup(StateType const& group, ValueType const& value) {
-                boundsPerState[group].second = value;
+                boundsPerState[group].upper.store(value, std::memory_order_relaxed);
             }
             
             template<typename StateType, typename ValueType>
             void Bounds<StateType, ValueType>::setBoundsForAction(ActionType const& action, std::pair<ValueType, ValueType> const& values) {
-                boundsPerAction[action] = values;
+                boundsPerAction[action].lower.store(values.first, std::memory_order_relaxed);
+                boundsPerAction[action].upper.store(values.second, std::memory_order_relaxed);
             }
             
             template<typename StateType, typename ValueType>
@@ -119,25 +120,59 @@ namespace storm {
             
             template<typename StateType, typename ValueType>
             void Bounds<StateType, ValueType>::setBoundsForRowGroup(StateType const& rowGroup, std::pair<ValueType, ValueType> const& values) {
-                boundsPerState[rowGroup] = values;
+                boundsPerState[rowGroup].lower.store(values.first, std::memory_order_relaxed);
+                boundsPerState[rowGroup].upper.store(values.second, std::memory_order_relaxed);
             }
             
             template<typename StateType, typename ValueType>
             bool Bounds<StateType, ValueType>::setLowerBoundOfStateIfGreaterThanOld(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation, ValueType const& newLowerValue) {
-                StateType const& rowGroup = explorationInformation.getRowGroup(state);
-                if (boundsPerState[rowGroup].first < newLowerValue) {
-                    boundsPerState[rowGroup].first = newLowerValue;
-                    return true;
+                return setLowerBoundOfRowGroupIfGreaterThanOld(explorationInformation.getRowGroup(state), newLowerValue);
+            }
+            
+            template<typename StateType, typename ValueType>
+            bool Bounds<StateType, ValueType>::setUpperBoundOfStateIfLessThanOld(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation, ValueType const& newUpperValue) {
+                return setUpperBoundOfRowGroupIfLessThanOld(explorationInformation.getRowGroup(state), newUpperValue);
+            }
+            
+            template<typename StateType, typename ValueType>
+            bool Bounds<StateType, ValueType>::setLowerBoundOfRowGroupIfGreaterThanOld(StateType const& group, ValueType const& newLowerValue) {
+                return setIfGreater(boundsPerState[group].lower, newLowerValue);
+            }
+            
+            template<typename StateType, typename ValueType>
+            bool Bounds<StateType, ValueType>::setUpperBoundOfRowGroupIfLessThanOld(StateType const& group, ValueType const& newUpperValue) {
+                return setIfLess(boundsPerState[group].upper, newUpperValue);
+            }
+            
+            template<typename StateType, typename ValueType>
+            void Bounds<StateType, ValueType>::tightenBoundsForAction(ActionType const& action, std::pair<ValueType, ValueType> const& values) {
+                setIfGreater(boundsPerAction[action].lower, values.first);
+                setIfLess(boundsPerAction[action].upper, values.second);
+            }
+            
+            template<typename StateType, typename ValueType>
+            Bounds<StateType, ValueType>::AtomicBounds::AtomicBounds(std::pair<ValueType, ValueType> const& values) : lower(values.first), upper(values.second) {
+                // Intentionally left empty.
+            }
+            
+            template<typename StateType, typename ValueType>
+            bool Bounds<StateType, ValueType>::setIfGreater(std::atomic<ValueType>& value, ValueType const& newValue) {
+                ValueType oldValue = value.load(std::memory_order_relaxed);
+                while (oldValue < newValue) {
+                    if (value.compare_exchange_weak(oldValue, newValue, std::memory_order_relaxed)) {
+                        return true;
+                    }
                 }
                 return false;
             }
             
             template<typename StateType, typename ValueType>
-            bool Bounds<StateType, ValueType>::setUpperBoundOfStateIfLessThanOld(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation, ValueType const& newUpperValue) {
-                StateType const& rowGroup = explorationInformation.getRowGroup(state);
-                if (newUpperValue < boundsPerState[rowGroup].second) {
-                    boundsPerState[rowGroup].second = newUpperValue;
-                    return true;
+            bool Bounds<StateType, ValueType>::setIfLess(std::atomic<ValueType>& value, ValueType const& newValue) {
+                ValueType oldValue = value.load(std::memory_order_relaxed);
+                while (newValue < oldValue) {
+                    if (value.compare_exchange_weak(oldValue, newValue, std::memory_order_relaxed)) {
+                        return true;
+                    }
                 }
                 return false;
             }
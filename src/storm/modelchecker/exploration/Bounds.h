@@ -1,7 +1,8 @@
 #ifndef STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_BOUNDS_H_
 #define STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_BOUNDS_H_
 
-#include <vector>
+#include <atomic>
+#include <deque>
 #include <utility>
 
 #include "storm/solver/OptimizationDirection.h"
@@ -15,6 +16,11 @@ namespace storm {
             template<typename StateType, typename ValueType>
             class ExplorationInformation;
             
+            /*!
+             * Stores the lower and upper bounds of the row groups (states) and actions of the explored fragment. The
+             * bounds are stored atomically and are never relocated, so that several threads may read and tighten them
+             * concurrently as long as the fragment is not extended at the same time.
+             */
             template<typename StateType, typename ValueType>
             class Bounds {
             public:
@@ -24,19 +30,19 @@ namespace storm {
                 
                 ValueType getLowerBoundForState(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation) const;
                 
-                ValueType const& getLowerBoundForRowGroup(StateType const& rowGroup) const;
+                ValueType getLowerBoundForRowGroup(StateType const& rowGroup) const;
                 
                 ValueType getUpperBoundForState(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation) const;
                 
-                ValueType const& getUpperBoundForRowGroup(StateType const& rowGroup) const;
+                ValueType getUpperBoundForRowGroup(StateType const& rowGroup) const;
                 
-                std::pair<ValueType, ValueType> const& getBoundsForAction(ActionType const& action) const;
+                std::pair<ValueType, ValueType> getBoundsForAction(ActionType const& action) const;
                 
-                ValueType const& getLowerBoundForAction(ActionType const& action) const;
+                ValueType getLowerBoundForAction(ActionType const& action) const;
                 
-                ValueType const& getUpperBoundForAction(ActionType const& action) const;
+                ValueType getUpperBoundForAction(ActionType const& action) const;
                 
-                ValueType const& getBoundForAction(storm::OptimizationDirection const& direction, ActionType const& action) const;
+                ValueType getBoundForAction(storm::OptimizationDirection const& direction, ActionType const& action) const;
                 
                 ValueType getDifferenceOfStateBounds(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation) const;
                 
@@ -62,9 +68,31 @@ namespace storm {
                 
                 bool setUpperBoundOfStateIfLessThanOld(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation, ValueType const& newUpperValue);
                 
+                bool setLowerBoundOfRowGroupIfGreaterThanOld(StateType const& group, ValueType const& newLowerValue);
+                
+                bool setUpperBoundOfRowGroupIfLessThanOld(StateType const& group, ValueType const& newUpperValue);
+                
+                /*!
+                 * Tightens the bounds of the given action, i.e. raises the lower and lowers the upper bound if the
+                 * given values are better than the current ones.
+                 */
+                void tightenBoundsForAction(ActionType const& action, std::pair<ValueType, ValueType> const& values);
+                
             private:
-                std::vector<std::pair<ValueType, ValueType>> boundsPerState;
-                std::vector<std::pair<ValueType, ValueType>> boundsPerAction;
+                struct AtomicBounds {
+                    AtomicBounds(std::pair<ValueType, ValueType> const& values);
+                    
+                    std::atomic<ValueType> lower;
+                    std::atomic<ValueType> upper;
+                };
+                
+                // Atomically sets the value to the given one if the given one is greater (less, respectively).
+                static bool setIfGreater(std::atomic<ValueType>& value, ValueType const& newValue);
+                static bool setIfLess(std::atomic<ValueType>& value, ValueType const& newValue);
+                
+                // Deques are used, because their elements are not moved when new ones are appended.
+                std::deque<AtomicBounds> boundsPerState;
+                std::deque<AtomicBounds> boundsPerAction;
             };
             
         }
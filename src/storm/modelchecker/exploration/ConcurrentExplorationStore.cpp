@@ -0,0 +1,102 @@
+#include "storm/modelchecker/exploration/ConcurrentExplorationStore.h"
+
+#include <mutex>
+
+#include "storm/modelchecker/exploration/ExplorationInformation.h"
+#include "storm/modelchecker/exploration/Bounds.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace exploration_detail {
+            
+            template<typename StateType, typename ValueType>
+            ConcurrentExplorationStore<StateType, ValueType>::ConcurrentExplorationStore(ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, uint64_t bitsPerState) : explorationInformation(explorationInformation), bounds(bounds), stateStorage(bitsPerState), version(0), explorationStepsSinceLastPrecomputation(0), sampledPathsSinceLastPrecomputation(0), finished(false) {
+                // Intentionally left empty.
+            }
+            
+            template<typename StateType, typename ValueType>
+            StateType ConcurrentExplorationStore<StateType, ValueType>::getOrAddStateIndex(storm::generator::CompressedState const& state) {
+                std::unique_lock<MutexType> lock(mutex);
+                StateType newIndex = stateStorage.getNumberOfStates();
+                
+                // Check, if the state was already registered.
+                std::pair<StateType, std::size_t> actualIndexBucketPair = stateStorage.stateToId.findOrAddAndGetBucket(state, newIndex);
+                
+                if (actualIndexBucketPair.first == newIndex) {
+                    explorationInformation.addUnexploredState(newIndex, state);
+                }
+                
+                return actualIndexBucketPair.first;
+            }
+            
+            template<typename StateType, typename ValueType>
+            boost::optional<storm::generator::CompressedState> ConcurrentExplorationStore<StateType, ValueType>::claimUnexploredState(StateType const& state) {
+                std::unique_lock<MutexType> lock(mutex);
+                return explorationInformation.removeUnexploredState(state);
+            }
+            
+            template<typename StateType, typename ValueType>
+            typename ConcurrentExplorationStore<StateType, ValueType>::MutexType& ConcurrentExplorationStore<StateType, ValueType>::getMutex() {
+                return mutex;
+            }
+            
+            template<typename StateType, typename ValueType>
+            ExplorationInformation<StateType, ValueType>& ConcurrentExplorationStore<StateType, ValueType>::getExplorationInformation() {
+                return explorationInformation;
+            }
+            
+            template<typename StateType, typename ValueType>
+            Bounds<StateType, ValueType>& ConcurrentExplorationStore<StateType, ValueType>::getBounds() {
+                return bounds;
+            }
+            
+            template<typename StateType, typename ValueType>
+            uint64_t ConcurrentExplorationStore<StateType, ValueType>::getVersion() const {
+                return version;
+            }
+            
+            template<typename StateType, typename ValueType>
+            void ConcurrentExplorationStore<StateType, ValueType>::increaseVersion() {
+                ++version;
+            }
+            
+            template<typename StateType, typename ValueType>
+            void ConcurrentExplorationStore<StateType, ValueType>::explorationStep() {
+                explorationStepsSinceLastPrecomputation.fetch_add(1, std::memory_order_relaxed);
+            }
+            
+            template<typename StateType, typename ValueType>
+            void ConcurrentExplorationStore<StateType, ValueType>::sampledPath() {
+                sampledPathsSinceLastPrecomputation.fetch_add(1, std::memory_order_relaxed);
+            }
+            
+            template<typename StateType, typename ValueType>
+            std::size_t ConcurrentExplorationStore<StateType, ValueType>::getExplorationStepsSinceLastPrecomputation() const {
+                return explorationStepsSinceLastPrecomputation.load(std::memory_order_relaxed);
+            }
+            
+            template<typename StateType, typename ValueType>
+            std::size_t ConcurrentExplorationStore<StateType, ValueType>::getSampledPathsSinceLastPrecomputation() const {
+                return sampledPathsSinceLastPrecomputation.load(std::memory_order_relaxed);
+            }
+            
+            template<typename StateType, typename ValueType>
+            void ConcurrentExplorationStore<StateType, ValueType>::resetCountsSinceLastPrecomputation() {
+                explorationStepsSinceLastPrecomputation.store(0, std::memory_order_relaxed);
+                sampledPathsSinceLastPrecomputation.store(0, std::memory_order_relaxed);
+            }
+            
+            template<typename StateType, typename ValueType>
+            bool ConcurrentExplorationStore<StateType, ValueType>::isFinished() const {
+                return finished.load();
+            }
+            
+            template<typename StateType, typename ValueType>
+            void ConcurrentExplorationStore<StateType, ValueType>::setFinished() {
+                finished.store(true);
+            }
+            
+            template class ConcurrentExplorationStore<uint32_t, double>;
+        }
+    }
+}
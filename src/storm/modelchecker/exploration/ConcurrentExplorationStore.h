@@ -0,0 +1,101 @@
+#ifndef STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_CONCURRENTEXPLORATIONSTORE_H_
+#define STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_CONCURRENTEXPLORATIONSTORE_H_
+
+#include <atomic>
+#include <shared_mutex>
+
+#include <boost/optional.hpp>
+
+#include "storm/generator/CompressedState.h"
+
+#include "storm/storage/sparse/StateStorage.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace exploration_detail {
+            
+            template<typename StateType, typename ValueType>
+            class ExplorationInformation;
+            
+            template<typename StateType, typename ValueType>
+            class Bounds;
+            
+            /*!
+             * The partial model that is shared by several threads sampling paths concurrently. Reading the partial
+             * model and tightening its bounds (which are stored atomically) requires the mutex to be locked in shared
+             * mode, whereas changing its structure (exploring states, collapsing MECs) requires it to be locked
+             * exclusively.
+             */
+            template<typename StateType, typename ValueType>
+            class ConcurrentExplorationStore {
+            public:
+                typedef std::shared_timed_mutex MutexType;
+                
+                ConcurrentExplorationStore(ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, uint64_t bitsPerState);
+                
+                /*!
+                 * Retrieves the index of the given state. If the state was not yet discovered, it is added as an
+                 * unexplored state. This locks the store exclusively, so the calling thread must not hold the lock.
+                 */
+                StateType getOrAddStateIndex(storm::generator::CompressedState const& state);
+                
+                /*!
+                 * Claims the given state for exploration, such that no other thread explores it. This locks the store
+                 * exclusively, so the calling thread must not hold the lock.
+                 *
+                 * @return The state if it was unexplored and none if it was explored or claimed before.
+                 */
+                boost::optional<storm::generator::CompressedState> claimUnexploredState(StateType const& state);
+                
+                MutexType& getMutex();
+                
+                ExplorationInformation<StateType, ValueType>& getExplorationInformation();
+                
+                Bounds<StateType, ValueType>& getBounds();
+                
+                /*!
+                 * Retrieves the version of the row groups and actions. Sampled paths are only valid as long as the
+                 * version does not change. This requires the store to be locked.
+                 */
+                uint64_t getVersion() const;
+                
+                /*!
+                 * Marks that actions were moved to other row groups (e.g. because of a collapsed MEC), which
+                 * invalidates all paths currently sampled. This requires the store to be locked exclusively.
+                 */
+                void increaseVersion();
+                
+                void explorationStep();
+                
+                void sampledPath();
+                
+                std::size_t getExplorationStepsSinceLastPrecomputation() const;
+                
+                std::size_t getSampledPathsSinceLastPrecomputation() const;
+                
+                void resetCountsSinceLastPrecomputation();
+                
+                bool isFinished() const;
+                
+                void setFinished();
+                
+            private:
+                ExplorationInformation<StateType, ValueType>& explorationInformation;
+                Bounds<StateType, ValueType>& bounds;
+                
+                // The storage that assigns the indices to the states found by all threads.
+                storm::storage::sparse::StateStorage<StateType> stateStorage;
+                
+                MutexType mutex;
+                uint64_t version;
+                
+                std::atomic<std::size_t> explorationStepsSinceLastPrecomputation;
+                std::atomic<std::size_t> sampledPathsSinceLastPrecomputation;
+                std::atomic<bool> finished;
+            };
+            
+        }
+    }
+}
+
+#endif /* STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_CONCURRENTEXPLORATIONSTORE_H_ */
@@ -23,24 +23,14 @@ namespace storm {
             }
             
             template<typename StateType, typename ValueType>
-            typename ExplorationInformation<StateType, ValueType>::const_iterator ExplorationInformation<StateType, ValueType>::findUnexploredState(StateType const& state) const {
-                return unexploredStates.find(state);
-            }
-            
-            template<typename StateType, typename ValueType>
-            typename ExplorationInformation<StateType, ValueType>::const_iterator ExplorationInformation<StateType, ValueType>::unexploredStatesEnd() const {
-                return unexploredStates.end();
-            }
-            
-            template<typename StateType, typename ValueType>
-            void ExplorationInformation<StateType, ValueType>::removeUnexploredState(const_iterator it) {
-                unexploredStates.erase(it);
+            boost::optional<storm::generator::CompressedState> ExplorationInformation<StateType, ValueType>::removeUnexploredState(StateType const& state) {
+                return unexploredStates.remove(state);
             }
             
             template<typename StateType, typename ValueType>
             void ExplorationInformation<StateType, ValueType>::addUnexploredState(StateType const& stateId, storm::generator::CompressedState const& compressedState) {
                 stateToRowGroupMapping.push_back(unexploredMarker);
-                unexploredStates[stateId] = compressedState;
+                unexploredStates.insert(stateId, compressedState);
             }
             
             template<typename StateType, typename ValueType>
@@ -66,22 +56,22 @@ namespace storm {
             
             template<typename StateType, typename ValueType>
             void ExplorationInformation<StateType, ValueType>::newRowGroup() {
-                newRowGroup(matrix.size());
+                newRowGroup(matrix.getRowCount());
             }
             
             template<typename StateType, typename ValueType>
             void ExplorationInformation<StateType, ValueType>::terminateCurrentRowGroup() {
-                rowGroupIndices.push_back(matrix.size());
+                rowGroupIndices.push_back(matrix.getRowCount());
             }
             
             template<typename StateType, typename ValueType>
             void ExplorationInformation<StateType, ValueType>::moveActionToBackOfMatrix(ActionType const& action) {
-                matrix.emplace_back(std::move(matrix[action]));
+                matrix.copyRowToBack(action);
             }
             
             template<typename StateType, typename ValueType>
             StateType ExplorationInformation<StateType, ValueType>::getActionCount() const {
-                return matrix.size();
+                return matrix.getRowCount();
             }
             
             template<typename StateType, typename ValueType>
@@ -135,18 +125,18 @@ namespace storm {
             }
             
             template<typename StateType, typename ValueType>
-            std::vector<storm::storage::MatrixEntry<StateType, ValueType>>& ExplorationInformation<StateType, ValueType>::getRowOfMatrix(ActionType const& row) {
-                return matrix[row];
+            typename ExplorationInformation<StateType, ValueType>::const_rows ExplorationInformation<StateType, ValueType>::getRowOfMatrix(ActionType const& row) const {
+                return matrix.getRow(row);
             }
             
             template<typename StateType, typename ValueType>
-            std::vector<storm::storage::MatrixEntry<StateType, ValueType>> const& ExplorationInformation<StateType, ValueType>::getRowOfMatrix(ActionType const& row) const {
-                return matrix[row];
+            typename ExplorationInformation<StateType, ValueType>::ActionType ExplorationInformation<StateType, ValueType>::addActionToMatrix() {
+                return matrix.addRow();
             }
             
             template<typename StateType, typename ValueType>
-            void ExplorationInformation<StateType, ValueType>::addActionsToMatrix(std::size_t const& count) {
-                matrix.resize(matrix.size() + count);
+            void ExplorationInformation<StateType, ValueType>::addTransitionToLastAction(StateType const& successor, ValueType const& probability) {
+                matrix.addEntryToLastRow(successor, probability);
             }
             
             template<typename StateType, typename ValueType>
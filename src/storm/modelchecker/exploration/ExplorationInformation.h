@@ -3,7 +3,6 @@
 
 #include <vector>
 #include <limits>
-#include <unordered_map>
 
 #include <boost/optional.hpp>
 
@@ -11,9 +10,11 @@
 
 #include "storm/generator/CompressedState.h"
 
-#include "storm/storage/SparseMatrix.h"
 #include "storm/storage/BoostTypes.h"
 
+#include "storm/modelchecker/exploration/PartialMatrix.h"
+#include "storm/modelchecker/exploration/UnexploredStateTable.h"
+
 #include "storm/settings/modules/ExplorationSettings.h"
 
 namespace storm {    
@@ -24,17 +25,17 @@ namespace storm {
             public:
                 typedef StateType ActionType;
                 typedef storm::storage::FlatSet<StateType> StateSet;
-                typedef std::unordered_map<StateType, storm::generator::CompressedState> IdToStateMap;
-                typedef typename IdToStateMap::const_iterator const_iterator;
-                typedef std::vector<std::vector<storm::storage::MatrixEntry<StateType, ValueType>>> MatrixType;
+                typedef PartialMatrix<StateType, ValueType> MatrixType;
+                typedef typename MatrixType::const_rows const_rows;
                 
                 ExplorationInformation(storm::OptimizationDirection const& direction, ActionType const& unexploredMarker = std::numeric_limits<ActionType>::max());
                 
-                const_iterator findUnexploredState(StateType const& state) const;
-                
-                const_iterator unexploredStatesEnd() const;
-                
-                void removeUnexploredState(const_iterator it);
+                /*!
+                 * Removes the given state from the unexplored states.
+                 *
+                 * @return The compressed representation of the state or none if it was not unexplored.
+                 */
+                boost::optional<storm::generator::CompressedState> removeUnexploredState(StateType const& state);
                 
                 void addUnexploredState(StateType const& stateId, storm::generator::CompressedState const& compressedState);
                 
@@ -74,11 +75,19 @@ namespace storm {
                 
                 void addTerminalState(StateType const& state);
                 
-                std::vector<storm::storage::MatrixEntry<StateType, ValueType>>& getRowOfMatrix(ActionType const& row);
+                const_rows getRowOfMatrix(ActionType const& row) const;
                 
-                std::vector<storm::storage::MatrixEntry<StateType, ValueType>> const& getRowOfMatrix(ActionType const& row) const;
+                /*!
+                 * Appends an action without transitions to the matrix.
+                 *
+                 * @return The new action.
+                 */
+                ActionType addActionToMatrix();
                 
-                void addActionsToMatrix(std::size_t const& count);
+                /*!
+                 * Adds a transition to the action that was added last.
+                 */
+                void addTransitionToLastAction(StateType const& successor, ValueType const& probability);
                 
                 bool maximize() const;
                 
@@ -110,7 +119,7 @@ namespace storm {
                 
                 std::vector<StateType> stateToRowGroupMapping;
                 StateType unexploredMarker;
-                IdToStateMap unexploredStates;
+                UnexploredStateTable<StateType> unexploredStates;
                 
                 storm::OptimizationDirection optimizationDirection;
                 StateSet terminalStates;
@@ -0,0 +1,83 @@
+#include "storm/modelchecker/exploration/PartialMatrix.h"
+
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace exploration_detail {
+            
+            template<typename StateType, typename ValueType>
+            PartialMatrix<StateType, ValueType>::PartialMatrix(std::size_t chunkSize) : chunkSize(chunkSize), entryCount(0) {
+                STORM_LOG_ASSERT(chunkSize > 0, "Illegal chunk size.");
+            }
+            
+            template<typename StateType, typename ValueType>
+            StateType PartialMatrix<StateType, ValueType>::addRow() {
+                EntryType const* end = chunks.empty() ? nullptr : chunks.back().data() + chunks.back().size();
+                rows.emplace_back(end, end);
+                return rows.size() - 1;
+            }
+            
+            template<typename StateType, typename ValueType>
+            void PartialMatrix<StateType, ValueType>::addEntryToLastRow(StateType const& column, ValueType const& value) {
+                STORM_LOG_ASSERT(!rows.empty(), "Cannot add entry to empty matrix.");
+                reserveEntry();
+                chunks.back().emplace_back(column, value);
+                rows.back().second = chunks.back().data() + chunks.back().size();
+                ++entryCount;
+            }
+            
+            template<typename StateType, typename ValueType>
+            StateType PartialMatrix<StateType, ValueType>::copyRowToBack(StateType const& row) {
+                StateType newRow = addRow();
+                
+                // The row is accessed by index in each step, because appending may reallocate the vector of rows.
+                std::size_t rowSize = rows[row].second - rows[row].first;
+                for (std::size_t index = 0; index < rowSize; ++index) {
+                    EntryType entry = rows[row].first[index];
+                    addEntryToLastRow(entry.getColumn(), entry.getValue());
+                }
+                return newRow;
+            }
+            
+            template<typename StateType, typename ValueType>
+            typename PartialMatrix<StateType, ValueType>::const_rows PartialMatrix<StateType, ValueType>::getRow(StateType const& row) const {
+                return const_rows(rows[row].first, rows[row].second);
+            }
+            
+            template<typename StateType, typename ValueType>
+            StateType PartialMatrix<StateType, ValueType>::getRowCount() const {
+                return rows.size();
+            }
+            
+            template<typename StateType, typename ValueType>
+            std::size_t PartialMatrix<StateType, ValueType>::getEntryCount() const {
+                return entryCount;
+            }
+            
+            template<typename StateType, typename ValueType>
+            void PartialMatrix<StateType, ValueType>::reserveEntry() {
+                if (!chunks.empty() && chunks.back().size() < chunks.back().capacity()) {
+                    return;
+                }
+                
+                // The last row is always stored at the end of the last chunk.
+                std::size_t rowSize = rows.back().second - rows.back().first;
+                std::vector<EntryType> newChunk;
+                newChunk.reserve(std::max(chunkSize, 2 * (rowSize + 1)));
+                if (rowSize > 0) {
+                    std::vector<EntryType>& lastChunk = chunks.back();
+                    newChunk.insert(newChunk.end(), lastChunk.end() - rowSize, lastChunk.end());
+                    lastChunk.erase(lastChunk.end() - rowSize, lastChunk.end());
+                }
+                chunks.push_back(std::move(newChunk));
+                rows.back().first = chunks.back().data();
+                rows.back().second = chunks.back().data() + rowSize;
+            }
+            
+            template class PartialMatrix<uint32_t, double>;
+        }
+    }
+}
@@ -0,0 +1,80 @@
+#ifndef STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_PARTIALMATRIX_H_
+#define STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_PARTIALMATRIX_H_
+
+#include <vector>
+#include <utility>
+
+#include <boost/range/iterator_range.hpp>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace exploration_detail {
+            
+            /*!
+             * The transition matrix of the explored fragment. Rows can only be appended and only the last row can be
+             * extended. The entries are stored contiguously in large chunks that are never reallocated, so rows
+             * remain valid (and can be read by other threads) while the matrix grows.
+             */
+            template<typename StateType, typename ValueType>
+            class PartialMatrix {
+            public:
+                typedef storm::storage::MatrixEntry<StateType, ValueType> EntryType;
+                typedef boost::iterator_range<EntryType const*> const_rows;
+                
+                /*!
+                 * Creates an empty matrix.
+                 *
+                 * @param chunkSize The number of entries that are allocated at once.
+                 */
+                PartialMatrix(std::size_t chunkSize = 1ull << 16);
+                
+                /*!
+                 * Appends an empty row.
+                 *
+                 * @return The index of the new row.
+                 */
+                StateType addRow();
+                
+                /*!
+                 * Appends an entry to the last row.
+                 */
+                void addEntryToLastRow(StateType const& column, ValueType const& value);
+                
+                /*!
+                 * Appends a copy of the given row.
+                 *
+                 * @return The index of the new row.
+                 */
+                StateType copyRowToBack(StateType const& row);
+                
+                const_rows getRow(StateType const& row) const;
+                
+                StateType getRowCount() const;
+                
+                std::size_t getEntryCount() const;
+                
+            private:
+                /*!
+                 * Makes sure that the last chunk can hold another entry. If a new chunk is needed, the entries of the
+                 * last row are moved to it, so that each row is stored contiguously.
+                 */
+                void reserveEntry();
+                
+                std::size_t chunkSize;
+                
+                // The chunks holding the entries. Each chunk is allocated with its final capacity.
+                std::vector<std::vector<EntryType>> chunks;
+                
+                // The first and past-the-end entry of each row.
+                std::vector<std::pair<EntryType const*, EntryType const*>> rows;
+                
+                std::size_t entryCount;
+            };
+            
+        }
+    }
+}
+
+#endif /* STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_PARTIALMATRIX_H_ */
@@ -1,9 +1,16 @@
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
 
+#include <chrono>
+#include <exception>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+
 #include "storm/modelchecker/exploration/ExplorationInformation.h"
 #include "storm/modelchecker/exploration/StateGeneration.h"
 #include "storm/modelchecker/exploration/Bounds.h"
 #include "storm/modelchecker/exploration/Statistics.h"
+#include "storm/modelchecker/exploration/ConcurrentExplorationStore.h"
 
 #include "storm/generator/CompressedState.h"
 
@@ -29,6 +36,7 @@
 #include "storm/utility/graph.h"
 #include "storm/utility/prism.h"
 
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -37,10 +45,16 @@ namespace storm {
     namespace modelchecker {
         
         template<typename ModelType, typename StateType>
-        SparseExplorationModelChecker<ModelType, StateType>::SparseExplorationModelChecker(storm::prism::Program const& program) : program(program.substituteConstantsFormulas()), randomGenerator(std::chrono::system_clock::now().time_since_epoch().count()), comparator(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision()) {
+        SparseExplorationModelChecker<ModelType, StateType>::SparseExplorationModelChecker(storm::prism::Program const& program) : program(program.substituteConstantsFormulas()), randomGenerator(std::chrono::system_clock::now().time_since_epoch().count()), comparator(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision()), numberOfThreads(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getNumberOfThreads()) {
             // Intentionally left empty.
         }
         
+        template<typename ModelType, typename StateType>
+        void SparseExplorationModelChecker<ModelType, StateType>::setNumberOfThreads(uint64_t numberOfThreads) {
+            STORM_LOG_THROW(numberOfThreads > 0, storm::exceptions::InvalidArgumentException, "The number of threads must be positive.");
+            this->numberOfThreads = numberOfThreads;
+        }
+        
         template<typename ModelType, typename StateType>
         bool SparseExplorationModelChecker<ModelType, StateType>::canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
             storm::logic::Formula const& formula = checkTask.getFormula();
@@ -61,11 +75,17 @@ namespace storm {
             explorationInformation.newRowGroup(0);
             
             std::map<std::string, storm::expressions::Expression> labelToExpressionMapping = program.getLabelToExpressionMapping();
-            StateGeneration<StateType, ValueType> stateGeneration(program, explorationInformation, conditionFormula.toExpression(program.getManager(), labelToExpressionMapping), targetFormula.toExpression(program.getManager(), labelToExpressionMapping));
-            
+            storm::expressions::Expression conditionStateExpression = conditionFormula.toExpression(program.getManager(), labelToExpressionMapping);
+            storm::expressions::Expression targetStateExpression = targetFormula.toExpression(program.getManager(), labelToExpressionMapping);
             
             // Compute and return result.
-            std::tuple<StateType, ValueType, ValueType> boundsForInitialState = performExploration(stateGeneration, explorationInformation);
+            std::tuple<StateType, ValueType, ValueType> boundsForInitialState;
+            if (numberOfThreads > 1) {
+                boundsForInitialState = performConcurrentExploration(numberOfThreads, conditionStateExpression, targetStateExpression, explorationInformation);
+            } else {
+                StateGeneration<StateType, ValueType> stateGeneration(program, explorationInformation, conditionStateExpression, targetStateExpression);
+                boundsForInitialState = performExploration(stateGeneration, explorationInformation);
+            }
             return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(std::get<0>(boundsForInitialState), std::get<1>(boundsForInitialState));
         }
         
@@ -122,6 +142,198 @@ namespace storm {
             return std::make_tuple(initialStateIndex, bounds.getLowerBoundForState(initialStateIndex, explorationInformation), bounds.getUpperBoundForState(initialStateIndex, explorationInformation));
         }
         
+        template<typename ModelType, typename StateType>
+        std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueType> SparseExplorationModelChecker<ModelType, StateType>::performConcurrentExploration(uint64_t numberOfThreads, storm::expressions::Expression const& conditionStateExpression, storm::expressions::Expression const& targetStateExpression, ExplorationInformation<StateType, ValueType>& explorationInformation) const {
+            STORM_LOG_WARN_COND(!explorationInformation.useLocalPrecomputation(), "Local precomputations are not supported when sampling paths concurrently, using global precomputations instead.");
+            
+            Bounds<StateType, ValueType> bounds;
+            
+            // The state generations of all threads assign the indices of states via the shared store. They are created
+            // sequentially as their construction may modify the shared expression manager.
+            std::unique_ptr<ConcurrentExplorationStore<StateType, ValueType>> store;
+            std::function<StateType (storm::generator::CompressedState const&)> stateToIdCallback = [&store] (storm::generator::CompressedState const& state) { return store->getOrAddStateIndex(state); };
+            std::vector<std::unique_ptr<StateGeneration<StateType, ValueType>>> stateGenerations;
+            for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+                stateGenerations.push_back(std::make_unique<StateGeneration<StateType, ValueType>>(program, stateToIdCallback, conditionStateExpression, targetStateExpression));
+            }
+            store = std::make_unique<ConcurrentExplorationStore<StateType, ValueType>>(explorationInformation, bounds, stateGenerations.front()->getStateSize());
+            
+            // Generate the initial state so we know where to start the simulation.
+            stateGenerations.front()->computeInitialStates();
+            STORM_LOG_THROW(stateGenerations.front()->getNumberOfInitialStates() == 1, storm::exceptions::NotSupportedException, "Currently only models with one initial state are supported by the exploration engine.");
+            StateType initialStateIndex = stateGenerations.front()->getFirstInitialState();
+            
+            std::vector<Statistics<StateType, ValueType>> stats(numberOfThreads + 1);
+            std::vector<std::exception_ptr> exceptions(numberOfThreads + 1);
+            auto runThread = [&store, &exceptions] (uint64_t thread, std::function<void ()> const& function) {
+                try {
+                    function();
+                } catch (...) {
+                    exceptions[thread] = std::current_exception();
+                    store->setFinished();
+                }
+            };
+            
+            std::vector<std::thread> threads;
+            for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+                uint64_t seed = randomGenerator();
+                threads.emplace_back(runThread, thread, [this, &store, &stateGenerations, &stats, initialStateIndex, thread, seed] () {
+                    std::default_random_engine generator(seed);
+                    StateActionStack stack;
+                    Statistics<StateType, ValueType>& threadStats = stats[thread];
+                    while (!store->isFinished()) {
+                        bool result = sampleConcurrentPath(*stateGenerations[thread], *store, initialStateIndex, stack, generator, threadStats);
+                        
+                        threadStats.sampledPath();
+                        threadStats.updateMaxPathLength(stack.size());
+                        store->sampledPath();
+                        if (!result) {
+                            STORM_LOG_TRACE("Did not find terminal state.");
+                            continue;
+                        }
+                        
+                        ValueType difference;
+                        {
+                            std::shared_lock<typename ConcurrentExplorationStore<StateType, ValueType>::MutexType> lock(store->getMutex());
+                            difference = store->getBounds().getDifferenceOfStateBounds(initialStateIndex, store->getExplorationInformation());
+                        }
+                        STORM_LOG_DEBUG("Difference after path " << threadStats.pathsSampled << " of thread " << thread << " is " << difference << ".");
+                        if (comparator.isZero(difference)) {
+                            store->setFinished();
+                        }
+                    }
+                });
+            }
+            
+            // The precomputations are performed in the background whenever enough paths were sampled.
+            threads.emplace_back(runThread, numberOfThreads, [this, &store, &stats, &explorationInformation, numberOfThreads] () {
+                while (!store->isFinished()) {
+                    std::size_t explorationSteps = store->getExplorationStepsSinceLastPrecomputation();
+                    std::size_t sampledPaths = store->getSampledPathsSinceLastPrecomputation();
+                    if (explorationInformation.performPrecomputationExcessiveExplorationSteps(explorationSteps) || explorationInformation.performPrecomputationExcessiveSampledPaths(sampledPaths)) {
+                        store->resetCountsSinceLastPrecomputation();
+                        performConcurrentPrecomputation(*store, stats[numberOfThreads]);
+                    } else {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    }
+                }
+            });
+            
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            for (auto const& exception : exceptions) {
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+            }
+            
+            // Show statistics if required.
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+                Statistics<StateType, ValueType> totalStats;
+                for (auto const& threadStats : stats) {
+                    totalStats.add(threadStats);
+                }
+                totalStats.printToStream(std::cout, explorationInformation);
+            }
+            
+            return std::make_tuple(initialStateIndex, bounds.getLowerBoundForState(initialStateIndex, explorationInformation), bounds.getUpperBoundForState(initialStateIndex, explorationInformation));
+        }
+        
+        template<typename ModelType, typename StateType>
+        bool SparseExplorationModelChecker<ModelType, StateType>::sampleConcurrentPath(StateGeneration<StateType, ValueType>& stateGeneration, ConcurrentExplorationStore<StateType, ValueType>& store, StateType const& initialStateIndex, StateActionStack& stack, std::default_random_engine& generator, Statistics<StateType, ValueType>& stats) const {
+            typedef typename ConcurrentExplorationStore<StateType, ValueType>::MutexType MutexType;
+            ExplorationInformation<StateType, ValueType>& explorationInformation = store.getExplorationInformation();
+            Bounds<StateType, ValueType>& bounds = store.getBounds();
+            
+            // Start the search from the initial state.
+            stack.clear();
+            stack.push_back(std::make_pair(initialStateIndex, 0));
+            
+            uint64_t version;
+            {
+                std::shared_lock<MutexType> lock(store.getMutex());
+                version = store.getVersion();
+            }
+            
+            while (!store.isFinished()) {
+                StateType currentStateId = stack.back().first;
+                
+                bool unexplored;
+                {
+                    std::shared_lock<MutexType> lock(store.getMutex());
+                    unexplored = explorationInformation.isUnexplored(currentStateId);
+                }
+                if (unexplored) {
+                    boost::optional<storm::generator::CompressedState> compressedState = store.claimUnexploredState(currentStateId);
+                    if (!compressedState) {
+                        STORM_LOG_TRACE("Abandoning path, because state " << currentStateId << " is explored by another thread.");
+                        return false;
+                    }
+                    
+                    // The behavior is generated without holding the lock, only adding it to the fragment requires it.
+                    ++stats.numberOfExploredStates;
+                    bool isTargetState = false;
+                    storm::generator::StateBehavior<ValueType, StateType> behavior;
+                    bool isTerminalState = expandState(stateGeneration, currentStateId, compressedState.get(), behavior, isTargetState);
+                    if (isTargetState) {
+                        ++stats.numberOfTargetStates;
+                    }
+                    
+                    std::unique_lock<MutexType> lock(store.getMutex());
+                    addExploredState(currentStateId, isTargetState, isTerminalState, behavior, explorationInformation, bounds);
+                }
+                
+                stats.explorationStep();
+                store.explorationStep();
+                
+                std::shared_lock<MutexType> lock(store.getMutex());
+                if (store.getVersion() != version) {
+                    STORM_LOG_TRACE("Abandoning path, because a precomputation changed the explored fragment.");
+                    return false;
+                }
+                if (explorationInformation.isTerminal(currentStateId)) {
+                    // Update the bounds along the path to the terminal state.
+                    STORM_LOG_TRACE("Found terminal state, updating probabilities along path.");
+                    updateProbabilityBoundsAlongSampledPath(stack, explorationInformation, bounds);
+                    return true;
+                }
+                
+                ActionType chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds, generator);
+                stack.back().second = chosenAction;
+                StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds, generator);
+                STORM_LOG_TRACE("Sampled successor " << successor << " according to action " << chosenAction << " of state " << currentStateId << ".");
+                stack.emplace_back(successor, 0);
+            }
+            return false;
+        }
+        
+        template<typename ModelType, typename StateType>
+        void SparseExplorationModelChecker<ModelType, StateType>::performConcurrentPrecomputation(ConcurrentExplorationStore<StateType, ValueType>& store, Statistics<StateType, ValueType>& stats) const {
+            typedef typename ConcurrentExplorationStore<StateType, ValueType>::MutexType MutexType;
+            ExplorationInformation<StateType, ValueType>& explorationInformation = store.getExplorationInformation();
+            Bounds<StateType, ValueType>& bounds = store.getBounds();
+            ++stats.numberOfPrecomputations;
+            STORM_LOG_TRACE("Starting global precomputation in the background.");
+            
+            // Only the translation of the fragment needs to see a consistent state. While the matrix is analyzed, the
+            // other threads may extend the fragment and tighten the bounds, but as only this thread changes the row
+            // groups of explored states, the result still applies to them afterwards.
+            PrecomputationResult result;
+            {
+                std::shared_lock<MutexType> lock(store.getMutex());
+                result.relevantStates = getRelevantStatesForPrecomputation(StateActionStack(), false, explorationInformation, bounds);
+                buildPrecomputationMatrix(result, explorationInformation, bounds);
+            }
+            analyzePrecomputationMatrix(result, explorationInformation, stats);
+            
+            std::unique_lock<MutexType> lock(store.getMutex());
+            applyPrecomputationResult(result, explorationInformation, bounds);
+            if (!result.mecs.empty()) {
+                store.increaseVersion();
+            }
+        }
+        
         template<typename ModelType, typename StateType>
         bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const {
             // Start the search from the initial state.
@@ -134,17 +346,15 @@ namespace storm {
                 STORM_LOG_TRACE("State on top of stack is: " << currentStateId << ".");
                 
                 // If the state is not yet explored, we need to retrieve its behaviors.
-                auto unexploredIt = explorationInformation.findUnexploredState(currentStateId);
-                if (unexploredIt != explorationInformation.unexploredStatesEnd()) {
+                boost::optional<storm::generator::CompressedState> compressedState = explorationInformation.removeUnexploredState(currentStateId);
+                if (compressedState) {
                     STORM_LOG_TRACE("State was not yet explored.");
                     
                     // Explore the previously unexplored state.
-                    storm::generator::CompressedState const& compressedState = unexploredIt->second;
-                    foundTerminalState = exploreState(stateGeneration, currentStateId, compressedState, explorationInformation, bounds, stats);
+                    foundTerminalState = exploreState(stateGeneration, currentStateId, compressedState.get(), explorationInformation, bounds, stats);
                     if (foundTerminalState) {
                         STORM_LOG_TRACE("Aborting sampling of path, because a terminal state was reached.");
                     }
-                    explorationInformation.removeUnexploredState(unexploredIt);
                 } else {
                     // If the state was already explored, we check whether it is a terminal state or not.
                     if (explorationInformation.isTerminal(currentStateId)) {
@@ -160,11 +370,11 @@ namespace storm {
                 if (!foundTerminalState) {
                     // At this point, we can be sure that the state was expanded and that we can sample according to the
                     // probabilities in the matrix.
-                    uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds);
+                    uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds, randomGenerator);
                     stack.back().second = chosenAction;
                     STORM_LOG_TRACE("Sampled action " << chosenAction << " in state " << currentStateId << ".");
                     
-                    StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds);
+                    StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds, randomGenerator);
                     STORM_LOG_TRACE("Sampled successor " << successor << " according to action " << chosenAction << " of state " << currentStateId << ".");
                     
                     // Put the successor state and a dummy action on top of the stack.
@@ -186,85 +396,87 @@ namespace storm {
         
         template<typename ModelType, typename StateType>
         bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGeneration<StateType, ValueType>& stateGeneration, StateType const& currentStateId, storm::generator::CompressedState const& currentState, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const {
-            bool isTerminalState = false;
-            bool isTargetState = false;
-            
             ++stats.numberOfExploredStates;
             
-            // Finally, map the unexplored state to the row group.
-            explorationInformation.assignStateToNextRowGroup(currentStateId);
-            STORM_LOG_TRACE("Assigning row group " << explorationInformation.getRowGroup(currentStateId) << " to state " << currentStateId << ".");
-            
-            // Initialize the bounds, because some of the following computations depend on the values to be available for
-            // all states that have been assigned to a row-group.
-            bounds.initializeBoundsForNextState();
+            bool isTargetState = false;
+            storm::generator::StateBehavior<ValueType, StateType> behavior;
+            bool isTerminalState = expandState(stateGeneration, currentStateId, currentState, behavior, isTargetState);
+            if (isTargetState) {
+                ++stats.numberOfTargetStates;
+            }
             
+            addExploredState(currentStateId, isTargetState, isTerminalState, behavior, explorationInformation, bounds);
+            return isTerminalState;
+        }
+        
+        template<typename ModelType, typename StateType>
+        bool SparseExplorationModelChecker<ModelType, StateType>::expandState(StateGeneration<StateType, ValueType>& stateGeneration, StateType const& currentStateId, storm::generator::CompressedState const& currentState, storm::generator::StateBehavior<ValueType, StateType>& behavior, bool& isTargetState) const {
             // Before generating the behavior of the state, we need to determine whether it's a target state that
             // does not need to be expanded.
             stateGeneration.load(currentState);
             if (stateGeneration.isTargetState()) {
-                ++stats.numberOfTargetStates;
                 isTargetState = true;
-                isTerminalState = true;
+                return true;
             } else if (stateGeneration.isConditionState()) {
                 STORM_LOG_TRACE("Exploring state.");
                 
                 // If it needs to be expanded, we use the generator to retrieve the behavior of the new state.
-                storm::generator::StateBehavior<ValueType, StateType> behavior = stateGeneration.expand();
+                behavior = stateGeneration.expand();
                 STORM_LOG_TRACE("State has " << behavior.getNumberOfChoices() << " choices.");
                 
                 // Clumsily check whether we have found a state that forms a trivial BMEC.
-                bool otherSuccessor = false;
                 for (auto const& choice : behavior) {
                     for (auto const& entry : choice) {
                         if (entry.first != currentStateId) {
-                            otherSuccessor = true;
-                            break;
+                            return false;
                         }
                     }
                 }
-                isTerminalState = !otherSuccessor;
-                
-                // If the state was neither a trivial (non-accepting) terminal state nor a target state, we
-                // need to store its behavior.
-                if (!isTerminalState) {
-                    // Next, we insert the behavior into our matrix structure.
-                    StateType startAction = explorationInformation.getActionCount();
-                    explorationInformation.addActionsToMatrix(behavior.getNumberOfChoices());
-                    
-                    ActionType localAction = 0;
-                    
-                    // Retrieve the lowest state bounds (wrt. to the current optimization direction).
-                    std::pair<ValueType, ValueType> stateBounds = getLowestBounds(explorationInformation.getOptimizationDirection());
-                    
-                    for (auto const& choice : behavior) {
-                        for (auto const& entry : choice) {
-                            explorationInformation.getRowOfMatrix(startAction + localAction).emplace_back(entry.first, entry.second);
-                            STORM_LOG_TRACE("Found transition " << currentStateId << "-[" << (startAction + localAction) << ", " << entry.second << "]-> " << entry.first << ".");
-                        }
-                        
-                        std::pair<ValueType, ValueType> actionBounds = computeBoundsOfAction(startAction + localAction, explorationInformation, bounds);
-                        bounds.initializeBoundsForNextAction(actionBounds);
-                        stateBounds = combineBounds(explorationInformation.getOptimizationDirection(), stateBounds, actionBounds);
-                        
-                        STORM_LOG_TRACE("Initializing bounds of action " << (startAction + localAction) << " to " << bounds.getLowerBoundForAction(startAction + localAction) << " and " << bounds.getUpperBoundForAction(startAction + localAction) << ".");
-                        
-                        ++localAction;
-                    }
-                    
-                    // Terminate the row group.
-                    explorationInformation.terminateCurrentRowGroup();
-                    
-                    bounds.setBoundsForState(currentStateId, explorationInformation, stateBounds);
-                    STORM_LOG_TRACE("Initializing bounds of state " << currentStateId << " to " << bounds.getLowerBoundForState(currentStateId, explorationInformation) << " and " << bounds.getUpperBoundForState(currentStateId, explorationInformation) << ".");
-                }
+                return true;
             } else {
                 // In this case, the state is neither a target state nor a condition state and therefore a rejecting
                 // terminal state.
-                isTerminalState = true;
+                return true;
             }
+        }
+        
+        template<typename ModelType, typename StateType>
+        void SparseExplorationModelChecker<ModelType, StateType>::addExploredState(StateType const& currentStateId, bool isTargetState, bool isTerminalState, storm::generator::StateBehavior<ValueType, StateType> const& behavior, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds) const {
+            // Finally, map the unexplored state to the row group.
+            explorationInformation.assignStateToNextRowGroup(currentStateId);
+            STORM_LOG_TRACE("Assigning row group " << explorationInformation.getRowGroup(currentStateId) << " to state " << currentStateId << ".");
+            
+            // Initialize the bounds, because some of the following computations depend on the values to be available for
+            // all states that have been assigned to a row-group.
+            bounds.initializeBoundsForNextState();
             
-            if (isTerminalState) {
+            // If the state was neither a trivial (non-accepting) terminal state nor a target state, we need to store
+            // its behavior.
+            if (!isTerminalState) {
+                // Retrieve the lowest state bounds (wrt. to the current optimization direction).
+                std::pair<ValueType, ValueType> stateBounds = getLowestBounds(explorationInformation.getOptimizationDirection());
+                
+                // Next, we insert the behavior into our matrix structure.
+                for (auto const& choice : behavior) {
+                    ActionType action = explorationInformation.addActionToMatrix();
+                    for (auto const& entry : choice) {
+                        explorationInformation.addTransitionToLastAction(entry.first, entry.second);
+                        STORM_LOG_TRACE("Found transition " << currentStateId << "-[" << action << ", " << entry.second << "]-> " << entry.first << ".");
+                    }
+                    
+                    std::pair<ValueType, ValueType> actionBounds = computeBoundsOfAction(action, explorationInformation, bounds);
+                    bounds.initializeBoundsForNextAction(actionBounds);
+                    stateBounds = combineBounds(explorationInformation.getOptimizationDirection(), stateBounds, actionBounds);
+                    
+                    STORM_LOG_TRACE("Initializing bounds of action " << action << " to " << bounds.getLowerBoundForAction(action) << " and " << bounds.getUpperBoundForAction(action) << ".");
+                }
+                
+                // Terminate the row group.
+                explorationInformation.terminateCurrentRowGroup();
+                
+                bounds.setBoundsForState(currentStateId, explorationInformation, stateBounds);
+                STORM_LOG_TRACE("Initializing bounds of state " << currentStateId << " to " << bounds.getLowerBoundForState(currentStateId, explorationInformation) << " and " << bounds.getUpperBoundForState(currentStateId, explorationInformation) << ".");
+            } else {
                 STORM_LOG_TRACE("State does not need to be explored, because it is " << (isTargetState ? "a target state" : "a rejecting terminal state") << ".");
                 explorationInformation.addTerminalState(currentStateId);
                 
@@ -277,17 +489,15 @@ namespace storm {
                 }
                 
                 // Increase the size of the matrix, but leave the row empty.
-                explorationInformation.addActionsToMatrix(1);
+                explorationInformation.addActionToMatrix();
                 
                 // Terminate the row group.
                 explorationInformation.newRowGroup();
             }
-            
-            return isTerminalState;
         }
         
         template<typename ModelType, typename StateType>
-        typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseExplorationModelChecker<ModelType, StateType>::sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const {
+        typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseExplorationModelChecker<ModelType, StateType>::sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds, std::default_random_engine& generator) const {
             // Determine the values of all available actions.
             std::vector<std::pair<ActionType, ValueType>> actionValues;
             StateType rowGroup = explorationInformation.getRowGroup(currentStateId);
@@ -321,12 +531,12 @@ namespace storm {
             
             // Now sample from all maximizing actions.
             std::uniform_int_distribution<ActionType> distribution(0, std::distance(actionValues.begin(), end) - 1);
-            return actionValues[distribution(randomGenerator)].first;
+            return actionValues[distribution(generator)].first;
         }
         
         template<typename ModelType, typename StateType>
-        StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorFromAction(ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds) const {
-            std::vector<storm::storage::MatrixEntry<StateType, ValueType>> const& row = explorationInformation.getRowOfMatrix(chosenAction);
+        StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorFromAction(ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds, std::default_random_engine& generator) const {
+            typename ExplorationInformation<StateType, ValueType>::const_rows row = explorationInformation.getRowOfMatrix(chosenAction);
             if (row.size() == 1) {
                 return row.front().getColumn();
             }
@@ -348,14 +558,30 @@ namespace storm {
                 
                 // Now sample according to the probabilities.
                 std::discrete_distribution<StateType> distribution(probabilities.begin(), probabilities.end());
-                return row[distribution(randomGenerator)].getColumn();
+                return row[distribution(generator)].getColumn();
             } else {
                 STORM_LOG_ASSERT(explorationInformation.useUniformHeuristic(), "Illegal next-state heuristic.");
                 std::uniform_int_distribution<ActionType> distribution(0, row.size() - 1);
-                return row[distribution(randomGenerator)].getColumn();
+                return row[distribution(generator)].getColumn();
             }
         }
         
+        template<typename ModelType, typename StateType>
+        struct SparseExplorationModelChecker<ModelType, StateType>::PrecomputationResult {
+            // The states of the fragment considered by the precomputation.
+            std::vector<StateType> relevantStates;
+            
+            // The matrix of the fragment, in which all other states are redirected to an additional sink state.
+            storm::storage::SparseMatrix<ValueType> relevantStatesMatrix;
+            storm::storage::BitVector targetStates;
+            
+            storm::storage::BitVector statesWithProbability0;
+            storm::storage::BitVector statesWithProbability1;
+            
+            // The MECs (other than the one of the sink) that need to be collapsed.
+            std::vector<storm::storage::MaximalEndComponent> mecs;
+        };
+        
         template<typename ModelType, typename StateType>
         bool SparseExplorationModelChecker<ModelType, StateType>::performPrecomputation(StateActionStack const& stack, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const {
             ++stats.numberOfPrecomputations;
@@ -366,12 +592,19 @@ namespace storm {
             // 3. use MEC decomposition to collapse MECs.
             STORM_LOG_TRACE("Starting " << (explorationInformation.useLocalPrecomputation() ? "local" : "global") << " precomputation.");
             
-            // Construct the matrix that represents the fragment of the system contained in the currently sampled path.
-            storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true, 0);
-            
+            PrecomputationResult result;
+            result.relevantStates = getRelevantStatesForPrecomputation(stack, explorationInformation.useLocalPrecomputation(), explorationInformation, bounds);
+            buildPrecomputationMatrix(result, explorationInformation, bounds);
+            analyzePrecomputationMatrix(result, explorationInformation, stats);
+            applyPrecomputationResult(result, explorationInformation, bounds);
+            return true;
+        }
+        
+        template<typename ModelType, typename StateType>
+        std::vector<StateType> SparseExplorationModelChecker<ModelType, StateType>::getRelevantStatesForPrecomputation(StateActionStack const& stack, bool local, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds) const {
             // Determine the set of states that was expanded.
             std::vector<StateType> relevantStates;
-            if (explorationInformation.useLocalPrecomputation()) {
+            if (local) {
                 for (auto const& stateActionPair : stack) {
                     if (explorationInformation.maximize() || !storm::utility::isOne(bounds.getLowerBoundForState(stateActionPair.first, explorationInformation))) {
                         relevantStates.push_back(stateActionPair.first);
@@ -388,16 +621,25 @@ namespace storm {
                     }
                 }
             }
+            return relevantStates;
+        }
+        
+        template<typename ModelType, typename StateType>
+        void SparseExplorationModelChecker<ModelType, StateType>::buildPrecomputationMatrix(PrecomputationResult& result, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds) const {
+            std::vector<StateType> const& relevantStates = result.relevantStates;
             StateType sink = relevantStates.size();
             
+            // Construct the matrix that represents the fragment of the system contained in the currently sampled path.
+            storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true, 0);
+            
             // Create a mapping for faster look-up during the translation of flexible matrix to the real sparse matrix.
             // While doing so, record all target states.
             std::unordered_map<StateType, StateType> relevantStateToNewRowGroupMapping;
-            storm::storage::BitVector targetStates(sink + 1);
+            result.targetStates = storm::storage::BitVector(sink + 1);
             for (StateType index = 0; index < relevantStates.size(); ++index) {
                 relevantStateToNewRowGroupMapping.emplace(relevantStates[index], index);
                 if (storm::utility::isOne(bounds.getLowerBoundForState(relevantStates[index], explorationInformation))) {
-                    targetStates.set(index);
+                    result.targetStates.set(index);
                 }
             }
             
@@ -427,13 +669,18 @@ namespace storm {
             // Then, make the unexpanded state absorbing.
             builder.newRowGroup(currentRow);
             builder.addNextValue(currentRow, sink, storm::utility::one<ValueType>());
-            storm::storage::SparseMatrix<ValueType> relevantStatesMatrix = builder.build();
-            storm::storage::SparseMatrix<ValueType> transposedMatrix = relevantStatesMatrix.transpose(true);
+            result.relevantStatesMatrix = builder.build();
             STORM_LOG_TRACE("Successfully built matrix for precomputation.");
+        }
+        
+        template<typename ModelType, typename StateType>
+        void SparseExplorationModelChecker<ModelType, StateType>::analyzePrecomputationMatrix(PrecomputationResult& result, ExplorationInformation<StateType, ValueType> const& explorationInformation, Statistics<StateType, ValueType>& stats) const {
+            storm::storage::SparseMatrix<ValueType> const& relevantStatesMatrix = result.relevantStatesMatrix;
+            storm::storage::SparseMatrix<ValueType> transposedMatrix = relevantStatesMatrix.transpose(true);
+            StateType sink = result.relevantStates.size();
+            storm::storage::BitVector& targetStates = result.targetStates;
             
             storm::storage::BitVector allStates(sink + 1, true);
-            storm::storage::BitVector statesWithProbability0;
-            storm::storage::BitVector statesWithProbability1;
             if (explorationInformation.maximize()) {
                 // If we are computing maximal probabilities, we first perform a detection of states that have
                 // probability 01 and then additionally perform an MEC decomposition. The reason for this somewhat
@@ -441,9 +688,9 @@ namespace storm {
                 // it anyway. However, when only detecting (accepting) MECs, we do not infer which of the other states
                 // (not contained in MECs) also have probability 0/1.
                 targetStates.set(sink, true);
-                statesWithProbability0 = storm::utility::graph::performProb0A(transposedMatrix, allStates, targetStates);
+                result.statesWithProbability0 = storm::utility::graph::performProb0A(transposedMatrix, allStates, targetStates);
                 targetStates.set(sink, false);
-                statesWithProbability1 = storm::utility::graph::performProb1E(relevantStatesMatrix, relevantStatesMatrix.getRowGroupIndices(), transposedMatrix, allStates, targetStates);
+                result.statesWithProbability1 = storm::utility::graph::performProb1E(relevantStatesMatrix, relevantStatesMatrix.getRowGroupIndices(), transposedMatrix, allStates, targetStates);
                 
                 storm::storage::MaximalEndComponentDecomposition<ValueType> mecDecomposition(relevantStatesMatrix, relevantStatesMatrix.transpose(true));
                 ++stats.ecDetections;
@@ -456,14 +703,13 @@ namespace storm {
                 } else {
                     stats.totalNumberOfEcDetected += mecDecomposition.size() - 1;
                     
-                    // 3. Analyze the MEC decomposition.
-                    for (auto const& mec : mecDecomposition) {
+                    for (auto& mec : mecDecomposition) {
                         // Ignore the (expected) MEC of the sink state.
                         if (mec.containsState(sink)) {
                             continue;
                         }
                         
-                        collapseMec(mec, relevantStates, relevantStatesMatrix, explorationInformation, bounds);
+                        result.mecs.push_back(std::move(mec));
                     }
                 }
             } else {
@@ -472,14 +718,25 @@ namespace storm {
                 // probability 0, we have to mark the sink as being a target. For states with probability 1, however,
                 // we must treat the sink as being rejecting.
                 targetStates.set(sink, true);
-                statesWithProbability0 = storm::utility::graph::performProb0E(relevantStatesMatrix, relevantStatesMatrix.getRowGroupIndices(), transposedMatrix, allStates, targetStates);
+                result.statesWithProbability0 = storm::utility::graph::performProb0E(relevantStatesMatrix, relevantStatesMatrix.getRowGroupIndices(), transposedMatrix, allStates, targetStates);
                 targetStates.set(sink, false);
-                statesWithProbability1 = storm::utility::graph::performProb1A(relevantStatesMatrix, relevantStatesMatrix.getRowGroupIndices(), transposedMatrix, allStates, targetStates);
+                result.statesWithProbability1 = storm::utility::graph::performProb1A(relevantStatesMatrix, relevantStatesMatrix.getRowGroupIndices(), transposedMatrix, allStates, targetStates);
+            }
+        }
+        
+        template<typename ModelType, typename StateType>
+        void SparseExplorationModelChecker<ModelType, StateType>::applyPrecomputationResult(PrecomputationResult const& result, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds) const {
+            std::vector<StateType> const& relevantStates = result.relevantStates;
+            StateType sink = relevantStates.size();
+            
+            // 3. Analyze the MEC decomposition.
+            for (auto const& mec : result.mecs) {
+                collapseMec(mec, relevantStates, result.relevantStatesMatrix, explorationInformation, bounds);
             }
             
             // Set the bounds of the identified states.
-            STORM_LOG_ASSERT((statesWithProbability0 & statesWithProbability1).empty(), "States with probability 0 and 1 overlap.");
-            for (auto state : statesWithProbability0) {
+            STORM_LOG_ASSERT((result.statesWithProbability0 & result.statesWithProbability1).empty(), "States with probability 0 and 1 overlap.");
+            for (auto state : result.statesWithProbability0) {
                 // Skip the sink state as it is not contained in the original system.
                 if (state == sink) {
                     continue;
@@ -489,7 +746,7 @@ namespace storm {
                 bounds.setUpperBoundForState(originalState, explorationInformation, storm::utility::zero<ValueType>());
                 explorationInformation.addTerminalState(originalState);
             }
-            for (auto state : statesWithProbability1) {
+            for (auto state : result.statesWithProbability1) {
                 // Skip the sink state as it is not contained in the original system.
                 if (state == sink) {
                     continue;
@@ -499,7 +756,6 @@ namespace storm {
                 bounds.setLowerBoundForState(originalState, explorationInformation, storm::utility::one<ValueType>());
                 explorationInformation.addTerminalState(originalState);
             }
-            return true;
         }
         
         template<typename ModelType, typename StateType>
@@ -625,8 +881,9 @@ namespace storm {
             // Compute the new lower/upper values of the action.
             std::pair<ValueType, ValueType> newBoundsForAction = computeBoundsOfAction(action, explorationInformation, bounds);
             
-            // And set them as the current value.
-            bounds.setBoundsForAction(action, newBoundsForAction);
+            // And set them as the current value. As bounds only get tighter over time, the values are only changed if they
+            // are better, such that concurrent updates that were computed from older bounds do not loosen them.
+            bounds.tightenBoundsForAction(action, newBoundsForAction);
             
             // Check if we need to update the values for the states.
             if (explorationInformation.maximize()) {
@@ -638,7 +895,7 @@ namespace storm {
                         newBoundsForAction.second = std::max(newBoundsForAction.second, computeBoundOverAllOtherActions(storm::OptimizationDirection::Maximize, state, action, explorationInformation, bounds));
                     }
                     
-                    bounds.setUpperBoundForRowGroup(rowGroup, newBoundsForAction.second);
+                    bounds.setUpperBoundOfRowGroupIfLessThanOld(rowGroup, newBoundsForAction.second);
                 }
             } else {
                 bounds.setUpperBoundOfStateIfLessThanOld(state, explorationInformation, newBoundsForAction.second);
@@ -650,7 +907,7 @@ namespace storm {
                         newBoundsForAction.first = std::min(newBoundsForAction.first, min);
                     }
                     
-                    bounds.setLowerBoundForRowGroup(rowGroup, newBoundsForAction.first);
+                    bounds.setLowerBoundOfRowGroupIfGreaterThanOld(rowGroup, newBoundsForAction.first);
                 }
             }
         }
@@ -9,6 +9,7 @@
 
 #include "storm/generator/CompressedState.h"
 #include "storm/generator/VariableInformation.h"
+#include "storm/generator/StateBehavior.h"
 
 #include "storm/utility/ConstantsComparator.h"
 
@@ -29,6 +30,7 @@ namespace storm {
             template <typename StateType, typename ValueType> class ExplorationInformation;
             template <typename StateType, typename ValueType> class Bounds;
             template <typename StateType, typename ValueType> struct Statistics;
+            template <typename StateType, typename ValueType> class ConcurrentExplorationStore;
         }
         
         using namespace exploration_detail;
@@ -42,23 +44,69 @@ namespace storm {
             
             SparseExplorationModelChecker(storm::prism::Program const& program);
             
+            /*!
+             * Sets the number of threads that sample paths concurrently. By default, the number given in the
+             * exploration settings is used.
+             */
+            void setNumberOfThreads(uint64_t numberOfThreads);
+            
             virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
             
             virtual std::unique_ptr<CheckResult> computeUntilProbabilities(Environment const& env, CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) override;
             
         private:
+            // The results of a precomputation that are applied to the explored fragment.
+            struct PrecomputationResult;
+            
             std::tuple<StateType, ValueType, ValueType> performExploration(StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation) const;
+            
+            /*!
+             * Performs the exploration with several threads that sample paths concurrently and share the explored
+             * fragment and its bounds. Precomputations are performed by an additional background thread.
+             */
+            std::tuple<StateType, ValueType, ValueType> performConcurrentExploration(uint64_t numberOfThreads, storm::expressions::Expression const& conditionStateExpression, storm::expressions::Expression const& targetStateExpression, ExplorationInformation<StateType, ValueType>& explorationInformation) const;
+            
+            /*!
+             * Samples a path as one of several concurrent threads and updates the bounds along it. The path is
+             * abandoned (and false is returned) if it reaches a state that is explored by another thread or if a
+             * precomputation changed the row groups in the meantime.
+             */
+            bool sampleConcurrentPath(StateGeneration<StateType, ValueType>& stateGeneration, ConcurrentExplorationStore<StateType, ValueType>& store, StateType const& initialStateIndex, StateActionStack& stack, std::default_random_engine& generator, Statistics<StateType, ValueType>& stats) const;
+            
+            void performConcurrentPrecomputation(ConcurrentExplorationStore<StateType, ValueType>& store, Statistics<StateType, ValueType>& stats) const;
 
             bool samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
             
             bool exploreState(StateGeneration<StateType, ValueType>& stateGeneration, StateType const& currentStateId, storm::generator::CompressedState const& currentState, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
             
-            ActionType sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const;
+            /*!
+             * Generates the behavior of the given state without modifying the explored fragment.
+             *
+             * @return True iff the state is a terminal state.
+             */
+            bool expandState(StateGeneration<StateType, ValueType>& stateGeneration, StateType const& currentStateId, storm::generator::CompressedState const& currentState, storm::generator::StateBehavior<ValueType, StateType>& behavior, bool& isTargetState) const;
+            
+            /*!
+             * Adds the given (expanded) state to the explored fragment and initializes its bounds.
+             */
+            void addExploredState(StateType const& currentStateId, bool isTargetState, bool isTerminalState, storm::generator::StateBehavior<ValueType, StateType> const& behavior, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds) const;
+            
+            ActionType sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds, std::default_random_engine& generator) const;
 
-            StateType sampleSuccessorFromAction(ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds) const;
+            StateType sampleSuccessorFromAction(ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds, std::default_random_engine& generator) const;
             
             bool performPrecomputation(StateActionStack const& stack, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
             
+            std::vector<StateType> getRelevantStatesForPrecomputation(StateActionStack const& stack, bool local, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds) const;
+            
+            // Builds the matrix of the fragment induced by the relevant states of the given result.
+            void buildPrecomputationMatrix(PrecomputationResult& result, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds) const;
+            
+            // Computes the states with probability 0/1 and the MECs of the matrix of the given result.
+            void analyzePrecomputationMatrix(PrecomputationResult& result, ExplorationInformation<StateType, ValueType> const& explorationInformation, Statistics<StateType, ValueType>& stats) const;
+            
+            void applyPrecomputationResult(PrecomputationResult const& result, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds) const;
+            
             void collapseMec(storm::storage::MaximalEndComponent const& mec, std::vector<StateType> const& relevantStates, storm::storage::SparseMatrix<ValueType> const& relevantStatesMatrix, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds) const;
             
             void updateProbabilityBoundsAlongSampledPath(StateActionStack& stack, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const;
@@ -83,6 +131,9 @@ namespace storm {
             
             // A comparator used to determine whether values are equal.
             storm::utility::ConstantsComparator<ValueType> comparator;
+            
+            // The number of threads that sample paths.
+            uint64_t numberOfThreads;
         };
     }
 }
@@ -23,6 +23,11 @@ namespace storm {
                 };
             }
             
+            template <typename StateType, typename ValueType>
+            StateGeneration<StateType, ValueType>::StateGeneration(storm::prism::Program const& program, std::function<StateType (storm::generator::CompressedState const&)> const& stateToIdCallback, storm::expressions::Expression const& conditionStateExpression, storm::expressions::Expression const& targetStateExpression) : generator(program), stateToIdCallback(stateToIdCallback), stateStorage(generator.getStateSize()), conditionStateExpression(conditionStateExpression), targetStateExpression(targetStateExpression) {
+                // Intentionally left empty.
+            }
+            
             template <typename StateType, typename ValueType>
             void StateGeneration<StateType, ValueType>::load(storm::generator::CompressedState const& state) {
                 generator.load(state);
@@ -38,6 +43,11 @@ namespace storm {
                 return generator.expand(stateToIdCallback);
             }
             
+            template <typename StateType, typename ValueType>
+            uint64_t StateGeneration<StateType, ValueType>::getStateSize() const {
+                return generator.getStateSize();
+            }
+            
             template <typename StateType, typename ValueType>
             bool StateGeneration<StateType, ValueType>::isConditionState() const {
                 return generator.satisfies(conditionStateExpression);
@@ -22,6 +22,12 @@ namespace storm {
             class StateGeneration {
             public:
                 StateGeneration(storm::prism::Program const& program, ExplorationInformation<StateType, ValueType>& explorationInformation, storm::expressions::Expression const& conditionStateExpression, storm::expressions::Expression const& targetStateExpression);
+                
+                /*!
+                 * Creates a state generation that retrieves the indices of states via the given callback (e.g. from a
+                 * store shared by several generations) instead of its own state storage.
+                 */
+                StateGeneration(storm::prism::Program const& program, std::function<StateType (storm::generator::CompressedState const&)> const& stateToIdCallback, storm::expressions::Expression const& conditionStateExpression, storm::expressions::Expression const& targetStateExpression);
                                 
                 void load(storm::generator::CompressedState const& state);
                 
@@ -35,6 +41,8 @@ namespace storm {
                 
                 std::size_t getNumberOfInitialStates() const;
                 
+                uint64_t getStateSize() const;
+                
                 bool isConditionState() const;
                 
                 bool isTargetState() const;
@@ -0,0 +1,115 @@
+#include "storm/modelchecker/exploration/UnexploredStateTable.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace exploration_detail {
+            
+            template<typename StateType>
+            const StateType UnexploredStateTable<StateType>::emptyKey;
+            
+            template<typename StateType>
+            const StateType UnexploredStateTable<StateType>::deletedKey;
+            
+            template<typename StateType>
+            UnexploredStateTable<StateType>::UnexploredStateTable() : keys(1ull << 4, emptyKey), bitsPerState(0), capacityExponent(4), numberOfElements(0), numberOfDeletedSlots(0) {
+                // Intentionally left empty.
+            }
+            
+            template<typename StateType>
+            void UnexploredStateTable<StateType>::insert(StateType const& state, storm::generator::CompressedState const& compressedState) {
+                STORM_LOG_ASSERT(state != emptyKey && state != deletedKey, "Illegal state index.");
+                STORM_LOG_ASSERT(!contains(state), "State is already contained.");
+                if (bitsPerState == 0) {
+                    STORM_LOG_ASSERT(compressedState.size() % 64 == 0, "Size of compressed state must be a multiple of 64.");
+                    bitsPerState = compressedState.size();
+                    values = storm::storage::BitVector(keys.size() * bitsPerState);
+                }
+                STORM_LOG_ASSERT(compressedState.size() == bitsPerState, "Sizes of compressed states do not match.");
+                
+                // Keep the load (including deleted slots) below one half, so probe sequences remain short.
+                if (2 * (numberOfElements + numberOfDeletedSlots + 1) > keys.size()) {
+                    rehash(2 * (numberOfElements + 1) > keys.size() / 2 ? capacityExponent + 1 : capacityExponent);
+                }
+                
+                uint64_t slot = getInitialSlot(state);
+                while (keys[slot] != emptyKey && keys[slot] != deletedKey) {
+                    slot = (slot + 1) & (keys.size() - 1);
+                }
+                if (keys[slot] == deletedKey) {
+                    --numberOfDeletedSlots;
+                }
+                keys[slot] = state;
+                values.set(slot * bitsPerState, compressedState);
+                ++numberOfElements;
+            }
+            
+            template<typename StateType>
+            boost::optional<storm::generator::CompressedState> UnexploredStateTable<StateType>::remove(StateType const& state) {
+                uint64_t slot = findSlot(state);
+                if (slot == keys.size()) {
+                    return boost::none;
+                }
+                keys[slot] = deletedKey;
+                --numberOfElements;
+                ++numberOfDeletedSlots;
+                return values.get(slot * bitsPerState, bitsPerState);
+            }
+            
+            template<typename StateType>
+            bool UnexploredStateTable<StateType>::contains(StateType const& state) const {
+                return findSlot(state) != keys.size();
+            }
+            
+            template<typename StateType>
+            std::size_t UnexploredStateTable<StateType>::size() const {
+                return numberOfElements;
+            }
+            
+            template<typename StateType>
+            uint64_t UnexploredStateTable<StateType>::findSlot(StateType const& state) const {
+                uint64_t slot = getInitialSlot(state);
+                while (keys[slot] != emptyKey) {
+                    if (keys[slot] == state) {
+                        return slot;
+                    }
+                    slot = (slot + 1) & (keys.size() - 1);
+                }
+                return keys.size();
+            }
+            
+            template<typename StateType>
+            uint64_t UnexploredStateTable<StateType>::getInitialSlot(StateType const& state) const {
+                // Fibonacci hashing spreads the (mostly consecutive) state indices over the table.
+                return (static_cast<uint64_t>(state) * 11400714819323198485ull) >> (64 - capacityExponent);
+            }
+            
+            template<typename StateType>
+            void UnexploredStateTable<StateType>::rehash(uint64_t newCapacityExponent) {
+                std::vector<StateType> oldKeys = std::move(keys);
+                storm::storage::BitVector oldValues = std::move(values);
+                
+                capacityExponent = newCapacityExponent;
+                keys = std::vector<StateType>(1ull << capacityExponent, emptyKey);
+                values = storm::storage::BitVector(keys.size() * bitsPerState);
+                numberOfDeletedSlots = 0;
+                
+                for (uint64_t oldSlot = 0; oldSlot < oldKeys.size(); ++oldSlot) {
+                    StateType const& state = oldKeys[oldSlot];
+                    if (state == emptyKey || state == deletedKey) {
+                        continue;
+                    }
+                    uint64_t slot = getInitialSlot(state);
+                    while (keys[slot] != emptyKey) {
+                        slot = (slot + 1) & (keys.size() - 1);
+                    }
+                    keys[slot] = state;
+                    values.set(slot * bitsPerState, oldValues.get(oldSlot * bitsPerState, bitsPerState));
+                }
+            }
+            
+            template class UnexploredStateTable<uint32_t>;
+        }
+    }
+}
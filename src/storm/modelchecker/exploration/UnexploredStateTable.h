@@ -0,0 +1,76 @@
+#ifndef STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_UNEXPLOREDSTATETABLE_H_
+#define STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_UNEXPLOREDSTATETABLE_H_
+
+#include <vector>
+#include <limits>
+
+#include <boost/optional.hpp>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace exploration_detail {
+            
+            /*!
+             * Maps the indices of the discovered but unexplored states to their compressed representation. The table
+             * uses open addressing with linear probing and stores all compressed states in a single bit vector, so
+             * adding a state does not allocate unless the table grows.
+             */
+            template<typename StateType>
+            class UnexploredStateTable {
+            public:
+                UnexploredStateTable();
+                
+                /*!
+                 * Adds the given state, which must not be contained in the table.
+                 */
+                void insert(StateType const& state, storm::generator::CompressedState const& compressedState);
+                
+                /*!
+                 * Removes the given state from the table.
+                 *
+                 * @return The compressed representation of the state or none if the state was not contained.
+                 */
+                boost::optional<storm::generator::CompressedState> remove(StateType const& state);
+                
+                bool contains(StateType const& state) const;
+                
+                std::size_t size() const;
+                
+            private:
+                static const StateType emptyKey = std::numeric_limits<StateType>::max();
+                static const StateType deletedKey = std::numeric_limits<StateType>::max() - 1;
+                
+                /*!
+                 * Retrieves the slot that holds the given state or the number of slots if there is none.
+                 */
+                uint64_t findSlot(StateType const& state) const;
+                
+                uint64_t getInitialSlot(StateType const& state) const;
+                
+                /*!
+                 * Rehashes the table into a table with the given number of slots (a power of two).
+                 */
+                void rehash(uint64_t newCapacityExponent);
+                
+                // The state stored in each slot (or a marker for empty or deleted slots).
+                std::vector<StateType> keys;
+                
+                // The compressed states, stored consecutively for all slots.
+                storm::storage::BitVector values;
+                
+                // The number of bits of each compressed state (known once the first state is inserted).
+                uint64_t bitsPerState;
+                
+                uint64_t capacityExponent;
+                std::size_t numberOfElements;
+                std::size_t numberOfDeletedSlots;
+            };
+            
+        }
+    }
+}
+
+#endif /* STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_UNEXPLOREDSTATETABLE_H_ */
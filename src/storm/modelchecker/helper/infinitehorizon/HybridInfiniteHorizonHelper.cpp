@@ -35,7 +35,7 @@ namespace storm {
             std::unique_ptr<HybridQuantitativeCheckResult<DdType, ValueType>> HybridInfiniteHorizonHelper<ValueType, DdType, Nondeterministic>::computeLongRunAverageProbabilities(Environment const& env, storm::dd::Bdd<DdType> const& psiStates) {
                 // Convert this query to an instance for the sparse engine.
                 // Create ODD for the translation.
-                storm::dd::Odd odd = _model.getReachableStates().createOdd();
+                storm::dd::Odd odd = _model.getReachableStatesOdd();
                 // Translate all required components
                 storm::storage::SparseMatrix<ValueType> explicitTransitionMatrix;
                 if (Nondeterministic) {
@@ -60,7 +60,7 @@ namespace storm {
             std::unique_ptr<HybridQuantitativeCheckResult<DdType, ValueType>> HybridInfiniteHorizonHelper<ValueType, DdType, Nondeterministic>::computeLongRunAverageRewards(Environment const& env, storm::models::symbolic::StandardRewardModel<DdType, ValueType> const& rewardModel) {
                 // Convert this query to an instance for the sparse engine.
                 // Create ODD for the translation.
-                storm::dd::Odd odd = _model.getReachableStates().createOdd();
+                storm::dd::Odd odd = _model.getReachableStatesOdd();
                 
                 // Translate all required components
                 // Transitions and rewards
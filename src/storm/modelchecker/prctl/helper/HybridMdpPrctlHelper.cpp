@@ -12,6 +12,7 @@
 #include "storm/utility/constants.h"
 
 #include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/models/symbolic/ExplicitSubmatrixCache.h"
 
 #include "storm/modelchecker/prctl/helper/SparseMdpEndComponentInformation.h"
 #include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
@@ -181,7 +182,7 @@ namespace storm {
                         
                         // Create the ODD for the translation between symbolic and explicit storage.
                         conversionWatch.start();
-                        storm::dd::Odd odd = extendedMaybeStates.createOdd();
+                        storm::dd::Odd odd = model.getExplicitSubmatrixCache().getOdd(extendedMaybeStates);
                         conversionWatch.stop();
                         
                         // Convert the maybe states BDD to an ADD.
@@ -192,8 +193,13 @@ namespace storm {
                         storm::dd::Add<DdType, ValueType> submatrix = transitionMatrix * maybeStatesAdd;
                         
                         // If the maybe states were extended, we generate the explicit representation slightly differently.
-                        std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation;
+                        // As the explicit matrix may be shared with the cache of the model, it is only accessed through a
+                        // pointer to a constant matrix.
+                        std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitMatrix;
+                        std::vector<ValueType> explicitVector;
                         if (extendMaybeStates) {
+                            std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation;
+
                             // Eliminate all transitions to non-extended-maybe states.
                             submatrix *= extendedMaybeStates.template toAdd<ValueType>().swapVariables(model.getRowColumnMetaVariablePairs());
 
@@ -210,7 +216,8 @@ namespace storm {
 
                             // Eliminate the end components and remove the states that are not interesting (target or non-filter).
                             eliminateEndComponentsAndExtendedStatesUntilProbabilities(explicitRepresentation, solverRequirementsData, targetStates);
-                            
+                            explicitMatrix = std::make_shared<storm::storage::SparseMatrix<ValueType> const>(std::move(explicitRepresentation.first));
+                            explicitVector = std::move(explicitRepresentation.second);
                         } else {
                             // Then compute the vector that contains the one-step probabilities to a state with probability 1 for all
                             // maybe states.
@@ -224,20 +231,21 @@ namespace storm {
                             
                             // Translate the symbolic matrix/vector to their explicit representations and solve the equation system.
                             conversionWatch.start();
-                            explicitRepresentation = submatrix.toMatrixVector(subvector, model.getNondeterminismVariables(), odd, odd);
+                            storm::dd::Bdd<DdType> enabledChoices = submatrix.notZero().existsAbstract(model.getColumnVariables()) || subvector.notZero();
+                            std::tie(explicitMatrix, explicitVector) = model.getExplicitSubmatrixCache().getMatrixVector(submatrix, subvector, enabledChoices, model.getRowVariables(), model.getColumnVariables(), model.getNondeterminismVariables(), maybeStates);
                             conversionWatch.stop();
 
                             if (requirements.validInitialScheduler()) {
-                                solverRequirementsData.initialScheduler = computeValidInitialSchedulerForUntilProbabilities<ValueType>(explicitRepresentation.first, explicitRepresentation.second);
+                                solverRequirementsData.initialScheduler = computeValidInitialSchedulerForUntilProbabilities<ValueType>(*explicitMatrix, explicitVector);
                             }
                         }
                         
                         STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
                         
                         // Create the solution vector.
-                        std::vector<ValueType> x(explicitRepresentation.first.getRowGroupCount(), storm::utility::zero<ValueType>());
+                        std::vector<ValueType> x(explicitMatrix->getRowGroupCount(), storm::utility::zero<ValueType>());
                         
-                        std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(explicitRepresentation.first));
+                        std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, *explicitMatrix);
                         
                         // Set whether the equation system will have a unique solution / no end components
                         solver->setHasUniqueSolution(hasNoEndComponents);
@@ -248,7 +256,7 @@ namespace storm {
                         }
                         solver->setBounds(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
                         solver->setRequirementsChecked();
-                        solver->solveEquations(env, dir, x, explicitRepresentation.second);
+                        solver->solveEquations(env, dir, x, explicitVector);
                         
                         // If we included some target and non-filter states in the ODD, we need to expand the result from the solver.
                         if (requirements.uniqueSolution() && solverRequirementsData.ecInformation) {
@@ -259,7 +267,7 @@ namespace storm {
 
                         // If we extended the maybe states, we create a new ODD containing only the propery maybe states.
                         if (extendMaybeStates) {
-                            odd = maybeStates.createOdd();
+                            odd = model.getExplicitSubmatrixCache().getOdd(maybeStates);
                         }
                         
                         // Return a hybrid check result that stores the numerical values explicitly.
@@ -302,7 +310,7 @@ namespace storm {
                     
                     // Create the ODD for the translation between symbolic and explicit storage.
                     conversionWatch.start();
-                    storm::dd::Odd odd = maybeStates.createOdd();
+                    storm::dd::Odd odd = model.getExplicitSubmatrixCache().getOdd(maybeStates);
                     conversionWatch.stop();
                     
                     // Create the matrix and the vector for the equation system.
@@ -325,11 +333,12 @@ namespace storm {
                     
                     // Translate the symbolic matrix/vector to their explicit representations.
                     conversionWatch.start();
-                    std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation = submatrix.toMatrixVector(subvector, model.getNondeterminismVariables(), odd, odd);
+                    storm::dd::Bdd<DdType> enabledChoices = submatrix.notZero().existsAbstract(model.getColumnVariables()) || subvector.notZero();
+                    std::pair<std::shared_ptr<storm::storage::SparseMatrix<ValueType> const>, std::vector<ValueType>> explicitRepresentation = model.getExplicitSubmatrixCache().getMatrixVector(submatrix, subvector, enabledChoices, model.getRowVariables(), model.getColumnVariables(), model.getNondeterminismVariables(), maybeStates);
                     conversionWatch.stop();
                     STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-                    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitRepresentation.first);
+                    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *explicitRepresentation.first);
                     multiplier->repeatedMultiplyAndReduce(env, dir, x, &explicitRepresentation.second, stepBound);
                     
                     // Return a hybrid check result that stores the numerical values explicitly.
@@ -347,7 +356,7 @@ namespace storm {
                 storm::utility::Stopwatch conversionWatch;
                 
                 // Create the ODD for the translation between symbolic and explicit storage.
-                storm::dd::Odd odd = model.getReachableStates().createOdd();
+                storm::dd::Odd odd = model.getReachableStatesOdd();
                 
                 // Translate the symbolic matrix to its explicit representations.
                 storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(model.getNondeterminismVariables(), odd, odd);
@@ -379,7 +388,7 @@ namespace storm {
                 storm::utility::Stopwatch conversionWatch(true);
                 
                 // Create the ODD for the translation between symbolic and explicit storage.
-                storm::dd::Odd odd = model.getReachableStates().createOdd();
+                storm::dd::Odd odd = model.getReachableStatesOdd();
                 
                 // Translate the symbolic matrix/vector to their explicit representations.
                 std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation = transitionMatrix.toMatrixVector(totalRewardVector, model.getNondeterminismVariables(), odd, odd);
@@ -579,7 +588,7 @@ namespace storm {
                         
                         // Create the ODD for the translation between symbolic and explicit storage.
                         conversionWatch.start();
-                        storm::dd::Odd odd = requiredMaybeStates.createOdd();
+                        storm::dd::Odd odd = model.getExplicitSubmatrixCache().getOdd(requiredMaybeStates);
                         conversionWatch.stop();
                         
                         // Create the matrix and the vector for the equation system.
@@ -595,22 +604,25 @@ namespace storm {
                         // Then compute the reward vector to use in the computation.
                         storm::dd::Add<DdType, ValueType> subvector = rewardModel.getTotalRewardVector(maybeStatesAdd, choiceFilterAdd, submatrix, model.getColumnVariables());
 
-                        conversionWatch.start();
-                        std::vector<uint_fast64_t> rowGroupSizes = (submatrix.notZero().existsAbstract(model.getColumnVariables()) || subvector.notZero()).template toAdd<uint_fast64_t>().sumAbstract(model.getNondeterminismVariables()).toVector(odd);
-                        conversionWatch.stop();
+                        // The choices are determined before cutting away the columns.
+                        storm::dd::Bdd<DdType> enabledChoices = submatrix.notZero().existsAbstract(model.getColumnVariables()) || subvector.notZero();
                         
                         // Finally cut away all columns targeting non-maybe states (or non-(maybe or target) states, respectively).
                         submatrix *= extendMaybeStates ? maybeStatesWithTargetStates.swapVariables(model.getRowColumnMetaVariablePairs()).template toAdd<ValueType>() : maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
                         
                         // Translate the symbolic matrix/vector to their explicit representations.
                         conversionWatch.start();
-                        std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation = submatrix.toMatrixVector(std::move(rowGroupSizes), subvector, model.getRowVariables(), model.getColumnVariables(), model.getNondeterminismVariables(), odd, odd);
+                        std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitMatrix;
+                        std::vector<ValueType> explicitVector;
+                        std::tie(explicitMatrix, explicitVector) = model.getExplicitSubmatrixCache().getMatrixVector(submatrix, subvector, enabledChoices, model.getRowVariables(), model.getColumnVariables(), model.getNondeterminismVariables(), requiredMaybeStates);
                         conversionWatch.stop();
                         STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
                         // Fulfill the solver's requirements.
                         SolverRequirementsData<ValueType> solverRequirementsData;
                         if (extendMaybeStates) {
+                            // The explicit matrix is shared with the cache of the model, so we modify a copy of it.
+                            std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation(*explicitMatrix, std::move(explicitVector));
                             storm::storage::BitVector targetStates = computeTargetStatesForReachabilityRewardsFromExplicitRepresentation(explicitRepresentation.first);
                             solverRequirementsData.properMaybeStates = ~targetStates;
 
@@ -636,10 +648,12 @@ namespace storm {
                                 // of the scheduler, we have to get rid of them now.
                                 eliminateExtendedStatesFromExplicitRepresentation(explicitRepresentation, solverRequirementsData.initialScheduler, solverRequirementsData.properMaybeStates);
                             }
+                            explicitMatrix = std::make_shared<storm::storage::SparseMatrix<ValueType> const>(std::move(explicitRepresentation.first));
+                            explicitVector = std::move(explicitRepresentation.second);
                         }
                         
                         // Create the solution vector.
-                        std::vector<ValueType> x(explicitRepresentation.first.getRowGroupCount(), storm::utility::zero<ValueType>());
+                        std::vector<ValueType> x(explicitMatrix->getRowGroupCount(), storm::utility::zero<ValueType>());
                         
                         // Now solve the resulting equation system.
                         std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env);
@@ -650,10 +664,10 @@ namespace storm {
                         
                         // If the solver requires upper bounds, compute them now.
                         if (requirements.upperBounds()) {
-                            setUpperRewardBounds(*solver, dir, explicitRepresentation.first, explicitRepresentation.second, solverRequirementsData.oneStepTargetProbabilities.get());
+                            setUpperRewardBounds(*solver, dir, *explicitMatrix, explicitVector, solverRequirementsData.oneStepTargetProbabilities.get());
                         }
                         
-                        solver->setMatrix(std::move(explicitRepresentation.first));
+                        solver->setMatrix(*explicitMatrix);
                         
                         // Move the scheduler to the solver.
                         if (solverRequirementsData.initialScheduler) {
@@ -662,7 +676,7 @@ namespace storm {
                         
                         solver->setLowerBound(storm::utility::zero<ValueType>());
                         solver->setRequirementsChecked();
-                        solver->solveEquations(env, dir, x, explicitRepresentation.second);
+                        solver->solveEquations(env, dir, x, explicitVector);
 
                         // If we eliminated end components, we need to extend the solution vector.
                         if (requirements.uniqueSolution() && solverRequirementsData.ecInformation) {
@@ -673,7 +687,7 @@ namespace storm {
 
                         // If we extended the maybe states, we create a new ODD that only contains proper maybe states.
                         if (extendMaybeStates) {
-                            odd = maybeStates.createOdd();
+                            odd = model.getExplicitSubmatrixCache().getOdd(maybeStates);
                         }
 
                         // Return a hybrid check result that stores the numerical values explicitly.
@@ -0,0 +1,131 @@
+#include "storm/modelchecker/prctl/helper/SparseQuotientViewPrctlHelper.h"
+
+#include <utility>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BisimulationSettings.h"
+
+#include "storm/solver/QuotientMultiplier.h"
+#include "storm/storage/bisimulation/DeterministicModelBisimulationDecomposition.h"
+#include "storm/storage/bisimulation/NondeterministicModelBisimulationDecomposition.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/vector.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+
+            namespace {
+                template<typename ValueType>
+                std::pair<storm::storage::BitVector, storm::storage::BitVector> computeStatesWithProbability01(storm::models::sparse::Dtmc<ValueType> const& model, boost::optional<storm::solver::OptimizationDirection> const&, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                    return storm::utility::graph::performProb01(model.getBackwardTransitions(), phiStates, psiStates);
+                }
+
+                template<typename ValueType>
+                std::pair<storm::storage::BitVector, storm::storage::BitVector> computeStatesWithProbability01(storm::models::sparse::Mdp<ValueType> const& model, boost::optional<storm::solver::OptimizationDirection> const& dir, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                    if (storm::solver::minimize(dir.get())) {
+                        return storm::utility::graph::performProb01Min(model, phiStates, psiStates);
+                    } else {
+                        return storm::utility::graph::performProb01Max(model, phiStates, psiStates);
+                    }
+                }
+
+                template<typename ModelType, typename DecompositionType>
+                storm::storage::bisimulation::QuotientView<typename ModelType::ValueType> computeQuotientViewWithDecomposition(ModelType const& model, boost::optional<storm::solver::OptimizationDirection> const& dir, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                    typename DecompositionType::Options options;
+                    options.preserveUntilProbabilities(phiStates, psiStates, dir);
+                    options.buildQuotient = false;
+                    options.signatureBasedRefinement = storm::settings::getModule<storm::settings::modules::BisimulationSettings>().isSparseSignatureRefinementSet();
+                    DecompositionType decomposition(model, options);
+                    decomposition.computeBisimulationDecomposition();
+                    return decomposition.getQuotientView();
+                }
+
+                template<typename ValueType>
+                storm::storage::bisimulation::QuotientView<ValueType> computeQuotientView(storm::models::sparse::Dtmc<ValueType> const& model, boost::optional<storm::solver::OptimizationDirection> const& dir, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                    return computeQuotientViewWithDecomposition<storm::models::sparse::Dtmc<ValueType>, storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<ValueType>>>(model, dir, phiStates, psiStates);
+                }
+
+                template<typename ValueType>
+                storm::storage::bisimulation::QuotientView<ValueType> computeQuotientView(storm::models::sparse::Mdp<ValueType> const& model, boost::optional<storm::solver::OptimizationDirection> const& dir, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                    return computeQuotientViewWithDecomposition<storm::models::sparse::Mdp<ValueType>, storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Mdp<ValueType>>>(model, dir, phiStates, psiStates);
+                }
+            }
+
+            template<typename ModelType>
+            std::vector<typename ModelType::ValueType> SparseQuotientViewPrctlHelper<ModelType>::computeUntilProbabilities(Environment const& env, boost::optional<storm::solver::OptimizationDirection> const& dir, ModelType const& model, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                STORM_LOG_THROW(model.isNondeterministicModel() == static_cast<bool>(dir), storm::exceptions::InvalidArgumentException, "An optimization direction has to be given iff the model is nondeterministic.");
+
+                // The states with probability 0 and 1 keep their values during the value iteration.
+                std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 = computeStatesWithProbability01(model, dir, phiStates, psiStates);
+                storm::storage::bisimulation::QuotientView<ValueType> quotient = computeQuotientView(model, dir, phiStates, psiStates);
+                STORM_LOG_INFO("Computing until probabilities on a view of the bisimulation quotient with " << quotient.getNumberOfBlocks() << " blocks (the model has " << model.getNumberOfStates() << " states).");
+                storm::storage::BitVector blocksWithProbability0 = quotient.projectStates(statesWithProbability01.first);
+                storm::storage::BitVector blocksWithProbability1 = quotient.projectStates(statesWithProbability01.second);
+
+                std::vector<ValueType> x(quotient.getNumberOfBlocks(), storm::utility::zero<ValueType>());
+                storm::utility::vector::setVectorValues(x, blocksWithProbability1, storm::utility::one<ValueType>());
+                std::vector<ValueType> y = x;
+
+                storm::solver::QuotientMultiplier<ValueType> multiplier(quotient);
+                ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+                bool relative = env.solver().minMax().getRelativeTerminationCriterion();
+                uint64_t maximalNumberOfIterations = env.solver().minMax().getMaximalNumberOfIterations();
+
+                // Value iteration starting from below converges to the least fixed point, i.e., the (optimal) probabilities.
+                bool converged = (blocksWithProbability0 | blocksWithProbability1).full();
+                uint64_t iterations = 0;
+                while (!converged && iterations < maximalNumberOfIterations && !storm::utility::resources::isTerminate()) {
+                    if (dir) {
+                        multiplier.multiplyAndReduce(env, dir.get(), x, nullptr, y);
+                    } else {
+                        multiplier.multiply(env, x, nullptr, y);
+                    }
+                    storm::utility::vector::setVectorValues(y, blocksWithProbability0, storm::utility::zero<ValueType>());
+                    storm::utility::vector::setVectorValues(y, blocksWithProbability1, storm::utility::one<ValueType>());
+                    converged = storm::utility::vector::equalModuloPrecision(x, y, precision, relative);
+                    std::swap(x, y);
+                    ++iterations;
+                }
+                STORM_LOG_WARN_COND(converged, "Value iteration on the bisimulation quotient did not converge within " << iterations << " iterations.");
+                STORM_LOG_INFO("Value iteration on the bisimulation quotient performed " << iterations << " iterations.");
+
+                return quotient.liftStateVector(x);
+            }
+
+#ifdef STORM_HAVE_CARL
+            template<>
+            std::vector<storm::RationalFunction> SparseQuotientViewPrctlHelper<storm::models::sparse::Dtmc<storm::RationalFunction>>::computeUntilProbabilities(Environment const&, boost::optional<storm::solver::OptimizationDirection> const&, storm::models::sparse::Dtmc<storm::RationalFunction> const&, storm::storage::BitVector const&, storm::storage::BitVector const&) {
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Computing probabilities on the bisimulation quotient view is not supported for parametric models.");
+            }
+#endif
+
+            template class SparseQuotientViewPrctlHelper<storm::models::sparse::Dtmc<double>>;
+            template class SparseQuotientViewPrctlHelper<storm::models::sparse::Mdp<double>>;
+
+#ifdef STORM_HAVE_CARL
+            template class SparseQuotientViewPrctlHelper<storm::models::sparse::Dtmc<storm::RationalNumber>>;
+            template class SparseQuotientViewPrctlHelper<storm::models::sparse::Mdp<storm::RationalNumber>>;
+            template class SparseQuotientViewPrctlHelper<storm::models::sparse::Dtmc<storm::RationalFunction>>;
+#endif
+        }
+    }
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+
+    class Environment;
+
+    namespace modelchecker {
+        namespace helper {
+
+            /*!
+             * Computes reachability probabilities of a sparse DTMC or MDP on an implicit view of its strong bisimulation
+             * quotient. The bisimulation preserving the probabilities is computed without building the quotient model and
+             * value iteration is performed on the blocks with the QuotientMultiplier, which aggregates the rows of the block
+             * representatives on the fly. Hence, the peak memory consumption is that of the original model plus a few
+             * vectors over the states.
+             */
+            template<typename ModelType>
+            class SparseQuotientViewPrctlHelper {
+            public:
+                typedef typename ModelType::ValueType ValueType;
+
+                /*!
+                 * Computes the probabilities of satisfying phi U psi for all states of the model. The precision and the
+                 * maximal number of iterations of the value iteration are taken from the min-max solver environment.
+                 *
+                 * @param dir The optimization direction, which needs to be given iff the model is nondeterministic.
+                 * @return The probabilities for the states of the original model.
+                 */
+                static std::vector<ValueType> computeUntilProbabilities(Environment const& env, boost::optional<storm::solver::OptimizationDirection> const& dir, ModelType const& model, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            };
+        }
+    }
+}
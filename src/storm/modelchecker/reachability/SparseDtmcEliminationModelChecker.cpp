@@ -21,6 +21,7 @@
 #include "storm/solver/stateelimination/MultiValueStateEliminator.h"
 #include "storm/solver/stateelimination/ConditionalStateEliminator.h"
 #include "storm/solver/stateelimination/PrioritizedStateEliminator.h"
+#include "storm/solver/stateelimination/ParallelStateEliminator.h"
 #include "storm/solver/stateelimination/StaticStatePriorityQueue.h"
 #include "storm/solver/stateelimination/DynamicStatePriorityQueue.h"
 
@@ -810,6 +811,19 @@ namespace storm {
         template<typename SparseDtmcModelType>
         void SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performPrioritizedStateElimination(std::shared_ptr<StatePriorityQueue>& priorityQueue, storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, std::vector<ValueType>& values, storm::storage::BitVector const& initialStates, bool computeResultsForInitialStatesOnly) {
             
+            if (storm::settings::getModule<storm::settings::modules::EliminationSettings>().isParallelEliminationSet()) {
+                storm::solver::stateelimination::ParallelStateEliminator<ValueType> stateEliminator(transitionMatrix, backwardTransitions, priorityQueue, values);
+                if (computeResultsForInitialStatesOnly) {
+                    stateEliminator.eliminateAll(initialStates);
+                } else {
+                    stateEliminator.eliminateAll(false);
+                }
+#ifdef STORM_DEV
+                STORM_LOG_ASSERT(checkConsistent(transitionMatrix, backwardTransitions), "The forward and backward transition matrices became inconsistent.");
+#endif
+                return;
+            }
+            
             storm::solver::stateelimination::PrioritizedStateEliminator<ValueType> stateEliminator(transitionMatrix, backwardTransitions, priorityQueue, values);
             
             while (priorityQueue->hasNext()) {
@@ -0,0 +1,326 @@
+#include "storm/modelchecker/statistical/SparseStatisticalModelChecker.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <boost/math/distributions/normal.hpp>
+
+#include "storm/logic/FragmentSpecification.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/StatisticalSettings.h"
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/FilteredRewardModel.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/SignalHandler.h"
+
+#include "storm/exceptions/InvalidPropertyException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace modelchecker {
+
+        namespace {
+            // Mixing function of SplitMix64, used to derive independent seeds and scheduler choices.
+            uint64_t mix(uint64_t value) {
+                value += 0x9e3779b97f4a7c15ull;
+                value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+                value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+                return value ^ (value >> 31);
+            }
+        }
+
+        template<typename SparseModelType>
+        SparseStatisticalModelChecker<SparseModelType>::SparseStatisticalModelChecker(SparseModelType const& model) : SparsePropositionalModelChecker<SparseModelType>(model) {
+            STORM_LOG_THROW(model.getInitialStates().getNumberOfSetBits() == 1, storm::exceptions::NotSupportedException, "Statistical model checking requires a unique initial state.");
+            initialState = *model.getInitialStates().begin();
+
+            // Trivial row groupings are created lazily. Make sure this happens before the model is accessed concurrently.
+            model.getTransitionMatrix().getRowGroupIndices();
+
+            auto const& settings = storm::settings::getModule<storm::settings::modules::StatisticalSettings>();
+            precision = settings.getPrecision();
+            confidence = settings.getConfidence();
+            indifferenceRegion = settings.getIndifferenceRegion();
+            maximalPathLength = settings.getMaximalPathLength();
+            batchSize = settings.getBatchSize();
+            numberOfSchedulers = settings.getNumberOfSchedulers();
+            seed = settings.getSeed();
+        }
+
+        template<typename SparseModelType>
+        bool SparseStatisticalModelChecker<SparseModelType>::canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
+            storm::logic::FragmentSpecification fragment = storm::logic::propositional();
+            fragment.setProbabilityOperatorsAllowed(true).setRewardOperatorsAllowed(true);
+            fragment.setReachabilityProbabilityFormulasAllowed(true).setUntilFormulasAllowed(true).setBoundedUntilFormulasAllowed(true).setStepBoundedUntilFormulasAllowed(true);
+            fragment.setCumulativeRewardFormulasAllowed(true).setStepBoundedCumulativeRewardFormulasAllowed(true);
+            return checkTask.getFormula().isInFragment(fragment) && checkTask.isOnlyInitialStatesRelevantSet();
+        }
+
+        template<typename SparseModelType>
+        bool SparseStatisticalModelChecker<SparseModelType>::canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
+            return canHandleStatic(checkTask);
+        }
+
+        template<typename SparseModelType>
+        std::unique_ptr<CheckResult> SparseStatisticalModelChecker<SparseModelType>::checkProbabilityOperatorFormula(Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) {
+            storm::logic::Formula const& pathFormula = checkTask.getFormula().getSubformula();
+            // Bounded properties on deterministic models are decided with the SPRT which usually requires far less paths than an estimation.
+            if (checkTask.isBoundSet() && !this->getModel().isNondeterministicModel() && (pathFormula.isReachabilityProbabilityFormula() || pathFormula.isUntilFormula() || pathFormula.isBoundedUntilFormula())) {
+                UntilProperty property = createUntilProperty(env, pathFormula);
+                boost::optional<bool> result = testUntilProbability(checkTask.template substituteFormula<storm::logic::Formula>(pathFormula), property);
+                if (result) {
+                    return std::make_unique<ExplicitQualitativeCheckResult>(initialState, result.get());
+                }
+            }
+            return SparsePropositionalModelChecker<SparseModelType>::checkProbabilityOperatorFormula(env, checkTask);
+        }
+
+        template<typename SparseModelType>
+        std::unique_ptr<CheckResult> SparseStatisticalModelChecker<SparseModelType>::computeBoundedUntilProbabilities(Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) {
+            UntilProperty property = createUntilProperty(env, checkTask.getFormula());
+            return estimateUntilProbability(checkTask.template substituteFormula<storm::logic::Formula>(checkTask.getFormula()), property);
+        }
+
+        template<typename SparseModelType>
+        std::unique_ptr<CheckResult> SparseStatisticalModelChecker<SparseModelType>::computeUntilProbabilities(Environment const& env, CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) {
+            UntilProperty property = createUntilProperty(env, checkTask.getFormula());
+            return estimateUntilProbability(checkTask.template substituteFormula<storm::logic::Formula>(checkTask.getFormula()), property);
+        }
+
+        template<typename SparseModelType>
+        std::unique_ptr<CheckResult> SparseStatisticalModelChecker<SparseModelType>::computeCumulativeRewards(Environment const&, storm::logic::RewardMeasureType, CheckTask<storm::logic::CumulativeRewardFormula, ValueType> const& checkTask) {
+            storm::logic::CumulativeRewardFormula const& rewardPathFormula = checkTask.getFormula();
+            STORM_LOG_THROW(!rewardPathFormula.isMultiDimensional() && rewardPathFormula.getTimeBoundReference().isStepBound(), storm::exceptions::NotSupportedException, "Statistical model checking only supports step-bounded cumulative reward formulas.");
+            STORM_LOG_THROW(rewardPathFormula.hasIntegerBound(), storm::exceptions::InvalidPropertyException, "Formula needs to have a discrete time bound.");
+            uint64_t stepBound = rewardPathFormula.template getNonStrictBound<uint64_t>();
+            auto filteredRewardModel = storm::utility::createFilteredRewardModel(this->getModel(), checkTask);
+            RewardModelType const& rewardModel = filteredRewardModel.get();
+            STORM_LOG_THROW(!rewardModel.hasTransitionRewards(), storm::exceptions::NotSupportedException, "Statistical model checking does not support transition rewards.");
+
+            std::vector<uint64_t> const& rowGroupIndices = this->getModel().getTransitionMatrix().getRowGroupIndices();
+            PathValueFunction pathValue = [&] (SimulatorType& simulator, uint64_t schedulerIndex, bool&) {
+                simulator.resetToInitial();
+                double value = 0;
+                for (uint64_t step = 0; step < stepBound; ++step) {
+                    uint64_t state = simulator.getCurrentState();
+                    uint64_t action = chooseAction(schedulerIndex, state);
+                    if (rewardModel.hasStateRewards()) {
+                        value += storm::utility::convertNumber<double>(rewardModel.getStateReward(state));
+                    }
+                    if (rewardModel.hasStateActionRewards()) {
+                        value += storm::utility::convertNumber<double>(rewardModel.getStateActionReward(rowGroupIndices[state] + action));
+                    }
+                    simulator.step(action);
+                }
+                return value;
+            };
+
+            // The values are not bounded, so we rely on the central limit theorem to obtain a confidence interval.
+            double quantile = boost::math::quantile(boost::math::normal(), (1 + confidence) / 2);
+            auto isDone = [this, quantile] (PathStatistics const& statistics) {
+                return statistics.numberOfPaths > 1 && quantile * std::sqrt(statistics.getVariance() / statistics.numberOfPaths) <= precision;
+            };
+            double result = estimateOptimalMean(checkTask.template substituteFormula<storm::logic::Formula>(rewardPathFormula), pathValue, isDone, std::numeric_limits<uint64_t>::max());
+            return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(initialState, storm::utility::convertNumber<ValueType>(result));
+        }
+
+        template<typename SparseModelType>
+        uint64_t SparseStatisticalModelChecker<SparseModelType>::getOkamotoBound(double precision, double confidence) {
+            return static_cast<uint64_t>(std::ceil(std::log(2.0 / (1.0 - confidence)) / (2.0 * precision * precision)));
+        }
+
+        template<typename SparseModelType>
+        typename SparseStatisticalModelChecker<SparseModelType>::UntilProperty SparseStatisticalModelChecker<SparseModelType>::createUntilProperty(Environment const& env, storm::logic::Formula const& pathFormula) {
+            UntilProperty property;
+            property.lowerBound = 0;
+            property.unbounded = true;
+            if (pathFormula.isReachabilityProbabilityFormula()) {
+                property.phiStates = storm::storage::BitVector(this->getModel().getNumberOfStates(), true);
+                property.psiStates = this->check(env, pathFormula.asReachabilityProbabilityFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            } else if (pathFormula.isUntilFormula()) {
+                property.phiStates = this->check(env, pathFormula.asUntilFormula().getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                property.psiStates = this->check(env, pathFormula.asUntilFormula().getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            } else {
+                STORM_LOG_THROW(pathFormula.isBoundedUntilFormula(), storm::exceptions::InvalidPropertyException, "Formula " << pathFormula << " is not an until formula.");
+                storm::logic::BoundedUntilFormula const& boundedUntilFormula = pathFormula.asBoundedUntilFormula();
+                STORM_LOG_THROW(!boundedUntilFormula.isMultiDimensional() && boundedUntilFormula.getTimeBoundReference().isStepBound(), storm::exceptions::NotSupportedException, "Statistical model checking only supports step-bounded until formulas.");
+                STORM_LOG_THROW(boundedUntilFormula.hasIntegerLowerBound() && boundedUntilFormula.hasIntegerUpperBound(), storm::exceptions::InvalidPropertyException, "Formula step bounds must be discrete.");
+                property.phiStates = this->check(env, boundedUntilFormula.getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                property.psiStates = this->check(env, boundedUntilFormula.getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                if (boundedUntilFormula.hasLowerBound()) {
+                    property.lowerBound = boundedUntilFormula.template getNonStrictLowerBound<uint64_t>();
+                }
+                if (boundedUntilFormula.hasUpperBound()) {
+                    property.upperBound = boundedUntilFormula.template getNonStrictUpperBound<uint64_t>();
+                    property.unbounded = false;
+                }
+            }
+            if (property.unbounded) {
+                property.upperBound = maximalPathLength;
+            }
+
+            // Paths can be stopped as soon as the outcome is certain.
+            storm::storage::SparseMatrix<ValueType> backwardTransitions = this->getModel().getBackwardTransitions();
+            storm::storage::BitVector statesWithProbabilityGreater0;
+            if (this->getModel().isNondeterministicModel()) {
+                statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0E(backwardTransitions, property.phiStates, property.psiStates);
+            } else {
+                statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, property.phiStates, property.psiStates);
+                if (property.unbounded && property.lowerBound == 0) {
+                    // Reaching a state with probability one suffices.
+                    property.psiStates = storm::utility::graph::performProb1(backwardTransitions, property.phiStates, property.psiStates, statesWithProbabilityGreater0);
+                }
+            }
+            property.zeroStates = ~statesWithProbabilityGreater0;
+            return property;
+        }
+
+        template<typename SparseModelType>
+        double SparseStatisticalModelChecker<SparseModelType>::simulateUntilPath(SimulatorType& simulator, uint64_t schedulerIndex, UntilProperty const& property, bool& truncated) const {
+            simulator.resetToInitial();
+            for (uint64_t step = 0; ; ++step) {
+                uint64_t state = simulator.getCurrentState();
+                if (step >= property.lowerBound && property.psiStates.get(state)) {
+                    return 1;
+                }
+                if (!property.phiStates.get(state) || property.zeroStates.get(state)) {
+                    return 0;
+                }
+                if (step == property.upperBound) {
+                    truncated = property.unbounded;
+                    return 0;
+                }
+                simulator.step(chooseAction(schedulerIndex, state));
+            }
+        }
+
+        template<typename SparseModelType>
+        std::unique_ptr<CheckResult> SparseStatisticalModelChecker<SparseModelType>::estimateUntilProbability(CheckTask<storm::logic::Formula, ValueType> const& checkTask, UntilProperty const& property) const {
+            PathValueFunction pathValue = [this, &property] (SimulatorType& simulator, uint64_t schedulerIndex, bool& truncated) {
+                return simulateUntilPath(simulator, schedulerIndex, property, truncated);
+            };
+            // The number of paths is fixed in advance.
+            auto isDone = [] (PathStatistics const&) {
+                return false;
+            };
+            double result = estimateOptimalMean(checkTask, pathValue, isDone, getOkamotoBound(precision, confidence));
+            return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(initialState, storm::utility::convertNumber<ValueType>(result));
+        }
+
+        template<typename SparseModelType>
+        boost::optional<bool> SparseStatisticalModelChecker<SparseModelType>::testUntilProbability(CheckTask<storm::logic::Formula, ValueType> const& checkTask, UntilProperty const& property) const {
+            double threshold = storm::utility::convertNumber<double>(checkTask.getBoundThreshold());
+            // Hypothesis H0: p >= threshold + indifference, hypothesis H1: p <= threshold - indifference.
+            double p0 = threshold + indifferenceRegion;
+            double p1 = threshold - indifferenceRegion;
+            if (p1 <= 0 || p0 >= 1) {
+                STORM_LOG_INFO("Indifference region around threshold " << threshold << " exceeds [0,1]. Falling back to estimation.");
+                return boost::none;
+            }
+            double error = 1 - confidence;
+            double acceptH1 = std::log((1 - error) / error);
+            double acceptH0 = std::log(error / (1 - error));
+            double successWeight = std::log(p1 / p0);
+            double failureWeight = std::log((1 - p1) / (1 - p0));
+
+            boost::optional<bool> acceptedH0;
+            auto isDone = [&] (PathStatistics const& statistics) {
+                double ratio = statistics.sum * successWeight + (statistics.numberOfPaths - statistics.sum) * failureWeight;
+                if (ratio >= acceptH1) {
+                    acceptedH0 = false;
+                } else if (ratio <= acceptH0) {
+                    acceptedH0 = true;
+                }
+                return static_cast<bool>(acceptedH0);
+            };
+            PathValueFunction pathValue = [this, &property] (SimulatorType& simulator, uint64_t schedulerIndex, bool& truncated) {
+                return simulateUntilPath(simulator, schedulerIndex, property, truncated);
+            };
+            PathStatistics statistics = samplePaths(pathValue, 0, isDone, std::numeric_limits<uint64_t>::max());
+            if (!acceptedH0) {
+                STORM_LOG_WARN("Sequential probability ratio test was aborted after " << statistics.numberOfPaths << " paths. Comparing the current estimate against the threshold.");
+                acceptedH0 = statistics.getMean() >= threshold;
+            }
+            STORM_LOG_INFO("Sequential probability ratio test decided after " << statistics.numberOfPaths << " paths.");
+            if (storm::logic::isLowerBound(checkTask.getBoundComparisonType())) {
+                return acceptedH0.get();
+            } else {
+                return !acceptedH0.get();
+            }
+        }
+
+        template<typename SparseModelType>
+        typename SparseStatisticalModelChecker<SparseModelType>::PathStatistics SparseStatisticalModelChecker<SparseModelType>::samplePaths(PathValueFunction const& pathValue, uint64_t schedulerIndex, std::function<bool(PathStatistics const&)> const& isDone, uint64_t maximalNumberOfPaths) const {
+            uint64_t maximalNumberOfBatches = maximalNumberOfPaths / batchSize + (maximalNumberOfPaths % batchSize == 0 ? 0 : 1);
+            PathStatistics result;
+            uint64_t numberOfBatches = 0;
+            while (numberOfBatches < maximalNumberOfBatches) {
+                uint64_t roundBatches = std::min(storm::simulator::BATCHES_PER_ROUND, maximalNumberOfBatches - numberOfBatches);
+                std::vector<PathStatistics> batchStatistics(roundBatches);
+                storm::simulator::simulateBatches(numberOfBatches, roundBatches, [&] (uint64_t batchIndex) {
+                    SimulatorType simulator(this->getModel());
+                    simulator.setSeed(storm::simulator::getBatchSeed(mix(mix(seed) ^ schedulerIndex), batchIndex));
+                    uint64_t numberOfPaths = std::min(batchSize, maximalNumberOfPaths - batchIndex * batchSize);
+                    PathStatistics& statistics = batchStatistics[batchIndex - numberOfBatches];
+                    for (uint64_t path = 0; path < numberOfPaths; ++path) {
+                        bool truncated = false;
+                        double value = pathValue(simulator, schedulerIndex, truncated);
+                        statistics.addPath(value, truncated);
+                    }
+                });
+                for (auto const& statistics : batchStatistics) {
+                    result.add(statistics);
+                }
+                numberOfBatches += roundBatches;
+                if (isDone(result) || storm::utility::resources::isTerminate()) {
+                    break;
+                }
+            }
+            STORM_LOG_WARN_COND(result.numberOfTruncatedPaths == 0, result.numberOfTruncatedPaths << " of " << result.numberOfPaths << " paths reached the maximal path length " << maximalPathLength << " and were considered unsuccessful.");
+            return result;
+        }
+
+        template<typename SparseModelType>
+        double SparseStatisticalModelChecker<SparseModelType>::estimateOptimalMean(CheckTask<storm::logic::Formula, ValueType> const& checkTask, PathValueFunction const& pathValue, std::function<bool(PathStatistics const&)> const& isDone, uint64_t maximalNumberOfPaths) const {
+            if (!this->getModel().isNondeterministicModel()) {
+                return samplePaths(pathValue, 0, isDone, maximalNumberOfPaths).getMean();
+            }
+
+            STORM_LOG_THROW(checkTask.isOptimizationDirectionSet(), storm::exceptions::InvalidPropertyException, "For nondeterministic systems, an optimization direction (min/max) must be given in the property.");
+            bool minimize = storm::solver::minimize(checkTask.getOptimizationDirection());
+            boost::optional<double> bestValue;
+            uint64_t bestScheduler = 0;
+            for (uint64_t scheduler = 0; scheduler < numberOfSchedulers; ++scheduler) {
+                double value = samplePaths(pathValue, scheduler, isDone, maximalNumberOfPaths).getMean();
+                if (!bestValue || (minimize ? value < bestValue.get() : value > bestValue.get())) {
+                    bestValue = value;
+                    bestScheduler = scheduler;
+                }
+                if (storm::utility::resources::isTerminate()) {
+                    break;
+                }
+            }
+            STORM_LOG_INFO("Best value " << bestValue.get() << " obtained by sampled scheduler " << bestScheduler << " of " << numberOfSchedulers << ".");
+            return bestValue.get();
+        }
+
+        template<typename SparseModelType>
+        uint64_t SparseStatisticalModelChecker<SparseModelType>::chooseAction(uint64_t schedulerIndex, uint64_t state) const {
+            uint64_t numberOfChoices = this->getModel().getTransitionMatrix().getRowGroupSize(state);
+            if (numberOfChoices == 1) {
+                return 0;
+            }
+            // A sampled scheduler is memoryless and deterministic, so the choice only depends on the scheduler and the state.
+            return mix(mix(seed ^ schedulerIndex) ^ state) % numberOfChoices;
+        }
+
+        template class SparseStatisticalModelChecker<storm::models::sparse::Dtmc<double>>;
+        template class SparseStatisticalModelChecker<storm::models::sparse::Mdp<double>>;
+    }
+}
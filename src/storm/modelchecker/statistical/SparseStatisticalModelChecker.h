@@ -0,0 +1,134 @@
+#pragma once
+
+#include <functional>
+
+#include <boost/optional.hpp>
+
+#include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/simulator/BatchSimulation.h"
+#include "storm/simulator/DiscreteTimeSparseModelSimulator.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace modelchecker {
+
+        /*!
+         * Statistical model checker for discrete-time sparse models.
+         * Instead of solving the model numerically, paths are sampled from the initial state with the DiscreteTimeSparseModelSimulator.
+         * Paths are simulated in batches which run in parallel. Every batch has its own random number stream derived from the seed,
+         * the batch index and the scheduler index, such that the results do not depend on the number of threads.
+         *
+         * - Quantitative probabilities are estimated with the number of paths given by the Okamoto (Chernoff-Hoeffding) bound.
+         * - Probabilities compared against a bound are decided with Wald's sequential probability ratio test (SPRT).
+         * - Expected cumulative rewards are estimated until the confidence interval obtained from the central limit theorem is small enough.
+         * - For nondeterministic models, memoryless deterministic schedulers are sampled uniformly and the best scheduler is reported.
+         *   The result is thus an under-approximation of the maximum (over-approximation of the minimum).
+         *
+         * Only the value for the (unique) initial state is computed.
+         */
+        template<class SparseModelType>
+        class SparseStatisticalModelChecker : public SparsePropositionalModelChecker<SparseModelType> {
+        public:
+            typedef typename SparseModelType::ValueType ValueType;
+            typedef typename SparseModelType::RewardModelType RewardModelType;
+
+            explicit SparseStatisticalModelChecker(SparseModelType const& model);
+
+            /*!
+             * Returns false, if this task can certainly not be handled by this model checker (independent of the concrete model).
+             */
+            static bool canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask);
+
+            // The implemented methods of the AbstractModelChecker interface.
+            virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
+            virtual std::unique_ptr<CheckResult> checkProbabilityOperatorFormula(Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) override;
+            virtual std::unique_ptr<CheckResult> computeBoundedUntilProbabilities(Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) override;
+            virtual std::unique_ptr<CheckResult> computeUntilProbabilities(Environment const& env, CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) override;
+            virtual std::unique_ptr<CheckResult> computeCumulativeRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType, CheckTask<storm::logic::CumulativeRewardFormula, ValueType> const& checkTask) override;
+
+            /*!
+             * Computes the number of paths required to estimate a probability with the given precision and confidence (Okamoto bound).
+             */
+            static uint64_t getOkamotoBound(double precision, double confidence);
+
+        private:
+            typedef storm::simulator::DiscreteTimeSparseModelSimulator<ValueType, RewardModelType> SimulatorType;
+
+            typedef storm::simulator::PathStatistics PathStatistics;
+
+            // Callback computing the value of a single path. The flag has to be set if the path was cut off.
+            typedef std::function<double(SimulatorType& simulator, uint64_t schedulerIndex, bool& truncated)> PathValueFunction;
+
+            /*!
+             * Describes a (bounded) until property on the level of states.
+             */
+            struct UntilProperty {
+                storm::storage::BitVector phiStates;
+                // The states for which the path is successful.
+                storm::storage::BitVector psiStates;
+                // States from which no psi state can be reached via phi states.
+                storm::storage::BitVector zeroStates;
+                uint64_t lowerBound;
+                uint64_t upperBound;
+                // True iff the upper bound is given by the maximal path length.
+                bool unbounded;
+            };
+
+            /*!
+             * Builds the state-based description of the given (bounded) until or eventually formula.
+             */
+            UntilProperty createUntilProperty(Environment const& env, storm::logic::Formula const& pathFormula);
+
+            /*!
+             * Simulates one path for the given until property and returns 1 iff the path satisfies it.
+             */
+            double simulateUntilPath(SimulatorType& simulator, uint64_t schedulerIndex, UntilProperty const& property, bool& truncated) const;
+
+            /*!
+             * Estimates the probability of the given until property for the initial state.
+             */
+            std::unique_ptr<CheckResult> estimateUntilProbability(CheckTask<storm::logic::Formula, ValueType> const& checkTask, UntilProperty const& property) const;
+
+            /*!
+             * Decides whether the probability of the given until property satisfies the bound of the check task via the SPRT.
+             * Returns none if the indifference region does not fit into [0,1].
+             */
+            boost::optional<bool> testUntilProbability(CheckTask<storm::logic::Formula, ValueType> const& checkTask, UntilProperty const& property) const;
+
+            /*!
+             * Samples paths in rounds of parallel batches until the stopping criterion is fulfilled.
+             *
+             * @param pathValue Computes the value of a single path.
+             * @param schedulerIndex Index of the sampled scheduler.
+             * @param isDone Stopping criterion which is checked after every round.
+             * @param maximalNumberOfPaths Maximal number of paths to sample.
+             * @return Statistics over all sampled paths.
+             */
+            PathStatistics samplePaths(PathValueFunction const& pathValue, uint64_t schedulerIndex, std::function<bool(PathStatistics const&)> const& isDone, uint64_t maximalNumberOfPaths) const;
+
+            /*!
+             * Estimates the mean value of the paths. For nondeterministic models, schedulers are sampled and the best value is returned.
+             */
+            double estimateOptimalMean(CheckTask<storm::logic::Formula, ValueType> const& checkTask, PathValueFunction const& pathValue, std::function<bool(PathStatistics const&)> const& isDone, uint64_t maximalNumberOfPaths) const;
+
+            /*!
+             * Chooses the action of the given sampled scheduler in the given state.
+             */
+            uint64_t chooseAction(uint64_t schedulerIndex, uint64_t state) const;
+
+            // The unique initial state.
+            uint64_t initialState;
+
+            // The settings of the engine.
+            double precision;
+            double confidence;
+            double indifferenceRegion;
+            uint64_t maximalPathLength;
+            uint64_t batchSize;
+            uint64_t numberOfSchedulers;
+            uint64_t seed;
+        };
+    }
+}
@@ -0,0 +1,105 @@
+#include "storm/models/symbolic/ExplicitSubmatrixCache.h"
+
+#include "storm/storage/dd/DdManager.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace models {
+        namespace symbolic {
+
+            template<storm::dd::DdType Type, typename ValueType>
+            ExplicitSubmatrixCache<Type, ValueType>::ExplicitSubmatrixCache(uint64_t maximalNumberOfMatrices, uint64_t maximalNumberOfOdds) : maximalNumberOfMatrices(maximalNumberOfMatrices), maximalNumberOfOdds(maximalNumberOfOdds), numberOfMatrixHits(0) {
+                // Intentionally left empty.
+            }
+
+            template<storm::dd::DdType Type, typename ValueType>
+            storm::dd::Odd ExplicitSubmatrixCache<Type, ValueType>::getOdd(storm::dd::Bdd<Type> const& states) {
+                for (auto it = odds.begin(); it != odds.end(); ++it) {
+                    if (it->states == states) {
+                        odds.splice(odds.begin(), odds, it);
+                        return odds.front().odd;
+                    }
+                }
+
+                odds.push_front(OddEntry({states, states.createOdd()}));
+                if (odds.size() > maximalNumberOfOdds) {
+                    odds.pop_back();
+                }
+                return odds.front().odd;
+            }
+
+            template<storm::dd::DdType Type, typename ValueType>
+            std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> ExplicitSubmatrixCache<Type, ValueType>::getMatrix(storm::dd::Add<Type, ValueType> const& matrix, storm::dd::Bdd<Type> const& states) {
+                MatrixEntry const* entry = findMatrix(matrix, states, boost::none);
+                if (entry) {
+                    return entry->explicitMatrix;
+                }
+
+                storm::dd::Odd odd = getOdd(states);
+                auto explicitMatrix = std::make_shared<storm::storage::SparseMatrix<ValueType> const>(matrix.toMatrix(odd, odd));
+                insertMatrix(MatrixEntry({matrix, states, boost::none, explicitMatrix}));
+                return explicitMatrix;
+            }
+
+            template<storm::dd::DdType Type, typename ValueType>
+            std::pair<std::shared_ptr<storm::storage::SparseMatrix<ValueType> const>, std::vector<ValueType>> ExplicitSubmatrixCache<Type, ValueType>::getMatrixVector(storm::dd::Add<Type, ValueType> const& matrix, storm::dd::Add<Type, ValueType> const& vector, storm::dd::Bdd<Type> const& enabledChoices, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, std::set<storm::expressions::Variable> const& groupMetaVariables, storm::dd::Bdd<Type> const& states) {
+                storm::dd::Odd odd = getOdd(states);
+
+                MatrixEntry const* entry = findMatrix(matrix, states, enabledChoices);
+                if (entry) {
+                    // The vector is translated such that its rows match the ones of the cached matrix.
+                    std::vector<ValueType> explicitVector = vector.toVector(matrix, entry->explicitMatrix->getRowGroupIndices(), rowMetaVariables, columnMetaVariables, groupMetaVariables, odd);
+                    return std::make_pair(entry->explicitMatrix, std::move(explicitVector));
+                }
+
+                std::vector<uint_fast64_t> rowGroupSizes = enabledChoices.template toAdd<uint_fast64_t>().sumAbstract(groupMetaVariables).toVector(odd);
+                std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> result = matrix.toMatrixVector(std::move(rowGroupSizes), vector, rowMetaVariables, columnMetaVariables, groupMetaVariables, odd, odd);
+                auto explicitMatrix = std::make_shared<storm::storage::SparseMatrix<ValueType> const>(std::move(result.first));
+                insertMatrix(MatrixEntry({matrix, states, enabledChoices, explicitMatrix}));
+                return std::make_pair(explicitMatrix, std::move(result.second));
+            }
+
+            template<storm::dd::DdType Type, typename ValueType>
+            uint64_t ExplicitSubmatrixCache<Type, ValueType>::getNumberOfMatrixHits() const {
+                return numberOfMatrixHits;
+            }
+
+            template<storm::dd::DdType Type, typename ValueType>
+            void ExplicitSubmatrixCache<Type, ValueType>::clear() {
+                odds.clear();
+                matrices.clear();
+            }
+
+            template<storm::dd::DdType Type, typename ValueType>
+            typename ExplicitSubmatrixCache<Type, ValueType>::MatrixEntry const* ExplicitSubmatrixCache<Type, ValueType>::findMatrix(storm::dd::Add<Type, ValueType> const& matrix, storm::dd::Bdd<Type> const& states, boost::optional<storm::dd::Bdd<Type>> const& enabledChoices) {
+                for (auto it = matrices.begin(); it != matrices.end(); ++it) {
+                    if (it->matrix == matrix && it->states == states && it->enabledChoices.is_initialized() == enabledChoices.is_initialized() && (!enabledChoices || it->enabledChoices.get() == enabledChoices.get())) {
+                        matrices.splice(matrices.begin(), matrices, it);
+                        ++numberOfMatrixHits;
+                        STORM_LOG_DEBUG("Reusing the explicit representation of a symbolic matrix.");
+                        return &matrices.front();
+                    }
+                }
+                return nullptr;
+            }
+
+            template<storm::dd::DdType Type, typename ValueType>
+            void ExplicitSubmatrixCache<Type, ValueType>::insertMatrix(MatrixEntry&& entry) {
+                if (maximalNumberOfMatrices == 0) {
+                    return;
+                }
+                matrices.push_front(std::move(entry));
+                if (matrices.size() > maximalNumberOfMatrices) {
+                    matrices.pop_back();
+                }
+            }
+
+            template class ExplicitSubmatrixCache<storm::dd::DdType::CUDD, double>;
+            template class ExplicitSubmatrixCache<storm::dd::DdType::Sylvan, double>;
+
+            template class ExplicitSubmatrixCache<storm::dd::DdType::Sylvan, storm::RationalNumber>;
+            template class ExplicitSubmatrixCache<storm::dd::DdType::Sylvan, storm::RationalFunction>;
+        }
+    }
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/dd/DdType.h"
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/Odd.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    namespace models {
+        namespace symbolic {
+
+            /*!
+             * Caches the explicit representations of (sub)matrices of a symbolic model, so that checking several
+             * properties with the same sets of relevant (e.g. maybe) states does not repeat the translation from DDs to
+             * sparse matrices. As DDs are canonical, the entries are keyed by the DDs that are to be translated. Only
+             * the most recently used entries are kept. The explicit matrices are shared with the callers rather than
+             * copied, so callers that need to modify a matrix have to copy it themselves.
+             */
+            template<storm::dd::DdType Type, typename ValueType>
+            class ExplicitSubmatrixCache {
+            public:
+                /*!
+                 * Creates an empty cache.
+                 *
+                 * @param maximalNumberOfMatrices The number of matrices that are kept at most. If zero, no matrix is kept.
+                 * @param maximalNumberOfOdds The number of ODDs that are kept at most.
+                 */
+                ExplicitSubmatrixCache(uint64_t maximalNumberOfMatrices = 4, uint64_t maximalNumberOfOdds = 16);
+
+                /*!
+                 * Retrieves the ODD of the given states.
+                 */
+                storm::dd::Odd getOdd(storm::dd::Bdd<Type> const& states);
+
+                /*!
+                 * Retrieves the explicit representation of the given (deterministic) matrix whose rows and columns are
+                 * numbered according to the ODD of the given states.
+                 */
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> getMatrix(storm::dd::Add<Type, ValueType> const& matrix, storm::dd::Bdd<Type> const& states);
+
+                /*!
+                 * Retrieves the explicit representation of the given nondeterministic matrix together with the given
+                 * vector, whose rows and columns are numbered according to the ODD of the given states. Only the
+                 * conversion of the matrix is cached, so a different vector with the same enabled choices reuses it.
+                 *
+                 * @param enabledChoices The choices that get a row in the explicit matrix.
+                 */
+                std::pair<std::shared_ptr<storm::storage::SparseMatrix<ValueType> const>, std::vector<ValueType>> getMatrixVector(storm::dd::Add<Type, ValueType> const& matrix, storm::dd::Add<Type, ValueType> const& vector, storm::dd::Bdd<Type> const& enabledChoices, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, std::set<storm::expressions::Variable> const& groupMetaVariables, storm::dd::Bdd<Type> const& states);
+
+                /*!
+                 * Retrieves the number of lookups of matrices that could be answered from the cache.
+                 */
+                uint64_t getNumberOfMatrixHits() const;
+
+                /*!
+                 * Removes all entries from the cache.
+                 */
+                void clear();
+
+            private:
+                struct OddEntry {
+                    storm::dd::Bdd<Type> states;
+                    storm::dd::Odd odd;
+                };
+
+                struct MatrixEntry {
+                    storm::dd::Add<Type, ValueType> matrix;
+                    storm::dd::Bdd<Type> states;
+                    // For nondeterministic matrices, the choices that have a row in the explicit matrix.
+                    boost::optional<storm::dd::Bdd<Type>> enabledChoices;
+                    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitMatrix;
+                };
+
+                /*!
+                 * Searches the entry for the given key and moves it to the front. Returns null if there is none.
+                 */
+                MatrixEntry const* findMatrix(storm::dd::Add<Type, ValueType> const& matrix, storm::dd::Bdd<Type> const& states, boost::optional<storm::dd::Bdd<Type>> const& enabledChoices);
+
+                void insertMatrix(MatrixEntry&& entry);
+
+                uint64_t maximalNumberOfMatrices;
+                uint64_t maximalNumberOfOdds;
+
+                // The entries ordered from the most to the least recently used.
+                std::list<OddEntry> odds;
+                std::list<MatrixEntry> matrices;
+
+                uint64_t numberOfMatrixHits;
+            };
+
+        }
+    }
+}
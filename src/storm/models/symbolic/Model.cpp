@@ -14,6 +14,9 @@
 #include "storm/adapters/AddExpressionAdapter.h"
 
 #include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/models/symbolic/ExplicitSubmatrixCache.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
 
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
@@ -91,6 +94,23 @@ namespace storm {
             storm::dd::Bdd<Type> const& Model<Type, ValueType>::getReachableStates() const {
                 return reachableStates;
             }
+
+            template<storm::dd::DdType Type, typename ValueType>
+            storm::dd::Odd const& Model<Type, ValueType>::getReachableStatesOdd() const {
+                if (!reachableStatesOdd) {
+                    reachableStatesOdd = reachableStates.createOdd();
+                }
+                return reachableStatesOdd.get();
+            }
+
+            template<storm::dd::DdType Type, typename ValueType>
+            ExplicitSubmatrixCache<Type, ValueType>& Model<Type, ValueType>::getExplicitSubmatrixCache() const {
+                if (!explicitSubmatrixCache) {
+                    auto const& modelCheckerSettings = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>();
+                    explicitSubmatrixCache = std::make_shared<ExplicitSubmatrixCache<Type, ValueType>>(modelCheckerSettings.isExplicitSubmatrixCacheSet() ? modelCheckerSettings.getExplicitSubmatrixCacheSize() : 0);
+                }
+                return *explicitSubmatrixCache;
+            }
             
             template<storm::dd::DdType Type, typename ValueType>
             storm::dd::Bdd<Type> const& Model<Type, ValueType>::getInitialStates() const {
@@ -38,6 +38,9 @@ namespace storm {
             
             template<storm::dd::DdType Type, typename ValueType>
             class StandardRewardModel;
+
+            template<storm::dd::DdType Type, typename ValueType>
+            class ExplicitSubmatrixCache;
             
             /*!
              * Base class for all symbolic models.
@@ -141,6 +144,22 @@ namespace storm {
                  * @return The reachble states of the model.
                  */
                 storm::dd::Bdd<Type> const& getReachableStates() const;
+
+                /*!
+                 * Retrieves the ODD of the reachable states of the model. The ODD is created upon the first request and
+                 * then reused, so conversions of the model's DDs to explicit matrices and vectors can share it.
+                 *
+                 * @return The ODD of the reachable states.
+                 */
+                storm::dd::Odd const& getReachableStatesOdd() const;
+
+                /*!
+                 * Retrieves the cache of explicit representations of (sub)matrices of this model. It is shared by all
+                 * copies of the model.
+                 *
+                 * @return The cache.
+                 */
+                ExplicitSubmatrixCache<Type, ValueType>& getExplicitSubmatrixCache() const;
                 
                 /*!
                  * Retrieves the initial states of the model.
@@ -411,6 +430,12 @@ namespace storm {
                 // A vector representing the reachable states of the model.
                 storm::dd::Bdd<Type> reachableStates;
 
+                // The ODD of the reachable states (if it was already created).
+                mutable boost::optional<storm::dd::Odd> reachableStatesOdd;
+
+                // The cache of explicit representations of (sub)matrices (if it was already created).
+                mutable std::shared_ptr<ExplicitSubmatrixCache<Type, ValueType>> explicitSubmatrixCache;
+
             protected:
                 // A matrix representing transition relation.
                 storm::dd::Add<Type, ValueType> transitionMatrix;
@@ -22,6 +22,8 @@ namespace storm {
             const std::string BisimulationSettings::initialPartitionOptionName = "init";
             const std::string BisimulationSettings::refinementModeOptionName = "refine";
             const std::string BisimulationSettings::exactArithmeticDdOptionName = "ddexact";
+            const std::string BisimulationSettings::sparseSignatureRefinementOptionName = "sparsesig";
+            const std::string BisimulationSettings::quotientViewOptionName = "quotientview";
             
             BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> types = { "strong", "weak" };
@@ -54,6 +56,9 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("mode", "The mode to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(refinementModes))
                                              .setDefaultValueString("full").build())
                                 .build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, sparseSignatureRefinementOptionName, false, "Sets whether to refine sparse models in rounds based on signatures that are computed in parallel (only applies to strong bisimulation).").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, quotientViewOptionName, false, "Sets whether reachability probabilities on sparse DTMCs and MDPs are computed on an implicit view of the strong bisimulation quotient (which is not built).").setIsAdvanced().build());
             }
             
             bool BisimulationSettings::isStrongBisimulationSet() const {
@@ -135,6 +140,14 @@ namespace storm {
                 return RefinementMode::Full;
             }
 
+            bool BisimulationSettings::isSparseSignatureRefinementSet() const {
+                return this->getOption(sparseSignatureRefinementOptionName).getHasOptionBeenSet();
+            }
+            
+            bool BisimulationSettings::isQuotientViewSet() const {
+                return this->getOption(quotientViewOptionName).getHasOptionBeenSet();
+            }
+            
             bool BisimulationSettings::check() const {
                 bool optionsSet = this->getOption(typeOptionName).getHasOptionBeenSet();
                 STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet() || !optionsSet, "Bisimulation minimization is not selected, so setting options for bisimulation has no effect.");
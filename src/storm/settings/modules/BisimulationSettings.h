@@ -95,6 +95,17 @@ namespace storm {
                  * Retrieves the refinement mode to use.
                  */
                 RefinementMode getRefinementMode() const;
+                
+                /*!
+                 * Retrieves whether sparse models are to be refined based on signatures rather than splitters.
+                 */
+                bool isSparseSignatureRefinementSet() const;
+                
+                /*!
+                 * Retrieves whether (unbounded) reachability probabilities on sparse models are to be computed on an
+                 * implicit view of the bisimulation quotient instead of the original model.
+                 */
+                bool isQuotientViewSet() const;
                                 
                 virtual bool check() const override;
                 
@@ -113,6 +124,8 @@ namespace storm {
                 static const std::string refinementModeOptionName;
                 static const std::string parallelismModeOptionName;
                 static const std::string exactArithmeticDdOptionName;
+                static const std::string sparseSignatureRefinementOptionName;
+                static const std::string quotientViewOptionName;
             };
         } // namespace modules
     } // namespace settings
@@ -20,6 +20,7 @@ namespace storm {
 
             const std::string explorationOrderOptionName = "explorder";
             const std::string explorationOrderOptionShortName = "eo";
+            const std::string ddVariableOrderingOptionName = "ddvarorder";
             const std::string explorationChecksOptionName = "explchecks";
             const std::string explorationChecksOptionShortName = "ec";
             const std::string prismCompatibilityOptionName = "prismcompat";
@@ -37,6 +38,7 @@ namespace storm {
             const std::string buildOverlappingGuardsLabelOptionName = "build-overlapping-guards-label";
             const std::string noSimplifyOptionName = "no-simplify";
             const std::string bitsForUnboundedVariablesOptionName = "int-bits";
+            const std::string compileExpressionsOptionName = "compile-expressions";
 
             BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
 
@@ -53,10 +55,14 @@ namespace storm {
                 std::vector<std::string> explorationOrders = {"dfs", "bfs"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, explorationOrderOptionName, false, "Sets which exploration order to use.").setShortName(explorationOrderOptionShortName).setIsAdvanced()
                                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the exploration order to choose.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(explorationOrders)).setDefaultValueString("bfs").build()).build());
+                std::vector<std::string> ddVariableOrderings = {"declaration", "force"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddVariableOrderingOptionName, false, "Sets the heuristic that orders the variables of symbolic models. 'force' places variables that occur in the same commands (or edges) close to each other.").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the variable ordering to choose.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ddVariableOrderings)).setDefaultValueString("declaration").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, explorationChecksOptionName, false, "If set, additional checks (if available) are performed during model exploration to debug the model.").setShortName(explorationChecksOptionShortName).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, buildOutOfBoundsStateOptionName, false, "If set, a state for out-of-bounds valuations is added").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, buildOverlappingGuardsLabelOptionName, false, "For states where multiple guards are enabled, we add a label (for debugging DTMCs)").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, noSimplifyOptionName, false, "If set, simplification PRISM input is disabled.").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, compileExpressionsOptionName, false, "If set, the expressions of the model are compiled such that the explicit model builder can evaluate them directly on the states (only for floating point models).").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, bitsForUnboundedVariablesOptionName, false, "Sets the number of bits that is used for unbounded integer variables.").setIsAdvanced()
                                         .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of bits.").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedRangeValidatorExcluding(0,63)).setDefaultValueUnsignedInteger(32).build()).build());
             }
@@ -109,6 +115,10 @@ namespace storm {
                 return this->getOption(buildOverlappingGuardsLabelOptionName).getHasOptionBeenSet();
             }
 
+            bool BuildSettings::isCompileExpressionsSet() const {
+                return this->getOption(compileExpressionsOptionName).getHasOptionBeenSet();
+            }
+
             bool BuildSettings::isBuildAllLabelsSet() const {
                 return this->getOption(buildAllLabelsOptionName).getHasOptionBeenSet();
             }
@@ -123,6 +133,16 @@ namespace storm {
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown exploration order '" << explorationOrderAsString << "'.");
             }
             
+            storm::builder::DdVariableOrdering BuildSettings::getDdVariableOrdering() const {
+                std::string orderingAsString = this->getOption(ddVariableOrderingOptionName).getArgumentByName("name").getValueAsString();
+                if (orderingAsString == "declaration") {
+                    return storm::builder::DdVariableOrdering::Declaration;
+                } else if (orderingAsString == "force") {
+                    return storm::builder::DdVariableOrdering::Force;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown variable ordering '" << orderingAsString << "'.");
+            }
+            
             bool BuildSettings::isExplorationChecksSet() const {
                 return this->getOption(explorationChecksOptionName).getHasOptionBeenSet();
             }
@@ -4,6 +4,7 @@
 #include "storm-config.h"
 #include "storm/settings/modules/ModuleSettings.h"
 #include "storm/builder/ExplorationOrder.h"
+#include "storm/builder/DdVariableOrdering.h"
 
 namespace storm {
     namespace settings {
@@ -38,6 +39,13 @@ namespace storm {
                  */
                 storm::builder::ExplorationOrder getExplorationOrder() const;
 
+                /*!
+                 * Retrieves the heuristic that orders the variables when building symbolic models.
+                 *
+                 * @return The chosen variable ordering.
+                 */
+                storm::builder::DdVariableOrdering getDdVariableOrdering() const;
+
                 /*!
                  * Retrieves whether the PRISM compatibility mode was enabled.
                  *
@@ -105,6 +113,11 @@ namespace storm {
                  */
                  bool isAddOverlappingGuardsLabelSet() const;
 
+                /*!
+                 * Retrieves whether the expressions of the model should be compiled for the explicit model builder
+                 */
+                 bool isCompileExpressionsSet() const;
+
                 /*!
                  * Retrieves whether all labels should be build
                  */
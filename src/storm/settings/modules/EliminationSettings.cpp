@@ -18,9 +18,10 @@ namespace storm {
             const std::string EliminationSettings::entryStatesLastOptionName = "entrylast";
             const std::string EliminationSettings::maximalSccSizeOptionName = "sccsize";
             const std::string EliminationSettings::useDedicatedModelCheckerOptionName = "use-dedicated-mc";
+            const std::string EliminationSettings::parallelEliminationOptionName = "parallel";
             
             EliminationSettings::EliminationSettings() : ModuleSettings(moduleName) {
-                std::vector<std::string> orders = {"fw", "fwrev", "bw", "bwrev", "rand", "spen", "dpen", "regex"};
+                std::vector<std::string> orders = {"fw", "fwrev", "bw", "bwrev", "rand", "spen", "dpen", "regex", "amd", "markowitz", "nd"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, eliminationOrderOptionName, true, "The order that is to be used for the elimination techniques.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the order in which states are chosen for elimination.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(orders)).setDefaultValueString("fwrev").build()).build());
                 
                 std::vector<std::string> methods = {"state", "hybrid"};
@@ -30,6 +31,7 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, maximalSccSizeOptionName, true, "Sets the maximal size of the SCCs for which state elimination is applied.").setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("maxsize", "The maximal size of an SCC on which state elimination is applied.").setDefaultValueUnsignedInteger(20).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, useDedicatedModelCheckerOptionName, true, "Sets whether to use the dedicated model elimination checker (only DTMCs).").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, parallelEliminationOptionName, true, "Sets whether states with disjoint neighbourhoods are eliminated in parallel (only DTMCs). For parametric models, this also caches the simplification of rational functions.").setIsAdvanced().build());
             }
             
             EliminationSettings::EliminationMethod EliminationSettings::getEliminationMethod() const {
@@ -61,6 +63,12 @@ namespace storm {
                     return EliminationOrder::DynamicPenalty;
                 } else if (eliminationOrderAsString == "regex") {
                     return EliminationOrder::RegularExpression;
+                } else if (eliminationOrderAsString == "amd") {
+                    return EliminationOrder::MinimumDegree;
+                } else if (eliminationOrderAsString == "markowitz") {
+                    return EliminationOrder::Markowitz;
+                } else if (eliminationOrderAsString == "nd") {
+                    return EliminationOrder::NestedDissection;
                 } else {
                     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Illegal elimination order selected.");
                 }
@@ -77,6 +85,10 @@ namespace storm {
             bool EliminationSettings::isUseDedicatedModelCheckerSet() const {
                 return this->getOption(useDedicatedModelCheckerOptionName).getHasOptionBeenSet();
             }
+            
+            bool EliminationSettings::isParallelEliminationSet() const {
+                return this->getOption(parallelEliminationOptionName).getHasOptionBeenSet();
+            }
         } // namespace modules
     } // namespace settings
 } // namespace storm
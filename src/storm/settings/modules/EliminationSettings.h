@@ -15,7 +15,7 @@ namespace storm {
                 /*!
                  * An enum that contains all available state elimination orders.
                  */
-                enum class EliminationOrder { Forward, ForwardReversed, Backward, BackwardReversed, Random, StaticPenalty, DynamicPenalty, RegularExpression };
+                enum class EliminationOrder { Forward, ForwardReversed, Backward, BackwardReversed, Random, StaticPenalty, DynamicPenalty, RegularExpression, MinimumDegree, Markowitz, NestedDissection };
 				
                 /*!
                  * An enum that contains all available elimination methods.
@@ -61,6 +61,13 @@ namespace storm {
                  * @return True iff the option was set.
                  */
                 bool isUseDedicatedModelCheckerSet() const;
+                
+                /*!
+                 * Retrieves whether states with disjoint neighbourhoods are to be eliminated in parallel.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isParallelEliminationSet() const;
 				
                 const static std::string moduleName;
                 
@@ -70,6 +77,7 @@ namespace storm {
                 const static std::string entryStatesLastOptionName;
                 const static std::string maximalSccSizeOptionName;
                 const static std::string useDedicatedModelCheckerOptionName;
+                const static std::string parallelEliminationOptionName;
             };
             
         } // namespace modules
@@ -32,6 +32,13 @@ namespace storm {
                 
                 uint64_t getOptimizationLevel() const;
                 
+                /*!
+                 * Retrieves whether a directory was set in which the compiled shared libraries are kept such that they
+                 * can be reused when the same model is built again.
+                 */
+                bool isCacheDirectorySet() const;
+                std::string getCacheDirectory() const;
+                
                 bool check() const override;
                 void finalize() override;
                 
@@ -45,6 +52,7 @@ namespace storm {
                 static const std::string compilerFlagsOptionName;
                 static const std::string doctorOptionName;
                 static const std::string optimizationLevelOptionName;
+                static const std::string cacheDirectoryOptionName;
             };
             
         }
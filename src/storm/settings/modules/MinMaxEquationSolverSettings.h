@@ -95,6 +95,11 @@ namespace storm {
                  */
                 bool isForceIntervalIterationSymmetricUpdatesSet() const;
                 
+                /*!
+                 * Retrieves whether policy iteration shall only re-solve the SCCs that are affected by a change of the scheduler.
+                 */
+                bool isTopologicalPolicyIterationSet() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
@@ -106,6 +111,7 @@ namespace storm {
                 static const std::string absoluteOptionName;
                 static const std::string valueIterationMultiplicationStyleOptionName;
                 static const std::string intervalIterationSymmetricUpdatesOptionName;
+                static const std::string topologicalPolicyIterationOptionName;
                 static const std::string forceBoundsOptionName;
             };
             
@@ -14,14 +14,26 @@ namespace storm {
             
             const std::string ModelCheckerSettings::moduleName = "modelchecker";
             const std::string ModelCheckerSettings::filterRewZeroOptionName = "filterrewzero";
+            const std::string ModelCheckerSettings::noExplicitSubmatrixCacheOptionName = "noexplicitcache";
+            const std::string ModelCheckerSettings::explicitSubmatrixCacheSizeOptionName = "explicitcachesize";
 
             ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, filterRewZeroOptionName, false, "If set, states with reward zero are filtered out, potentially reducing the size of the equation system").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, noExplicitSubmatrixCacheOptionName, false, "If set, the hybrid engine does not keep explicit representations of (sub)matrices for later model checking calls.").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, explicitSubmatrixCacheSizeOptionName, false, "Sets the number of explicit (sub)matrices the hybrid engine keeps for later model checking calls.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of matrices (0 disables the cache).").setDefaultValueUnsignedInteger(4).build()).build());
             }
             
             bool ModelCheckerSettings::isFilterRewZeroSet() const {
                 return this->getOption(filterRewZeroOptionName).getHasOptionBeenSet();
             }
+
+            bool ModelCheckerSettings::isExplicitSubmatrixCacheSet() const {
+                return !this->getOption(noExplicitSubmatrixCacheOptionName).getHasOptionBeenSet() && getExplicitSubmatrixCacheSize() > 0;
+            }
+
+            uint64_t ModelCheckerSettings::getExplicitSubmatrixCacheSize() const {
+                return this->getOption(explicitSubmatrixCacheSizeOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
             
         } // namespace modules
     } // namespace settings
@@ -22,12 +22,25 @@ namespace storm {
                 
                 bool isFilterRewZeroSet() const;
 
+                /*!
+                 * Retrieves whether the hybrid engine is to keep explicit representations of (sub)matrices of the
+                 * symbolic model for later model checking calls.
+                 */
+                bool isExplicitSubmatrixCacheSet() const;
+
+                /*!
+                 * Retrieves the number of explicit (sub)matrices the hybrid engine keeps at most.
+                 */
+                uint64_t getExplicitSubmatrixCacheSize() const;
+
                 // The name of the module.
                 static const std::string moduleName;
 
             private:
                 // Define the string names of the options as constants.
                 static const std::string filterRewZeroOptionName;
+                static const std::string noExplicitSubmatrixCacheOptionName;
+                static const std::string explicitSubmatrixCacheSizeOptionName;
             };
 
         } // namespace modules
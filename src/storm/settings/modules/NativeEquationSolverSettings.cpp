@@ -18,6 +18,8 @@ namespace storm {
             const std::string NativeEquationSolverSettings::moduleName = "native";
             const std::string NativeEquationSolverSettings::techniqueOptionName = "method";
             const std::string NativeEquationSolverSettings::omegaOptionName = "soromega";
+            const std::string NativeEquationSolverSettings::restartOptionName = "restart";
+            const std::string NativeEquationSolverSettings::preconditionOptionName = "precond";
             const std::string NativeEquationSolverSettings::maximalIterationsOptionName = "maxiter";
             const std::string NativeEquationSolverSettings::maximalIterationsOptionShortName = "i";
             const std::string NativeEquationSolverSettings::precisionOptionName = "precision";
@@ -26,7 +28,7 @@ namespace storm {
             const std::string NativeEquationSolverSettings::intervalIterationSymmetricUpdatesOptionName = "symmetricupdates";
 
             NativeEquationSolverSettings::NativeEquationSolverSettings() : ModuleSettings(moduleName) {
-                std::vector<std::string> methods = { "jacobi", "gaussseidel", "sor", "walkerchae", "power", "sound-value-iteration", "svi", "optimistic-value-itearation", "ovi", "interval-iteration", "ii", "ratsearch" };
+                std::vector<std::string> methods = { "jacobi", "gaussseidel", "sor", "walkerchae", "power", "sound-value-iteration", "svi", "optimistic-value-itearation", "ovi", "interval-iteration", "ii", "ratsearch", "bicgstab", "gmres" };
                 this->addOption(storm::settings::OptionBuilder(moduleName, techniqueOptionName, true, "The method to be used for solving linear equation systems with the native engine.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the method to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(methods)).setDefaultValueString("jacobi").build()).build());
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, maximalIterationsOptionName, false, "The maximal number of iterations to perform before iterative solving is aborted.").setIsAdvanced().setShortName(maximalIterationsOptionShortName).addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The maximal iteration count.").build()).build());
@@ -35,6 +37,11 @@ namespace storm {
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, omegaOptionName, false, "The omega used for SOR.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The value of the SOR parameter.").setDefaultValueDouble(0.9).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
                 
+                this->addOption(storm::settings::OptionBuilder(moduleName, restartOptionName, false, "The number of iterations until GMRES is restarted.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of iterations.").setDefaultValueUnsignedInteger(50).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                
+                std::vector<std::string> preconditioners = {"diagonal", "none"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, preconditionOptionName, false, "The preconditioning technique used by the Krylov methods (BiCGSTAB and GMRES).").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the preconditioning method.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(preconditioners)).setDefaultValueString("diagonal").build()).build());
+                
                 this->addOption(storm::settings::OptionBuilder(moduleName, absoluteOptionName, false, "Sets whether the relative or the absolute error is considered for detecting convergence.").setIsAdvanced().build());
                 
                 std::vector<std::string> multiplicationStyles = {"gaussseidel", "regular", "gs", "r"};
@@ -72,6 +79,10 @@ namespace storm {
                     return storm::solver::NativeLinearEquationSolverMethod::IntervalIteration;
                 } else if (linearEquationSystemTechniqueAsString == "ratsearch") {
                     return storm::solver::NativeLinearEquationSolverMethod::RationalSearch;
+                } else if (linearEquationSystemTechniqueAsString == "bicgstab") {
+                    return storm::solver::NativeLinearEquationSolverMethod::Bicgstab;
+                } else if (linearEquationSystemTechniqueAsString == "gmres") {
+                    return storm::solver::NativeLinearEquationSolverMethod::Gmres;
                 }
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown solution technique '" << linearEquationSystemTechniqueAsString << "' selected.");
             }
@@ -96,6 +107,20 @@ namespace storm {
                 return this->getOption(omegaOptionName).getArgumentByName("value").getValueAsDouble();
             }
             
+            uint_fast64_t NativeEquationSolverSettings::getRestartIterationCount() const {
+                return this->getOption(restartOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            storm::solver::NativeLinearEquationSolverPreconditioner NativeEquationSolverSettings::getPreconditioningMethod() const {
+                std::string preconditioningMethodAsString = this->getOption(preconditionOptionName).getArgumentByName("name").getValueAsString();
+                if (preconditioningMethodAsString == "diagonal") {
+                    return storm::solver::NativeLinearEquationSolverPreconditioner::Diagonal;
+                } else if (preconditioningMethodAsString == "none") {
+                    return storm::solver::NativeLinearEquationSolverPreconditioner::None;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown preconditioning technique '" << preconditioningMethodAsString << "' selected.");
+            }
+            
             bool NativeEquationSolverSettings::isConvergenceCriterionSet() const {
                 return this->getOption(absoluteOptionName).getHasOptionBeenSet();
             }
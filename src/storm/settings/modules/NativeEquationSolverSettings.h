@@ -79,6 +79,20 @@ namespace storm {
                  */
                 double getOmega() const;
                 
+                /*!
+                 * Retrieves the number of iterations after which restarted methods (e.g. GMRES) are restarted.
+                 *
+                 * @return The number of iterations.
+                 */
+                uint_fast64_t getRestartIterationCount() const;
+                
+                /*!
+                 * Retrieves the preconditioner to be used by the Krylov methods.
+                 *
+                 * @return The preconditioner to use.
+                 */
+                storm::solver::NativeLinearEquationSolverPreconditioner getPreconditioningMethod() const;
+                
                 /*!
                  * Retrieves whether the convergence criterion has been set.
                  *
@@ -119,6 +133,8 @@ namespace storm {
                 // Define the string names of the options as constants.
                 static const std::string techniqueOptionName;
                 static const std::string omegaOptionName;
+                static const std::string restartOptionName;
+                static const std::string preconditionOptionName;
                 static const std::string maximalIterationsOptionName;
                 static const std::string maximalIterationsOptionShortName;
                 static const std::string precisionOptionName;
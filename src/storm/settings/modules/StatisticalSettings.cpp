@@ -0,0 +1,84 @@
+#include "storm/settings/modules/StatisticalSettings.h"
+
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/Argument.h"
+#include "storm/settings/SettingsManager.h"
+
+#include "storm/utility/macros.h"
+#include "storm/utility/Engine.h"
+
+namespace storm {
+    namespace settings {
+        namespace modules {
+            
+            const std::string StatisticalSettings::moduleName = "statistical";
+            const std::string StatisticalSettings::precisionOptionName = "precision";
+            const std::string StatisticalSettings::confidenceOptionName = "confidence";
+            const std::string StatisticalSettings::indifferenceOptionName = "indifference";
+            const std::string StatisticalSettings::pathLengthOptionName = "pathlength";
+            const std::string StatisticalSettings::batchSizeOptionName = "batchsize";
+            const std::string StatisticalSettings::schedulersOptionName = "schedulers";
+            const std::string StatisticalSettings::seedOptionName = "seed";
+            
+            StatisticalSettings::StatisticalSettings() : ModuleSettings(moduleName) {
+                this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, false, "The maximal absolute error of the estimated values.")
+                                .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The precision.").setDefaultValueDouble(0.01).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, confidenceOptionName, false, "The confidence with which the estimated values respect the precision.")
+                                .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The confidence.").setDefaultValueDouble(0.95).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, indifferenceOptionName, false, "The half-width of the indifference region around the threshold of bounded properties (sequential probability ratio test).").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The half-width.").setDefaultValueDouble(0.01).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 0.5)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, pathLengthOptionName, false, "The maximal length of a simulated path for properties without step bound.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("length", "The maximal path length.").setDefaultValueUnsignedInteger(100000).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, batchSizeOptionName, false, "The number of paths simulated by one (sequential) batch.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of paths.").setDefaultValueUnsignedInteger(1000).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, schedulersOptionName, false, "The number of schedulers that are sampled for nondeterministic models.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of schedulers.").setDefaultValueUnsignedInteger(100).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, seedOptionName, false, "The seed from which all random number streams are derived.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The seed.").setDefaultValueUnsignedInteger(0).build()).build());
+            }
+            
+            double StatisticalSettings::getPrecision() const {
+                return this->getOption(precisionOptionName).getArgumentByName("value").getValueAsDouble();
+            }
+            
+            double StatisticalSettings::getConfidence() const {
+                return this->getOption(confidenceOptionName).getArgumentByName("value").getValueAsDouble();
+            }
+            
+            double StatisticalSettings::getIndifferenceRegion() const {
+                return this->getOption(indifferenceOptionName).getArgumentByName("value").getValueAsDouble();
+            }
+            
+            uint64_t StatisticalSettings::getMaximalPathLength() const {
+                return this->getOption(pathLengthOptionName).getArgumentByName("length").getValueAsUnsignedInteger();
+            }
+            
+            uint64_t StatisticalSettings::getBatchSize() const {
+                return this->getOption(batchSizeOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            uint64_t StatisticalSettings::getNumberOfSchedulers() const {
+                return this->getOption(schedulersOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            uint64_t StatisticalSettings::getSeed() const {
+                return this->getOption(seedOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+            }
+            
+            bool StatisticalSettings::check() const {
+                bool optionsSet = this->getOption(precisionOptionName).getHasOptionBeenSet() ||
+                                  this->getOption(confidenceOptionName).getHasOptionBeenSet() ||
+                                  this->getOption(indifferenceOptionName).getHasOptionBeenSet() ||
+                                  this->getOption(pathLengthOptionName).getHasOptionBeenSet() ||
+                                  this->getOption(batchSizeOptionName).getHasOptionBeenSet() ||
+                                  this->getOption(schedulersOptionName).getHasOptionBeenSet() ||
+                                  this->getOption(seedOptionName).getHasOptionBeenSet();
+                STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::CoreSettings>().getEngine() == storm::utility::Engine::Statistical || !optionsSet, "Statistical engine is not selected, so setting options for it has no effect.");
+                return true;
+            }
+        } // namespace modules
+    } // namespace settings
+} // namespace storm
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+    namespace settings {
+        namespace modules {
+            
+            /*!
+             * This class represents the settings for the statistical model checking engine.
+             */
+            class StatisticalSettings : public ModuleSettings {
+            public:
+                /*!
+                 * Creates a new set of statistical model checking settings.
+                 */
+                StatisticalSettings();
+                
+                /*!
+                 * Retrieves the maximal absolute error of the estimates.
+                 *
+                 * @return The precision.
+                 */
+                double getPrecision() const;
+                
+                /*!
+                 * Retrieves the confidence with which the estimates respect the precision.
+                 *
+                 * @return The confidence.
+                 */
+                double getConfidence() const;
+                
+                /*!
+                 * Retrieves the half-width of the indifference region used by the sequential probability ratio test.
+                 *
+                 * @return The half-width of the indifference region.
+                 */
+                double getIndifferenceRegion() const;
+                
+                /*!
+                 * Retrieves the maximal length of a path for properties without a step bound.
+                 *
+                 * @return The maximal path length.
+                 */
+                uint64_t getMaximalPathLength() const;
+                
+                /*!
+                 * Retrieves the number of paths which are simulated by one batch.
+                 *
+                 * @return The batch size.
+                 */
+                uint64_t getBatchSize() const;
+                
+                /*!
+                 * Retrieves the number of schedulers that are sampled for nondeterministic models.
+                 *
+                 * @return The number of schedulers.
+                 */
+                uint64_t getNumberOfSchedulers() const;
+                
+                /*!
+                 * Retrieves the seed from which all random number streams are derived.
+                 *
+                 * @return The seed.
+                 */
+                uint64_t getSeed() const;
+                
+                virtual bool check() const override;
+                
+                // The name of the module.
+                static const std::string moduleName;
+                
+            private:
+                // Define the string names of the options as constants.
+                static const std::string precisionOptionName;
+                static const std::string confidenceOptionName;
+                static const std::string indifferenceOptionName;
+                static const std::string pathLengthOptionName;
+                static const std::string batchSizeOptionName;
+                static const std::string schedulersOptionName;
+                static const std::string seedOptionName;
+            };
+            
+        }
+    }
+}
@@ -0,0 +1,60 @@
+#include "storm/simulator/BatchSimulation.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+
+namespace storm {
+    namespace simulator {
+
+        uint64_t getBatchSeed(uint64_t seed, uint64_t batchIndex) {
+            std::seed_seq sequence{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32), static_cast<uint32_t>(batchIndex), static_cast<uint32_t>(batchIndex >> 32)};
+            std::vector<uint32_t> result(2);
+            sequence.generate(result.begin(), result.end());
+            return (static_cast<uint64_t>(result[0]) << 32) | result[1];
+        }
+
+        void simulateBatches(uint64_t firstBatch, uint64_t numberOfBatches, std::function<void(uint64_t)> const& simulateBatch) {
+#ifdef STORM_HAVE_INTELTBB
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(firstBatch, firstBatch + numberOfBatches), [&] (tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t batch = range.begin(); batch < range.end(); ++batch) {
+                    simulateBatch(batch);
+                }
+            });
+#else
+            for (uint64_t batch = firstBatch; batch < firstBatch + numberOfBatches; ++batch) {
+                simulateBatch(batch);
+            }
+#endif
+        }
+
+        void PathStatistics::addPath(double value, bool truncated) {
+            ++numberOfPaths;
+            sum += value;
+            sumOfSquares += value * value;
+            if (truncated) {
+                ++numberOfTruncatedPaths;
+            }
+        }
+
+        void PathStatistics::add(PathStatistics const& other) {
+            numberOfPaths += other.numberOfPaths;
+            numberOfTruncatedPaths += other.numberOfTruncatedPaths;
+            sum += other.sum;
+            sumOfSquares += other.sumOfSquares;
+        }
+
+        double PathStatistics::getMean() const {
+            return numberOfPaths == 0 ? 0.0 : sum / numberOfPaths;
+        }
+
+        double PathStatistics::getVariance() const {
+            if (numberOfPaths < 2) {
+                return 0.0;
+            }
+            return std::max(0.0, (sumOfSquares - sum * sum / numberOfPaths) / (numberOfPaths - 1));
+        }
+    }
+}
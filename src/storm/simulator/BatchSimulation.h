@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+namespace storm {
+    namespace simulator {
+
+        // Number of batches which are simulated in parallel before a stopping criterion is checked again.
+        const uint64_t BATCHES_PER_ROUND = 64;
+
+        /*!
+         * Derives the seed of the random number stream of a batch. Every batch uses its own stream that only depends on the
+         * given seed and the batch index, such that simulation results do not depend on the number of threads.
+         *
+         * @param seed The seed of the simulation.
+         * @param batchIndex The index of the batch.
+         * @return The seed for the random number generator of the batch.
+         */
+        uint64_t getBatchSeed(uint64_t seed, uint64_t batchIndex);
+
+        /*!
+         * Simulates the batches with indices firstBatch, ..., firstBatch + numberOfBatches - 1. The batches are simulated in
+         * parallel if Storm was built with support for Intel TBB.
+         *
+         * @param firstBatch The index of the first batch.
+         * @param numberOfBatches The number of batches.
+         * @param simulateBatch Simulates the batch with the given index. May be called concurrently.
+         */
+        void simulateBatches(uint64_t firstBatch, uint64_t numberOfBatches, std::function<void(uint64_t)> const& simulateBatch);
+
+        /*!
+         * Statistics over the values of simulated paths.
+         */
+        struct PathStatistics {
+            void addPath(double value, bool truncated);
+            void add(PathStatistics const& other);
+            double getMean() const;
+            double getVariance() const;
+
+            uint64_t numberOfPaths = 0;
+            // Number of paths which were cut off because the maximal path length was reached.
+            uint64_t numberOfTruncatedPaths = 0;
+            double sum = 0;
+            double sumOfSquares = 0;
+        };
+    }
+}
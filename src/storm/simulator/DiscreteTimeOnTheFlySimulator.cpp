@@ -0,0 +1,346 @@
+#include "storm/simulator/DiscreteTimeOnTheFlySimulator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <unordered_map>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/generator/JaniNextStateGenerator.h"
+#include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/SignalHandler.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace simulator {
+
+        /*!
+         * A worker owns a next-state generator and a cache of the behavior of recently expanded states.
+         */
+        template<typename ValueType>
+        class DiscreteTimeOnTheFlySimulator<ValueType>::Worker {
+        public:
+            /*!
+             * The behavior of an expanded state in a form that allows to quickly sample successors.
+             */
+            struct CachedBehavior {
+                uint64_t getNumberOfChoices() const {
+                    return choiceIndices.size() - 1;
+                }
+
+                // The successors of choice i are stored at positions choiceIndices[i], ..., choiceIndices[i+1]-1.
+                std::vector<uint64_t> choiceIndices;
+                std::vector<storm::generator::CompressedState> successors;
+                // The probabilities of the successors, accumulated per choice.
+                std::vector<ValueType> cumulativeProbabilities;
+                // The action reward of choice i for reward model j is stored at position i * numberOfRewardModels + j.
+                std::vector<ValueType> actionRewards;
+                std::vector<ValueType> stateRewards;
+                // The values of the predicates of the simulator in this state.
+                storm::storage::BitVector predicateValues;
+                // True iff no other state can be reached from this state.
+                bool absorbing;
+            };
+
+            Worker(std::unique_ptr<GeneratorType>&& generator, uint64_t cacheSize) : generator(std::move(generator)), cacheSize(cacheSize) {
+                STORM_LOG_THROW(this->generator->isDiscreteTimeModel(), storm::exceptions::NotSupportedException, "On-the-fly simulation is only supported for discrete-time models.");
+                std::vector<uint32_t> initialStateIndices = this->generator->getInitialStates(stateToIdCallback);
+                STORM_LOG_THROW(initialStateIndices.size() == 1, storm::exceptions::NotSupportedException, "Model must have a unique initial state.");
+                initialState = stateBuffer[initialStateIndices.front()];
+                stateBuffer.clear();
+            }
+
+            storm::generator::CompressedState const& getInitialState() const {
+                return initialState;
+            }
+
+            GeneratorType const& getGenerator() const {
+                return *generator;
+            }
+
+            /*!
+             * Retrieves the behavior of the given state, either from the cache or by expanding it.
+             * The reference is only valid until the next call.
+             */
+            CachedBehavior const& getBehavior(storm::generator::CompressedState const& state, std::vector<storm::expressions::Expression> const& predicates) {
+                auto cacheIt = cache.find(state);
+                if (cacheIt != cache.end()) {
+                    ++cacheHits;
+                    // Move the entry to the front as it is now the most recently used one.
+                    recentlyUsed.splice(recentlyUsed.begin(), recentlyUsed, cacheIt->second);
+                    return cacheIt->second->second;
+                }
+                ++cacheMisses;
+                CachedBehavior behavior = expand(state, predicates);
+                if (cache.size() >= cacheSize) {
+                    cache.erase(recentlyUsed.back().first);
+                    recentlyUsed.pop_back();
+                }
+                recentlyUsed.emplace_front(state, std::move(behavior));
+                cache.emplace(state, recentlyUsed.begin());
+                return recentlyUsed.front().second;
+            }
+
+            /*!
+             * Samples a successor of the given choice.
+             */
+            storm::generator::CompressedState const& sampleSuccessor(CachedBehavior const& behavior, uint64_t choice, storm::utility::RandomProbabilityGenerator<ValueType>& randomGenerator) const {
+                auto first = behavior.cumulativeProbabilities.begin() + behavior.choiceIndices[choice];
+                auto last = behavior.cumulativeProbabilities.begin() + behavior.choiceIndices[choice + 1];
+                STORM_LOG_ASSERT(first != last, "Choice without successors.");
+                ValueType quantile = randomGenerator.random() * *(last - 1);
+                auto successorIt = std::upper_bound(first, last, quantile);
+                if (successorIt == last) {
+                    --successorIt;
+                }
+                return behavior.successors[std::distance(behavior.cumulativeProbabilities.begin(), successorIt)];
+            }
+
+            void clearCache(uint64_t newCacheSize) {
+                cache.clear();
+                recentlyUsed.clear();
+                cacheSize = newCacheSize;
+            }
+
+            uint64_t cacheHits = 0;
+            uint64_t cacheMisses = 0;
+
+        private:
+            CachedBehavior expand(storm::generator::CompressedState const& state, std::vector<storm::expressions::Expression> const& predicates) {
+                CachedBehavior result;
+                generator->load(state);
+                result.predicateValues = storm::storage::BitVector(predicates.size());
+                for (uint64_t predicate = 0; predicate < predicates.size(); ++predicate) {
+                    result.predicateValues.set(predicate, generator->satisfies(predicates[predicate]));
+                }
+
+                storm::generator::StateBehavior<ValueType, uint32_t> behavior = generator->expand(stateToIdCallback);
+                uint64_t numberOfRewardModels = generator->getNumberOfRewardModels();
+                result.stateRewards = behavior.getStateRewards();
+                result.stateRewards.resize(numberOfRewardModels, storm::utility::zero<ValueType>());
+                result.choiceIndices.push_back(0);
+                result.absorbing = true;
+                for (auto const& choice : behavior) {
+                    ValueType cumulativeProbability = storm::utility::zero<ValueType>();
+                    for (auto const& successor : choice) {
+                        cumulativeProbability += successor.second;
+                        result.successors.push_back(stateBuffer[successor.first]);
+                        result.cumulativeProbabilities.push_back(cumulativeProbability);
+                        result.absorbing &= result.successors.back() == state;
+                    }
+                    result.choiceIndices.push_back(result.successors.size());
+                    std::vector<ValueType> choiceRewards = choice.getRewards();
+                    choiceRewards.resize(numberOfRewardModels, storm::utility::zero<ValueType>());
+                    result.actionRewards.insert(result.actionRewards.end(), choiceRewards.begin(), choiceRewards.end());
+                }
+                stateBuffer.clear();
+                return result;
+            }
+
+            std::unique_ptr<GeneratorType> generator;
+            storm::generator::CompressedState initialState;
+
+            // The states that are reported by the generator during an expansion. As the ids are only used within one
+            // expansion, a state may be stored multiple times.
+            std::vector<storm::generator::CompressedState> stateBuffer;
+            std::function<uint32_t (storm::generator::CompressedState const&)> stateToIdCallback = [this] (storm::generator::CompressedState const& state) {
+                stateBuffer.push_back(state);
+                return static_cast<uint32_t>(stateBuffer.size() - 1);
+            };
+
+            // The cached states, ordered from most to least recently used.
+            std::list<std::pair<storm::generator::CompressedState, CachedBehavior>> recentlyUsed;
+            std::unordered_map<storm::generator::CompressedState, typename std::list<std::pair<storm::generator::CompressedState, CachedBehavior>>::iterator> cache;
+            uint64_t cacheSize;
+        };
+
+        template<typename ValueType>
+        DiscreteTimeOnTheFlySimulator<ValueType>::DiscreteTimeOnTheFlySimulator(storm::prism::Program const& program, storm::generator::NextStateGeneratorOptions const& options) : seed(0), cacheSize(100000), maximalPathLength(100000), batchSize(1000) {
+            // Workers may be created later on, so the factory keeps its own copies of the program and the options.
+            generatorFactory = [program, options] () { return std::make_unique<storm::generator::PrismNextStateGenerator<ValueType, uint32_t>>(program, options); };
+            createWorkers(1);
+        }
+
+        template<typename ValueType>
+        DiscreteTimeOnTheFlySimulator<ValueType>::DiscreteTimeOnTheFlySimulator(storm::jani::Model const& model, storm::generator::NextStateGeneratorOptions const& options) : seed(0), cacheSize(100000), maximalPathLength(100000), batchSize(1000) {
+            // Workers may be created later on, so the factory keeps its own copies of the model and the options.
+            generatorFactory = [model, options] () { return std::make_unique<storm::generator::JaniNextStateGenerator<ValueType, uint32_t>>(model, options); };
+            createWorkers(1);
+        }
+
+        template<typename ValueType>
+        DiscreteTimeOnTheFlySimulator<ValueType>::~DiscreteTimeOnTheFlySimulator() = default;
+
+        template<typename ValueType>
+        void DiscreteTimeOnTheFlySimulator<ValueType>::createWorkers(uint64_t numberOfWorkers) {
+            while (workers.size() < numberOfWorkers) {
+                workers.push_back(std::make_unique<Worker>(generatorFactory(), cacheSize));
+            }
+        }
+
+        template<typename ValueType>
+        void DiscreteTimeOnTheFlySimulator<ValueType>::setSeed(uint64_t newSeed) {
+            seed = newSeed;
+        }
+
+        template<typename ValueType>
+        void DiscreteTimeOnTheFlySimulator<ValueType>::setCacheSize(uint64_t newCacheSize) {
+            STORM_LOG_THROW(newCacheSize > 0, storm::exceptions::InvalidArgumentException, "The cache size must be positive.");
+            cacheSize = newCacheSize;
+            for (auto& worker : workers) {
+                worker->clearCache(cacheSize);
+            }
+        }
+
+        template<typename ValueType>
+        void DiscreteTimeOnTheFlySimulator<ValueType>::setMaximalPathLength(uint64_t newMaximalPathLength) {
+            maximalPathLength = newMaximalPathLength;
+        }
+
+        template<typename ValueType>
+        void DiscreteTimeOnTheFlySimulator<ValueType>::setBatchSize(uint64_t newBatchSize) {
+            STORM_LOG_THROW(newBatchSize > 0, storm::exceptions::InvalidArgumentException, "The batch size must be positive.");
+            batchSize = newBatchSize;
+        }
+
+        template<typename ValueType>
+        void DiscreteTimeOnTheFlySimulator<ValueType>::setPredicates(std::vector<storm::expressions::Expression> const& newPredicates) {
+            bool changed = newPredicates.size() != predicates.size();
+            for (uint64_t predicate = 0; !changed && predicate < predicates.size(); ++predicate) {
+                changed = !predicates[predicate].areSame(newPredicates[predicate]);
+            }
+            if (changed) {
+                predicates = newPredicates;
+                for (auto& worker : workers) {
+                    worker->clearCache(cacheSize);
+                }
+            }
+        }
+
+        template<typename ValueType>
+        PathStatistics DiscreteTimeOnTheFlySimulator<ValueType>::estimateUntilProbability(storm::expressions::Expression const& constraint, storm::expressions::Expression const& target, boost::optional<uint64_t> const& stepBound, uint64_t numberOfPaths) {
+            setPredicates({constraint, target});
+            auto pathValue = [this, &stepBound] (Worker& worker, storm::utility::RandomProbabilityGenerator<ValueType>& randomGenerator, bool& truncated) {
+                storm::generator::CompressedState state = worker.getInitialState();
+                for (uint64_t step = 0; ; ++step) {
+                    auto const& behavior = worker.getBehavior(state, predicates);
+                    if (behavior.predicateValues.get(1)) {
+                        return 1.0;
+                    }
+                    if (!behavior.predicateValues.get(0) || behavior.absorbing || (stepBound && step >= stepBound.get())) {
+                        return 0.0;
+                    }
+                    if (step >= maximalPathLength) {
+                        truncated = true;
+                        return 0.0;
+                    }
+                    uint64_t choice = behavior.getNumberOfChoices() == 1 ? 0 : randomGenerator.random_uint(0, behavior.getNumberOfChoices() - 1);
+                    state = worker.sampleSuccessor(behavior, choice, randomGenerator);
+                }
+            };
+            PathStatistics result = simulate(pathValue, numberOfPaths);
+            STORM_LOG_WARN_COND(result.numberOfTruncatedPaths == 0, result.numberOfTruncatedPaths << " of " << result.numberOfPaths << " paths reached the maximal path length " << maximalPathLength << " and were considered unsuccessful.");
+            return result;
+        }
+
+        template<typename ValueType>
+        PathStatistics DiscreteTimeOnTheFlySimulator<ValueType>::estimateCumulativeReward(std::string const& rewardModelName, uint64_t stepBound, uint64_t numberOfPaths) {
+            GeneratorType const& generator = workers.front()->getGenerator();
+            uint64_t numberOfRewardModels = generator.getNumberOfRewardModels();
+            uint64_t rewardModelIndex = 0;
+            while (rewardModelIndex < numberOfRewardModels && generator.getRewardModelInformation(rewardModelIndex).getName() != rewardModelName) {
+                ++rewardModelIndex;
+            }
+            STORM_LOG_THROW(rewardModelIndex < numberOfRewardModels, storm::exceptions::InvalidArgumentException, "The reward model '" << rewardModelName << "' is not built by the next-state generator.");
+
+            setPredicates({});
+            auto pathValue = [this, rewardModelIndex, numberOfRewardModels, stepBound] (Worker& worker, storm::utility::RandomProbabilityGenerator<ValueType>& randomGenerator, bool&) {
+                storm::generator::CompressedState state = worker.getInitialState();
+                double value = 0.0;
+                for (uint64_t step = 0; step < stepBound; ++step) {
+                    auto const& behavior = worker.getBehavior(state, predicates);
+                    value += storm::utility::convertNumber<double>(behavior.stateRewards[rewardModelIndex]);
+                    if (behavior.getNumberOfChoices() == 0) {
+                        // Deadlock and terminal states implicitly have a self-loop without action rewards.
+                        value += (stepBound - step - 1) * storm::utility::convertNumber<double>(behavior.stateRewards[rewardModelIndex]);
+                        break;
+                    }
+                    uint64_t choice = behavior.getNumberOfChoices() == 1 ? 0 : randomGenerator.random_uint(0, behavior.getNumberOfChoices() - 1);
+                    value += storm::utility::convertNumber<double>(behavior.actionRewards[choice * numberOfRewardModels + rewardModelIndex]);
+                    state = worker.sampleSuccessor(behavior, choice, randomGenerator);
+                }
+                return value;
+            };
+            return simulate(pathValue, numberOfPaths);
+        }
+
+        template<typename ValueType>
+        PathStatistics DiscreteTimeOnTheFlySimulator<ValueType>::simulate(PathValueFunction const& pathValue, uint64_t numberOfPaths) {
+            uint64_t numberOfBatches = numberOfPaths / batchSize + (numberOfPaths % batchSize == 0 ? 0 : 1);
+            std::vector<PathStatistics> batchResults(numberOfBatches);
+            auto simulateBatch = [&] (Worker& worker, uint64_t batchIndex) {
+                if (storm::utility::resources::isTerminate()) {
+                    return;
+                }
+                storm::utility::RandomProbabilityGenerator<ValueType> randomGenerator(getBatchSeed(seed, batchIndex));
+                uint64_t numberOfBatchPaths = std::min(batchSize, numberOfPaths - batchIndex * batchSize);
+                PathStatistics& batchResult = batchResults[batchIndex];
+                for (uint64_t path = 0; path < numberOfBatchPaths; ++path) {
+                    bool truncated = false;
+                    double value = pathValue(worker, randomGenerator, truncated);
+                    batchResult.addPath(value, truncated);
+                }
+            };
+#ifdef STORM_HAVE_INTELTBB
+            // All workers are created up front. Every task exclusively uses one worker and takes batches until none are left.
+            uint64_t numberOfWorkers = std::min<uint64_t>(std::max(tbb::this_task_arena::max_concurrency(), 1), numberOfBatches);
+            createWorkers(numberOfWorkers);
+            std::atomic<uint64_t> nextBatch(0);
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfWorkers, 1), [&] (tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t workerIndex = range.begin(); workerIndex < range.end(); ++workerIndex) {
+                    Worker& worker = *workers[workerIndex];
+                    for (uint64_t batch = nextBatch++; batch < numberOfBatches; batch = nextBatch++) {
+                        simulateBatch(worker, batch);
+                    }
+                }
+            }, tbb::simple_partitioner());
+#else
+            for (uint64_t batch = 0; batch < numberOfBatches; ++batch) {
+                simulateBatch(*workers.front(), batch);
+            }
+#endif
+            // Accumulate in a fixed order such that the result does not depend on the scheduling of the batches.
+            PathStatistics result;
+            for (auto const& batchResult : batchResults) {
+                result.add(batchResult);
+            }
+            return result;
+        }
+
+        template<typename ValueType>
+        uint64_t DiscreteTimeOnTheFlySimulator<ValueType>::getNumberOfCacheHits() const {
+            uint64_t result = 0;
+            for (auto const& worker : workers) {
+                result += worker->cacheHits;
+            }
+            return result;
+        }
+
+        template<typename ValueType>
+        uint64_t DiscreteTimeOnTheFlySimulator<ValueType>::getNumberOfCacheMisses() const {
+            uint64_t result = 0;
+            for (auto const& worker : workers) {
+                result += worker->cacheMisses;
+            }
+            return result;
+        }
+
+        template class DiscreteTimeOnTheFlySimulator<double>;
+    }
+}
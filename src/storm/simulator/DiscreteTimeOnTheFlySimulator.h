@@ -0,0 +1,149 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/generator/NextStateGenerator.h"
+#include "storm/simulator/BatchSimulation.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/utility/random.h"
+
+namespace storm {
+    namespace prism {
+        class Program;
+    }
+    namespace jani {
+        class Model;
+    }
+
+    namespace simulator {
+
+        /*!
+         * Simulates paths of a discrete-time PRISM program or JANI model without building the state space.
+         * States are expanded on the fly with the corresponding next-state generator. Since the expansion of a state is
+         * expensive compared to sampling a successor, the expanded successor distributions (together with the rewards and
+         * the values of the observed predicates) of recently visited states are kept in a least-recently-used cache.
+         *
+         * Paths are simulated in batches that run in parallel. Next-state generators are not thread-safe, so every parallel task
+         * owns a worker with a generator and a cache and simulates batches until none are left. Workers are created before the
+         * batches are simulated and are kept across simulations. Every batch has its own random number stream derived from the
+         * seed and the batch index, such that the results neither depend on the number of threads nor on the cache size.
+         *
+         * Nondeterminism is resolved uniformly at random in every step.
+         */
+        template<typename ValueType>
+        class DiscreteTimeOnTheFlySimulator {
+        public:
+            typedef storm::generator::NextStateGenerator<ValueType, uint32_t> GeneratorType;
+
+            /*!
+             * Initializes the simulator for the given PRISM program.
+             *
+             * @param program The program. Should have a unique initial state.
+             * @param options The generator options that are used to generate successor states. All reward models that are to be
+             * simulated need to be built.
+             */
+            DiscreteTimeOnTheFlySimulator(storm::prism::Program const& program, storm::generator::NextStateGeneratorOptions const& options);
+
+            /*!
+             * Initializes the simulator for the given JANI model.
+             *
+             * @param model The model. Should have a unique initial state.
+             * @param options The generator options that are used to generate successor states.
+             */
+            DiscreteTimeOnTheFlySimulator(storm::jani::Model const& model, storm::generator::NextStateGeneratorOptions const& options);
+
+            ~DiscreteTimeOnTheFlySimulator();
+
+            /*!
+             * Sets the seed from which the random number streams of the batches are derived.
+             */
+            void setSeed(uint64_t seed);
+
+            /*!
+             * Sets the number of states whose behavior is cached by every worker. Clears all caches.
+             */
+            void setCacheSize(uint64_t cacheSize);
+
+            /*!
+             * Sets the number of steps after which a path is cut off.
+             */
+            void setMaximalPathLength(uint64_t maximalPathLength);
+
+            /*!
+             * Sets the number of paths that are simulated sequentially (by the same worker).
+             */
+            void setBatchSize(uint64_t batchSize);
+
+            /*!
+             * Estimates the probability to satisfy constraint U target (or constraint U<=stepBound target) from the initial state.
+             * A path that reaches the maximal path length before deciding the property counts as unsuccessful.
+             *
+             * @param constraint Boolean expression over the variables of the model describing the constraint states.
+             * @param target Boolean expression over the variables of the model describing the target states.
+             * @param stepBound If given, the target has to be reached within this number of steps.
+             * @param numberOfPaths The number of paths to simulate.
+             * @return The statistics over the paths where each path has value 1 if successful and 0 otherwise.
+             */
+            PathStatistics estimateUntilProbability(storm::expressions::Expression const& constraint, storm::expressions::Expression const& target, boost::optional<uint64_t> const& stepBound, uint64_t numberOfPaths);
+
+            /*!
+             * Estimates the expected reward that is accumulated within the given number of steps from the initial state.
+             *
+             * @param rewardModelName The name of the reward model. Has to be built by the next-state generators.
+             * @param stepBound The number of steps.
+             * @param numberOfPaths The number of paths to simulate.
+             */
+            PathStatistics estimateCumulativeReward(std::string const& rewardModelName, uint64_t stepBound, uint64_t numberOfPaths);
+
+            /*!
+             * Retrieves the number of state expansions that were answered from the caches.
+             */
+            uint64_t getNumberOfCacheHits() const;
+
+            /*!
+             * Retrieves the number of state expansions that required the next-state generator.
+             */
+            uint64_t getNumberOfCacheMisses() const;
+
+        private:
+            class Worker;
+
+            /*!
+             * Creates workers with generators obtained from the generator factory until there are at least the given number of
+             * workers. The construction of generators may modify the shared expression manager, so this must not be called while
+             * batches are simulated.
+             */
+            void createWorkers(uint64_t numberOfWorkers);
+
+            /*!
+             * Sets the predicates whose values are stored together with the cached behavior. Clears all caches if the predicates change.
+             */
+            void setPredicates(std::vector<storm::expressions::Expression> const& newPredicates);
+
+            // Computes the value of a single path. The flag has to be set if the path was cut off.
+            typedef std::function<double(Worker& worker, storm::utility::RandomProbabilityGenerator<ValueType>& randomGenerator, bool& truncated)> PathValueFunction;
+
+            /*!
+             * Simulates the given number of paths in parallel batches.
+             */
+            PathStatistics simulate(PathValueFunction const& pathValue, uint64_t numberOfPaths);
+
+            std::function<std::unique_ptr<GeneratorType>()> generatorFactory;
+
+            // All workers that were created so far.
+            std::vector<std::unique_ptr<Worker>> workers;
+
+            std::vector<storm::expressions::Expression> predicates;
+
+            uint64_t seed;
+            uint64_t cacheSize;
+            uint64_t maximalPathLength;
+            uint64_t batchSize;
+        };
+    }
+}
@@ -219,6 +219,53 @@ namespace storm {
             this->currentModelHasBeenOptimized = false;
         }
         
+        template<typename ValueType>
+        void GlpkLpSolver<ValueType>::addConstraints(std::vector<storm::expressions::Variable> const& variables, std::vector<uint64_t> const& rowStarts, std::vector<uint64_t> const& columns, std::vector<ValueType> const& coefficients, storm::expressions::OperatorType const& relation, std::vector<ValueType> const& rightHandSides) {
+            STORM_LOG_THROW(relation == storm::expressions::OperatorType::LessOrEqual || relation == storm::expressions::OperatorType::GreaterOrEqual || relation == storm::expressions::OperatorType::Equal, storm::exceptions::InvalidArgumentException, "Illegal relation for LP constraints.");
+            STORM_LOG_ASSERT(rowStarts.size() == rightHandSides.size() + 1, "Number of row starts does not match the number of constraints.");
+            if (rightHandSides.empty()) {
+                return;
+            }
+            
+            // Translate the given variables to glpk's column indices once.
+            std::vector<int> variableIndices;
+            variableIndices.reserve(variables.size());
+            for (auto const& variable : variables) {
+                auto variableIndexPair = this->variableToIndexMap.find(variable);
+                STORM_LOG_THROW(variableIndexPair != this->variableToIndexMap.end(), storm::exceptions::InvalidArgumentException, "Constraint refers to unknown variable '" << variable.getName() << "'.");
+                variableIndices.push_back(variableIndexPair->second);
+            }
+            
+            // As glpk uses 1-based indexing, the k-th entry is stored at position k+1. The data of a row starting at
+            // entry k can then be passed to glpk by pointing to position k.
+            uint64_t numberOfEntries = rowStarts.back();
+            std::vector<int> entryColumns(numberOfEntries + 1, -1);
+            std::vector<double> entryValues(numberOfEntries + 1, 0.0);
+            for (uint64_t entry = 0; entry < numberOfEntries; ++entry) {
+                entryColumns[entry + 1] = variableIndices[columns[entry]];
+                entryValues[entry + 1] = storm::utility::convertNumber<double>(coefficients[entry]);
+            }
+            
+            int firstConstraintIndex = glp_add_rows(this->lp, static_cast<int>(rightHandSides.size()));
+            for (uint64_t row = 0; row < rightHandSides.size(); ++row) {
+                int constraintIndex = firstConstraintIndex + static_cast<int>(row);
+                double rhs = storm::utility::convertNumber<double>(rightHandSides[row]);
+                switch (relation) {
+                    case storm::expressions::OperatorType::LessOrEqual:
+                        glp_set_row_bnds(this->lp, constraintIndex, GLP_UP, 0, rhs);
+                        break;
+                    case storm::expressions::OperatorType::GreaterOrEqual:
+                        glp_set_row_bnds(this->lp, constraintIndex, GLP_LO, rhs, 0);
+                        break;
+                    default:
+                        glp_set_row_bnds(this->lp, constraintIndex, GLP_FX, rhs, rhs);
+                }
+                glp_set_mat_row(this->lp, constraintIndex, static_cast<int>(rowStarts[row + 1] - rowStarts[row]), entryColumns.data() + rowStarts[row], entryValues.data() + rowStarts[row]);
+            }
+            
+            this->currentModelHasBeenOptimized = false;
+        }
+        
         // Method used within the MIP solver to terminate early
         void callback(glp_tree* t, void* info) {
             auto& mipgap = *static_cast<std::pair<double, bool>*>(info);
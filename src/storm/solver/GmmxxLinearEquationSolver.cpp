@@ -37,7 +37,9 @@ namespace storm {
         
         template<typename ValueType>
         void GmmxxLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType>&& A) {
-            gmmxxA = storm::adapters::GmmxxAdapter<ValueType>::toGmmxxSparseMatrix(A);
+            // Take ownership of the matrix so it is destroyed after we have translated it to gmm++'s format.
+            storm::storage::SparseMatrix<ValueType> localA(std::move(A));
+            gmmxxA = storm::adapters::GmmxxAdapter<ValueType>::toGmmxxSparseMatrix(localA);
             clearCache();
         }
         
@@ -226,6 +226,49 @@ namespace storm {
             STORM_LOG_THROW(error == 0, storm::exceptions::InvalidStateException, "Could not assert constraint (" << GRBgeterrormsg(env) << ", error code " << error << ").");
         }
         
+        template<typename ValueType>
+        void GurobiLpSolver<ValueType>::addConstraints(std::vector<storm::expressions::Variable> const& variables, std::vector<uint64_t> const& rowStarts, std::vector<uint64_t> const& columns, std::vector<ValueType> const& coefficients, storm::expressions::OperatorType const& relation, std::vector<ValueType> const& rightHandSides) {
+            STORM_LOG_THROW(relation == storm::expressions::OperatorType::LessOrEqual || relation == storm::expressions::OperatorType::GreaterOrEqual || relation == storm::expressions::OperatorType::Equal, storm::exceptions::InvalidArgumentException, "Illegal relation for LP constraints.");
+            STORM_LOG_ASSERT(rowStarts.size() == rightHandSides.size() + 1, "Number of row starts does not match the number of constraints.");
+            STORM_LOG_TRACE("Adding " << rightHandSides.size() << " constraints to GurobiLpSolver.");
+            if (rightHandSides.empty()) {
+                return;
+            }
+            
+            // Translate the given variables to Gurobi's variable indices once.
+            std::vector<int> variableIndices;
+            variableIndices.reserve(variables.size());
+            for (auto const& variable : variables) {
+                auto variableIndexPair = this->variableToIndexMap.find(variable);
+                STORM_LOG_THROW(variableIndexPair != this->variableToIndexMap.end(), storm::exceptions::InvalidArgumentException, "Constraint refers to unknown variable '" << variable.getName() << "'.");
+                variableIndices.push_back(variableIndexPair->second);
+            }
+            
+            // Gurobi takes the constraints in compressed row format, so we only need to translate the indices and values.
+            std::vector<size_t> constraintStarts(rowStarts.begin(), rowStarts.end() - 1);
+            std::vector<int> entryColumns;
+            entryColumns.reserve(columns.size());
+            for (auto const& column : columns) {
+                entryColumns.push_back(variableIndices[column]);
+            }
+            std::vector<double> entryValues;
+            entryValues.reserve(coefficients.size());
+            for (auto const& coefficient : coefficients) {
+                entryValues.push_back(storm::utility::convertNumber<double>(coefficient));
+            }
+            std::vector<double> rhs;
+            rhs.reserve(rightHandSides.size());
+            for (auto const& value : rightHandSides) {
+                rhs.push_back(storm::utility::convertNumber<double>(value));
+            }
+            char sense = relation == storm::expressions::OperatorType::LessOrEqual ? GRB_LESS_EQUAL : (relation == storm::expressions::OperatorType::GreaterOrEqual ? GRB_GREATER_EQUAL : GRB_EQUAL);
+            std::vector<char> senses(rightHandSides.size(), sense);
+            
+            int error = GRBXaddconstrs(model, static_cast<int>(rightHandSides.size()), rowStarts.back(), constraintStarts.data(), entryColumns.data(), entryValues.data(), senses.data(), rhs.data(), nullptr);
+            nextConstraintIndex += static_cast<int>(rightHandSides.size());
+            STORM_LOG_THROW(error == 0, storm::exceptions::InvalidStateException, "Could not assert constraints (" << GRBgeterrormsg(env) << ", error code " << error << ").");
+        }
+        
         template<typename ValueType>
         void GurobiLpSolver<ValueType>::optimize() const {
             // First incorporate all recent changes.
@@ -654,6 +697,11 @@ namespace storm {
             throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Gurobi. Yet, a method was called that requires this support. Please choose a version of support with Gurobi support.";
         }
         
+        template<typename ValueType>
+        void GurobiLpSolver<ValueType>::addConstraints(std::vector<storm::expressions::Variable> const&, std::vector<uint64_t> const&, std::vector<uint64_t> const&, std::vector<ValueType> const&, storm::expressions::OperatorType const&, std::vector<ValueType> const&) {
+            throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Gurobi. Yet, a method was called that requires this support. Please choose a version of support with Gurobi support.";
+        }
+        
         template<typename ValueType>
         void GurobiLpSolver<ValueType>::optimize() const {
             throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Gurobi. Yet, a method was called that requires this support. Please choose a version of support with Gurobi support.";
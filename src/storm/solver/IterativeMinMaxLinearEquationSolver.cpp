@@ -162,6 +162,10 @@ namespace storm {
                 }
             }
             storm::Environment const& environmentOfSolver = environmentOfSolverStorage ? *environmentOfSolverStorage : env;
+            
+            if (env.solver().minMax().isTopologicalPolicyIterationSet()) {
+                return performTopologicalPolicyIteration(env, environmentOfSolver, dir, x, b, std::move(scheduler));
+            }
 
             SolverStatus status = SolverStatus::InProgress;
             uint64_t iterations = 0;
@@ -229,6 +233,205 @@ namespace storm {
             return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
         }
         
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::performTopologicalPolicyIteration(Environment const& env, Environment const& environmentOfSolver, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b, std::vector<storm::storage::sparse::state_type>&& initialPolicy) const {
+            std::vector<storm::storage::sparse::state_type> scheduler = std::move(initialPolicy);
+            if (!sortedSccDecomposition) {
+                STORM_LOG_TRACE("Creating SCC decomposition.");
+                sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(*this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort());
+            }
+            auto const& sccDecomposition = *sortedSccDecomposition;
+            STORM_LOG_INFO("Performing topological policy iteration on " << sccDecomposition.size() << " SCC(s).");
+            
+            // For each SCC, determine the SCCs whose values depend on it, i.e. that reach it in one step under some choice.
+            std::vector<uint64_t> sccOfState(this->A->getRowGroupCount());
+            for (uint64_t sccIndex = 0; sccIndex < sccDecomposition.size(); ++sccIndex) {
+                for (auto const& state : sccDecomposition.getBlock(sccIndex)) {
+                    sccOfState[state] = sccIndex;
+                }
+            }
+            std::vector<std::vector<uint64_t>> dependentSccs(sccDecomposition.size());
+            for (uint64_t sccIndex = 0; sccIndex < sccDecomposition.size(); ++sccIndex) {
+                for (auto const& state : sccDecomposition.getBlock(sccIndex)) {
+                    for (auto const& entry : this->A->getRowGroup(state)) {
+                        uint64_t successorScc = sccOfState[entry.getColumn()];
+                        if (successorScc != sccIndex && (dependentSccs[successorScc].empty() || dependentSccs[successorScc].back() != sccIndex)) {
+                            dependentSccs[successorScc].push_back(sccIndex);
+                        }
+                    }
+                }
+            }
+            
+            storm::storage::BitVector sccsToSolve(sccDecomposition.size(), true);
+            storm::storage::BitVector sccStates(this->A->getRowGroupCount(), false);
+            std::vector<uint64_t> localIndices(this->A->getRowGroupCount());
+            
+            SolverStatus status = SolverStatus::InProgress;
+            uint64_t iterations = 0;
+            this->startMeasureProgress();
+            do {
+                // Solve the equation systems of the marked SCCs. As the SCCs are sorted topologically, the dependents of
+                // an SCC are marked before they are reached.
+                for (uint64_t sccIndex = 0; sccIndex < sccDecomposition.size(); ++sccIndex) {
+                    if (sccsToSolve.get(sccIndex)) {
+                        solveInducedSccEquationSystem(environmentOfSolver, sccDecomposition.getBlock(sccIndex), scheduler, x, b, sccStates, localIndices);
+                        for (auto const& dependentScc : dependentSccs[sccIndex]) {
+                            sccsToSolve.set(dependentScc, true);
+                        }
+                    }
+                }
+                
+                // The values of the states of all other SCCs did not change, so it suffices to look for improvements in the solved SCCs.
+                storm::storage::BitVector improvedSccs(sccDecomposition.size(), false);
+                for (auto const& sccIndex : sccsToSolve) {
+                    for (auto const& group : sccDecomposition.getBlock(sccIndex)) {
+                        uint_fast64_t currentChoice = scheduler[group];
+                        ValueType bestValue = x[group];
+                        for (uint_fast64_t choice = this->A->getRowGroupIndices()[group]; choice < this->A->getRowGroupIndices()[group + 1]; ++choice) {
+                            // If the choice is the currently selected one, we can skip it.
+                            if (choice - this->A->getRowGroupIndices()[group] == currentChoice) {
+                                continue;
+                            }
+                            
+                            ValueType choiceValue = this->A->multiplyRowWithVector(choice, x) + b[choice];
+                            
+                            // If the value is strictly better than the solution of the inner system, we need to improve the scheduler.
+                            if (valueImproved(dir, bestValue, choiceValue)) {
+                                improvedSccs.set(sccIndex, true);
+                                scheduler[group] = choice - this->A->getRowGroupIndices()[group];
+                                bestValue = std::move(choiceValue);
+                            }
+                        }
+                    }
+                }
+                sccsToSolve = std::move(improvedSccs);
+                
+                // If the scheduler did not improve, we are done.
+                if (sccsToSolve.empty()) {
+                    status = SolverStatus::Converged;
+                }
+                
+                // Update environment variables.
+                ++iterations;
+                status = this->updateStatus(status, x, dir == storm::OptimizationDirection::Minimize ? SolverGuarantee::GreaterOrEqual : SolverGuarantee::LessOrEqual, iterations, env.solver().minMax().getMaximalNumberOfIterations());
+                
+                // Potentially show progress.
+                this->showProgressIterative(iterations);
+            } while (status == SolverStatus::InProgress);
+            
+            STORM_LOG_INFO("Number of iterations: " << iterations);
+            this->reportStatus(status, iterations);
+            
+            // If requested, we store the scheduler for retrieval.
+            if (this->isTrackSchedulerSet()) {
+                this->schedulerChoices = std::move(scheduler);
+            }
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+        }
+        
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::solveInducedSccEquationSystem(Environment const& env, storm::storage::StronglyConnectedComponent const& scc, std::vector<uint64_t> const& scheduler, std::vector<ValueType>& x, std::vector<ValueType> const& b, storm::storage::BitVector& sccStates, std::vector<uint64_t>& localIndices) const {
+            if (scc.size() == 1) {
+                // A single state can be solved directly.
+                uint64_t state = *scc.begin();
+                uint64_t row = this->A->getRowGroupIndices()[state] + scheduler[state];
+                ValueType value = b[row];
+                ValueType selfLoopProbability = storm::utility::zero<ValueType>();
+                for (auto const& entry : this->A->getRow(row)) {
+                    if (entry.getColumn() == state) {
+                        selfLoopProbability += entry.getValue();
+                    } else {
+                        value += entry.getValue() * x[entry.getColumn()];
+                    }
+                }
+                if (!storm::utility::isZero(selfLoopProbability)) {
+                    STORM_LOG_THROW(!storm::utility::isOne(selfLoopProbability), storm::exceptions::InvalidStateException, "The scheduler selects a self-loop with probability one at state " << state << ".");
+                    value /= storm::utility::one<ValueType>() - selfLoopProbability;
+                }
+                x[state] = std::move(value);
+                return true;
+            }
+            
+            uint64_t localIndex = 0;
+            for (auto const& state : scc) {
+                sccStates.set(state, true);
+                localIndices[state] = localIndex;
+                ++localIndex;
+            }
+            
+            // Build the equation system of the SCC. Transitions leaving the SCC are moved to the right-hand side.
+            bool convertToEquationSystem = this->linearEquationSolverFactory->getEquationProblemFormat(env) == LinearEquationSolverProblemFormat::EquationSystem;
+            storm::storage::SparseMatrixBuilder<ValueType> builder(scc.size(), scc.size());
+            std::vector<ValueType> sccB;
+            std::vector<ValueType> sccX;
+            sccB.reserve(scc.size());
+            sccX.reserve(scc.size());
+            for (auto const& state : scc) {
+                uint64_t localRow = localIndices[state];
+                uint64_t row = this->A->getRowGroupIndices()[state] + scheduler[state];
+                ValueType bi = b[row];
+                bool diagonalEntryInserted = false;
+                for (auto const& entry : this->A->getRow(row)) {
+                    if (!sccStates.get(entry.getColumn())) {
+                        bi += entry.getValue() * x[entry.getColumn()];
+                        continue;
+                    }
+                    uint64_t localColumn = localIndices[entry.getColumn()];
+                    // The conversion to an equation system requires that all diagonal entries are present.
+                    if (convertToEquationSystem && !diagonalEntryInserted && localColumn > localRow) {
+                        builder.addNextValue(localRow, localRow, storm::utility::zero<ValueType>());
+                        diagonalEntryInserted = true;
+                    }
+                    diagonalEntryInserted |= localColumn == localRow;
+                    builder.addNextValue(localRow, localColumn, entry.getValue());
+                }
+                if (convertToEquationSystem && !diagonalEntryInserted) {
+                    builder.addNextValue(localRow, localRow, storm::utility::zero<ValueType>());
+                }
+                sccB.push_back(std::move(bi));
+                sccX.push_back(x[state]);
+            }
+            storm::storage::SparseMatrix<ValueType> sccA = builder.build();
+            if (convertToEquationSystem) {
+                sccA.convertToEquationSystem();
+            }
+            
+            std::unique_ptr<LinearEquationSolver<ValueType>> linearEquationSolver = this->linearEquationSolverFactory->create(env, std::move(sccA));
+            if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
+                linearEquationSolver->setLowerBound(this->getLowerBound());
+            } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
+                std::vector<ValueType> lowerBounds;
+                lowerBounds.reserve(scc.size());
+                for (auto const& state : scc) {
+                    lowerBounds.push_back(this->getLowerBounds()[state]);
+                }
+                linearEquationSolver->setLowerBounds(std::move(lowerBounds));
+            }
+            if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
+                linearEquationSolver->setUpperBound(this->getUpperBound());
+            } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
+                std::vector<ValueType> upperBounds;
+                upperBounds.reserve(scc.size());
+                for (auto const& state : scc) {
+                    upperBounds.push_back(this->getUpperBounds()[state]);
+                }
+                linearEquationSolver->setUpperBounds(std::move(upperBounds));
+            }
+            
+            // The current values of the SCC states serve as the starting point.
+            bool result = linearEquationSolver->solveEquations(env, sccX, sccB);
+            for (auto const& state : scc) {
+                x[state] = std::move(sccX[localIndices[state]]);
+                sccStates.set(state, false);
+            }
+            return result;
+        }
+        
         template<typename ValueType>
         bool IterativeMinMaxLinearEquationSolver<ValueType>::valueImproved(OptimizationDirection dir, ValueType const& value1, ValueType const& value2) const {
             if (dir == OptimizationDirection::Minimize) {
@@ -1084,6 +1287,7 @@ namespace storm {
             auxiliaryRowGroupVector2.reset();
             soundValueIterationHelper.reset();
             optimisticValueIterationHelper.reset();
+            sortedSccDecomposition.reset();
             StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
         }
         
@@ -11,6 +11,7 @@
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
 
 #include "storm/solver/SolverStatus.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
 namespace storm {
     
@@ -38,6 +39,25 @@ namespace storm {
             bool solveInducedEquationSystem(Environment const& env, std::unique_ptr<LinearEquationSolver<ValueType>>& linearEquationSolver, std::vector<uint64_t> const& scheduler, std::vector<ValueType>& x, std::vector<ValueType>& subB, std::vector<ValueType> const& originalB) const;
             bool solveEquationsPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             bool performPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b, std::vector<storm::storage::sparse::state_type>&& initialPolicy) const;
+            
+            /*!
+             * Performs policy iteration where, after the first iteration, only the SCCs in which the scheduler changed
+             * and the SCCs depending on them are re-solved. The values of all other SCCs remain those of the current
+             * scheduler, so the iterations coincide with the ones of standard policy iteration.
+             *
+             * @param environmentOfSolver The environment for the linear equation solvers of the SCCs.
+             */
+            bool performTopologicalPolicyIteration(Environment const& env, Environment const& environmentOfSolver, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b, std::vector<storm::storage::sparse::state_type>&& initialPolicy) const;
+            
+            /*!
+             * Solves the equation system induced by the scheduler restricted to the states of the given SCC. The values
+             * of the states outside the SCC are taken from x and the current values of the SCC states serve as the
+             * starting point.
+             *
+             * @param sccStates Used to mark the states of the SCC. It is expected to be empty and is cleared again before returning.
+             * @param localIndices Used to store the index of each SCC state within the SCC.
+             */
+            bool solveInducedSccEquationSystem(Environment const& env, storm::storage::StronglyConnectedComponent const& scc, std::vector<uint64_t> const& scheduler, std::vector<ValueType>& x, std::vector<ValueType> const& b, storm::storage::BitVector& sccStates, std::vector<uint64_t>& localIndices) const;
             bool valueImproved(OptimizationDirection dir, ValueType const& value1, ValueType const& value2) const;
 
             bool solveEquationsValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
@@ -87,6 +107,7 @@ namespace storm {
             mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector2; // A.rowGroupCount() entries
             mutable std::unique_ptr<storm::solver::helper::SoundValueIterationHelper<ValueType>> soundValueIterationHelper;
             mutable std::unique_ptr<storm::solver::helper::OptimisticValueIterationHelper<ValueType>> optimisticValueIterationHelper;
+            mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition; // SCCs of A in topological order (successors first)
             
         };
         
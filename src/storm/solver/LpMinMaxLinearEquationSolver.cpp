@@ -3,8 +3,7 @@
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/utility/vector.h"
 #include "storm/utility/macros.h"
-#include "storm/storage/expressions/VariableExpression.h"
-#include "storm/storage/expressions/RationalLiteralExpression.h"
+#include "storm/storage/expressions/Variable.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/UnexpectedException.h"
 
@@ -31,56 +30,158 @@ namespace storm {
 
             STORM_LOG_THROW(env.solver().minMax().getMethod() == MinMaxMethod::LinearProgramming, storm::exceptions::InvalidEnvironmentException, "This min max solver does not support the selected technique.");
 
-            // Set up the LP solver
+            STORM_LOG_ASSERT(x.size() == this->A->getRowGroupCount(), "Provided x-vector has invalid size.");
+            STORM_LOG_ASSERT(b.size() == this->A->getRowCount(), "Provided b-vector has invalid size.");
+            
+            // Rather than building one LP for the whole system, we solve the SCCs in topological order, such that
+            // each LP only contains the variables of a single SCC.
+            if (!this->sortedSccDecomposition) {
+                STORM_LOG_TRACE("Creating SCC decomposition.");
+                this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(*this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort());
+            }
+            STORM_LOG_INFO("Solving MinMax equation system with " << this->sortedSccDecomposition->size() << " SCC(s) via linear programming.");
+            
+            std::vector<uint64_t> variableIndices(this->A->getRowGroupCount());
+            storm::storage::BitVector statesWithVariable(this->A->getRowGroupCount(), false);
+            for (auto const& scc : *this->sortedSccDecomposition) {
+                bool hasSelfLoop = false;
+                if (scc.size() == 1) {
+                    uint64_t state = *scc.begin();
+                    for (auto const& entry : this->A->getRowGroup(state)) {
+                        if (entry.getColumn() == state) {
+                            hasSelfLoop = true;
+                            break;
+                        }
+                    }
+                }
+                if (scc.size() == 1 && !hasSelfLoop) {
+                    solveTrivialScc(dir, *scc.begin(), x, b);
+                } else {
+                    STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
+                    solveScc(dir, scc, x, b, variableIndices, statesWithVariable);
+                }
+            }
+            
+            // If requested, we store the scheduler for retrieval.
+            if (this->isTrackSchedulerSet()) {
+                this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
+                for (uint64_t rowGroup = 0; rowGroup < this->A->getRowGroupCount(); ++rowGroup) {
+                    uint64_t row = this->A->getRowGroupIndices()[rowGroup];
+                    uint64_t optimalChoiceIndex = 0;
+                    uint64_t currChoice = 0;
+                    ValueType optimalGroupValue = this->A->multiplyRowWithVector(row, x) + b[row];
+                    for (++row, ++currChoice; row < this->A->getRowGroupIndices()[rowGroup + 1]; ++row, ++currChoice) {
+                        ValueType rowValue = this->A->multiplyRowWithVector(row, x) + b[row];
+                        if ((minimize(dir) && rowValue < optimalGroupValue) || (maximize(dir) && rowValue > optimalGroupValue)) {
+                            optimalGroupValue = rowValue;
+                            optimalChoiceIndex = currChoice;
+                        }
+                    }
+                    this->schedulerChoices.get()[rowGroup] = optimalChoiceIndex;
+                }
+            }
+
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+
+            return true;
+        }
+        
+        template<typename ValueType>
+        void LpMinMaxLinearEquationSolver<ValueType>::solveTrivialScc(OptimizationDirection dir, uint64_t state, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            uint64_t row = this->A->getRowGroupIndices()[state];
+            ValueType result = this->A->multiplyRowWithVector(row, x) + b[row];
+            for (++row; row < this->A->getRowGroupIndices()[state + 1]; ++row) {
+                ValueType rowValue = this->A->multiplyRowWithVector(row, x) + b[row];
+                if ((minimize(dir) && rowValue < result) || (maximize(dir) && rowValue > result)) {
+                    result = rowValue;
+                }
+            }
+            x[state] = result;
+        }
+        
+        template<typename ValueType>
+        void LpMinMaxLinearEquationSolver<ValueType>::solveScc(OptimizationDirection dir, storm::storage::StronglyConnectedComponent const& scc, std::vector<ValueType>& x, std::vector<ValueType> const& b, std::vector<uint64_t>& variableIndices, storm::storage::BitVector& statesWithVariable) const {
+            // Set up the LP solver. For minimization, the solution is the greatest vector satisfying all constraints and vice versa.
             std::unique_ptr<storm::solver::LpSolver<ValueType>> solver = lpSolverFactory->create("");
+            solver->setOptimizationDirection(invert(dir));
 
-            // Create a variable for each row group
-            std::vector<storm::expressions::Expression> variableExpressions;
-            variableExpressions.reserve(this->A->getRowGroupCount());
-            for (uint64_t rowGroup = 0; rowGroup < this->A->getRowGroupCount(); ++rowGroup) {
+            // Create a variable for each state of the SCC
+            std::vector<storm::expressions::Variable> variables;
+            std::vector<uint64_t> variableStates;
+            variables.reserve(scc.size());
+            variableStates.reserve(scc.size());
+            for (auto const& rowGroup : scc) {
                 if (this->hasLowerBound()) {
                     ValueType lowerBound = this->getLowerBound(rowGroup);
                     if (this->hasUpperBound()) {
                         ValueType upperBound = this->getUpperBound(rowGroup);
                         if (lowerBound == upperBound) {
                             // Some solvers (like glpk) don't support variables with bounds [x,x]. We therefore just use a constant instead. This should be more efficient anyways.
-                            variableExpressions.push_back(solver->getConstant(lowerBound));
+                            x[rowGroup] = lowerBound;
+                            continue;
                         } else {
                             STORM_LOG_ASSERT(lowerBound <= upperBound, "Lower Bound at row group " << rowGroup << " is " << lowerBound << " which exceeds the upper bound " << upperBound << ".");
-                            variableExpressions.emplace_back(solver->addBoundedContinuousVariable("x" + std::to_string(rowGroup), lowerBound, upperBound, storm::utility::one<ValueType>()));
+                            variables.push_back(solver->addBoundedContinuousVariable("x" + std::to_string(rowGroup), lowerBound, upperBound, storm::utility::one<ValueType>()));
                         }
                     } else {
-                        variableExpressions.emplace_back(solver->addLowerBoundedContinuousVariable("x" + std::to_string(rowGroup), lowerBound, storm::utility::one<ValueType>()));
+                        variables.push_back(solver->addLowerBoundedContinuousVariable("x" + std::to_string(rowGroup), lowerBound, storm::utility::one<ValueType>()));
                     }
                 } else {
                     if (this->upperBound) {
-                        variableExpressions.emplace_back(solver->addUpperBoundedContinuousVariable("x" + std::to_string(rowGroup), this->getUpperBound(rowGroup), storm::utility::one<ValueType>()));
+                        variables.push_back(solver->addUpperBoundedContinuousVariable("x" + std::to_string(rowGroup), this->getUpperBound(rowGroup), storm::utility::one<ValueType>()));
                     } else {
-                        variableExpressions.emplace_back(solver->addUnboundedContinuousVariable("x" + std::to_string(rowGroup), storm::utility::one<ValueType>()));
+                        variables.push_back(solver->addUnboundedContinuousVariable("x" + std::to_string(rowGroup), storm::utility::one<ValueType>()));
                     }
                 }
+                variableIndices[rowGroup] = variableStates.size();
+                variableStates.push_back(rowGroup);
+                statesWithVariable.set(rowGroup, true);
+            }
+            if (variables.empty()) {
+                return;
             }
             solver->update();
             
-            // Add a constraint for each row
-            for (uint64_t rowGroup = 0; rowGroup < this->A->getRowGroupCount(); ++rowGroup) {
+            // Add a constraint x_group - sum_j A[row][j] * x_j ~ b[row] for each row, where the values of states
+            // without a variable (in particular the ones of other SCCs) are moved to the right-hand side.
+            std::vector<uint64_t> rowStarts;
+            std::vector<uint64_t> columns;
+            std::vector<ValueType> coefficients;
+            std::vector<ValueType> rightHandSides;
+            rowStarts.push_back(0);
+            for (auto const& rowGroup : scc) {
+                bool groupHasVariable = statesWithVariable.get(rowGroup);
                 for (uint64_t rowIndex = this->A->getRowGroupIndices()[rowGroup]; rowIndex < this->A->getRowGroupIndices()[rowGroup + 1]; ++rowIndex) {
-                    auto row = this->A->getRow(rowIndex);
-                    std::vector<storm::expressions::Expression> summands;
-                    summands.reserve(1+row.getNumberOfEntries());
-                    summands.push_back(solver->getConstant(b[rowIndex]));
-                    for (auto const& entry : row) {
-                        summands.push_back(solver->getConstant(entry.getValue()) * variableExpressions[entry.getColumn()]);
+                    ValueType rhs = b[rowIndex];
+                    ValueType diagonalCoefficient = groupHasVariable ? storm::utility::one<ValueType>() : storm::utility::zero<ValueType>();
+                    if (!groupHasVariable) {
+                        rhs -= x[rowGroup];
                     }
-                    storm::expressions::Expression rowConstraint = storm::expressions::sum(summands);
-                    if (minimize(dir)) {
-                        rowConstraint = variableExpressions[rowGroup] <= rowConstraint;
-                    } else {
-                        rowConstraint = variableExpressions[rowGroup] >= rowConstraint;
+                    for (auto const& entry : this->A->getRow(rowIndex)) {
+                        if (!statesWithVariable.get(entry.getColumn())) {
+                            rhs += entry.getValue() * x[entry.getColumn()];
+                        } else if (entry.getColumn() == rowGroup) {
+                            diagonalCoefficient -= entry.getValue();
+                        } else {
+                            columns.push_back(variableIndices[entry.getColumn()]);
+                            coefficients.push_back(-entry.getValue());
+                        }
                     }
-                    solver->addConstraint("", rowConstraint);
+                    if (!storm::utility::isZero(diagonalCoefficient)) {
+                        columns.push_back(variableIndices[rowGroup]);
+                        coefficients.push_back(diagonalCoefficient);
+                    }
+                    if (columns.size() == rowStarts.back()) {
+                        // The constraint does not involve any variable.
+                        continue;
+                    }
+                    rowStarts.push_back(columns.size());
+                    rightHandSides.push_back(std::move(rhs));
                 }
             }
+            solver->addConstraints(variables, rowStarts, columns, coefficients, minimize(dir) ? storm::expressions::OperatorType::LessOrEqual : storm::expressions::OperatorType::GreaterOrEqual, rightHandSides);
             
             // Invoke optimization
             solver->optimize();
@@ -88,44 +189,16 @@ namespace storm {
             STORM_LOG_THROW(!solver->isUnbounded(), storm::exceptions::UnexpectedException, "The MinMax equation system is unbounded.");
             STORM_LOG_THROW(solver->isOptimal(), storm::exceptions::UnexpectedException, "Unable to find optimal solution for MinMax equation system.");
             
-            // write the solution into the solution vector
-            STORM_LOG_ASSERT(x.size() == variableExpressions.size(), "Dimension of x-vector does not match number of varibales.");
-            auto xIt = x.begin();
-            auto vIt = variableExpressions.begin();
-            for (; xIt != x.end(); ++xIt, ++vIt) {
-                auto const& vBaseExpr = vIt->getBaseExpression();
-                if (vBaseExpr.isVariable()) {
-                    *xIt = solver->getContinuousValue(vBaseExpr.asVariableExpression().getVariable());
-                } else {
-                    STORM_LOG_ASSERT(vBaseExpr.isRationalLiteralExpression(), "Variable expression has unexpected type.");
-                    *xIt = storm::utility::convertNumber<ValueType>(vBaseExpr.asRationalLiteralExpression().getValue());
-                }
-            }
-            
-            // If requested, we store the scheduler for retrieval.
-            if (this->isTrackSchedulerSet()) {
-                this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
-                for (uint64_t rowGroup = 0; rowGroup < this->A->getRowGroupCount(); ++rowGroup) {
-                    uint64_t row = this->A->getRowGroupIndices()[rowGroup];
-                    uint64_t optimalChoiceIndex = 0;
-                    uint64_t currChoice = 0;
-                    ValueType optimalGroupValue = this->A->multiplyRowWithVector(row, x) + b[row];
-                    for (++row, ++currChoice; row < this->A->getRowGroupIndices()[rowGroup + 1]; ++row, ++currChoice) {
-                        ValueType rowValue = this->A->multiplyRowWithVector(row, x) + b[row];
-                        if ((minimize(dir) && rowValue < optimalGroupValue) || (maximize(dir) && rowValue > optimalGroupValue)) {
-                            optimalGroupValue = rowValue;
-                            optimalChoiceIndex = currChoice;
-                        }
-                    }
-                    this->schedulerChoices.get()[rowGroup] = optimalChoiceIndex;
-                }
+            // Write the solution into the solution vector.
+            for (uint64_t variableIndex = 0; variableIndex < variables.size(); ++variableIndex) {
+                x[variableStates[variableIndex]] = solver->getContinuousValue(variables[variableIndex]);
+                statesWithVariable.set(variableStates[variableIndex], false);
             }
-
-            return true;
         }
        
         template<typename ValueType>
         void LpMinMaxLinearEquationSolver<ValueType>::clearCache() const {
+            sortedSccDecomposition.reset();
             StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
         }
         
@@ -2,6 +2,7 @@
 
 #include "storm/solver/LpSolver.h"
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include "storm/utility/solver.h"
 
 namespace storm {
@@ -24,7 +25,26 @@ namespace storm {
             virtual MinMaxLinearEquationSolverRequirements getRequirements(Environment const& env, boost::optional<storm::solver::OptimizationDirection> const& direction = boost::none, bool const& hasInitialScheduler = false) const override;
             
         private:
+            /*!
+             * Solves the equation system restricted to the states of the given SCC, assuming that the values of all
+             * states reached from the SCC are already stored in x. Only SCCs that are not trivial are passed to the
+             * LP solver.
+             *
+             * @param variableIndices Used to store the index of the LP variable of each state of the SCC.
+             * @param statesWithVariable Used to store the states of the SCC that have an LP variable. It is expected
+             * to be empty and is cleared again before returning.
+             */
+            void solveScc(OptimizationDirection dir, storm::storage::StronglyConnectedComponent const& scc, std::vector<ValueType>& x, std::vector<ValueType> const& b, std::vector<uint64_t>& variableIndices, storm::storage::BitVector& statesWithVariable) const;
+            
+            /*!
+             * Solves the equation system for a single state without a self-loop, which does not require an LP.
+             */
+            void solveTrivialScc(OptimizationDirection dir, uint64_t state, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            
             std::unique_ptr<storm::utility::solver::LpSolverFactory<ValueType>> lpSolverFactory;
+            
+            // The SCC decomposition of the underlying matrix in topological order (successors first).
+            mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
         };
         
     }
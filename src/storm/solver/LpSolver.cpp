@@ -3,6 +3,11 @@
 
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/expressions/Variable.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
 
 
 
@@ -58,6 +63,30 @@ namespace storm {
             return manager->rational(value);
         }
         
+        template<typename ValueType>
+        void LpSolver<ValueType>::addConstraints(std::vector<storm::expressions::Variable> const& variables, std::vector<uint64_t> const& rowStarts, std::vector<uint64_t> const& columns, std::vector<ValueType> const& coefficients, storm::expressions::OperatorType const& relation, std::vector<ValueType> const& rightHandSides) {
+            STORM_LOG_THROW(relation == storm::expressions::OperatorType::LessOrEqual || relation == storm::expressions::OperatorType::GreaterOrEqual || relation == storm::expressions::OperatorType::Equal, storm::exceptions::InvalidArgumentException, "Illegal relation for LP constraints.");
+            STORM_LOG_ASSERT(rowStarts.size() == rightHandSides.size() + 1, "Number of row starts does not match the number of constraints.");
+            
+            // By default, we translate each row to an expression.
+            for (uint64_t row = 0; row + 1 < rowStarts.size(); ++row) {
+                std::vector<storm::expressions::Expression> summands;
+                summands.reserve(rowStarts[row + 1] - rowStarts[row]);
+                for (uint64_t entry = rowStarts[row]; entry < rowStarts[row + 1]; ++entry) {
+                    summands.push_back(getConstant(coefficients[entry]) * variables[columns[entry]].getExpression());
+                }
+                storm::expressions::Expression lhs = summands.empty() ? getConstant(storm::utility::zero<ValueType>()) : storm::expressions::sum(summands);
+                storm::expressions::Expression rhs = getConstant(rightHandSides[row]);
+                if (relation == storm::expressions::OperatorType::LessOrEqual) {
+                    addConstraint("", lhs <= rhs);
+                } else if (relation == storm::expressions::OperatorType::GreaterOrEqual) {
+                    addConstraint("", lhs >= rhs);
+                } else {
+                    addConstraint("", lhs == rhs);
+                }
+            }
+        }
+        
         template class LpSolver<double>;
         template class LpSolver<storm::RationalNumber>;
         
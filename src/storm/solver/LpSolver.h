@@ -7,6 +7,7 @@
 #include <memory>
 #include <boost/optional.hpp>
 #include "OptimizationDirection.h"
+#include "storm/storage/expressions/OperatorType.h"
 
 namespace storm {
     namespace expressions {
@@ -180,6 +181,22 @@ namespace storm {
              */
             virtual void addConstraint(std::string const& name, storm::expressions::Expression const& constraint) = 0;
             
+            /*!
+             * Adds the constraints given by a sparse matrix in compressed row format to the LP problem. The i-th
+             * constraint is sum_k coefficients[k] * variables[columns[k]] ~ rightHandSides[i], where k ranges from
+             * rowStarts[i] to rowStarts[i + 1] - 1 and ~ is the given relation. The constraints have no names.
+             * Compared to adding each constraint as an expression, this avoids building and analyzing expressions
+             * and allows solvers to pass the arrays (almost) directly to the underlying library.
+             *
+             * @param variables The variables to which the column indices refer.
+             * @param rowStarts The index of the first entry of each constraint followed by the total number of entries.
+             * @param columns The column index of each entry. The column indices within a constraint must be distinct.
+             * @param coefficients The coefficient of each entry.
+             * @param relation The relation of all constraints. Must be one of LessOrEqual, GreaterOrEqual and Equal.
+             * @param rightHandSides The right-hand side of each constraint.
+             */
+            virtual void addConstraints(std::vector<storm::expressions::Variable> const& variables, std::vector<uint64_t> const& rowStarts, std::vector<uint64_t> const& columns, std::vector<ValueType> const& coefficients, storm::expressions::OperatorType const& relation, std::vector<ValueType> const& rightHandSides);
+            
             /*!
              * Optimizes the LP problem previously constructed. Afterwards, the methods isInfeasible, isUnbounded and
              * isOptimal can be used to query the optimality status.
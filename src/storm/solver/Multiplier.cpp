@@ -31,12 +31,12 @@ namespace storm {
         
         template<typename ValueType>
         void Multiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
-            multiplyAndReduce(env, dir, this->matrix.getRowGroupIndices(), x, b, result, choices);
+            multiplyAndReduce(env, dir, this->getRowGroupIndices(), x, b, result, choices);
         }
 
         template<typename ValueType>
         void Multiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
-            multiplyAndReduceGaussSeidel(env, dir, this->matrix.getRowGroupIndices(), x, b, choices, backwards);
+            multiplyAndReduceGaussSeidel(env, dir, this->getRowGroupIndices(), x, b, choices, backwards);
         }
     
         template<typename ValueType>
@@ -74,6 +74,11 @@ namespace storm {
             multiplyRow(rowIndex, x2, val2);
         }
         
+        template<typename ValueType>
+        std::vector<uint64_t> const& Multiplier<ValueType>::getRowGroupIndices() const {
+            return this->matrix.getRowGroupIndices();
+        }
+        
         template<typename ValueType>
         std::unique_ptr<Multiplier<ValueType>> MultiplierFactory<ValueType>::create(Environment const& env, storm::storage::SparseMatrix<ValueType> const& matrix) {
             auto type = env.solver().multiplier().getType();
@@ -135,6 +135,11 @@ namespace storm {
             virtual void multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2, ValueType& val2) const;
             
         protected:
+            /*!
+             * Retrieves the row groups that are reduced if no row groups are given explicitly.
+             */
+            virtual std::vector<uint64_t> const& getRowGroupIndices() const;
+            
             mutable std::unique_ptr<std::vector<ValueType>> cachedVector;
             storm::storage::SparseMatrix<ValueType> const& matrix;
         };
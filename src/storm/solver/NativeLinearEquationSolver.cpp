@@ -168,6 +168,266 @@ namespace storm {
             return status == SolverStatus::Converged;
         }
         
+        template<typename ValueType>
+        ValueType computeEuclideanNorm(std::vector<ValueType> const& vector) {
+            return storm::utility::sqrt(storm::utility::vector::dotProduct(vector, vector));
+        }
+        
+        template<typename ValueType>
+        void NativeLinearEquationSolver<ValueType>::applyPreconditioner(Environment const& env, std::vector<ValueType> const& in, std::vector<ValueType>& out) const {
+            if (env.solver().native().getPreconditioner() == NativeLinearEquationSolverPreconditioner::Diagonal) {
+                if (!inverseDiagonal) {
+                    // Rows without a (non-zero) diagonal entry are left unscaled.
+                    inverseDiagonal = std::make_unique<std::vector<ValueType>>(getMatrixRowCount(), storm::utility::one<ValueType>());
+                    for (uint64_t row = 0; row < getMatrixRowCount(); ++row) {
+                        for (auto const& entry : A->getRow(row)) {
+                            if (entry.getColumn() == row && !storm::utility::isZero(entry.getValue())) {
+                                (*inverseDiagonal)[row] = storm::utility::one<ValueType>() / entry.getValue();
+                            }
+                        }
+                    }
+                }
+                storm::utility::vector::multiplyVectorsPointwise(*inverseDiagonal, in, out);
+            } else {
+                out = in;
+            }
+        }
+        
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::solveEquationsBicgstab(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (BiCGSTAB)");
+            
+            if (!this->multiplier) {
+                this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
+            }
+            
+            ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+            uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
+            bool relative = env.solver().native().getRelativeTerminationCriterion();
+            
+            // The method has converged as soon as the norm of the residual drops below this threshold.
+            ValueType threshold = relative ? precision * computeEuclideanNorm(b) : precision;
+            
+            ValueType const zero = storm::utility::zero<ValueType>();
+            ValueType const one = storm::utility::one<ValueType>();
+            uint64_t numberOfRows = getMatrixRowCount();
+            
+            // Compute the initial residual r = b - A * x.
+            std::vector<ValueType> r(numberOfRows);
+            this->multiplier->multiply(env, x, nullptr, r);
+            storm::utility::vector::subtractVectors(b, r, r);
+            
+            std::vector<ValueType> shadowResidual = r;
+            std::vector<ValueType> p(numberOfRows, zero);
+            std::vector<ValueType> v(numberOfRows, zero);
+            std::vector<ValueType> preconditionedP(numberOfRows);
+            std::vector<ValueType> s(numberOfRows);
+            std::vector<ValueType> preconditionedS(numberOfRows);
+            std::vector<ValueType> t(numberOfRows);
+            ValueType rho = one;
+            ValueType alpha = one;
+            ValueType omega = one;
+            
+            uint64_t iterations = 0;
+            SolverStatus status = computeEuclideanNorm(r) <= threshold ? SolverStatus::Converged : SolverStatus::InProgress;
+            
+            this->startMeasureProgress();
+            while (status == SolverStatus::InProgress && iterations < maxIter) {
+                ValueType newRho = storm::utility::vector::dotProduct(shadowResidual, r);
+                if (storm::utility::isZero(newRho) || storm::utility::isZero(omega)) {
+                    // The method broke down, so we restart it with the current residual as the shadow residual.
+                    STORM_LOG_TRACE("Restarting BiCGSTAB after " << iterations << " iterations.");
+                    shadowResidual = r;
+                    std::fill(p.begin(), p.end(), zero);
+                    std::fill(v.begin(), v.end(), zero);
+                    rho = alpha = omega = one;
+                    newRho = storm::utility::vector::dotProduct(r, r);
+                }
+                
+                // Compute the new search direction p = r + beta * (p - omega * v).
+                ValueType beta = (newRho / rho) * (alpha / omega);
+                storm::utility::vector::addScaledVector(p, v, -omega);
+                storm::utility::vector::scaleVectorInPlace(p, beta);
+                storm::utility::vector::addVectors(p, r, p);
+                
+                applyPreconditioner(env, p, preconditionedP);
+                this->multiplier->multiply(env, preconditionedP, nullptr, v);
+                ValueType shadowResidualTimesV = storm::utility::vector::dotProduct(shadowResidual, v);
+                if (storm::utility::isZero(shadowResidualTimesV)) {
+                    STORM_LOG_WARN("BiCGSTAB stagnated after " << iterations << " iterations.");
+                    status = SolverStatus::Aborted;
+                    break;
+                }
+                alpha = newRho / shadowResidualTimesV;
+                
+                // Compute s = r - alpha * v and check whether the half-step already suffices.
+                s = r;
+                storm::utility::vector::addScaledVector(s, v, -alpha);
+                storm::utility::vector::addScaledVector(x, preconditionedP, alpha);
+                if (computeEuclideanNorm(s) <= threshold) {
+                    status = SolverStatus::Converged;
+                } else {
+                    applyPreconditioner(env, s, preconditionedS);
+                    this->multiplier->multiply(env, preconditionedS, nullptr, t);
+                    ValueType tTimesT = storm::utility::vector::dotProduct(t, t);
+                    omega = storm::utility::isZero(tTimesT) ? zero : storm::utility::vector::dotProduct(t, s) / tTimesT;
+                    storm::utility::vector::addScaledVector(x, preconditionedS, omega);
+                    
+                    // Compute the new residual r = s - omega * t.
+                    std::swap(r, s);
+                    storm::utility::vector::addScaledVector(r, t, -omega);
+                    if (computeEuclideanNorm(r) <= threshold) {
+                        status = SolverStatus::Converged;
+                    }
+                }
+                rho = newRho;
+                
+                // Potentially show progress.
+                this->showProgressIterative(iterations);
+                
+                // Increase iteration count so we can abort if convergence is too slow.
+                ++iterations;
+                
+                status = this->updateStatus(status, x, SolverGuarantee::None, iterations, maxIter);
+            }
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            this->reportStatus(status, iterations);
+            
+            return status == SolverStatus::Converged;
+        }
+        
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::solveEquationsGmres(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (GMRES)");
+            
+            if (!this->multiplier) {
+                this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
+            }
+            
+            ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+            uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
+            bool relative = env.solver().native().getRelativeTerminationCriterion();
+            uint64_t restart = env.solver().native().getRestartThreshold();
+            STORM_LOG_THROW(restart > 0, storm::exceptions::InvalidEnvironmentException, "The restart threshold of GMRES must be positive.");
+            
+            // The method has converged as soon as the norm of the residual drops below this threshold.
+            ValueType threshold = relative ? precision * computeEuclideanNorm(b) : precision;
+            
+            ValueType const zero = storm::utility::zero<ValueType>();
+            ValueType const one = storm::utility::one<ValueType>();
+            uint64_t numberOfRows = getMatrixRowCount();
+            
+            // The orthonormal basis of the Krylov subspace and the Hessenberg matrix (stored column-wise) that is
+            // brought to upper triangular form by Givens rotations as the basis grows.
+            std::vector<std::vector<ValueType>> basis(restart + 1, std::vector<ValueType>(numberOfRows));
+            std::vector<std::vector<ValueType>> hessenberg(restart, std::vector<ValueType>(restart + 1));
+            std::vector<ValueType> cosines(restart);
+            std::vector<ValueType> sines(restart);
+            std::vector<ValueType> g(restart + 1);
+            std::vector<ValueType> y(restart);
+            std::vector<ValueType> w(numberOfRows);
+            std::vector<ValueType> preconditioned(numberOfRows);
+            
+            uint64_t iterations = 0;
+            SolverStatus status = SolverStatus::InProgress;
+            bool stagnated = false;
+            
+            this->startMeasureProgress();
+            while (status == SolverStatus::InProgress && iterations < maxIter && !stagnated) {
+                // Compute the residual r = b - A * x, which (normalized) is the first basis vector.
+                this->multiplier->multiply(env, x, nullptr, basis[0]);
+                storm::utility::vector::subtractVectors(b, basis[0], basis[0]);
+                ValueType residualNorm = computeEuclideanNorm(basis[0]);
+                if (residualNorm <= threshold) {
+                    status = SolverStatus::Converged;
+                    break;
+                }
+                storm::utility::vector::scaleVectorInPlace(basis[0], one / residualNorm);
+                std::fill(g.begin(), g.end(), zero);
+                g[0] = residualNorm;
+                
+                uint64_t k = 0;
+                while (k < restart && iterations < maxIter) {
+                    // Extend the basis by A * M^-1 * v_k, orthogonalized with modified Gram-Schmidt.
+                    applyPreconditioner(env, basis[k], preconditioned);
+                    this->multiplier->multiply(env, preconditioned, nullptr, w);
+                    std::vector<ValueType>& h = hessenberg[k];
+                    for (uint64_t i = 0; i <= k; ++i) {
+                        h[i] = storm::utility::vector::dotProduct(w, basis[i]);
+                        storm::utility::vector::addScaledVector(w, basis[i], -h[i]);
+                    }
+                    h[k + 1] = computeEuclideanNorm(w);
+                    ValueType subdiagonal = h[k + 1];
+                    
+                    // Apply the previous rotations to the new column and eliminate its subdiagonal entry.
+                    for (uint64_t i = 0; i < k; ++i) {
+                        ValueType tmp = cosines[i] * h[i] + sines[i] * h[i + 1];
+                        h[i + 1] = -sines[i] * h[i] + cosines[i] * h[i + 1];
+                        h[i] = tmp;
+                    }
+                    ValueType denominator = storm::utility::sqrt(h[k] * h[k] + h[k + 1] * h[k + 1]);
+                    if (storm::utility::isZero(denominator)) {
+                        STORM_LOG_WARN("GMRES stagnated after " << iterations << " iterations.");
+                        stagnated = true;
+                        break;
+                    }
+                    cosines[k] = h[k] / denominator;
+                    sines[k] = h[k + 1] / denominator;
+                    h[k] = denominator;
+                    h[k + 1] = zero;
+                    g[k + 1] = -sines[k] * g[k];
+                    g[k] = cosines[k] * g[k];
+                    
+                    // Potentially show progress.
+                    this->showProgressIterative(iterations);
+                    ++iterations;
+                    ++k;
+                    
+                    // The absolute value of g[k] is the norm of the residual of the current approximation.
+                    if (storm::utility::abs(g[k]) <= threshold || storm::utility::isZero(subdiagonal)) {
+                        break;
+                    }
+                    storm::utility::vector::scaleVectorInPlace(w, one / subdiagonal);
+                    std::swap(basis[k], w);
+                }
+                
+                // Solve the triangular system R * y = g by back substitution and update x by M^-1 * V * y.
+                for (uint64_t i = k; i > 0; --i) {
+                    uint64_t row = i - 1;
+                    y[row] = g[row];
+                    for (uint64_t column = i; column < k; ++column) {
+                        y[row] -= hessenberg[column][row] * y[column];
+                    }
+                    y[row] /= hessenberg[row][row];
+                }
+                std::fill(w.begin(), w.end(), zero);
+                for (uint64_t i = 0; i < k; ++i) {
+                    storm::utility::vector::addScaledVector(w, basis[i], y[i]);
+                }
+                applyPreconditioner(env, w, preconditioned);
+                storm::utility::vector::addVectors(x, preconditioned, x);
+                
+                if (k > 0 && storm::utility::abs(g[k]) <= threshold) {
+                    status = SolverStatus::Converged;
+                } else if (stagnated) {
+                    status = SolverStatus::Aborted;
+                }
+                status = this->updateStatus(status, x, SolverGuarantee::None, iterations, maxIter);
+            }
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            this->reportStatus(status, iterations);
+            
+            return status == SolverStatus::Converged;
+        }
+        
         template<typename ValueType>
         NativeLinearEquationSolver<ValueType>::WalkerChaeData::WalkerChaeData(Environment const& env, storm::storage::SparseMatrix<ValueType> const& originalMatrix, std::vector<ValueType> const& originalB) : t(storm::utility::convertNumber<ValueType>(1000.0)) {
             computeWalkerChaeMatrix(originalMatrix);
@@ -994,6 +1254,10 @@ namespace storm {
                     return this->solveEquationsIntervalIteration(env, x, b);
                 case NativeLinearEquationSolverMethod::RationalSearch:
                     return this->solveEquationsRationalSearch(env, x, b);
+                case NativeLinearEquationSolverMethod::Bicgstab:
+                    return this->solveEquationsBicgstab(env, x, b);
+                case NativeLinearEquationSolverMethod::Gmres:
+                    return this->solveEquationsGmres(env, x, b);
             }
             STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "Unknown solving technique.");
             return false;
@@ -1026,6 +1290,7 @@ namespace storm {
         template<typename ValueType>
         void NativeLinearEquationSolver<ValueType>::clearCache() const {
             jacobiDecomposition.reset();
+            inverseDiagonal.reset();
             cachedRowVector2.reset();
             walkerChaeData.reset();
             multiplier.reset();
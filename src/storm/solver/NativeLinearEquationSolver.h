@@ -70,6 +70,14 @@ namespace storm {
             virtual bool solveEquationsOptimisticValueIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             virtual bool solveEquationsIntervalIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             virtual bool solveEquationsRationalSearch(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            virtual bool solveEquationsBicgstab(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            virtual bool solveEquationsGmres(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            
+            /*!
+             * Applies the preconditioner selected in the environment to the given vector, i.e. approximates the
+             * solution of A * out = in. This is used by the Krylov methods (BiCGSTAB and GMRES).
+             */
+            void applyPreconditioner(storm::Environment const& env, std::vector<ValueType> const& in, std::vector<ValueType>& out) const;
 
             template<typename RationalType, typename ImpreciseType>
             bool solveEquationsRationalSearchHelper(storm::Environment const& env, NativeLinearEquationSolver<ImpreciseType> const& impreciseSolver, storm::storage::SparseMatrix<RationalType> const& rationalA, std::vector<RationalType>& rationalX, std::vector<RationalType> const& rationalB, storm::storage::SparseMatrix<ImpreciseType> const& A, std::vector<ImpreciseType>& x, std::vector<ImpreciseType> const& b, std::vector<ImpreciseType>& tmpX) const;
@@ -108,6 +116,9 @@ namespace storm {
             };
             mutable std::unique_ptr<JacobiDecomposition> jacobiDecomposition;
             
+            // The inverted diagonal entries of A used for (diagonal) preconditioning of the Krylov methods.
+            mutable std::unique_ptr<std::vector<ValueType>> inverseDiagonal;
+            
             struct WalkerChaeData {
                 WalkerChaeData(Environment const& env, storm::storage::SparseMatrix<ValueType> const& originalMatrix, std::vector<ValueType> const& originalB);
                 
@@ -0,0 +1,178 @@
+#include "storm/solver/QuotientMultiplier.h"
+
+#include "storm-config.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/bisimulation/QuotientView.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/IntelTbbAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace solver {
+
+        template<typename ValueType>
+        QuotientMultiplier<ValueType>::QuotientMultiplier(storm::storage::bisimulation::QuotientView<ValueType> const& quotient) : Multiplier<ValueType>(quotient.getTransitionMatrix()), quotient(quotient) {
+            // Intentionally left empty.
+        }
+
+        template<typename ValueType>
+        bool QuotientMultiplier<ValueType>::parallelize(Environment const& env) const {
+#ifdef STORM_HAVE_INTELTBB
+            return storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#else
+            return false;
+#endif
+        }
+
+        template<typename ValueType>
+        void QuotientMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            std::vector<ValueType>* target = &result;
+            if (&x == &result) {
+                if (this->cachedVector) {
+                    this->cachedVector->resize(quotient.getNumberOfRows());
+                } else {
+                    this->cachedVector = std::make_unique<std::vector<ValueType>>(quotient.getNumberOfRows());
+                }
+                target = this->cachedVector.get();
+            }
+
+            std::vector<uint64_t> const& rowGroupIndices = quotient.getRowGroupIndices();
+            auto multiplyBlocks = [&] (uint64_t firstBlock, uint64_t lastBlock) {
+                for (uint64_t block = firstBlock; block < lastBlock; ++block) {
+                    for (uint64_t row = rowGroupIndices[block]; row < rowGroupIndices[block + 1]; ++row) {
+                        (*target)[row] = computeRowValue(block, row - rowGroupIndices[block], x, b);
+                    }
+                }
+            };
+#ifdef STORM_HAVE_INTELTBB
+            if (parallelize(env)) {
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, quotient.getNumberOfBlocks()), [&] (tbb::blocked_range<uint64_t> const& range) { multiplyBlocks(range.begin(), range.end()); });
+            } else {
+                multiplyBlocks(0, quotient.getNumberOfBlocks());
+            }
+#else
+            multiplyBlocks(0, quotient.getNumberOfBlocks());
+#endif
+
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+        }
+
+        template<typename ValueType>
+        void QuotientMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards) const {
+            STORM_LOG_ASSERT(quotient.getNumberOfRows() == quotient.getNumberOfBlocks(), "Gauss-Seidel multiplication requires a square matrix.");
+            uint64_t numberOfBlocks = quotient.getNumberOfBlocks();
+            for (uint64_t index = 0; index < numberOfBlocks; ++index) {
+                uint64_t block = backwards ? numberOfBlocks - index - 1 : index;
+                x[block] = computeRowValue(block, 0, x, b);
+            }
+        }
+
+        template<typename ValueType>
+        void QuotientMultiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            STORM_LOG_ASSERT(rowGroupIndices == quotient.getRowGroupIndices(), "The row groups need to coincide with the blocks of the quotient.");
+            std::vector<ValueType>* target = &result;
+            if (&x == &result) {
+                if (this->cachedVector) {
+                    this->cachedVector->resize(x.size());
+                } else {
+                    this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+                }
+                target = this->cachedVector.get();
+            }
+
+            auto reduceBlocks = [&] (uint64_t firstBlock, uint64_t lastBlock) {
+                for (uint64_t block = firstBlock; block < lastBlock; ++block) {
+                    (*target)[block] = reduceBlock(dir, block, x, b, choices);
+                }
+            };
+#ifdef STORM_HAVE_INTELTBB
+            if (parallelize(env)) {
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, quotient.getNumberOfBlocks()), [&] (tbb::blocked_range<uint64_t> const& range) { reduceBlocks(range.begin(), range.end()); });
+            } else {
+                reduceBlocks(0, quotient.getNumberOfBlocks());
+            }
+#else
+            reduceBlocks(0, quotient.getNumberOfBlocks());
+#endif
+
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+        }
+
+        template<typename ValueType>
+        void QuotientMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
+            STORM_LOG_ASSERT(rowGroupIndices == quotient.getRowGroupIndices(), "The row groups need to coincide with the blocks of the quotient.");
+            uint64_t numberOfBlocks = quotient.getNumberOfBlocks();
+            for (uint64_t index = 0; index < numberOfBlocks; ++index) {
+                uint64_t block = backwards ? numberOfBlocks - index - 1 : index;
+                x[block] = reduceBlock(dir, block, x, b, choices);
+            }
+        }
+
+        template<typename ValueType>
+        void QuotientMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
+            quotient.multiplyRow(rowIndex, x, value);
+        }
+
+        template<typename ValueType>
+        std::vector<uint64_t> const& QuotientMultiplier<ValueType>::getRowGroupIndices() const {
+            return quotient.getRowGroupIndices();
+        }
+
+        template<typename ValueType>
+        ValueType QuotientMultiplier<ValueType>::computeRowValue(uint64_t block, uint64_t localRow, std::vector<ValueType> const& x, std::vector<ValueType> const* b) const {
+            ValueType result = b ? (*b)[quotient.getRowGroupIndices()[block] + localRow] : storm::utility::zero<ValueType>();
+            uint64_t originalRow = this->matrix.getRowGroupIndices()[quotient.getRepresentative(block)] + localRow;
+            for (auto const& entry : this->matrix.getRow(originalRow)) {
+                result += entry.getValue() * x[quotient.getBlockIndex(entry.getColumn())];
+            }
+            return result;
+        }
+
+        template<typename ValueType>
+        ValueType QuotientMultiplier<ValueType>::reduceBlock(OptimizationDirection const& dir, uint64_t block, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices) const {
+            std::vector<uint64_t> const& rowGroupIndices = quotient.getRowGroupIndices();
+            uint64_t numberOfRows = rowGroupIndices[block + 1] - rowGroupIndices[block];
+            if (numberOfRows == 0) {
+                return storm::utility::zero<ValueType>();
+            }
+
+            ValueType currentValue = computeRowValue(block, 0, x, b);
+            ValueType oldSelectedChoiceValue = currentValue;
+            uint64_t selectedChoice = 0;
+            for (uint64_t localRow = 1; localRow < numberOfRows; ++localRow) {
+                ValueType newValue = computeRowValue(block, localRow, x, b);
+                if (choices && localRow == (*choices)[block]) {
+                    oldSelectedChoiceValue = newValue;
+                }
+                if (minimize(dir) ? newValue < currentValue : newValue > currentValue) {
+                    currentValue = newValue;
+                    selectedChoice = localRow;
+                }
+            }
+
+            // Only update the choice if the new choice is strictly better than the previous one.
+            if (choices && (minimize(dir) ? currentValue < oldSelectedChoiceValue : currentValue > oldSelectedChoiceValue)) {
+                (*choices)[block] = selectedChoice;
+            }
+            return currentValue;
+        }
+
+        template class QuotientMultiplier<double>;
+#ifdef STORM_HAVE_CARL
+        template class QuotientMultiplier<storm::RationalNumber>;
+#endif
+
+    }
+}
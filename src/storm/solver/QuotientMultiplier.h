@@ -0,0 +1,59 @@
+#pragma once
+
+#include "storm/solver/Multiplier.h"
+
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+    namespace storage {
+        namespace bisimulation {
+            template<typename ValueType>
+            class QuotientView;
+        }
+    }
+
+    namespace solver {
+
+        /*!
+         * A multiplier that operates on the quotient of a model under a strong bisimulation without building it. The
+         * entries of the aggregated matrix are computed on the fly from the rows of the block representatives, so all
+         * vectors are over the blocks (or the rows of the quotient, respectively).
+         */
+        template<typename ValueType>
+        class QuotientMultiplier : public Multiplier<ValueType> {
+        public:
+            /*!
+             * Creates a multiplier for the given view, which needs to outlive the multiplier.
+             */
+            QuotientMultiplier(storm::storage::bisimulation::QuotientView<ValueType> const& quotient);
+            virtual ~QuotientMultiplier() = default;
+
+            virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
+            virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards = true) const override;
+            virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices = nullptr) const override;
+            virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr, bool backwards = true) const override;
+            virtual void multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const override;
+
+        protected:
+            virtual std::vector<uint64_t> const& getRowGroupIndices() const override;
+
+        private:
+            bool parallelize(Environment const& env) const;
+
+            /*!
+             * Computes the value of the given row of the given block, where the row is given relative to the first
+             * row of the block.
+             */
+            ValueType computeRowValue(uint64_t block, uint64_t localRow, std::vector<ValueType> const& x, std::vector<ValueType> const* b) const;
+
+            /*!
+             * Computes the optimal value over the rows of the given block. The choice of the block is only changed if
+             * the new choice is strictly better than the previous one.
+             */
+            ValueType reduceBlock(OptimizationDirection const& dir, uint64_t block, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices) const;
+
+            storm::storage::bisimulation::QuotientView<ValueType> const& quotient;
+        };
+
+    }
+}
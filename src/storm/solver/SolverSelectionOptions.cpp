@@ -134,6 +134,20 @@ namespace storm {
                     return "IntervalIteration";
                 case NativeLinearEquationSolverMethod::RationalSearch:
                     return "RationalSearch";
+                case NativeLinearEquationSolverMethod::Bicgstab:
+                    return "BiCGSTAB";
+                case NativeLinearEquationSolverMethod::Gmres:
+                    return "GMRES";
+            }
+            return "invalid";
+        }
+        
+        std::string toString(NativeLinearEquationSolverPreconditioner t) {
+            switch (t) {
+                case NativeLinearEquationSolverPreconditioner::Diagonal:
+                    return "diagonal";
+                case NativeLinearEquationSolverPreconditioner::None:
+                    return "none";
             }
             return "invalid";
         }
@@ -10,7 +10,7 @@ namespace storm {
         namespace stateelimination {
             
             template<typename ValueType>
-            DynamicStatePriorityQueue<ValueType>::DynamicStatePriorityQueue(std::vector<std::pair<storm::storage::sparse::state_type, uint_fast64_t>> const& sortedStatePenaltyPairs, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities, PenaltyFunctionType const& penaltyFunction) : StatePriorityQueue(), transitionMatrix(transitionMatrix), backwardTransitions(backwardTransitions), oneStepProbabilities(oneStepProbabilities), priorityQueue(), stateToPriorityQueueEntry(), penaltyFunction(penaltyFunction) {
+            DynamicStatePriorityQueue<ValueType>::DynamicStatePriorityQueue(std::vector<std::pair<storm::storage::sparse::state_type, uint_fast64_t>> const& sortedStatePenaltyPairs, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities, PenaltyFunctionType const& penaltyFunction, bool updateSuccessors) : StatePriorityQueue(), transitionMatrix(transitionMatrix), backwardTransitions(backwardTransitions), oneStepProbabilities(oneStepProbabilities), priorityQueue(), stateToPriorityQueueEntry(), penaltyFunction(penaltyFunction), updateSuccessors(updateSuccessors) {
                 // Insert all state-penalty pairs into our priority queue.
                 for (auto const& statePenalty : sortedStatePenaltyPairs) {
                     auto it = priorityQueue.insert(priorityQueue.end(), statePenalty);
@@ -56,6 +56,13 @@ namespace storm {
                 }
             }
             
+            template<typename ValueType>
+            void DynamicStatePriorityQueue<ValueType>::updateSuccessor(storm::storage::sparse::state_type state) {
+                if (updateSuccessors) {
+                    update(state);
+                }
+            }
+            
             template<typename ValueType>
             std::size_t DynamicStatePriorityQueue<ValueType>::size() const {
                 return priorityQueue.size();
@@ -27,11 +27,17 @@ namespace storm {
             public:
                 typedef std::function<uint_fast64_t (storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities)> PenaltyFunctionType;
                 
-                DynamicStatePriorityQueue(std::vector<std::pair<storm::storage::sparse::state_type, uint_fast64_t>> const& sortedStatePenaltyPairs, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities, PenaltyFunctionType const& penaltyFunction);
+                /*!
+                 * Creates a queue over the given states. If updateSuccessors is set, the penalty of a state is also
+                 * recomputed when its predecessors change, which is needed for penalties that depend on the number of
+                 * predecessors.
+                 */
+                DynamicStatePriorityQueue(std::vector<std::pair<storm::storage::sparse::state_type, uint_fast64_t>> const& sortedStatePenaltyPairs, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities, PenaltyFunctionType const& penaltyFunction, bool updateSuccessors = false);
                 
                 virtual bool hasNext() const override;
                 virtual storm::storage::sparse::state_type pop() override;
                 virtual void update(storm::storage::sparse::state_type state) override;
+                virtual void updateSuccessor(storm::storage::sparse::state_type state) override;
                 virtual std::size_t size() const override;
                 
             private:
@@ -44,6 +50,7 @@ namespace storm {
                 PriorityQueue priorityQueue;
                 StatePriorityQueueEntryMap stateToPriorityQueueEntry;
                 PenaltyFunctionType penaltyFunction;
+                bool updateSuccessors;
             };
             
         }
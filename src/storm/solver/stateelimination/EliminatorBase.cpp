@@ -1,5 +1,9 @@
 #include "storm/solver/stateelimination/EliminatorBase.h"
 
+#include <algorithm>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
 #include "storm/utility/stateelimination.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/constants.h"
@@ -11,6 +15,19 @@ namespace storm {
         namespace stateelimination {
             
             using namespace storm::utility::stateelimination;
+            
+            namespace {
+                template<typename ValueType>
+                ValueType simplifyWithCache(SimplificationCache<ValueType>*, ValueType const& value) {
+                    return storm::utility::simplify(value);
+                }
+                
+#ifdef STORM_HAVE_CARL
+                storm::RationalFunction simplifyWithCache(SimplificationCache<storm::RationalFunction>* cache, storm::RationalFunction const& value) {
+                    return cache ? cache->simplify(value) : storm::utility::simplify(value);
+                }
+#endif
+            }
 
             template<typename ValueType, ScalingMode Mode>
             EliminatorBase<ValueType, Mode>::EliminatorBase(storm::storage::FlexibleSparseMatrix<ValueType>& matrix, storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix) : matrix(matrix), transposedMatrix(transposedMatrix) {
@@ -50,7 +67,7 @@ namespace storm {
                     if (hasEntryInColumn) {
                         STORM_LOG_ASSERT(columnValue != storm::utility::one<ValueType>(), "The scaling mode 'divide-one-minus' requires a non-one value in the given column.");
                         columnValue = storm::utility::one<ValueType>() / (storm::utility::one<ValueType>() - columnValue);
-                        columnValue = storm::utility::simplify(columnValue);
+                        columnValue = simplifyValue(columnValue);
                     }
                 }
                 
@@ -58,7 +75,7 @@ namespace storm {
                     for (auto entryIt = entriesInRow.begin(), entryIte = entriesInRow.end(); entryIt != entryIte; ++entryIt) {
                         // Only scale the entries in a different column.
                         if (entryIt->getColumn() != column) {
-                            entryIt->setValue(storm::utility::simplify((ValueType) (entryIt->getValue() * columnValue)));
+                            entryIt->setValue(simplifyValue((ValueType) (entryIt->getValue() * columnValue)));
                         }
                     }
                     updateValue(row, columnValue);
@@ -69,13 +86,16 @@ namespace storm {
                 
                 // In case we have a constrained elimination, we need to keep track of the rows that keep their value
                 // in the column equal to the current row.
-                FlexibleRowType rowsKeepingEntryInColumnEqualRow;
+                FlexibleRowType rowsKeepingEntryInColumnEqualRow(transposedMatrix.getRowAllocator());
                 
                 // For each entry in the row d, we need to build a list of other rows that will contain an element in the
                 // column d.
-                std::vector<FlexibleRowType> newBackwardEntries(entriesInRow.size());
-                for (auto& backwardEntry : newBackwardEntries) {
-                    backwardEntry.reserve(elementsWithEntryInColumnEqualRow.size());
+                uint_fast64_t numberOfSuccessors = std::count_if(entriesInRow.begin(), entriesInRow.end(), [&] (FlexibleEntryType const& a) { return a.getColumn() != column; });
+                std::vector<FlexibleRowType> newBackwardEntries;
+                newBackwardEntries.reserve(numberOfSuccessors);
+                for (uint_fast64_t successor = 0; successor < numberOfSuccessors; ++successor) {
+                    newBackwardEntries.emplace_back(transposedMatrix.getRowAllocator());
+                    newBackwardEntries.back().reserve(elementsWithEntryInColumnEqualRow.size());
                 }
                 
                 // Now go through the rows with an entry in the column corresponding to the current row and substitute
@@ -101,72 +121,67 @@ namespace storm {
                     // First, find the probability with which the predecessor can move to the current state, because
                     // the forward probabilities of the state to be eliminated need to be scaled with this factor.
                     FlexibleRowType& predecessorForwardTransitions = matrix.getRow(predecessor);
-                    FlexibleRowIterator multiplyElement = std::find_if(predecessorForwardTransitions.begin(), predecessorForwardTransitions.end(), [&](storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a) { return a.getColumn() == column; });
+                    FlexibleRowIterator multiplyElement = std::find_if(predecessorForwardTransitions.begin(), predecessorForwardTransitions.end(), [&](FlexibleEntryType const& a) { return a.getColumn() == column; });
                     
-                    // Make sure we have found the probability and set it to zero.
+                    // Make sure we have found the probability and remove the transition, so that the remaining entries
+                    // can be merged with the (scaled) successors of the current state.
                     STORM_LOG_THROW(multiplyElement != predecessorForwardTransitions.end(), storm::exceptions::InvalidStateException, "No probability for successor found.");
                     ValueType multiplyFactor = multiplyElement->getValue();
-                    multiplyElement->setValue(storm::utility::zero<ValueType>());
+                    predecessorForwardTransitions.erase(multiplyElement);
                     
-                    // At this point, we need to update the (forward) transitions of the predecessor.
+                    // Determine the size of the merged row, i.e. count the successors the predecessor does not have yet.
+                    uint_fast64_t mergedSize = predecessorForwardTransitions.size();
                     FlexibleRowIterator first1 = predecessorForwardTransitions.begin();
                     FlexibleRowIterator last1 = predecessorForwardTransitions.end();
-                    FlexibleRowIterator first2 = entriesInRow.begin();
-                    FlexibleRowIterator last2 = entriesInRow.end();
-                    
-                    FlexibleRowType newSuccessors;
-                    newSuccessors.reserve((last1 - first1) + (last2 - first2));
-                    std::insert_iterator<FlexibleRowType> result(newSuccessors, newSuccessors.end());
+                    for (auto const& successorEntry : entriesInRow) {
+                        if (successorEntry.getColumn() == column) {
+                            continue;
+                        }
+                        while (first1 != last1 && first1->getColumn() < successorEntry.getColumn()) {
+                            ++first1;
+                        }
+                        if (first1 == last1 || first1->getColumn() != successorEntry.getColumn()) {
+                            ++mergedSize;
+                        }
+                    }
                     
-                    uint_fast64_t successorOffsetInNewBackwardTransitions = 0;
-                    // Now we merge the two successor lists. (Code taken from std::set_union and modified to suit our needs).
-                    for (; first1 != last1; ++result) {
+                    // Now we merge the two successor lists in place. By going from the largest column to the smallest
+                    // one, no entry of the predecessor is overwritten before it was moved to its final position.
+                    uint_fast64_t readPosition = predecessorForwardTransitions.size();
+                    uint_fast64_t writePosition = mergedSize;
+                    predecessorForwardTransitions.resize(mergedSize);
+                    uint_fast64_t successorOffsetInNewBackwardTransitions = numberOfSuccessors;
+                    for (auto successorIt = entriesInRow.rbegin(), successorIte = entriesInRow.rend(); successorIt != successorIte; ++successorIt) {
                         // Skip the transitions to the state that is currently being eliminated.
-                        if (first1->getColumn() == column || (first2 != last2 && first2->getColumn() == column)) {
-                            if (first1->getColumn() == column) {
-                                ++first1;
-                            }
-                            if (first2 != last2 && first2->getColumn() == column) {
-                                ++first2;
-                            }
+                        if (successorIt->getColumn() == column) {
                             continue;
                         }
                         
-                        if (first2 == last2) {
-                            std::copy_if(first1, last1, result, [&] (storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a) { return a.getColumn() != column; } );
-                            break;
+                        while (readPosition > 0 && predecessorForwardTransitions[readPosition - 1].getColumn() > successorIt->getColumn()) {
+                            --readPosition;
+                            --writePosition;
+                            if (readPosition != writePosition) {
+                                predecessorForwardTransitions[writePosition] = std::move(predecessorForwardTransitions[readPosition]);
+                            }
                         }
-                        if (first2->getColumn() < first1->getColumn()) {
-                            auto successorEntry = storm::utility::simplify(std::move(*first2 * multiplyFactor));
-                            *result = successorEntry;
-                            newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, successorEntry.getValue());
-                            ++first2;
-                            ++successorOffsetInNewBackwardTransitions;
-                        } else if (first1->getColumn() < first2->getColumn()) {
-                            *result = *first1;
-                            ++first1;
+                        
+                        --writePosition;
+                        --successorOffsetInNewBackwardTransitions;
+                        if (readPosition > 0 && predecessorForwardTransitions[readPosition - 1].getColumn() == successorIt->getColumn()) {
+                            --readPosition;
+                            ValueType sprod = multiplyFactor * successorIt->getValue();
+                            ValueType sum = predecessorForwardTransitions[readPosition].getValue() + simplifyValue(sprod);
+                            ValueType probability = simplifyValue(sum);
+                            predecessorForwardTransitions[writePosition] = FlexibleEntryType(successorIt->getColumn(), probability);
+                            newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, probability);
                         } else {
-                            ValueType sprod = multiplyFactor * first2->getValue();
-                            ValueType sum = first1->getValue() + storm::utility::simplify(sprod);
-                            auto probability = storm::utility::simplify(sum);
-                            *result = storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type>(first1->getColumn(), probability);
+                            ValueType probability = simplifyValue((ValueType) (successorIt->getValue() * multiplyFactor));
                             newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, probability);
-                            ++first1;
-                            ++first2;
-                            ++successorOffsetInNewBackwardTransitions;
+                            predecessorForwardTransitions[writePosition] = FlexibleEntryType(successorIt->getColumn(), std::move(probability));
                         }
                     }
-                    for (; first2 != last2; ++first2) {
-                        if (first2->getColumn() != column) {
-                            auto stateProbability = storm::utility::simplify(std::move(*first2 * multiplyFactor));
-                            *result = stateProbability;
-                            newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, stateProbability.getValue());
-                            ++successorOffsetInNewBackwardTransitions;
-                        }
-                    }
-                    
-                    // Now move the new transitions in place.
-                    predecessorForwardTransitions = std::move(newSuccessors);
+                    // The remaining entries of the predecessor already are at their final position.
+                    STORM_LOG_ASSERT(readPosition == writePosition, "Unexpected positions after merging the successor lists.");
                     STORM_LOG_TRACE("Fixed new next-state probabilities of predecessor state " << predecessor << ".");
                     
                     updatePredecessor(predecessor, multiplyFactor, row);
@@ -187,7 +202,7 @@ namespace storm {
                     // Delete the current state as a predecessor of the successor state only if we are going to remove the
                     // current state's forward transitions.
                     if (clearRow) {
-                        FlexibleRowIterator elimIt = std::find_if(successorBackwardTransitions.begin(), successorBackwardTransitions.end(), [&](storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a) { return a.getColumn() == row; });
+                        FlexibleRowIterator elimIt = std::find_if(successorBackwardTransitions.begin(), successorBackwardTransitions.end(), [&](FlexibleEntryType const& a) { return a.getColumn() == row; });
                         STORM_LOG_ASSERT(elimIt != successorBackwardTransitions.end(), "Expected a proper backward transition from " << successorEntry.getColumn() << " to " << column << ", but found none.");
                         successorBackwardTransitions.erase(elimIt);
                     }
@@ -197,7 +212,7 @@ namespace storm {
                     FlexibleRowIterator first2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].begin();
                     FlexibleRowIterator last2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].end();
                     
-                    FlexibleRowType newPredecessors;
+                    FlexibleRowType newPredecessors(transposedMatrix.getRowAllocator());
                     newPredecessors.reserve((last1 - first1) + (last2 - first2));
                     std::insert_iterator<FlexibleRowType> result(newPredecessors, newPredecessors.end());
                     
@@ -225,12 +240,13 @@ namespace storm {
                         }
                     }
                     if (isFilterPredecessor()) {
-                        std::copy_if(first2, last2, result, [&] (storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a) { return a.getColumn() != row && filterPredecessor(a.getColumn()); });
+                        std::copy_if(first2, last2, result, [&] (FlexibleEntryType const& a) { return a.getColumn() != row && filterPredecessor(a.getColumn()); });
                     } else {
-                        std::copy_if(first2, last2, result, [&] (storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a) { return a.getColumn() != row; });
+                        std::copy_if(first2, last2, result, [&] (FlexibleEntryType const& a) { return a.getColumn() != row; });
                     }
                     // Now move the new predecessors in place.
                     successorBackwardTransitions = std::move(newPredecessors);
+                    updateSuccessorPriority(successorEntry.getColumn());
                     ++successorOffsetInNewBackwardTransitions;
                 }
                 STORM_LOG_TRACE("Fixed predecessor lists of successor states.");
@@ -274,7 +290,7 @@ namespace storm {
                     if (hasEntryInColumn) {
                         STORM_LOG_ASSERT(columnValue != storm::utility::one<ValueType>(), "The scaling mode 'divide-one-minus' requires a non-one value in the given column.");
                         columnValue = storm::utility::one<ValueType>() / (storm::utility::one<ValueType>() - columnValue);
-                        columnValue = storm::utility::simplify(columnValue);
+                        columnValue = simplifyValue(columnValue);
                     }
                 }
 
@@ -282,7 +298,7 @@ namespace storm {
                     for (auto entryIt = entriesInRow.begin(), entryIte = entriesInRow.end(); entryIt != entryIte; ++entryIt) {
                         // Scale the entries in a different column, set state transition probability to 0.
                         if (entryIt->getColumn() != state) {
-                            entryIt->setValue(storm::utility::simplify((ValueType) (entryIt->getValue() * columnValue)));
+                            entryIt->setValue(simplifyValue((ValueType) (entryIt->getValue() * columnValue)));
                         } else {
                             entryIt->setValue(storm::utility::zero<ValueType>());
                         }
@@ -290,6 +306,16 @@ namespace storm {
                 }
             }
 
+            template<typename ValueType, ScalingMode Mode>
+            void EliminatorBase<ValueType, Mode>::setSimplificationCache(std::shared_ptr<SimplificationCache<ValueType>> const& cache) {
+                simplificationCache = cache;
+            }
+            
+            template<typename ValueType, ScalingMode Mode>
+            ValueType EliminatorBase<ValueType, Mode>::simplifyValue(ValueType const& value) const {
+                return simplifyWithCache(simplificationCache.get(), value);
+            }
+            
             template<typename ValueType, ScalingMode Mode>
             void EliminatorBase<ValueType, Mode>::updateValue(storm::storage::sparse::state_type const&, ValueType const&) {
                 // Intentionally left empty.
@@ -305,6 +331,11 @@ namespace storm {
                 // Intentionally left empty.
             }
             
+            template<typename ValueType, ScalingMode Mode>
+            void EliminatorBase<ValueType, Mode>::updateSuccessorPriority(storm::storage::sparse::state_type const&) {
+                // Intentionally left empty.
+            }
+            
             template<typename ValueType, ScalingMode Mode>
             bool EliminatorBase<ValueType, Mode>::filterPredecessor(storm::storage::sparse::state_type const&) {
                 STORM_LOG_ASSERT(false, "Must not filter predecessors.");
@@ -4,6 +4,8 @@
 
 #include "storm/storage/FlexibleSparseMatrix.h"
 
+#include "storm/solver/stateelimination/SimplificationCache.h"
+
 namespace storm {
     namespace solver {
         namespace stateelimination {
@@ -17,6 +19,7 @@ namespace storm {
             public:
                 typedef typename storm::storage::FlexibleSparseMatrix<ValueType>::row_type FlexibleRowType;
                 typedef typename FlexibleRowType::iterator FlexibleRowIterator;
+                typedef typename FlexibleRowType::value_type FlexibleEntryType;
                 
                 EliminatorBase(storm::storage::FlexibleSparseMatrix<ValueType>& matrix, storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix);
                 virtual ~EliminatorBase() = default;
@@ -29,12 +32,25 @@ namespace storm {
                 virtual void updateValue(storm::storage::sparse::state_type const& state, ValueType const& loopProbability);
                 virtual void updatePredecessor(storm::storage::sparse::state_type const& predecessor, ValueType const& probability, storm::storage::sparse::state_type const& state);
                 virtual void updatePriority(storm::storage::sparse::state_type const& state);
+                virtual void updateSuccessorPriority(storm::storage::sparse::state_type const& state);
                 virtual bool filterPredecessor(storm::storage::sparse::state_type const& state);
                 virtual bool isFilterPredecessor() const;
                 
+                /*!
+                 * Sets a cache that is used to simplify the values computed during the elimination. The cache is only
+                 * used for rational functions, because simplifying other values is cheap anyway.
+                 */
+                void setSimplificationCache(std::shared_ptr<SimplificationCache<ValueType>> const& cache);
+                
             protected:
+                /*!
+                 * Simplifies the given value (using the simplification cache, if one was set).
+                 */
+                ValueType simplifyValue(ValueType const& value) const;
+                
                 storm::storage::FlexibleSparseMatrix<ValueType>& matrix;
                 storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix;
+                std::shared_ptr<SimplificationCache<ValueType>> simplificationCache;
             };
             
         } // namespace stateelimination
@@ -0,0 +1,213 @@
+#include "storm/solver/stateelimination/ParallelStateEliminator.h"
+
+#include <algorithm>
+#include <type_traits>
+
+#include "storm-config.h"
+
+#include "storm/solver/stateelimination/StatePriorityQueue.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/IntelTbbAdapter.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/IllegalArgumentException.h"
+
+namespace storm {
+    namespace solver {
+        namespace stateelimination {
+
+            namespace {
+                template<typename ValueType>
+                std::shared_ptr<SimplificationCache<ValueType>> createSimplificationCache() {
+                    // Simplifying values other than rational functions is cheap, so there is no need for a cache.
+                    return nullptr;
+                }
+
+#ifdef STORM_HAVE_CARL
+                template<>
+                std::shared_ptr<SimplificationCache<storm::RationalFunction>> createSimplificationCache<storm::RationalFunction>() {
+                    return std::make_shared<SimplificationCache<storm::RationalFunction>>();
+                }
+#endif
+
+                template<typename ValueType>
+                void logCacheStatistics(SimplificationCache<ValueType> const*) {
+                    // Intentionally left empty.
+                }
+
+#ifdef STORM_HAVE_CARL
+                void logCacheStatistics(SimplificationCache<storm::RationalFunction> const* cache) {
+                    if (cache) {
+                        STORM_LOG_DEBUG("Simplification cache answered " << cache->getNumberOfHits() << " of " << cache->getNumberOfLookups() << " lookups.");
+                    }
+                }
+#endif
+
+                template<typename ValueType>
+                bool supportsConcurrentArithmetic() {
+                    // Copies of carl numbers and rational functions share (CLN) coefficients whose reference counts are
+                    // not atomic, even if carl is built with THREAD_SAFE, so only built-in numbers are used concurrently.
+                    return std::is_arithmetic<ValueType>::value;
+                }
+            }
+
+            template<typename ValueType>
+            ParallelStateEliminator<ValueType>::ParallelStateEliminator(storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, PriorityQueuePointer priorityQueue, std::vector<ValueType>& stateValues) : PrioritizedStateEliminator<ValueType>(transitionMatrix, backwardTransitions, priorityQueue, stateValues), marked(transitionMatrix.getRowCount()), maximalBatchSize(1024), numberOfRounds(0), concurrent(supportsConcurrentArithmetic<ValueType>()) {
+                STORM_LOG_THROW(transitionMatrix.hasTrivialRowGrouping(), storm::exceptions::IllegalArgumentException, "Parallel state elimination requires a matrix with trivial row grouping.");
+                STORM_LOG_INFO_COND(concurrent, "The arithmetic of the value type is not thread-safe, so the states of a round are eliminated sequentially.");
+                this->setSimplificationCache(createSimplificationCache<ValueType>());
+            }
+
+            template<typename ValueType>
+            void ParallelStateEliminator<ValueType>::updatePriority(storm::storage::sparse::state_type const&) {
+                // Intentionally left empty.
+            }
+
+            template<typename ValueType>
+            void ParallelStateEliminator<ValueType>::updateSuccessorPriority(storm::storage::sparse::state_type const&) {
+                // Intentionally left empty.
+            }
+
+            template<typename ValueType>
+            void ParallelStateEliminator<ValueType>::eliminateAll(bool removeForwardTransitions) {
+                eliminateInRounds(nullptr, removeForwardTransitions);
+            }
+
+            template<typename ValueType>
+            void ParallelStateEliminator<ValueType>::eliminateAll(storm::storage::BitVector const& statesToKeepForwardTransitions) {
+                eliminateInRounds(&statesToKeepForwardTransitions, true);
+            }
+
+            template<typename ValueType>
+            void ParallelStateEliminator<ValueType>::setMaximalBatchSize(uint64_t value) {
+                STORM_LOG_THROW(value > 0, storm::exceptions::IllegalArgumentException, "The maximal batch size must be positive.");
+                maximalBatchSize = value;
+            }
+
+            template<typename ValueType>
+            uint64_t ParallelStateEliminator<ValueType>::getNumberOfRounds() const {
+                return numberOfRounds;
+            }
+
+            template<typename ValueType>
+            bool ParallelStateEliminator<ValueType>::isConcurrent() const {
+                return concurrent;
+            }
+
+            template<typename ValueType>
+            std::vector<storm::storage::sparse::state_type> ParallelStateEliminator<ValueType>::selectIndependentStates(std::vector<storm::storage::sparse::state_type>& pendingStates) {
+                std::vector<storm::storage::sparse::state_type> selectedStates;
+                std::vector<storm::storage::sparse::state_type> deferredStates;
+                std::vector<storm::storage::sparse::state_type> markedStates;
+
+                // Only consider a window of the states with the highest priority, so a round does not cost more than
+                // the elimination itself if only few states are independent.
+                uint64_t windowStart = pendingStates.size() - std::min<uint64_t>(pendingStates.size(), 4 * maximalBatchSize);
+                uint64_t index = pendingStates.size();
+                for (; index > windowStart && selectedStates.size() < maximalBatchSize; --index) {
+                    storm::storage::sparse::state_type state = pendingStates[index - 1];
+                    if (markNeighbourhood(state, markedStates)) {
+                        selectedStates.push_back(state);
+                    } else {
+                        deferredStates.push_back(state);
+                    }
+                }
+
+                // Put the deferred states back such that the order of the pending states is preserved.
+                pendingStates.resize(index);
+                pendingStates.insert(pendingStates.end(), deferredStates.rbegin(), deferredStates.rend());
+
+                for (auto const& state : markedStates) {
+                    marked.set(state, false);
+                }
+                return selectedStates;
+            }
+
+            template<typename ValueType>
+            bool ParallelStateEliminator<ValueType>::markNeighbourhood(storm::storage::sparse::state_type state, std::vector<storm::storage::sparse::state_type>& markedStates) {
+                if (marked.get(state)) {
+                    return false;
+                }
+                for (auto const& entry : this->matrix.getRow(state)) {
+                    if (marked.get(entry.getColumn())) {
+                        return false;
+                    }
+                }
+                for (auto const& entry : this->transposedMatrix.getRow(state)) {
+                    if (marked.get(entry.getColumn())) {
+                        return false;
+                    }
+                }
+
+                auto mark = [&] (storm::storage::sparse::state_type const& neighbour) {
+                    if (!marked.get(neighbour)) {
+                        marked.set(neighbour);
+                        markedStates.push_back(neighbour);
+                    }
+                };
+                mark(state);
+                for (auto const& entry : this->matrix.getRow(state)) {
+                    mark(entry.getColumn());
+                }
+                for (auto const& entry : this->transposedMatrix.getRow(state)) {
+                    mark(entry.getColumn());
+                }
+                return true;
+            }
+
+            template<typename ValueType>
+            void ParallelStateEliminator<ValueType>::eliminateInRounds(storm::storage::BitVector const* statesToKeepForwardTransitions, bool removeForwardTransitions) {
+                // Fix the order of the states once. The pending states are ordered by decreasing priority from the back.
+                std::vector<storm::storage::sparse::state_type> pendingStates;
+                while (this->priorityQueue->hasNext()) {
+                    pendingStates.push_back(this->priorityQueue->pop());
+                }
+                std::reverse(pendingStates.begin(), pendingStates.end());
+
+                // Rows of distinct states are modified concurrently, but they share the pools of the matrices.
+                this->matrix.setSynchronizedRowAllocation(true);
+                this->transposedMatrix.setSynchronizedRowAllocation(true);
+
+                numberOfRounds = 0;
+                while (!pendingStates.empty()) {
+                    std::vector<storm::storage::sparse::state_type> selectedStates = selectIndependentStates(pendingStates);
+                    STORM_LOG_ASSERT(!selectedStates.empty(), "Expected to select at least one state.");
+                    ++numberOfRounds;
+
+                    auto eliminateStates = [&] (uint64_t first, uint64_t last) {
+                        for (uint64_t index = first; index < last; ++index) {
+                            storm::storage::sparse::state_type state = selectedStates[index];
+                            bool removeTransitions = statesToKeepForwardTransitions ? !statesToKeepForwardTransitions->get(state) : removeForwardTransitions;
+                            this->eliminateState(state, removeTransitions);
+                            if (removeTransitions) {
+                                this->clearStateValues(state);
+                            }
+                        }
+                    };
+#ifdef STORM_HAVE_INTELTBB
+                    if (concurrent && selectedStates.size() > 1) {
+                        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, selectedStates.size()), [&] (tbb::blocked_range<uint64_t> const& range) { eliminateStates(range.begin(), range.end()); });
+                    } else {
+                        eliminateStates(0, selectedStates.size());
+                    }
+#else
+                    eliminateStates(0, selectedStates.size());
+#endif
+                }
+
+                this->matrix.setSynchronizedRowAllocation(false);
+                this->transposedMatrix.setSynchronizedRowAllocation(false);
+                STORM_LOG_DEBUG("Eliminated the states in " << numberOfRounds << " rounds.");
+                logCacheStatistics(this->simplificationCache.get());
+            }
+
+            template class ParallelStateEliminator<double>;
+
+#ifdef STORM_HAVE_CARL
+            template class ParallelStateEliminator<storm::RationalNumber>;
+            template class ParallelStateEliminator<storm::RationalFunction>;
+#endif
+        }
+    }
+}
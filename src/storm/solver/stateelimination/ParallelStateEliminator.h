@@ -0,0 +1,85 @@
+#pragma once
+
+#include "storm/solver/stateelimination/PrioritizedStateEliminator.h"
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace solver {
+        namespace stateelimination {
+
+            /*!
+             * An eliminator that eliminates several states at once. Two states can be eliminated concurrently if their
+             * neighbourhoods (the state itself, its predecessors and its successors) are disjoint, because eliminating a
+             * state only modifies the forward transitions of the state and its predecessors and the backward transitions
+             * of the state and its successors. In every round, the eliminator greedily selects such an independent set
+             * of states (respecting the order of the priority queue) and eliminates it in parallel.
+             *
+             * The priorities are only evaluated once at the beginning, i.e. they are not updated during the elimination.
+             * Only values of built-in arithmetic types are processed concurrently. For other value types (in particular
+             * the numbers and rational functions of carl), the states of a round are eliminated one after another and
+             * the simplifications of rational functions are cached.
+             */
+            template<typename ValueType>
+            class ParallelStateEliminator : public PrioritizedStateEliminator<ValueType> {
+            public:
+                typedef typename PrioritizedStateEliminator<ValueType>::PriorityQueuePointer PriorityQueuePointer;
+
+                ParallelStateEliminator(storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, PriorityQueuePointer priorityQueue, std::vector<ValueType>& stateValues);
+
+                // The priorities are not updated.
+                virtual void updatePriority(storm::storage::sparse::state_type const& state) override;
+                virtual void updateSuccessorPriority(storm::storage::sparse::state_type const& state) override;
+
+                virtual void eliminateAll(bool removeForwardTransitions = true) override;
+
+                /*!
+                 * Eliminates all states of the queue and removes their forward transitions, unless they are contained
+                 * in the given set of states.
+                 */
+                void eliminateAll(storm::storage::BitVector const& statesToKeepForwardTransitions);
+
+                /*!
+                 * Sets the maximal number of states that are eliminated in one round.
+                 */
+                void setMaximalBatchSize(uint64_t value);
+
+                /*!
+                 * Retrieves the number of rounds of the last elimination.
+                 */
+                uint64_t getNumberOfRounds() const;
+
+                /*!
+                 * Retrieves whether the states of a round are eliminated concurrently, which requires the arithmetic of
+                 * the value type to be thread-safe.
+                 */
+                bool isConcurrent() const;
+
+            private:
+                /*!
+                 * Selects a set of states with disjoint neighbourhoods from the end of the pending states (which are
+                 * ordered by decreasing priority) and removes them from the pending states.
+                 */
+                std::vector<storm::storage::sparse::state_type> selectIndependentStates(std::vector<storm::storage::sparse::state_type>& pendingStates);
+
+                /*!
+                 * Tries to mark the neighbourhood of the given state. Returns false (without marking anything) if the
+                 * neighbourhood intersects a marked one.
+                 */
+                bool markNeighbourhood(storm::storage::sparse::state_type state, std::vector<storm::storage::sparse::state_type>& markedStates);
+
+                void eliminateInRounds(storm::storage::BitVector const* statesToKeepForwardTransitions, bool removeForwardTransitions);
+
+                // The states that belong to the neighbourhood of a state selected in the current round.
+                storm::storage::BitVector marked;
+
+                uint64_t maximalBatchSize;
+                uint64_t numberOfRounds;
+
+                // Whether the states of a round are eliminated concurrently.
+                bool concurrent;
+            };
+
+        }
+    }
+}
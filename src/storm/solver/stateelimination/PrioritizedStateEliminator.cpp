@@ -22,18 +22,23 @@ namespace storm {
             
             template<typename ValueType>
             void PrioritizedStateEliminator<ValueType>::updateValue(storm::storage::sparse::state_type const& state, ValueType const& loopProbability) {
-                stateValues[state] = storm::utility::simplify((ValueType) (loopProbability * stateValues[state]));
+                stateValues[state] = this->simplifyValue((ValueType) (loopProbability * stateValues[state]));
             }
        
             template<typename ValueType>
             void PrioritizedStateEliminator<ValueType>::updatePredecessor(storm::storage::sparse::state_type const& predecessor, ValueType const& probability, storm::storage::sparse::state_type const& state) {
-                stateValues[predecessor] = storm::utility::simplify((ValueType) (stateValues[predecessor] + storm::utility::simplify((ValueType) (probability * stateValues[state]))));
+                stateValues[predecessor] = this->simplifyValue((ValueType) (stateValues[predecessor] + this->simplifyValue((ValueType) (probability * stateValues[state]))));
             }
             
             template<typename ValueType>
             void PrioritizedStateEliminator<ValueType>::updatePriority(storm::storage::sparse::state_type const& state) {
                 priorityQueue->update(state);
             }
+            
+            template<typename ValueType>
+            void PrioritizedStateEliminator<ValueType>::updateSuccessorPriority(storm::storage::sparse::state_type const& state) {
+                priorityQueue->updateSuccessor(state);
+            }
 
             template<typename ValueType>
             void PrioritizedStateEliminator<ValueType>::eliminateAll(bool removeForwardTransitions) {
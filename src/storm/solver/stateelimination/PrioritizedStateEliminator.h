@@ -21,6 +21,7 @@ namespace storm {
                 virtual void updateValue(storm::storage::sparse::state_type const& state, ValueType const& loopProbability) override;
                 virtual void updatePredecessor(storm::storage::sparse::state_type const& predecessor, ValueType const& probability, storm::storage::sparse::state_type const& state) override;
                 virtual void updatePriority(storm::storage::sparse::state_type const& state) override;
+                virtual void updateSuccessorPriority(storm::storage::sparse::state_type const& state) override;
 
                 virtual void eliminateAll(bool eliminateForwardTransitions = true);
                 virtual void clearStateValues(storm::storage::sparse::state_type const& state);
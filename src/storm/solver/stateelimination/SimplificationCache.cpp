@@ -0,0 +1,50 @@
+#include "storm/solver/stateelimination/SimplificationCache.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/constants.h"
+
+namespace storm {
+    namespace solver {
+        namespace stateelimination {
+
+            template<typename ValueType>
+            SimplificationCache<ValueType>::SimplificationCache(uint64_t maximalSize) : maximalSize(std::max<uint64_t>(maximalSize, 1)), lookups(0), hits(0) {
+                // Intentionally left empty.
+            }
+
+            template<typename ValueType>
+            ValueType SimplificationCache<ValueType>::simplify(ValueType const& value) {
+                ++lookups;
+                auto it = values.find(value);
+                if (it != values.end()) {
+                    ++hits;
+                    return it->second;
+                }
+
+                ValueType result = storm::utility::simplify(value);
+                if (values.size() >= maximalSize) {
+                    values.clear();
+                }
+                values.emplace(value, result);
+                return result;
+            }
+
+            template<typename ValueType>
+            uint64_t SimplificationCache<ValueType>::getNumberOfLookups() const {
+                return lookups;
+            }
+
+            template<typename ValueType>
+            uint64_t SimplificationCache<ValueType>::getNumberOfHits() const {
+                return hits;
+            }
+
+#ifdef STORM_HAVE_CARL
+            template class SimplificationCache<storm::RationalFunction>;
+#endif
+        }
+    }
+}
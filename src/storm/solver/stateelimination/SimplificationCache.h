@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+
+namespace storm {
+    namespace solver {
+        namespace stateelimination {
+
+            /*!
+             * A cache for the simplification of values, i.e. the normalization of rational functions which requires the
+             * computation of the gcd of numerator and denominator. During the elimination of parametric models, the
+             * same (unsimplified) functions tend to come up repeatedly, for example for states that are structurally
+             * similar. The values handed out by the cache share their representation with the cached ones, so the
+             * cache must only be used by one thread.
+             */
+            template<typename ValueType>
+            class SimplificationCache {
+            public:
+                /*!
+                 * Creates a cache that holds at most the given number of values. If the cache becomes full, it is
+                 * cleared.
+                 */
+                SimplificationCache(uint64_t maximalSize = 1ull << 16);
+
+                /*!
+                 * Retrieves the simplified version of the given value.
+                 */
+                ValueType simplify(ValueType const& value);
+
+                /*!
+                 * Retrieves the number of lookups and the number of lookups that were answered by the cache.
+                 */
+                uint64_t getNumberOfLookups() const;
+                uint64_t getNumberOfHits() const;
+
+            private:
+                uint64_t maximalSize;
+                std::unordered_map<ValueType, ValueType> values;
+
+                uint64_t lookups;
+                uint64_t hits;
+            };
+
+        }
+    }
+}
@@ -8,6 +8,10 @@ namespace storm {
                 // Intentionally left empty.
             }
             
+            void StatePriorityQueue::updateSuccessor(storm::storage::sparse::state_type) {
+                // Intentionally left empty.
+            }
+            
         }
     }
 }
@@ -15,6 +15,11 @@ namespace storm {
                 virtual bool hasNext() const = 0;
                 virtual storm::storage::sparse::state_type pop() = 0;
                 virtual void update(storm::storage::sparse::state_type state);
+                
+                /*!
+                 * Notifies the queue that the predecessors of the given state changed.
+                 */
+                virtual void updateSuccessor(storm::storage::sparse::state_type state);
                 virtual std::size_t size() const = 0;
             };
             
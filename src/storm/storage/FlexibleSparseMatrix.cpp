@@ -11,13 +11,14 @@
 namespace storm {
     namespace storage {
         template<typename ValueType>
-        FlexibleSparseMatrix<ValueType>::FlexibleSparseMatrix(index_type rows) : data(rows), columnCount(0), nonzeroEntryCount(0) {
-            // Intentionally left empty.
+        FlexibleSparseMatrix<ValueType>::FlexibleSparseMatrix(index_type rows) : pool(std::make_unique<RowPool>()), columnCount(0), nonzeroEntryCount(0) {
+            createRows(rows);
         }
         
         template<typename ValueType>
-        FlexibleSparseMatrix<ValueType>::FlexibleSparseMatrix(storm::storage::SparseMatrix<ValueType> const& matrix, bool setAllValuesToOne, bool revertEquationSystem) : data(matrix.getRowCount()), columnCount(matrix.getColumnCount()), nonzeroEntryCount(matrix.getNonzeroEntryCount()), trivialRowGrouping(matrix.hasTrivialRowGrouping()) {
+        FlexibleSparseMatrix<ValueType>::FlexibleSparseMatrix(storm::storage::SparseMatrix<ValueType> const& matrix, bool setAllValuesToOne, bool revertEquationSystem) : pool(std::make_unique<RowPool>()), columnCount(matrix.getColumnCount()), nonzeroEntryCount(matrix.getNonzeroEntryCount()), trivialRowGrouping(matrix.hasTrivialRowGrouping()) {
             STORM_LOG_THROW(!revertEquationSystem || trivialRowGrouping, storm::exceptions::InvalidArgumentException, "Illegal option for creating flexible matrix.");
+            createRows(matrix.getRowCount());
             
             if (!trivialRowGrouping) {
                 rowGroupIndices = matrix.getRowGroupIndices();
@@ -58,6 +59,57 @@ namespace storm {
             }
         }
 
+        template<typename ValueType>
+        FlexibleSparseMatrix<ValueType>::FlexibleSparseMatrix(FlexibleSparseMatrix const& other) : pool(std::make_unique<RowPool>()), columnCount(other.columnCount), nonzeroEntryCount(other.nonzeroEntryCount), trivialRowGrouping(other.trivialRowGrouping), rowGroupIndices(other.rowGroupIndices) {
+            // Copy the rows into our own pool.
+            createRows(other.getRowCount());
+            for (index_type row = 0; row < other.getRowCount(); ++row) {
+                data[row].assign(other.data[row].begin(), other.data[row].end());
+            }
+        }
+
+        template<typename ValueType>
+        FlexibleSparseMatrix<ValueType>& FlexibleSparseMatrix<ValueType>::operator=(FlexibleSparseMatrix const& other) {
+            if (this != &other) {
+                *this = FlexibleSparseMatrix<ValueType>(other);
+            }
+            return *this;
+        }
+
+        template<typename ValueType>
+        FlexibleSparseMatrix<ValueType>& FlexibleSparseMatrix<ValueType>::operator=(FlexibleSparseMatrix&& other) {
+            // The rows refer to the pool they were allocated from, so the rows and the pools are swapped together and
+            // our old rows are destroyed along with their pool when the other matrix is.
+            std::swap(pool, other.pool);
+            std::swap(data, other.data);
+            columnCount = other.columnCount;
+            nonzeroEntryCount = other.nonzeroEntryCount;
+            trivialRowGrouping = other.trivialRowGrouping;
+            rowGroupIndices = std::move(other.rowGroupIndices);
+            return *this;
+        }
+
+        template<typename ValueType>
+        typename FlexibleSparseMatrix<ValueType>::allocator_type FlexibleSparseMatrix<ValueType>::getRowAllocator() const {
+            return allocator_type(pool.get());
+        }
+
+        template<typename ValueType>
+        void FlexibleSparseMatrix<ValueType>::setSynchronizedRowAllocation(bool value) {
+            if (pool) {
+                pool->setSynchronized(value);
+            }
+        }
+
+        template<typename ValueType>
+        void FlexibleSparseMatrix<ValueType>::createRows(index_type rows) {
+            // Rows are constructed one by one, because copying a prototype row would not preserve the allocator.
+            data.reserve(rows);
+            for (index_type row = 0; row < rows; ++row) {
+                data.emplace_back(getRowAllocator());
+            }
+        }
+
         template<typename ValueType>
         void FlexibleSparseMatrix<ValueType>::reserveInRow(index_type row, index_type numberOfElements) {
             this->data[row].reserve(numberOfElements);
@@ -163,7 +215,7 @@ namespace storm {
                     row.shrink_to_fit();
                     continue;
                 }
-                row_type newRow;
+                row_type newRow(getRowAllocator());
                 for (auto const& element : row) {
                     if (columnConstraint.get(element.getColumn())) {
                         newRow.push_back(element);
@@ -273,7 +325,7 @@ namespace storm {
         template<typename ValueType>
         std::ostream& FlexibleSparseMatrix<ValueType>::printRow(std::ostream& out, index_type const& rowIndex) const {
             index_type columnIndex = 0;
-            row_type row = this->getRow(rowIndex);
+            row_type const& row = this->getRow(rowIndex);
             for (index_type column = 0; column < this->getColumnCount(); ++column) {
                 if (columnIndex < row.size() && row[columnIndex].getColumn() == column) {
                     // Insert entry
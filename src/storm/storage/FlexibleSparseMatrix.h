@@ -2,10 +2,12 @@
 #define STORM_STORAGE_FLEXIBLESPARSEMATRIX_H_
 
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 #include "storm/storage/sparse/StateType.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/RowPool.h"
 
 namespace storm {
     namespace storage {
@@ -16,6 +18,10 @@ namespace storm {
         
         /*!
          * The flexible sparse matrix is used during state elimination.
+         *
+         * The entries of the rows are taken from a pool that is owned by the matrix, so that the buffers of rows that
+         * are replaced (or cleared) are reused for the rows built by later elimination steps. Rows that are moved out
+         * of the matrix must therefore not outlive it, while rows that are copied from it are independent.
          */
         template<typename ValueType>
         class FlexibleSparseMatrix {
@@ -25,7 +31,8 @@ namespace storm {
             
             typedef uint_fast64_t index_type;
             typedef ValueType value_type;
-            typedef std::vector<storm::storage::MatrixEntry<index_type, value_type>> row_type;
+            typedef PooledRowAllocator<storm::storage::MatrixEntry<index_type, value_type>> allocator_type;
+            typedef std::vector<storm::storage::MatrixEntry<index_type, value_type>, allocator_type> row_type;
             typedef typename row_type::iterator iterator;
             typedef typename row_type::const_iterator const_iterator;
             
@@ -49,6 +56,27 @@ namespace storm {
              */
             FlexibleSparseMatrix(storm::storage::SparseMatrix<ValueType> const& matrix, bool setAllValuesToOne = false, bool revertEquationSystem = false);
 
+            FlexibleSparseMatrix(FlexibleSparseMatrix const& other);
+            FlexibleSparseMatrix(FlexibleSparseMatrix&& other) = default;
+            FlexibleSparseMatrix& operator=(FlexibleSparseMatrix const& other);
+            FlexibleSparseMatrix& operator=(FlexibleSparseMatrix&& other);
+
+            /*!
+             * Retrieves an allocator that takes its memory from the pool of this matrix. Rows that are built with it
+             * can be moved into the matrix without copying their entries.
+             *
+             * @return The allocator of the rows of this matrix.
+             */
+            allocator_type getRowAllocator() const;
+
+            /*!
+             * Sets whether the allocation of row entries is synchronized. This needs to be enabled while distinct rows
+             * are modified concurrently.
+             *
+             * @param value The new value.
+             */
+            void setSynchronizedRowAllocation(bool value);
+
             /*!
              * Reserves space for elements in row.
              * @param row Row to reserve in.
@@ -204,6 +232,15 @@ namespace storm {
             friend std::ostream& operator<<(std::ostream& out, FlexibleSparseMatrix<TPrime> const& matrix);
 
         private:
+            /*!
+             * Creates the given number of empty rows that allocate from the pool of this matrix.
+             */
+            void createRows(index_type rows);
+
+            // The pool from which the entries of the rows are allocated. It is declared before the rows, so that it is
+            // destroyed after them.
+            std::unique_ptr<RowPool> pool;
+
             std::vector<row_type> data;
 
             // The number of columns of the matrix.
@@ -0,0 +1,121 @@
+#include "storm/storage/RowPool.h"
+
+#include <algorithm>
+#include <new>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace storage {
+
+        const std::size_t RowPool::alignment;
+
+        RowPool::RowPool(std::size_t slabSize) : slabSize(std::max<std::size_t>(slabSize, 4 * alignment) / alignment * alignment), slabPosition(nullptr), slabRemaining(0), reusedBlocks(0), synchronize(false) {
+            // Intentionally left empty.
+        }
+
+        RowPool::~RowPool() {
+            for (auto slab : slabs) {
+                ::operator delete(slab);
+            }
+        }
+
+        void* RowPool::allocate(std::size_t bytes) {
+            if (synchronize) {
+                std::lock_guard<std::mutex> lock(mutex);
+                return allocateUnsynchronized(bytes);
+            }
+            return allocateUnsynchronized(bytes);
+        }
+
+        void RowPool::deallocate(void* block, std::size_t bytes) {
+            if (synchronize) {
+                std::lock_guard<std::mutex> lock(mutex);
+                deallocateUnsynchronized(block, bytes);
+            } else {
+                deallocateUnsynchronized(block, bytes);
+            }
+        }
+
+        void RowPool::setSynchronized(bool value) {
+            synchronize = value;
+        }
+
+        void* RowPool::allocateUnsynchronized(std::size_t bytes) {
+            bytes = std::max(bytes, alignment);
+            if (bytes > slabSize / 4) {
+                return ::operator new(bytes);
+            }
+
+            uint64_t sizeClass = getSizeClass(bytes);
+            if (sizeClass < freeBlocks.size() && !freeBlocks[sizeClass].empty()) {
+                void* block = freeBlocks[sizeClass].back();
+                freeBlocks[sizeClass].pop_back();
+                ++reusedBlocks;
+                return block;
+            }
+            return carve(sizeClass);
+        }
+
+        void RowPool::deallocateUnsynchronized(void* block, std::size_t bytes) {
+            bytes = std::max(bytes, alignment);
+            if (bytes > slabSize / 4) {
+                ::operator delete(block);
+                return;
+            }
+
+            uint64_t sizeClass = getSizeClass(bytes);
+            if (sizeClass >= freeBlocks.size()) {
+                freeBlocks.resize(sizeClass + 1);
+            }
+            freeBlocks[sizeClass].push_back(block);
+        }
+
+        uint64_t RowPool::getNumberOfSlabs() const {
+            return slabs.size();
+        }
+
+        uint64_t RowPool::getNumberOfReusedBlocks() const {
+            return reusedBlocks;
+        }
+
+        uint64_t RowPool::getSizeClass(std::size_t bytes) {
+            uint64_t sizeClass = 0;
+            while ((static_cast<std::size_t>(1) << sizeClass) < bytes) {
+                ++sizeClass;
+            }
+            return sizeClass;
+        }
+
+        void* RowPool::carve(uint64_t sizeClass) {
+            std::size_t blockSize = static_cast<std::size_t>(1) << sizeClass;
+            if (blockSize > slabRemaining) {
+                // Hand the rest of the current slab to the free lists before starting a new one. As all block sizes
+                // are multiples of the alignment, the rest can be split into (aligned) power-of-two blocks.
+                while (slabRemaining >= alignment) {
+                    uint64_t restClass = getSizeClass(slabRemaining);
+                    if ((static_cast<std::size_t>(1) << restClass) > slabRemaining) {
+                        --restClass;
+                    }
+                    if (restClass >= freeBlocks.size()) {
+                        freeBlocks.resize(restClass + 1);
+                    }
+                    freeBlocks[restClass].push_back(slabPosition);
+                    slabPosition += static_cast<std::size_t>(1) << restClass;
+                    slabRemaining -= static_cast<std::size_t>(1) << restClass;
+                }
+
+                slabs.push_back(static_cast<char*>(::operator new(slabSize)));
+                slabPosition = slabs.back();
+                slabRemaining = slabSize;
+                STORM_LOG_TRACE("Row pool allocated slab " << slabs.size() << ".");
+            }
+
+            void* block = slabPosition;
+            slabPosition += blockSize;
+            slabRemaining -= blockSize;
+            return block;
+        }
+
+    }
+}
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * A pool for the entry buffers of the rows of a matrix whose rows are frequently rebuilt (as it happens during
+         * state elimination). Buffers are carved from large slabs in power-of-two size classes and buffers that are
+         * given back are kept in a free list per size class, so that they are reused by the next row of a similar size
+         * instead of going through the global allocator. Memory is only returned to the system when the pool is
+         * destroyed.
+         *
+         * Note that the pool is only thread-safe if it was explicitly made synchronized.
+         */
+        class RowPool {
+        public:
+            // The alignment of all blocks handed out by the pool.
+            static const std::size_t alignment = 16;
+
+            /*!
+             * Creates a pool that allocates slabs of the given size (in bytes). Requests that exceed a quarter of the
+             * slab size are served by the global allocator directly.
+             */
+            RowPool(std::size_t slabSize = 1ull << 18);
+            ~RowPool();
+
+            RowPool(RowPool const& other) = delete;
+            RowPool& operator=(RowPool const& other) = delete;
+
+            /*!
+             * Allocates a block that can hold (at least) the given number of bytes.
+             */
+            void* allocate(std::size_t bytes);
+
+            /*!
+             * Gives back a block that was obtained from this pool with the same number of bytes.
+             */
+            void deallocate(void* block, std::size_t bytes);
+
+            /*!
+             * Sets whether allocations are synchronized, which is required as long as several threads modify the
+             * containers that take their memory from this pool.
+             */
+            void setSynchronized(bool value);
+
+            /*!
+             * Retrieves the number of slabs the pool has allocated so far.
+             */
+            uint64_t getNumberOfSlabs() const;
+
+            /*!
+             * Retrieves the number of requests that were served from the free lists.
+             */
+            uint64_t getNumberOfReusedBlocks() const;
+
+        private:
+            void* allocateUnsynchronized(std::size_t bytes);
+            void deallocateUnsynchronized(void* block, std::size_t bytes);
+
+            /*!
+             * Retrieves the index of the smallest size class whose blocks can hold the given number of bytes.
+             */
+            static uint64_t getSizeClass(std::size_t bytes);
+
+            /*!
+             * Carves a block of the given size class from the current slab (and starts a new slab if necessary).
+             */
+            void* carve(uint64_t sizeClass);
+
+            // The size of the slabs in bytes.
+            std::size_t slabSize;
+
+            // The slabs allocated so far.
+            std::vector<char*> slabs;
+
+            // The position and the remaining number of bytes in the current slab.
+            char* slabPosition;
+            std::size_t slabRemaining;
+
+            // For every size class, the blocks that were given back to the pool.
+            std::vector<std::vector<void*>> freeBlocks;
+
+            // The number of requests that were served from the free lists.
+            uint64_t reusedBlocks;
+
+            // Whether (and with which mutex) allocations are synchronized.
+            bool synchronize;
+            std::mutex mutex;
+        };
+
+        /*!
+         * An allocator that takes its memory from a row pool. Default-constructed allocators (and hence containers
+         * that are copied from pooled ones) use the global allocator, so only the owner of the pool decides which
+         * containers are pooled and containers that are not owned by it can safely outlive the pool.
+         */
+        template<typename T>
+        class PooledRowAllocator {
+        public:
+            typedef T value_type;
+
+            PooledRowAllocator() noexcept : pool(nullptr) {
+                // Intentionally left empty.
+            }
+
+            explicit PooledRowAllocator(RowPool* pool) noexcept : pool(pool) {
+                // Intentionally left empty.
+            }
+
+            template<typename U>
+            PooledRowAllocator(PooledRowAllocator<U> const& other) noexcept : pool(other.getPool()) {
+                // Intentionally left empty.
+            }
+
+            T* allocate(std::size_t n) {
+                static_assert(alignof(T) <= RowPool::alignment, "Type is over-aligned for the row pool.");
+                if (pool) {
+                    return static_cast<T*>(pool->allocate(n * sizeof(T)));
+                }
+                return std::allocator<T>().allocate(n);
+            }
+
+            void deallocate(T* block, std::size_t n) {
+                if (pool) {
+                    pool->deallocate(block, n * sizeof(T));
+                } else {
+                    std::allocator<T>().deallocate(block, n);
+                }
+            }
+
+            PooledRowAllocator select_on_container_copy_construction() const {
+                return PooledRowAllocator();
+            }
+
+            RowPool* getPool() const noexcept {
+                return pool;
+            }
+
+        private:
+            // The pool to allocate from or null if the global allocator is to be used.
+            RowPool* pool;
+        };
+
+        template<typename T, typename U>
+        bool operator==(PooledRowAllocator<T> const& first, PooledRowAllocator<U> const& second) noexcept {
+            return first.getPool() == second.getPool();
+        }
+
+        template<typename T, typename U>
+        bool operator!=(PooledRowAllocator<T> const& first, PooledRowAllocator<U> const& second) noexcept {
+            return !(first == second);
+        }
+
+    }
+}
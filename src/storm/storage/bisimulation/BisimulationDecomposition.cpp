@@ -1,6 +1,8 @@
 #include "storm/storage/bisimulation/BisimulationDecomposition.h"
 
+#include <algorithm>
 #include <chrono>
+#include <limits>
 
 #include "storm/exceptions/AbortException.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
@@ -22,6 +24,8 @@
 
 #include "storm/storage/bisimulation/DeterministicBlockData.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
+
 #include "storm/utility/macros.h"
 #include "storm/utility/SignalHandler.h"
 
@@ -50,7 +54,7 @@ namespace storm {
         }
         
         template<typename ModelType, typename BlockDataType>
-        BisimulationDecomposition<ModelType, BlockDataType>::Options::Options() : measureDrivenInitialPartition(false), phiStates(), psiStates(), respectedAtomicPropositions(), buildQuotient(true), keepRewards(false), type(BisimulationType::Strong), bounded(false) {
+        BisimulationDecomposition<ModelType, BlockDataType>::Options::Options() : measureDrivenInitialPartition(false), phiStates(), psiStates(), respectedAtomicPropositions(), buildQuotient(true), signatureBasedRefinement(false), keepRewards(false), type(BisimulationType::Strong), bounded(false) {
             // Intentionally left empty.
         }
         
@@ -74,6 +78,16 @@ namespace storm {
             this->addToRespectedAtomicPropositions(formula.getAtomicExpressionFormulas(), formula.getAtomicLabelFormulas());
         }
         
+        template<typename ModelType, typename BlockDataType>
+        void BisimulationDecomposition<ModelType, BlockDataType>::Options::preserveUntilProbabilities(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, boost::optional<OptimizationDirection> const& optimizationDirection) {
+            measureDrivenInitialPartition = true;
+            this->phiStates = phiStates;
+            this->psiStates = psiStates;
+            optimalityType = optimizationDirection;
+            keepRewards = false;
+            bounded = false;
+        }
+        
         template<typename ModelType, typename BlockDataType>
         void BisimulationDecomposition<ModelType, BlockDataType>::Options::preserveSingleFormula(ModelType const& model, storm::logic::Formula const& formula) {
             // Retrieve information about formula.
@@ -196,10 +210,19 @@ namespace storm {
             STORM_LOG_WARN_COND(partition.size() > 1, "Initial partition consists only of a single block.");
             std::chrono::high_resolution_clock::duration initialPartitionTime = std::chrono::high_resolution_clock::now() - initialPartitionStart;
             
-            this->initialize();
+            bool useSignatures = options.signatureBasedRefinement && options.getType() == BisimulationType::Strong;
+            STORM_LOG_WARN_COND(!options.signatureBasedRefinement || useSignatures, "Signature-based refinement is only supported for strong bisimulation. Falling back to splitter-based refinement.");
             
             std::chrono::high_resolution_clock::time_point refinementStart = std::chrono::high_resolution_clock::now();
-            this->performPartitionRefinement();
+            if (useSignatures) {
+                // The signature-based refinement does not use the auxiliary data structures, so they are initialized
+                // for the final partition.
+                this->performSignatureBasedPartitionRefinement();
+                this->initialize();
+            } else {
+                this->initialize();
+                this->performPartitionRefinement();
+            }
             std::chrono::high_resolution_clock::duration refinementTime = std::chrono::high_resolution_clock::now() - refinementStart;
             
             std::chrono::high_resolution_clock::time_point extractionStart = std::chrono::high_resolution_clock::now();
@@ -262,11 +285,188 @@ namespace storm {
             }
         }
         
+        namespace {
+            // An entry of a signature. For each choice, the signature contains an entry with the block set to the
+            // separator that carries the reward of the choice, followed by the probabilities to move to the blocks.
+            template<typename ValueType>
+            struct SignatureEntry {
+                uint64_t block;
+                ValueType value;
+            };
+            
+            static const uint64_t SIGNATURE_SEPARATOR = std::numeric_limits<uint64_t>::max();
+            
+            template<typename ValueType>
+            bool signatureLess(SignatureEntry<ValueType> const* first, SignatureEntry<ValueType> const* firstEnd, SignatureEntry<ValueType> const* second, SignatureEntry<ValueType> const* secondEnd, storm::utility::ConstantsComparator<ValueType> const& comparator) {
+                for (; first != firstEnd && second != secondEnd; ++first, ++second) {
+                    if (first->block != second->block) {
+                        return first->block < second->block;
+                    }
+                    if (comparator.isLess(first->value, second->value)) {
+                        return true;
+                    } else if (comparator.isLess(second->value, first->value)) {
+                        return false;
+                    }
+                }
+                return first == firstEnd && second != secondEnd;
+            }
+        }
+        
+        template<typename ModelType, typename BlockDataType>
+        void BisimulationDecomposition<ModelType, BlockDataType>::performSignatureBasedPartitionRefinement() {
+            storm::storage::SparseMatrix<ValueType> const& transitionMatrix = model.getTransitionMatrix();
+            std::vector<uint_fast64_t> const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+            uint64_t numberOfStates = model.getNumberOfStates();
+            
+            std::vector<ValueType> const* actionRewards = nullptr;
+            if (options.getKeepRewards() && model.hasRewardModel() && model.getUniqueRewardModel().hasStateActionRewards()) {
+                actionRewards = &model.getUniqueRewardModel().getStateActionRewardVector();
+            }
+            
+            // Every state gets a fixed range of the signature storage that is large enough to hold its signature.
+            std::vector<uint64_t> signatureOffsets(numberOfStates + 1, 0);
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                signatureOffsets[state + 1] = signatureOffsets[state] + rowGroupIndices[state + 1] - rowGroupIndices[state];
+                for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                    signatureOffsets[state + 1] += transitionMatrix.getRow(row).getNumberOfEntries();
+                }
+            }
+            std::vector<SignatureEntry<ValueType>> signatures(signatureOffsets.back());
+            std::vector<uint64_t> signatureEnds(numberOfStates);
+            
+            auto needsRefinement = [] (Block<BlockDataType> const& block) { return block.getNumberOfStates() > 1 && !block.data().absorbing(); };
+            
+            // Computes the signature of the given state wrt. the current partition. The choices are ordered and
+            // duplicate choices are removed, such that states with the same set of choices get the same signature.
+            auto computeSignature = [&] (uint64_t state, std::vector<SignatureEntry<ValueType>>& scratch, std::vector<std::pair<uint64_t, uint64_t>>& choiceRanges) {
+                scratch.clear();
+                choiceRanges.clear();
+                for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                    uint64_t choiceBegin = scratch.size();
+                    scratch.push_back(SignatureEntry<ValueType>{SIGNATURE_SEPARATOR, actionRewards ? (*actionRewards)[row] : storm::utility::zero<ValueType>()});
+                    uint64_t distributionBegin = scratch.size();
+                    for (auto const& entry : transitionMatrix.getRow(row)) {
+                        scratch.push_back(SignatureEntry<ValueType>{partition.getBlock(entry.getColumn()).getId(), entry.getValue()});
+                    }
+                    std::sort(scratch.begin() + distributionBegin, scratch.end(), [] (SignatureEntry<ValueType> const& a, SignatureEntry<ValueType> const& b) { return a.block < b.block; });
+                    
+                    // Sum up the probabilities of moving to the same block.
+                    uint64_t distributionEnd = distributionBegin;
+                    for (uint64_t index = distributionBegin; index < scratch.size(); ++index) {
+                        if (distributionEnd > distributionBegin && scratch[distributionEnd - 1].block == scratch[index].block) {
+                            scratch[distributionEnd - 1].value += scratch[index].value;
+                        } else {
+                            scratch[distributionEnd++] = scratch[index];
+                        }
+                    }
+                    scratch.resize(distributionEnd);
+                    scratch.erase(std::remove_if(scratch.begin() + distributionBegin, scratch.end(), [this] (SignatureEntry<ValueType> const& entry) { return comparator.isZero(entry.value); }), scratch.end());
+                    choiceRanges.emplace_back(choiceBegin, scratch.size());
+                }
+                
+                auto choiceLess = [&] (std::pair<uint64_t, uint64_t> const& a, std::pair<uint64_t, uint64_t> const& b) {
+                    return signatureLess(scratch.data() + a.first, scratch.data() + a.second, scratch.data() + b.first, scratch.data() + b.second, comparator);
+                };
+                std::sort(choiceRanges.begin(), choiceRanges.end(), choiceLess);
+                
+                uint64_t position = signatureOffsets[state];
+                for (uint64_t choice = 0; choice < choiceRanges.size(); ++choice) {
+                    if (choice > 0 && !choiceLess(choiceRanges[choice - 1], choiceRanges[choice])) {
+                        continue;
+                    }
+                    position = std::copy(scratch.begin() + choiceRanges[choice].first, scratch.begin() + choiceRanges[choice].second, signatures.begin() + position) - signatures.begin();
+                }
+                signatureEnds[state] = position;
+            };
+            
+            auto stateLess = [&] (storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) {
+                return signatureLess(signatures.data() + signatureOffsets[state1], signatures.data() + signatureEnds[state1], signatures.data() + signatureOffsets[state2], signatures.data() + signatureEnds[state2], comparator);
+            };
+            
+            uint_fast64_t rounds = 0;
+            bool partitionChanged = true;
+            while (partitionChanged) {
+                ++rounds;
+                
+                // (1) Compute the signatures of all states whose block may be split.
+                auto computeSignatures = [&] (uint64_t firstState, uint64_t lastState) {
+                    std::vector<SignatureEntry<ValueType>> scratch;
+                    std::vector<std::pair<uint64_t, uint64_t>> choiceRanges;
+                    for (uint64_t state = firstState; state < lastState; ++state) {
+                        if (needsRefinement(partition.getBlock(state))) {
+                            computeSignature(state, scratch, choiceRanges);
+                        }
+                    }
+                };
+                
+                // (2) Sort the states of every block according to their signatures and determine the positions at
+                // which the blocks need to be split. The blocks occupy disjoint ranges, so they can be sorted in parallel.
+                std::vector<std::unique_ptr<Block<BlockDataType>>>& blocks = partition.getBlocks();
+                uint64_t numberOfBlocks = blocks.size();
+                std::vector<std::vector<storm::storage::sparse::state_type>> splitPositions(numberOfBlocks);
+                auto sortBlocks = [&] (uint64_t firstBlock, uint64_t lastBlock) {
+                    for (uint64_t blockIndex = firstBlock; blockIndex < lastBlock; ++blockIndex) {
+                        Block<BlockDataType>& block = *blocks[blockIndex];
+                        if (!needsRefinement(block)) {
+                            continue;
+                        }
+                        partition.sortBlock(block, stateLess, false);
+                        auto it = partition.begin(block);
+                        auto ite = partition.end(block);
+                        while (true) {
+                            it = std::upper_bound(it, ite, *it, stateLess);
+                            if (it == ite) {
+                                break;
+                            }
+                            splitPositions[blockIndex].push_back(std::distance(partition.begin(), it));
+                        }
+                    }
+                };
+                
+#ifdef STORM_HAVE_INTELTBB
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfStates), [&] (tbb::blocked_range<uint64_t> const& range) { computeSignatures(range.begin(), range.end()); });
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfBlocks), [&] (tbb::blocked_range<uint64_t> const& range) { sortBlocks(range.begin(), range.end()); });
+#else
+                computeSignatures(0, numberOfStates);
+                sortBlocks(0, numberOfBlocks);
+#endif
+                
+                // (3) Perform the splits. This modifies the partition, so it is done sequentially.
+                partitionChanged = false;
+                for (uint64_t blockIndex = 0; blockIndex < numberOfBlocks; ++blockIndex) {
+                    Block<BlockDataType>& block = *blocks[blockIndex];
+                    if (!needsRefinement(block)) {
+                        continue;
+                    }
+                    storm::storage::sparse::state_type originalBegin = block.getBeginIndex();
+                    storm::storage::sparse::state_type originalEnd = block.getEndIndex();
+                    for (auto const& position : splitPositions[blockIndex]) {
+                        partition.splitBlock(block, position);
+                        partitionChanged = true;
+                    }
+                    partition.mapStatesToPositions(partition.begin() + originalBegin, partition.begin() + originalEnd);
+                }
+                
+                if (storm::utility::resources::isTerminate()) {
+                    std::cout << "Performed " << rounds << " rounds of signature-based partition refinement before abort." << std::endl;
+                    STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in bisimulation computation.");
+                }
+            }
+            STORM_LOG_DEBUG("Signature-based partition refinement took " << rounds << " rounds and yielded " << partition.size() << " blocks.");
+        }
+        
         template<typename ModelType, typename BlockDataType>
         std::shared_ptr<ModelType> BisimulationDecomposition<ModelType, BlockDataType>::getQuotient() const {
             STORM_LOG_THROW(this->quotient != nullptr, storm::exceptions::IllegalFunctionCallException, "Unable to retrieve quotient model from bisimulation decomposition, because it was not built.");
             return this->quotient;
         }
+        
+        template<typename ModelType, typename BlockDataType>
+        storm::storage::bisimulation::QuotientView<typename BisimulationDecomposition<ModelType, BlockDataType>::ValueType> BisimulationDecomposition<ModelType, BlockDataType>::getQuotientView() const {
+            STORM_LOG_THROW(options.getType() == BisimulationType::Strong, storm::exceptions::IllegalFunctionCallException, "Unable to retrieve a view on the quotient of a weak bisimulation.");
+            STORM_LOG_THROW(this->size() > 0, storm::exceptions::IllegalFunctionCallException, "Unable to retrieve a view on the quotient before the bisimulation decomposition was computed.");
+            return storm::storage::bisimulation::QuotientView<ValueType>(model.getTransitionMatrix(), *this);
+        }
 
         template<typename ModelType, typename BlockDataType>
         void BisimulationDecomposition<ModelType, BlockDataType>::splitInitialPartitionBasedOnRewards() {
@@ -7,6 +7,7 @@
 #include "storm/storage/Decomposition.h"
 #include "storm/storage/StateBlock.h"
 #include "storm/storage/bisimulation/Partition.h"
+#include "storm/storage/bisimulation/QuotientView.h"
 #include "storm/storage/bisimulation/BisimulationType.h"
 #include "storm/solver/OptimizationDirection.h"
 
@@ -81,6 +82,16 @@ namespace storm {
                  */
                 void preserveFormula(storm::logic::Formula const& formula);
                 
+                /*!
+                 * Changes the options in a way that the probabilities of reaching the psi states while only visiting
+                 * phi states are preserved. This uses the measure-driven initial partition.
+                 *
+                 * @param phiStates The phi states.
+                 * @param psiStates The psi states.
+                 * @param optimizationDirection The direction of the preserved probabilities (only for nondeterministic models).
+                 */
+                void preserveUntilProbabilities(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, boost::optional<OptimizationDirection> const& optimizationDirection = boost::none);
+                
                 /**
                  * Sets the bisimulation type. If the bisimulation type is set to weak,
                  * we also change the bounded flag (as bounded properties are not preserved under
@@ -128,6 +139,11 @@ namespace storm {
                 /// A flag that governs whether the quotient model is actually built or only the decomposition is computed.
                 bool buildQuotient;
                 
+                /// A flag that governs whether the partition is refined in rounds based on the signatures of all states
+                /// (which are computed in parallel) rather than based on splitters. This is only supported for strong
+                /// bisimulation.
+                bool signatureBasedRefinement;
+                
             private:
                 boost::optional<OptimizationDirection> optimalityType;
                 
@@ -186,6 +202,16 @@ namespace storm {
              */
             std::shared_ptr<ModelType> getQuotient() const;
             
+            /*!
+             * Retrieves an implicit view on the quotient of the model under the computed bisimulation. In contrast to
+             * getQuotient(), this does not require the quotient model to be built (see Options::buildQuotient), so
+             * solvers can operate on the quotient without copying the transition matrix. The view refers to the
+             * transition matrix of the original model.
+             *
+             * @return The view on the quotient.
+             */
+            storm::storage::bisimulation::QuotientView<ValueType> getQuotientView() const;
+            
             /*!
              * Computes the decomposition of the model into bisimulation equivalence classes. If requested, a quotient
              * model is built.
@@ -209,6 +235,13 @@ namespace storm {
              */
             void performPartitionRefinement();
             
+            /*!
+             * Performs the partition refinement in rounds. In each round, the signature of every state, i.e. the
+             * (set of) distributions over the current blocks, is computed and all blocks are split such that the states
+             * of a block have equal signatures. The refinement stops once a round does not split any block.
+             */
+            void performSignatureBasedPartitionRefinement();
+            
             /*!
              * Refines the partition by considering the given splitter. All blocks that become potential splitters
              * because of this refinement, are marked as splitters and inserted into the splitter vector.
@@ -0,0 +1,121 @@
+#include "storm/storage/bisimulation/QuotientView.h"
+
+#include <algorithm>
+
+#include "storm/storage/SparseMatrix.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace storage {
+        namespace bisimulation {
+
+            template<typename ValueType>
+            QuotientView<ValueType>::QuotientView(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::Decomposition<storm::storage::StateBlock> const& decomposition) : transitionMatrix(transitionMatrix), stateToBlock(transitionMatrix.getRowGroupCount()), representatives(decomposition.size()), rowGroupIndices(decomposition.size() + 1, 0) {
+                std::vector<uint64_t> const& originalRowGroupIndices = transitionMatrix.getRowGroupIndices();
+                for (uint64_t block = 0; block < decomposition.size(); ++block) {
+                    STORM_LOG_ASSERT(!decomposition[block].empty(), "Expected non-empty block.");
+                    for (auto const& state : decomposition[block]) {
+                        stateToBlock[state] = block;
+                    }
+                    representatives[block] = *decomposition[block].begin();
+                    rowGroupIndices[block + 1] = rowGroupIndices[block] + originalRowGroupIndices[representatives[block] + 1] - originalRowGroupIndices[representatives[block]];
+                }
+            }
+
+            template<typename ValueType>
+            storm::storage::SparseMatrix<ValueType> const& QuotientView<ValueType>::getTransitionMatrix() const {
+                return transitionMatrix;
+            }
+
+            template<typename ValueType>
+            uint64_t QuotientView<ValueType>::getNumberOfBlocks() const {
+                return representatives.size();
+            }
+
+            template<typename ValueType>
+            uint64_t QuotientView<ValueType>::getNumberOfRows() const {
+                return rowGroupIndices.back();
+            }
+
+            template<typename ValueType>
+            std::vector<uint64_t> const& QuotientView<ValueType>::getRowGroupIndices() const {
+                return rowGroupIndices;
+            }
+
+            template<typename ValueType>
+            uint64_t QuotientView<ValueType>::getBlockIndex(storm::storage::sparse::state_type state) const {
+                return stateToBlock[state];
+            }
+
+            template<typename ValueType>
+            storm::storage::sparse::state_type QuotientView<ValueType>::getRepresentative(uint64_t block) const {
+                return representatives[block];
+            }
+
+            template<typename ValueType>
+            uint64_t QuotientView<ValueType>::getOriginalRow(uint64_t row) const {
+                // Find the block whose rows contain the given row.
+                uint64_t block = std::upper_bound(rowGroupIndices.begin(), rowGroupIndices.end(), row) - rowGroupIndices.begin() - 1;
+                return transitionMatrix.getRowGroupIndices()[representatives[block]] + row - rowGroupIndices[block];
+            }
+
+            template<typename ValueType>
+            void QuotientView<ValueType>::multiplyRow(uint64_t row, std::vector<ValueType> const& x, ValueType& value) const {
+                for (auto const& entry : transitionMatrix.getRow(getOriginalRow(row))) {
+                    value += entry.getValue() * x[stateToBlock[entry.getColumn()]];
+                }
+            }
+
+            template<typename ValueType>
+            std::vector<ValueType> QuotientView<ValueType>::projectStateVector(std::vector<ValueType> const& vector) const {
+                std::vector<ValueType> result;
+                result.reserve(representatives.size());
+                for (auto const& representative : representatives) {
+                    result.push_back(vector[representative]);
+                }
+                return result;
+            }
+
+            template<typename ValueType>
+            std::vector<ValueType> QuotientView<ValueType>::projectRowVector(std::vector<ValueType> const& vector) const {
+                std::vector<uint64_t> const& originalRowGroupIndices = transitionMatrix.getRowGroupIndices();
+                std::vector<ValueType> result;
+                result.reserve(getNumberOfRows());
+                for (auto const& representative : representatives) {
+                    result.insert(result.end(), vector.begin() + originalRowGroupIndices[representative], vector.begin() + originalRowGroupIndices[representative + 1]);
+                }
+                return result;
+            }
+
+            template<typename ValueType>
+            storm::storage::BitVector QuotientView<ValueType>::projectStates(storm::storage::BitVector const& states) const {
+                storm::storage::BitVector result(representatives.size());
+                for (uint64_t block = 0; block < representatives.size(); ++block) {
+                    result.set(block, states.get(representatives[block]));
+                }
+                return result;
+            }
+
+            template<typename ValueType>
+            std::vector<ValueType> QuotientView<ValueType>::liftStateVector(std::vector<ValueType> const& vector) const {
+                std::vector<ValueType> result;
+                result.reserve(stateToBlock.size());
+                for (auto const& block : stateToBlock) {
+                    result.push_back(vector[block]);
+                }
+                return result;
+            }
+
+            template class QuotientView<double>;
+
+#ifdef STORM_HAVE_CARL
+            template class QuotientView<storm::RationalNumber>;
+            template class QuotientView<storm::RationalFunction>;
+#endif
+        }
+    }
+}
@@ -0,0 +1,121 @@
+#ifndef STORM_STORAGE_BISIMULATION_QUOTIENTVIEW_H_
+#define STORM_STORAGE_BISIMULATION_QUOTIENTVIEW_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/Decomposition.h"
+#include "storm/storage/StateBlock.h"
+#include "storm/storage/sparse/StateType.h"
+
+namespace storm {
+    namespace storage {
+        template<typename ValueType>
+        class SparseMatrix;
+
+        namespace bisimulation {
+
+            /*!
+             * An implicit representation of the quotient of a model under a strong bisimulation. Instead of building the
+             * transition matrix of the quotient, it only stores the block of every state and a representative for every
+             * block. The rows of a block are the rows of its representative and the probabilities of moving to a block
+             * are aggregated when a row is multiplied with a vector over the blocks. Hence, no copy of the transition
+             * matrix (nor of the labeling or reward models) is needed.
+             *
+             * The view references the transition matrix of the original model, which therefore needs to outlive the view.
+             */
+            template<typename ValueType>
+            class QuotientView {
+            public:
+                /*!
+                 * Creates a view on the quotient of the model with the given transition matrix under the given
+                 * decomposition.
+                 *
+                 * @param transitionMatrix The transition matrix of the original model.
+                 * @param decomposition The decomposition into equivalence classes of a strong bisimulation.
+                 */
+                QuotientView(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::Decomposition<storm::storage::StateBlock> const& decomposition);
+
+                /*!
+                 * Retrieves the transition matrix of the original model.
+                 */
+                storm::storage::SparseMatrix<ValueType> const& getTransitionMatrix() const;
+
+                /*!
+                 * Retrieves the number of blocks, i.e. the number of states of the quotient.
+                 */
+                uint64_t getNumberOfBlocks() const;
+
+                /*!
+                 * Retrieves the number of rows (choices) of the quotient.
+                 */
+                uint64_t getNumberOfRows() const;
+
+                /*!
+                 * Retrieves the row group indices of the quotient.
+                 */
+                std::vector<uint64_t> const& getRowGroupIndices() const;
+
+                /*!
+                 * Retrieves the index of the block that contains the given state of the original model.
+                 */
+                uint64_t getBlockIndex(storm::storage::sparse::state_type state) const;
+
+                /*!
+                 * Retrieves the state of the original model that represents the given block.
+                 */
+                storm::storage::sparse::state_type getRepresentative(uint64_t block) const;
+
+                /*!
+                 * Retrieves the row of the original model that corresponds to the given row of the quotient.
+                 */
+                uint64_t getOriginalRow(uint64_t row) const;
+
+                /*!
+                 * Multiplies the given row of the quotient with the given vector over the blocks and adds the result to
+                 * the given value.
+                 */
+                void multiplyRow(uint64_t row, std::vector<ValueType> const& x, ValueType& value) const;
+
+                /*!
+                 * Restricts the given vector over the states of the original model to the representatives, which yields
+                 * a vector over the blocks. This is only meaningful for vectors that are constant within the blocks
+                 * (e.g. state rewards that were respected by the bisimulation).
+                 */
+                std::vector<ValueType> projectStateVector(std::vector<ValueType> const& vector) const;
+
+                /*!
+                 * Restricts the given vector over the rows of the original model to the rows of the representatives.
+                 */
+                std::vector<ValueType> projectRowVector(std::vector<ValueType> const& vector) const;
+
+                /*!
+                 * Retrieves the blocks whose representative is contained in the given set of states.
+                 */
+                storm::storage::BitVector projectStates(storm::storage::BitVector const& states) const;
+
+                /*!
+                 * Maps the given vector over the blocks back to the states of the original model.
+                 */
+                std::vector<ValueType> liftStateVector(std::vector<ValueType> const& vector) const;
+
+            private:
+                // The transition matrix of the original model.
+                storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
+
+                // The block of every state of the original model.
+                std::vector<uint64_t> stateToBlock;
+
+                // The representative of every block.
+                std::vector<storm::storage::sparse::state_type> representatives;
+
+                // The row group indices of the quotient.
+                std::vector<uint64_t> rowGroupIndices;
+            };
+
+        }
+    }
+}
+
+#endif /* STORM_STORAGE_BISIMULATION_QUOTIENTVIEW_H_ */
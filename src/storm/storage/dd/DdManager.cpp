@@ -485,6 +485,11 @@ namespace storm {
             internalDdManager.debugCheck();
         }
         
+        template<DdType LibraryType>
+        uint_fast64_t DdManager<LibraryType>::getPeakNumberOfNodes() const {
+            return internalDdManager.getPeakNumberOfNodes();
+        }
+        
         template class DdManager<DdType::CUDD>;
         
         template Add<DdType::CUDD, double> DdManager<DdType::CUDD>::getAddZero() const;
@@ -321,6 +321,14 @@ namespace storm {
              * Performs a debug check if available.
              */
             void debugCheck() const;
+            
+            /*!
+             * Retrieves the highest number of nodes that existed at the same time, including the ones that were not yet
+             * garbage collected. For sylvan, all managers share the same nodes.
+             *
+             * @return The peak number of nodes.
+             */
+            uint_fast64_t getPeakNumberOfNodes() const;
 
         private:
             /*!
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+
+#include "storm-config.h"
+
+namespace storm {
+    namespace dd {
+
+        // The minimal number of rows for which a DD is converted to a matrix concurrently.
+        uint_fast64_t const MINIMAL_NUMBER_OF_ROWS_FOR_CONCURRENT_CONVERSION = 1ull << 14;
+
+        // The maximal number of levels that are descended before the conversion is split into independent parts.
+        uint_fast64_t const MAXIMAL_NUMBER_OF_CONCURRENT_CONVERSION_LEVELS = 8;
+
+        /*!
+         * Determines the number of (row and column) levels of a DD that are descended before its conversion to a
+         * matrix is split into parts that cover disjoint sets of rows and can therefore be processed concurrently.
+         * The values of the leaves are only copied concurrently if they are plain numbers, as copying the values of
+         * other types (e.g. reference-counted rational numbers) is not thread-safe.
+         *
+         * @param numberOfRows The number of rows of the resulting matrix.
+         * @param numberOfRowVariables The number of DD row variables.
+         * @return The number of levels or zero if the conversion is to be done sequentially.
+         */
+        template<typename ValueType>
+        uint_fast64_t getNumberOfConcurrentConversionLevels(uint_fast64_t numberOfRows, uint_fast64_t numberOfRowVariables) {
+#ifdef STORM_HAVE_INTELTBB
+            if (!std::is_arithmetic<ValueType>::value || numberOfRows < MINIMAL_NUMBER_OF_ROWS_FOR_CONCURRENT_CONVERSION) {
+                return 0;
+            }
+
+            // Aim for several parts per thread, as the parts can differ significantly in size.
+            uint_fast64_t numberOfParts = 8 * std::max(1u, std::thread::hardware_concurrency());
+            uint_fast64_t numberOfLevels = 0;
+            while ((1ull << numberOfLevels) < numberOfParts && numberOfLevels < MAXIMAL_NUMBER_OF_CONCURRENT_CONVERSION_LEVELS) {
+                ++numberOfLevels;
+            }
+            return std::min(numberOfLevels, numberOfRowVariables);
+#else
+            return 0;
+#endif
+        }
+
+    }
+}
@@ -4,10 +4,12 @@
 #include "storm/storage/dd/cudd/InternalCuddBdd.h"
 #include "storm/storage/dd/cudd/CuddAddIterator.h"
 #include "storm/storage/dd/Odd.h"
+#include "storm/storage/dd/MatrixConversion.h"
 
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/BitVector.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/NotImplementedException.h"
@@ -690,7 +692,75 @@ namespace storm {
         
         template<typename ValueType>
         void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-            return toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+            uint_fast64_t maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+            uint_fast64_t splitLevel = getNumberOfConcurrentConversionLevels<ValueType>(rowOdd.getTotalOffset(), std::min(ddRowVariableIndices.size(), ddColumnVariableIndices.size()));
+#ifdef STORM_HAVE_INTELTBB
+            if (splitLevel > 0) {
+                // Parts of different groups write to disjoint rows (and thereby to disjoint ranges of the entries), so
+                // the groups can be processed concurrently. Within a group, the parts are processed in the order of
+                // the sequential conversion, which keeps the entries of each row sorted by column.
+                std::vector<std::vector<MatrixComponentsTask>> tasks(1ull << splitLevel);
+                collectMatrixComponentsTasks(this->getCuddDdNode(), rowOdd, columnOdd, 0, splitLevel, 0, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, tasks);
+                tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, tasks.size(), 1), [&] (tbb::blocked_range<uint_fast64_t> const& range) {
+                    for (uint_fast64_t rowEncoding = range.begin(); rowEncoding < range.end(); ++rowEncoding) {
+                        for (auto const& task : tasks[rowEncoding]) {
+                            toMatrixComponentsRec(task.dd, rowGroupIndices, rowIndications, columnsAndValues, *task.rowOdd, *task.columnOdd, splitLevel, splitLevel, maxLevel, task.rowOffset, task.columnOffset, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+                        }
+                    }
+                });
+                return;
+            }
+#endif
+            toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, maxLevel, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+        }
+
+        template<typename ValueType>
+        void InternalAdd<DdType::CUDD, ValueType>::getMatrixSuccessors(DdNode const* dd, uint_fast64_t currentLevel, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, DdNode const*& elseElse, DdNode const*& elseThen, DdNode const*& thenElse, DdNode const*& thenThen) {
+            if (ddColumnVariableIndices[currentLevel] < Cudd_NodeReadIndex(dd)) {
+                elseElse = elseThen = thenElse = thenThen = dd;
+            } else if (ddRowVariableIndices[currentLevel] < Cudd_NodeReadIndex(dd)) {
+                elseElse = thenElse = Cudd_E_const(dd);
+                elseThen = thenThen = Cudd_T_const(dd);
+            } else {
+                DdNode const* elseNode = Cudd_E_const(dd);
+                if (ddColumnVariableIndices[currentLevel] < Cudd_NodeReadIndex(elseNode)) {
+                    elseElse = elseThen = elseNode;
+                } else {
+                    elseElse = Cudd_E_const(elseNode);
+                    elseThen = Cudd_T_const(elseNode);
+                }
+
+                DdNode const* thenNode = Cudd_T_const(dd);
+                if (ddColumnVariableIndices[currentLevel] < Cudd_NodeReadIndex(thenNode)) {
+                    thenElse = thenThen = thenNode;
+                } else {
+                    thenElse = Cudd_E_const(thenNode);
+                    thenThen = Cudd_T_const(thenNode);
+                }
+            }
+        }
+
+        template<typename ValueType>
+        void InternalAdd<DdType::CUDD, ValueType>::collectMatrixComponentsTasks(DdNode const* dd, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentLevel, uint_fast64_t splitLevel, uint_fast64_t rowEncoding, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, std::vector<std::vector<MatrixComponentsTask>>& tasks) const {
+            // Parts without entries or rows do not need to be considered.
+            if (dd == Cudd_ReadZero(ddManager->getCuddManager().getManager()) || rowOdd.getTotalOffset() == 0) {
+                return;
+            }
+
+            if (currentLevel == splitLevel) {
+                tasks[rowEncoding].push_back(MatrixComponentsTask({dd, &rowOdd, &columnOdd, currentRowOffset, currentColumnOffset}));
+            } else {
+                DdNode const* elseElse;
+                DdNode const* elseThen;
+                DdNode const* thenElse;
+                DdNode const* thenThen;
+                getMatrixSuccessors(dd, currentLevel, ddRowVariableIndices, ddColumnVariableIndices, elseElse, elseThen, thenElse, thenThen);
+
+                collectMatrixComponentsTasks(elseElse, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentLevel + 1, splitLevel, rowEncoding << 1, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, tasks);
+                collectMatrixComponentsTasks(elseThen, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentLevel + 1, splitLevel, rowEncoding << 1, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, tasks);
+                collectMatrixComponentsTasks(thenElse, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentLevel + 1, splitLevel, (rowEncoding << 1) | 1, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, tasks);
+                collectMatrixComponentsTasks(thenThen, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentLevel + 1, splitLevel, (rowEncoding << 1) | 1, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, tasks);
+            }
         }
 
         template<typename ValueType>
@@ -711,29 +781,7 @@ namespace storm {
                 DdNode const* elseThen;
                 DdNode const* thenElse;
                 DdNode const* thenThen;
-                
-                if (ddColumnVariableIndices[currentColumnLevel] < Cudd_NodeReadIndex(dd)) {
-                    elseElse = elseThen = thenElse = thenThen = dd;
-                } else if (ddRowVariableIndices[currentColumnLevel] < Cudd_NodeReadIndex(dd)) {
-                    elseElse = thenElse = Cudd_E_const(dd);
-                    elseThen = thenThen = Cudd_T_const(dd);
-                } else {
-                    DdNode const* elseNode = Cudd_E_const(dd);
-                    if (ddColumnVariableIndices[currentColumnLevel] < Cudd_NodeReadIndex(elseNode)) {
-                        elseElse = elseThen = elseNode;
-                    } else {
-                        elseElse = Cudd_E_const(elseNode);
-                        elseThen = Cudd_T_const(elseNode);
-                    }
-                    
-                    DdNode const* thenNode = Cudd_T_const(dd);
-                    if (ddColumnVariableIndices[currentColumnLevel] < Cudd_NodeReadIndex(thenNode)) {
-                        thenElse = thenThen = thenNode;
-                    } else {
-                        thenElse = Cudd_E_const(thenNode);
-                        thenThen = Cudd_T_const(thenNode);
-                    }
-                }
+                getMatrixSuccessors(dd, currentColumnLevel, ddRowVariableIndices, ddColumnVariableIndices, elseElse, elseThen, thenElse, thenThen);
                 
                 // Visit else-else.
                 toMatrixComponentsRec(elseElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
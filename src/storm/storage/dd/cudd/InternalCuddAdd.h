@@ -765,7 +765,30 @@ namespace storm {
              * this flag needs to be false.
              */
             void toMatrixComponentsRec(DdNode const* dd, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const;
-            
+
+            /*!
+             * Retrieves the successors of the given node when fixing the row and the column variable of the given level.
+             */
+            static void getMatrixSuccessors(DdNode const* dd, uint_fast64_t currentLevel, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, DdNode const*& elseElse, DdNode const*& elseThen, DdNode const*& thenElse, DdNode const*& thenThen);
+
+            // A part of the conversion to a matrix, i.e. the arguments of a call to toMatrixComponentsRec.
+            struct MatrixComponentsTask {
+                DdNode const* dd;
+                Odd const* rowOdd;
+                Odd const* columnOdd;
+                uint_fast64_t rowOffset;
+                uint_fast64_t columnOffset;
+            };
+
+            /*!
+             * Descends the given number of levels of the DD (in the same order as toMatrixComponentsRec) and collects
+             * the remaining parts of the conversion. The parts are grouped by the encoding of the row variables of the
+             * descended levels, so parts of different groups cover disjoint sets of rows.
+             *
+             * @param tasks The groups of parts, one group for each encoding of the descended row variables.
+             */
+            void collectMatrixComponentsTasks(DdNode const* dd, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentLevel, uint_fast64_t splitLevel, uint_fast64_t rowEncoding, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, std::vector<std::vector<MatrixComponentsTask>>& tasks) const;
+
             /*!
              * Builds an ADD representing the given vector.
              *
@@ -168,6 +168,10 @@ namespace storm {
         uint_fast64_t InternalDdManager<DdType::CUDD>::getNumberOfDdVariables() const {
             return numberOfDdVariables;
         }
+        
+        uint_fast64_t InternalDdManager<DdType::CUDD>::getPeakNumberOfNodes() const {
+            return static_cast<uint_fast64_t>(this->getCuddManager().ReadPeakNodeCount());
+        }
 
         template InternalAdd<DdType::CUDD, double> InternalDdManager<DdType::CUDD>::getAddOne() const;
         template InternalAdd<DdType::CUDD, uint_fast64_t> InternalDdManager<DdType::CUDD>::getAddOne() const;
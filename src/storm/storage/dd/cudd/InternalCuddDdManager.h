@@ -137,6 +137,14 @@ namespace storm {
              * @return The number of managed variables.
              */
             uint_fast64_t getNumberOfDdVariables() const;
+            
+            /*!
+             * Retrieves the highest number of nodes that existed at the same time, including the ones that were not yet
+             * garbage collected.
+             *
+             * @return The peak number of nodes.
+             */
+            uint_fast64_t getPeakNumberOfNodes() const;
 
             /*!
              * Retrieves the underlying CUDD manager.
@@ -3,10 +3,12 @@
 #include "storm/storage/dd/sylvan/SylvanAddIterator.h"
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 #include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/MatrixConversion.h"
 
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/BitVector.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/constants.h"
 #include "storm/exceptions/NotImplementedException.h"
@@ -1135,7 +1137,76 @@ namespace storm {
 
         template<typename ValueType>
         void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-            return toMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+            MTBDD dd = this->getSylvanMtbdd().GetMTBDD();
+            uint_fast64_t maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+            uint_fast64_t splitLevel = getNumberOfConcurrentConversionLevels<ValueType>(rowOdd.getTotalOffset(), std::min(ddRowVariableIndices.size(), ddColumnVariableIndices.size()));
+#ifdef STORM_HAVE_INTELTBB
+            if (splitLevel > 0) {
+                // Parts of different groups write to disjoint rows (and thereby to disjoint ranges of the entries), so
+                // the groups can be processed concurrently. Within a group, the parts are processed in the order of
+                // the sequential conversion, which keeps the entries of each row sorted by column.
+                std::vector<std::vector<MatrixComponentsTask>> tasks(1ull << splitLevel);
+                collectMatrixComponentsTasks(mtbdd_regular(dd), mtbdd_hascomp(dd), rowOdd, columnOdd, 0, splitLevel, 0, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, tasks);
+                tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, tasks.size(), 1), [&] (tbb::blocked_range<uint_fast64_t> const& range) {
+                    for (uint_fast64_t rowEncoding = range.begin(); rowEncoding < range.end(); ++rowEncoding) {
+                        for (auto const& task : tasks[rowEncoding]) {
+                            toMatrixComponentsRec(task.dd, task.negated, rowGroupIndices, rowIndications, columnsAndValues, *task.rowOdd, *task.columnOdd, splitLevel, splitLevel, maxLevel, task.rowOffset, task.columnOffset, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+                        }
+                    }
+                });
+                return;
+            }
+#endif
+            toMatrixComponentsRec(mtbdd_regular(dd), mtbdd_hascomp(dd), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, maxLevel, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+        }
+
+        template<typename ValueType>
+        void InternalAdd<DdType::Sylvan, ValueType>::getMatrixSuccessors(MTBDD dd, uint_fast64_t currentLevel, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, MTBDD& elseElse, MTBDD& elseThen, MTBDD& thenElse, MTBDD& thenThen) {
+            if (mtbdd_isleaf(dd) || ddColumnVariableIndices[currentLevel] < mtbdd_getvar(dd)) {
+                elseElse = elseThen = thenElse = thenThen = dd;
+            } else if (ddRowVariableIndices[currentLevel] < mtbdd_getvar(dd)) {
+                elseElse = thenElse = mtbdd_getlow(dd);
+                elseThen = thenThen = mtbdd_gethigh(dd);
+            } else {
+                MTBDD elseNode = mtbdd_getlow(dd);
+                if (mtbdd_isleaf(elseNode) || ddColumnVariableIndices[currentLevel] < mtbdd_getvar(elseNode)) {
+                    elseElse = elseThen = elseNode;
+                } else {
+                    elseElse = mtbdd_getlow(elseNode);
+                    elseThen = mtbdd_gethigh(elseNode);
+                }
+
+                MTBDD thenNode = mtbdd_gethigh(dd);
+                if (mtbdd_isleaf(thenNode) || ddColumnVariableIndices[currentLevel] < mtbdd_getvar(thenNode)) {
+                    thenElse = thenThen = thenNode;
+                } else {
+                    thenElse = mtbdd_getlow(thenNode);
+                    thenThen = mtbdd_gethigh(thenNode);
+                }
+            }
+        }
+
+        template<typename ValueType>
+        void InternalAdd<DdType::Sylvan, ValueType>::collectMatrixComponentsTasks(MTBDD dd, bool negated, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentLevel, uint_fast64_t splitLevel, uint_fast64_t rowEncoding, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, std::vector<std::vector<MatrixComponentsTask>>& tasks) const {
+            // Parts without entries or rows do not need to be considered.
+            if ((mtbdd_isleaf(dd) && mtbdd_iszero(dd)) || rowOdd.getTotalOffset() == 0) {
+                return;
+            }
+
+            if (currentLevel == splitLevel) {
+                tasks[rowEncoding].push_back(MatrixComponentsTask({dd, negated, &rowOdd, &columnOdd, currentRowOffset, currentColumnOffset}));
+            } else {
+                MTBDD elseElse;
+                MTBDD elseThen;
+                MTBDD thenElse;
+                MTBDD thenThen;
+                getMatrixSuccessors(dd, currentLevel, ddRowVariableIndices, ddColumnVariableIndices, elseElse, elseThen, thenElse, thenThen);
+
+                collectMatrixComponentsTasks(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentLevel + 1, splitLevel, rowEncoding << 1, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, tasks);
+                collectMatrixComponentsTasks(mtbdd_regular(elseThen), mtbdd_hascomp(elseThen) ^ negated, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentLevel + 1, splitLevel, rowEncoding << 1, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, tasks);
+                collectMatrixComponentsTasks(mtbdd_regular(thenElse), mtbdd_hascomp(thenElse) ^ negated, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentLevel + 1, splitLevel, (rowEncoding << 1) | 1, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, tasks);
+                collectMatrixComponentsTasks(mtbdd_regular(thenThen), mtbdd_hascomp(thenThen) ^ negated, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentLevel + 1, splitLevel, (rowEncoding << 1) | 1, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, tasks);
+            }
         }
 
         template<typename ValueType>
@@ -1156,29 +1227,7 @@ namespace storm {
                 MTBDD elseThen;
                 MTBDD thenElse;
                 MTBDD thenThen;
-
-                if (mtbdd_isleaf(dd) || ddColumnVariableIndices[currentColumnLevel] < mtbdd_getvar(dd)) {
-                    elseElse = elseThen = thenElse = thenThen = dd;
-                } else if (ddRowVariableIndices[currentColumnLevel] < mtbdd_getvar(dd)) {
-                    elseElse = thenElse = mtbdd_getlow(dd);
-                    elseThen = thenThen = mtbdd_gethigh(dd);
-                } else {
-                    MTBDD elseNode = mtbdd_getlow(dd);
-                    if (mtbdd_isleaf(elseNode) || ddColumnVariableIndices[currentColumnLevel] < mtbdd_getvar(elseNode)) {
-                        elseElse = elseThen = elseNode;
-                    } else {
-                        elseElse = mtbdd_getlow(elseNode);
-                        elseThen = mtbdd_gethigh(elseNode);
-                    }
-
-                    MTBDD thenNode = mtbdd_gethigh(dd);
-                    if (mtbdd_isleaf(thenNode) || ddColumnVariableIndices[currentColumnLevel] < mtbdd_getvar(thenNode)) {
-                        thenElse = thenThen = thenNode;
-                    } else {
-                        thenElse = mtbdd_getlow(thenNode);
-                        thenThen = mtbdd_gethigh(thenNode);
-                    }
-                }
+                getMatrixSuccessors(dd, currentColumnLevel, ddRowVariableIndices, ddColumnVariableIndices, elseElse, elseThen, thenElse, thenThen);
 
                 // Visit else-else.
                 toMatrixComponentsRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
@@ -1,5 +1,6 @@
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 
@@ -37,6 +38,27 @@ namespace storm {
 #pragma clang diagnostic pop
 #endif
         
+#endif
+        
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wzero-length-array"
+#pragma clang diagnostic ignored "-Wc99-extensions"
+#endif
+        
+        // The highest number of nodes in the unique table that was observed before a garbage collection since the last
+        // manager was created. As nodes are only freed by garbage collections, the number of nodes is maximal right
+        // before them.
+        uint_fast64_t peakNumberOfNodesBeforeGarbageCollection = 0;
+        
+        VOID_TASK_0(record_number_of_nodes) {
+            size_t filled;
+            sylvan_table_usage(&filled, NULL);
+            peakNumberOfNodesBeforeGarbageCollection = std::max(peakNumberOfNodesBeforeGarbageCollection, static_cast<uint_fast64_t>(filled));
+        }
+        
+#if defined(__clang__)
+#pragma clang diagnostic pop
 #endif
         
         uint_fast64_t InternalDdManager<DdType::Sylvan>::numberOfInstances = 0;
@@ -103,12 +125,18 @@ namespace storm {
                 sylvan::Sylvan::initMtbdd();
                 sylvan::Sylvan::initCustomMtbdd();
                 
+                sylvan_gc_hook_pregc(TASK(record_number_of_nodes));
+                
 #ifndef NDEBUG
                 sylvan_gc_hook_pregc(TASK(gc_start));
                 sylvan_gc_hook_postgc(TASK(gc_end));
 #endif
 
             }
+            
+            // All managers share the unique table of sylvan, so the peak is reported relative to the creation of the
+            // most recent manager, which is created anew for every symbolic model that is built.
+            peakNumberOfNodesBeforeGarbageCollection = 0;
             ++numberOfInstances;
         }
         
@@ -263,6 +291,13 @@ namespace storm {
             return nextFreeVariableIndex;
         }
         
+        uint_fast64_t InternalDdManager<DdType::Sylvan>::getPeakNumberOfNodes() const {
+            LACE_ME;
+            size_t filled;
+            sylvan_table_usage(&filled, NULL);
+            return std::max(peakNumberOfNodesBeforeGarbageCollection, static_cast<uint_fast64_t>(filled));
+        }
+        
         template InternalAdd<DdType::Sylvan, double> InternalDdManager<DdType::Sylvan>::getAddUndefined() const;
         template InternalAdd<DdType::Sylvan, uint_fast64_t> InternalDdManager<DdType::Sylvan>::getAddUndefined() const;
         
@@ -139,6 +139,14 @@ namespace storm {
              */
             uint_fast64_t getNumberOfDdVariables() const;
             
+            /*!
+             * Retrieves the highest number of nodes that existed at the same time since the most recent manager was
+             * created, including the ones that were not yet garbage collected.
+             *
+             * @return The peak number of nodes.
+             */
+            uint_fast64_t getPeakNumberOfNodes() const;
+            
         private:
             // Helper function to create the BDD whose encodings are below a given bound.
             BDD getBddEncodingLessOrEqualThanRec(uint64_t minimalValue, uint64_t maximalValue, uint64_t bound, BDD cube, uint64_t remainingDdVariables) const;
@@ -38,7 +38,7 @@ namespace storm {
         template<storm::dd::DdType Type, typename ValueType>
         std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> SymbolicDtmcToSparseDtmcTransformer<Type, ValueType>::translate(storm::models::symbolic::Dtmc<Type, ValueType> const& symbolicDtmc, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
             
-            this->odd = symbolicDtmc.getReachableStates().createOdd();
+            this->odd = symbolicDtmc.getReachableStatesOdd();
             storm::storage::SparseMatrix<ValueType> transitionMatrix = symbolicDtmc.getTransitionMatrix().toMatrix(this->odd, this->odd);
             std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> rewardModels;
             for (auto const& rewardModelNameAndModel : symbolicDtmc.getRewardModels()) {
@@ -83,7 +83,7 @@ namespace storm {
         
         template<storm::dd::DdType Type, typename ValueType>
         std::shared_ptr<storm::models::sparse::Mdp<ValueType>> SymbolicMdpToSparseMdpTransformer<Type, ValueType>::translate(storm::models::symbolic::Mdp<Type, ValueType> const& symbolicMdp, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
-            storm::dd::Odd odd = symbolicMdp.getReachableStates().createOdd();
+            storm::dd::Odd odd = symbolicMdp.getReachableStatesOdd();
             
             // Collect action reward vectors that need translation
             std::vector<storm::dd::Add<Type, ValueType>> symbolicActionRewardVectors;
@@ -145,7 +145,7 @@ namespace storm {
 
         template<storm::dd::DdType Type, typename ValueType>
         std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> SymbolicCtmcToSparseCtmcTransformer<Type, ValueType>::translate(storm::models::symbolic::Ctmc<Type, ValueType> const& symbolicCtmc, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
-            storm::dd::Odd odd = symbolicCtmc.getReachableStates().createOdd();
+            storm::dd::Odd odd = symbolicCtmc.getReachableStatesOdd();
             storm::storage::SparseMatrix<ValueType> transitionMatrix = symbolicCtmc.getTransitionMatrix().toMatrix(odd, odd);
             std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> rewardModels;
             for (auto const& rewardModelNameAndModel : symbolicCtmc.getRewardModels()) {
@@ -187,7 +187,7 @@ namespace storm {
         
         template<storm::dd::DdType Type, typename ValueType>
         std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> SymbolicMaToSparseMaTransformer<Type, ValueType>::translate(storm::models::symbolic::MarkovAutomaton<Type, ValueType> const& symbolicMa, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
-            storm::dd::Odd odd = symbolicMa.getReachableStates().createOdd();
+            storm::dd::Odd odd = symbolicMa.getReachableStatesOdd();
             // Collect action reward vectors that need translation
             std::vector<storm::dd::Add<Type, ValueType>> symbolicActionRewardVectors;
             std::map<std::string, uint64_t> rewardNameToActionRewardIndexMap;
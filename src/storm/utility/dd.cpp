@@ -1,5 +1,7 @@
 #include "storm/utility/dd.h"
 
+#include <algorithm>
+
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
@@ -45,6 +47,84 @@ namespace storm {
                 return {reachableStates, iteration};
             }
             
+            template <storm::dd::DdType Type>
+            std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<Type> const& initialStates, std::vector<storm::dd::Bdd<Type>> const& transitionPartitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs) {
+                STORM_LOG_TRACE("Computing reachable states using " << transitionPartitions.size() << " partition(s) of the transition relation, " << initialStates.getNonZeroCount() << " initial states).");
+
+                auto start = std::chrono::high_resolution_clock::now();
+                storm::dd::DdManager<Type>& manager = initialStates.getDdManager();
+
+                // Determine the topmost level of a variable that is changed by each partition. Partitions that do not
+                // change any variable cannot discover new states and are dropped.
+                std::vector<std::pair<uint64_t, storm::dd::Bdd<Type>>> levelAndNonIdentity;
+                for (auto const& variablePair : rowColumnMetaVariablePairs) {
+                    uint64_t level = std::min(manager.getCube(variablePair.first).getLevel(), manager.getCube(variablePair.second).getLevel());
+                    levelAndNonIdentity.emplace_back(level, !manager.getIdentity(variablePair.first, variablePair.second, false));
+                }
+
+                std::vector<std::pair<uint64_t, storm::dd::Bdd<Type>>> levelAndPartition;
+                for (auto const& partition : transitionPartitions) {
+                    bool changesVariable = false;
+                    uint64_t topLevel = 0;
+                    for (auto const& variable : levelAndNonIdentity) {
+                        if (!(partition && variable.second).isZero()) {
+                            topLevel = changesVariable ? std::min(topLevel, variable.first) : variable.first;
+                            changesVariable = true;
+                        }
+                    }
+                    if (changesVariable) {
+                        levelAndPartition.emplace_back(topLevel, partition);
+                    }
+                }
+
+                // Apply the partitions changing the lowest variables first.
+                std::stable_sort(levelAndPartition.begin(), levelAndPartition.end(), [] (std::pair<uint64_t, storm::dd::Bdd<Type>> const& a, std::pair<uint64_t, storm::dd::Bdd<Type>> const& b) { return a.first > b.first; });
+
+                storm::dd::Bdd<Type> reachableStates = initialStates;
+
+                // For each partition, the states under which the reachable states were closed when it was last applied.
+                // Only the remaining states need to be considered when the partition is applied again.
+                std::vector<storm::dd::Bdd<Type>> closedStates(levelAndPartition.size(), manager.getBddZero());
+
+                uint64_t iteration = 0;
+                uint64_t index = 0;
+                while (index < levelAndPartition.size()) {
+                    storm::dd::Bdd<Type> const& partition = levelAndPartition[index].second;
+                    storm::dd::Bdd<Type> frontier = reachableStates && !closedStates[index];
+
+                    bool changed = false;
+                    while (!frontier.isZero()) {
+                        frontier = frontier.relationalProduct(partition, rowMetaVariables, columnMetaVariables) && !reachableStates;
+                        reachableStates |= frontier;
+                        changed |= !frontier.isZero();
+                        ++iteration;
+                    }
+                    closedStates[index] = reachableStates;
+
+                    STORM_LOG_TRACE("Partition " << index << " of reachability computation is saturated after " << iteration << " images: " << reachableStates.getNonZeroCount() << " reachable states found.");
+
+                    // If new states were found, the partitions before this one need to be applied to them.
+                    index = (changed && index > 0) ? 0 : index + 1;
+                }
+
+                auto end = std::chrono::high_resolution_clock::now();
+                STORM_LOG_TRACE("Partitioned reachability computation completed with " << iteration << " images (" << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms).");
+
+                return {reachableStates, iteration};
+            }
+
+            template <storm::dd::DdType Type>
+            std::vector<storm::dd::Bdd<Type>> splitTransitionsByChangedVariables(storm::dd::Bdd<Type> const& transitions, std::vector<storm::dd::Bdd<Type>> const& groupIdentities) {
+                std::vector<storm::dd::Bdd<Type>> result;
+                storm::dd::Bdd<Type> unchangedGroups = transitions;
+                for (auto const& identity : groupIdentities) {
+                    result.push_back(transitions && !identity);
+                    unchangedGroups &= identity;
+                }
+                result.push_back(unchangedGroups);
+                return result;
+            }
+
             template <storm::dd::DdType Type>
             storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& constraintStates, storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables) {
                 STORM_LOG_TRACE("Computing backwards reachable states: transition matrix BDD has " << transitions.getNodeCount() << " node(s) and " << transitions.getNonZeroCount() << " non-zero(s), " << initialStates.getNonZeroCount() << " initial states).");
@@ -85,6 +165,12 @@ namespace storm {
             template std::pair<storm::dd::Bdd<storm::dd::DdType::CUDD>,uint64_t> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates, storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
             template std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, uint64_t> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+            template std::pair<storm::dd::Bdd<storm::dd::DdType::CUDD>, uint64_t> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates, std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> const& transitionPartitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+            template std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, uint64_t> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> const& transitionPartitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+
+            template std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> splitTransitionsByChangedVariables(storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions, std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> const& groupIdentities);
+            template std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> splitTransitionsByChangedVariables(storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions, std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> const& groupIdentities);
+
             template storm::dd::Bdd<storm::dd::DdType::CUDD> computeBackwardsReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates, storm::dd::Bdd<storm::dd::DdType::CUDD> const& constraintStates, storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
             template storm::dd::Bdd<storm::dd::DdType::Sylvan> computeBackwardsReachableStates(storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& constraintStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
             
@@ -27,6 +27,32 @@ namespace storm {
             template <storm::dd::DdType Type>
             std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+            /*!
+             * Computes the states reachable from the initial states, where the transition relation is given as a set
+             * of partitions (e.g. one per action) whose union is the full relation. Instead of computing the image
+             * wrt. the full relation in a breadth-first manner, the partitions are applied in a saturation-like
+             * chaining order: partitions that only change variables close to the bottom of the variable order are
+             * applied first and each partition is applied until the reachable states are closed under it. Whenever a
+             * partition discovers new states, the search is resumed with the first partition. This typically needs
+             * far fewer and smaller intermediate results than the breadth-first search for asynchronous systems.
+             *
+             * @param rowColumnMetaVariablePairs The pairs of row and column meta variables that are used to determine
+             * which variables a partition may change.
+             * @return The reachable states and the number of images that were computed.
+             */
+            template <storm::dd::DdType Type>
+            std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<Type> const& initialStates, std::vector<storm::dd::Bdd<Type>> const& transitionPartitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+
+            /*!
+             * Splits the given transitions into partitions for the reachability computation: one per group of variables
+             * (e.g. the variables of a module) containing the transitions that change a variable of the group and one
+             * containing the transitions that change none of them.
+             *
+             * @param groupIdentities For each group, the identity of its row and column variables.
+             */
+            template <storm::dd::DdType Type>
+            std::vector<storm::dd::Bdd<Type>> splitTransitionsByChangedVariables(storm::dd::Bdd<Type> const& transitions, std::vector<storm::dd::Bdd<Type>> const& groupIdentities);
+
             template <storm::dd::DdType Type>
             storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& constraintStates, storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
 
@@ -1,5 +1,7 @@
 #include "storm/utility/stateelimination.h"
 
+#include <algorithm>
+#include <limits>
 #include <random>
 
 #include "storm/solver/stateelimination/StatePriorityQueue.h"
@@ -41,7 +43,9 @@ namespace storm {
             bool eliminationOrderIsPenaltyBased(storm::settings::modules::EliminationSettings::EliminationOrder const& order) {
                 return order == storm::settings::modules::EliminationSettings::EliminationOrder::StaticPenalty ||
                 order == storm::settings::modules::EliminationSettings::EliminationOrder::DynamicPenalty ||
-                order == storm::settings::modules::EliminationSettings::EliminationOrder::RegularExpression;
+                order == storm::settings::modules::EliminationSettings::EliminationOrder::RegularExpression ||
+                order == storm::settings::modules::EliminationSettings::EliminationOrder::MinimumDegree ||
+                order == storm::settings::modules::EliminationSettings::EliminationOrder::Markowitz;
             }
             
             bool eliminationOrderIsStatic(storm::settings::modules::EliminationSettings::EliminationOrder const& order) {
@@ -96,12 +100,238 @@ namespace storm {
             }
             
             template<typename ValueType>
-            std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities, storm::storage::BitVector const& states) {
+            uint_fast64_t computeStatePenaltyMinimumDegree(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const&) {
+                uint_fast64_t degree = 0;
+                for (auto const& predecessor : backwardTransitions.getRow(state)) {
+                    if (predecessor.getColumn() != state && !storm::utility::isZero(predecessor.getValue())) {
+                        ++degree;
+                    }
+                }
+                for (auto const& successor : transitionMatrix.getRow(state)) {
+                    if (successor.getColumn() != state && !storm::utility::isZero(successor.getValue())) {
+                        ++degree;
+                    }
+                }
+                return degree;
+            }
+            
+            template<typename ValueType>
+            uint_fast64_t computeStatePenaltyMarkowitz(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities) {
+                uint_fast64_t numberOfPredecessors = 0;
+                for (auto const& predecessor : backwardTransitions.getRow(state)) {
+                    if (predecessor.getColumn() != state && !storm::utility::isZero(predecessor.getValue())) {
+                        ++numberOfPredecessors;
+                    }
+                }
+                uint_fast64_t numberOfSuccessors = storm::utility::isZero(oneStepProbabilities[state]) ? 0 : 1;
+                for (auto const& successor : transitionMatrix.getRow(state)) {
+                    if (successor.getColumn() != state && !storm::utility::isZero(successor.getValue())) {
+                        ++numberOfSuccessors;
+                    }
+                }
+                return numberOfPredecessors * numberOfSuccessors;
+            }
+            
+            namespace {
+                // Parts with at most this many states are not dissected any further.
+                static const uint64_t minimalDissectionSize = 16;
                 
-                STORM_LOG_TRACE("Creating state priority queue for states " << states);
+                template<typename ValueType>
+                class NestedDissection {
+                public:
+                    NestedDissection(storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions) : transitionMatrix(transitionMatrix), backwardTransitions(backwardTransitions), partOfState(transitionMatrix.getRowCount(), 0), visited(transitionMatrix.getRowCount(), 0), level(transitionMatrix.getRowCount(), 0), currentPart(0), currentVisit(0) {
+                        // Intentionally left empty.
+                    }
+                    
+                    // Appends the states of the given part (which needs to be connected) to the order such that the
+                    // separators come after the parts they separate.
+                    void dissect(std::vector<storm::storage::sparse::state_type> const& part, std::vector<storm::storage::sparse::state_type>& order) {
+                        if (part.size() <= minimalDissectionSize) {
+                            appendByDegree(part, order);
+                            return;
+                        }
+                        uint64_t partIndex = markPart(part);
+                        
+                        // Start the level structure from a pseudo-peripheral state to obtain many small levels.
+                        std::vector<storm::storage::sparse::state_type> bfsOrder = breadthFirstSearch(part.front(), partIndex);
+                        bfsOrder = breadthFirstSearch(bfsOrder.back(), partIndex);
+                        uint64_t numberOfLevels = level[bfsOrder.back()] + 1;
+                        if (numberOfLevels < 3) {
+                            appendByDegree(part, order);
+                            return;
+                        }
+                        
+                        // Choose the level that splits the part into halves (but is neither the first nor the last level).
+                        // The states are ordered by their levels, so the level of the median state is the one we need.
+                        uint64_t separatorLevel = level[bfsOrder[bfsOrder.size() / 2]];
+                        separatorLevel = std::min(std::max<uint64_t>(separatorLevel, 1), numberOfLevels - 2);
+                        
+                        std::vector<storm::storage::sparse::state_type> separator;
+                        std::vector<storm::storage::sparse::state_type> rest;
+                        for (auto const& state : bfsOrder) {
+                            if (level[state] == separatorLevel) {
+                                separator.push_back(state);
+                            } else {
+                                rest.push_back(state);
+                            }
+                        }
+                        
+                        // Split the remaining states into their connected components and dissect them independently.
+                        std::vector<std::vector<storm::storage::sparse::state_type>> components;
+                        uint64_t restIndex = markPart(rest);
+                        ++currentVisit;
+                        for (auto const& state : rest) {
+                            if (visited[state] != currentVisit) {
+                                components.push_back(breadthFirstSearch(state, restIndex, false));
+                            }
+                        }
+                        for (auto const& component : components) {
+                            dissect(component, order);
+                        }
+                        appendByDegree(separator, order);
+                    }
+                    
+                private:
+                    uint64_t markPart(std::vector<storm::storage::sparse::state_type> const& part) {
+                        ++currentPart;
+                        for (auto const& state : part) {
+                            partOfState[state] = currentPart;
+                        }
+                        return currentPart;
+                    }
+                    
+                    // Performs a breadth-first search in the undirected graph restricted to the given part and sets the
+                    // levels of the reached states. If a new search is started, all states count as unvisited.
+                    std::vector<storm::storage::sparse::state_type> breadthFirstSearch(storm::storage::sparse::state_type start, uint64_t partIndex, bool newSearch = true) {
+                        if (newSearch) {
+                            ++currentVisit;
+                        }
+                        std::vector<storm::storage::sparse::state_type> bfsOrder = {start};
+                        visited[start] = currentVisit;
+                        level[start] = 0;
+                        for (uint64_t index = 0; index < bfsOrder.size(); ++index) {
+                            storm::storage::sparse::state_type state = bfsOrder[index];
+                            auto visitNeighbor = [&] (storm::storage::sparse::state_type neighbor) {
+                                if (partOfState[neighbor] == partIndex && visited[neighbor] != currentVisit) {
+                                    visited[neighbor] = currentVisit;
+                                    level[neighbor] = level[state] + 1;
+                                    bfsOrder.push_back(neighbor);
+                                }
+                            };
+                            for (auto const& entry : transitionMatrix.getRow(state)) {
+                                visitNeighbor(entry.getColumn());
+                            }
+                            for (auto const& entry : backwardTransitions.getRow(state)) {
+                                visitNeighbor(entry.getColumn());
+                            }
+                        }
+                        return bfsOrder;
+                    }
+                    
+                    void appendByDegree(std::vector<storm::storage::sparse::state_type> const& states, std::vector<storm::storage::sparse::state_type>& order) {
+                        std::vector<std::pair<uint_fast64_t, storm::storage::sparse::state_type>> degreeStatePairs;
+                        degreeStatePairs.reserve(states.size());
+                        for (auto const& state : states) {
+                            degreeStatePairs.emplace_back(transitionMatrix.getRow(state).size() + backwardTransitions.getRow(state).size(), state);
+                        }
+                        std::sort(degreeStatePairs.begin(), degreeStatePairs.end());
+                        for (auto const& degreeStatePair : degreeStatePairs) {
+                            order.push_back(degreeStatePair.second);
+                        }
+                    }
+                    
+                    storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix;
+                    storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions;
+                    
+                    // The part each state currently belongs to.
+                    std::vector<uint64_t> partOfState;
+                    // The breadth-first search in which each state was visited last.
+                    std::vector<uint64_t> visited;
+                    std::vector<uint64_t> level;
+                    uint64_t currentPart;
+                    uint64_t currentVisit;
+                };
+            }
+            
+            template<typename ValueType>
+            std::vector<storm::storage::sparse::state_type> getNestedDissectionOrder(storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states) {
+                std::vector<storm::storage::sparse::state_type> order;
+                order.reserve(states.getNumberOfSetBits());
+                NestedDissection<ValueType> nestedDissection(transitionMatrix, backwardTransitions);
                 
+                // Compute the SCCs of the given states with Tarjan's algorithm. The SCCs are found in reverse topological
+                // order and each SCC is dissected as soon as it is found.
+                uint64_t const unvisited = std::numeric_limits<uint64_t>::max();
+                std::vector<uint64_t> stateIndex(transitionMatrix.getRowCount(), unvisited);
+                std::vector<uint64_t> lowlink(transitionMatrix.getRowCount(), 0);
+                storm::storage::BitVector onStack(transitionMatrix.getRowCount());
+                std::vector<storm::storage::sparse::state_type> tarjanStack;
+                // The call stack holds the states together with the position of the next successor to explore.
+                std::vector<std::pair<storm::storage::sparse::state_type, uint64_t>> callStack;
+                uint64_t currentIndex = 0;
+                
+                auto visit = [&] (storm::storage::sparse::state_type state) {
+                    stateIndex[state] = currentIndex;
+                    lowlink[state] = currentIndex;
+                    ++currentIndex;
+                    tarjanStack.push_back(state);
+                    onStack.set(state);
+                    callStack.emplace_back(state, 0);
+                };
+                
+                for (auto const& root : states) {
+                    if (stateIndex[root] != unvisited) {
+                        continue;
+                    }
+                    visit(root);
+                    while (!callStack.empty()) {
+                        storm::storage::sparse::state_type state = callStack.back().first;
+                        uint64_t position = callStack.back().second;
+                        auto const& successors = transitionMatrix.getRow(state);
+                        if (position < successors.size()) {
+                            ++callStack.back().second;
+                            storm::storage::sparse::state_type successor = successors[position].getColumn();
+                            if (!states.get(successor) || storm::utility::isZero(successors[position].getValue())) {
+                                continue;
+                            }
+                            if (stateIndex[successor] == unvisited) {
+                                visit(successor);
+                            } else if (onStack.get(successor)) {
+                                lowlink[state] = std::min(lowlink[state], stateIndex[successor]);
+                            }
+                        } else {
+                            callStack.pop_back();
+                            if (!callStack.empty()) {
+                                lowlink[callStack.back().first] = std::min(lowlink[callStack.back().first], lowlink[state]);
+                            }
+                            if (lowlink[state] == stateIndex[state]) {
+                                std::vector<storm::storage::sparse::state_type> scc;
+                                storm::storage::sparse::state_type member;
+                                do {
+                                    member = tarjanStack.back();
+                                    tarjanStack.pop_back();
+                                    onStack.set(member, false);
+                                    scc.push_back(member);
+                                } while (member != state);
+                                nestedDissection.dissect(scc, order);
+                            }
+                        }
+                    }
+                }
+                return order;
+            }
+            
+            template<typename ValueType>
+            std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities, storm::storage::BitVector const& states) {
                 // Get the settings to customize the priority queue.
                 storm::settings::modules::EliminationSettings::EliminationOrder order = storm::settings::getModule<storm::settings::modules::EliminationSettings>().getEliminationOrder();
+                return createStatePriorityQueue(order, distanceBasedStatePriorities, transitionMatrix, backwardTransitions, oneStepProbabilities, states);
+            }
+            
+            template<typename ValueType>
+            std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(storm::settings::modules::EliminationSettings::EliminationOrder const& order, boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities, storm::storage::BitVector const& states) {
+                
+                STORM_LOG_TRACE("Creating state priority queue for states " << states);
                 
                 std::vector<storm::storage::sparse::state_type> sortedStates(states.begin(), states.end());
                 
@@ -115,9 +345,22 @@ namespace storm {
                         STORM_LOG_THROW(static_cast<bool>(distanceBasedStatePriorities), storm::exceptions::InvalidStateException, "Unable to build state priority queue without distance-based priorities.");
                         std::sort(sortedStates.begin(), sortedStates.end(), [&distanceBasedStatePriorities] (storm::storage::sparse::state_type const& state1, storm::storage::sparse::state_type const& state2) { return distanceBasedStatePriorities.get()[state1] < distanceBasedStatePriorities.get()[state2]; } );
                         return std::make_unique<StaticStatePriorityQueue>(sortedStates);
+                    } else if (order == storm::settings::modules::EliminationSettings::EliminationOrder::NestedDissection) {
+                        return std::make_unique<StaticStatePriorityQueue>(getNestedDissectionOrder(transitionMatrix, backwardTransitions, states));
                     } else if (eliminationOrderIsPenaltyBased(order)) {
                         std::vector<std::pair<storm::storage::sparse::state_type, uint_fast64_t>> statePenalties(sortedStates.size());
-                        typename DynamicStatePriorityQueue<ValueType>::PenaltyFunctionType penaltyFunction = order == storm::settings::modules::EliminationSettings::EliminationOrder::RegularExpression ?  computeStatePenaltyRegularExpression<ValueType> : computeStatePenalty<ValueType>;
+                        typename DynamicStatePriorityQueue<ValueType>::PenaltyFunctionType penaltyFunction = computeStatePenalty<ValueType>;
+                        // The degree and the Markowitz cost also change if a predecessor of a state is eliminated.
+                        bool updateSuccessors = false;
+                        if (order == storm::settings::modules::EliminationSettings::EliminationOrder::RegularExpression) {
+                            penaltyFunction = computeStatePenaltyRegularExpression<ValueType>;
+                        } else if (order == storm::settings::modules::EliminationSettings::EliminationOrder::MinimumDegree) {
+                            penaltyFunction = computeStatePenaltyMinimumDegree<ValueType>;
+                            updateSuccessors = true;
+                        } else if (order == storm::settings::modules::EliminationSettings::EliminationOrder::Markowitz) {
+                            penaltyFunction = computeStatePenaltyMarkowitz<ValueType>;
+                            updateSuccessors = true;
+                        }
                         for (uint_fast64_t index = 0; index < sortedStates.size(); ++index) {
                             statePenalties[index] = std::make_pair(sortedStates[index], penaltyFunction(sortedStates[index], transitionMatrix, backwardTransitions, oneStepProbabilities));
                         }
@@ -132,7 +375,7 @@ namespace storm {
                             return std::make_unique<StaticStatePriorityQueue>(sortedStates);
                         } else {
                             // For the dynamic penalty version, we need to give the full state-penalty pairs.
-                            return std::make_unique<DynamicStatePriorityQueue<ValueType>>(statePenalties, transitionMatrix, backwardTransitions, oneStepProbabilities, penaltyFunction);
+                            return std::make_unique<DynamicStatePriorityQueue<ValueType>>(statePenalties, transitionMatrix, backwardTransitions, oneStepProbabilities, penaltyFunction, updateSuccessors);
                         }
                     }
                 }
@@ -197,22 +440,34 @@ namespace storm {
             
             template uint_fast64_t estimateComplexity(double const& value);
             template std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities, storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions, std::vector<double> const& oneStepProbabilities, storm::storage::BitVector const& states);
+            template std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(storm::settings::modules::EliminationSettings::EliminationOrder const& order, boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities, storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions, std::vector<double> const& oneStepProbabilities, storm::storage::BitVector const& states);
             template uint_fast64_t computeStatePenalty(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions, std::vector<double> const& oneStepProbabilities);
             template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions, std::vector<double> const& oneStepProbabilities);
+            template uint_fast64_t computeStatePenaltyMinimumDegree(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions, std::vector<double> const& oneStepProbabilities);
+            template uint_fast64_t computeStatePenaltyMarkowitz(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions, std::vector<double> const& oneStepProbabilities);
+            template std::vector<storm::storage::sparse::state_type> getNestedDissectionOrder(storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& states);
             template std::vector<uint_fast64_t> getDistanceBasedPriorities(storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& transitionMatrixTransposed, storm::storage::BitVector const& initialStates, std::vector<double> const& oneStepProbabilities, bool forward, bool reverse);
             template std::vector<uint_fast64_t> getStateDistances(storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& transitionMatrixTransposed, storm::storage::BitVector const& initialStates, std::vector<double> const& oneStepProbabilities, bool forward);
             
 #ifdef STORM_HAVE_CARL
             template uint_fast64_t estimateComplexity(storm::RationalNumber const& value);
             template std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& oneStepProbabilities, storm::storage::BitVector const& states);
+            template std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(storm::settings::modules::EliminationSettings::EliminationOrder const& order, boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& oneStepProbabilities, storm::storage::BitVector const& states);
             template uint_fast64_t computeStatePenalty(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& oneStepProbabilities);
             template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& oneStepProbabilities);
+            template uint_fast64_t computeStatePenaltyMinimumDegree(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& oneStepProbabilities);
+            template uint_fast64_t computeStatePenaltyMarkowitz(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& oneStepProbabilities);
+            template std::vector<storm::storage::sparse::state_type> getNestedDissectionOrder(storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& states);
             template std::vector<uint_fast64_t> getDistanceBasedPriorities(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrixTransposed, storm::storage::BitVector const& initialStates, std::vector<storm::RationalNumber> const& oneStepProbabilities, bool forward, bool reverse);
             template std::vector<uint_fast64_t> getStateDistances(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrixTransposed, storm::storage::BitVector const& initialStates, std::vector<storm::RationalNumber> const& oneStepProbabilities, bool forward);
 
             template std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& oneStepProbabilities, storm::storage::BitVector const& states);
+            template std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(storm::settings::modules::EliminationSettings::EliminationOrder const& order, boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& oneStepProbabilities, storm::storage::BitVector const& states);
             template uint_fast64_t computeStatePenalty(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& oneStepProbabilities);
             template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& oneStepProbabilities);
+            template uint_fast64_t computeStatePenaltyMinimumDegree(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& oneStepProbabilities);
+            template uint_fast64_t computeStatePenaltyMarkowitz(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& oneStepProbabilities);
+            template std::vector<storm::storage::sparse::state_type> getNestedDissectionOrder(storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& states);
             template std::vector<uint_fast64_t> getDistanceBasedPriorities(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrixTransposed, storm::storage::BitVector const& initialStates, std::vector<storm::RationalFunction> const& oneStepProbabilities, bool forward, bool reverse);
             template std::vector<uint_fast64_t> getStateDistances(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrixTransposed, storm::storage::BitVector const& initialStates, std::vector<storm::RationalFunction> const& oneStepProbabilities, bool forward);
 #endif
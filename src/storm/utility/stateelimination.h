@@ -53,9 +53,41 @@ namespace storm {
             template<typename ValueType>
             uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities);
             
+            /*!
+             * Computes an approximation of the degree of the given state in the (undirected) elimination graph, namely
+             * the number of its predecessors plus the number of its successors (without the state itself). In contrast
+             * to the exact degree, this does not require to build the union of both sets.
+             */
+            template<typename ValueType>
+            uint_fast64_t computeStatePenaltyMinimumDegree(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities);
+            
+            /*!
+             * Computes the Markowitz cost of the given state, i.e. the product of the number of its predecessors and the
+             * number of its successors (without the state itself). This bounds the number of transitions that are
+             * created when eliminating the state. A non-zero one-step probability counts as an additional successor.
+             */
+            template<typename ValueType>
+            uint_fast64_t computeStatePenaltyMarkowitz(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities);
+            
+            /*!
+             * Computes a nested dissection order of the given states. The states are first split into their SCCs. Each
+             * SCC is then recursively split into two parts by a separator (a level of a breadth-first search in the
+             * undirected graph) and the separator is ordered after the parts, such that eliminating the states of one
+             * part does not create transitions to the other part.
+             */
+            template<typename ValueType>
+            std::vector<storm::storage::sparse::state_type> getNestedDissectionOrder(storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states);
+            
             template<typename ValueType>
             std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& stateDistances, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities, storm::storage::BitVector const& states);
             
+            /*!
+             * Creates a queue that yields the given states in the given elimination order (instead of the one that is
+             * selected in the settings).
+             */
+            template<typename ValueType>
+            std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(storm::settings::modules::EliminationSettings::EliminationOrder const& order, boost::optional<std::vector<uint_fast64_t>> const& stateDistances, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities, storm::storage::BitVector const& states);
+            
             std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(storm::storage::BitVector const& states);
             std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(std::vector<storm::storage::sparse::state_type> const& states);
             
@@ -1,12 +1,27 @@
 #include "test/storm_gtest.h"
 #include "storm-config.h"
 
+#include <cmath>
+
 #include "storm-dft/api/storm-dft.h"
 #include "storm-dft/builder/ExplicitDFTModelBuilder.h"
+#include "storm-dft/settings/modules/FaultTreeSettings.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
 #include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/verification.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 
 namespace {
 
+    // Checks the given property on the given model and returns the value of the (unique) initial state.
+    double checkInitialState(std::shared_ptr<storm::models::sparse::Model<double>> const& model, std::string const& property) {
+        std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parseProperties(property));
+        std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(formulas[0], true));
+        EXPECT_EQ(1ul, model->getInitialStates().getNumberOfSetBits());
+        return result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()];
+    }
+
     TEST(DftModelBuildingTest, RelevantEvents) {
         // Initialize
         std::string file = STORM_TEST_RESOURCES_DIR "/dft/dont_care.dft";
@@ -90,4 +105,56 @@ namespace {
         EXPECT_EQ(13ul, model->getNumberOfTransitions());
     }
 
+    TEST(DftModelBuildingTest, ParallelExploration) {
+        std::vector<std::string> files = {"and.dft", "pand.dft", "spare.dft", "spare7.dft", "pdep.dft", "seq4.dft", "symmetry6.dft", "hecs_2_2.dft"};
+        for (std::string const& name : files) {
+            std::string file = STORM_TEST_RESOURCES_DIR "/dft/" + name;
+            std::shared_ptr<storm::storage::DFT<double>> dft = storm::api::loadDFTGalileoFile<double>(file);
+            EXPECT_TRUE(storm::api::isWellFormed(*dft).first);
+            dft->setRelevantEvents(storm::utility::RelevantEvents{}, false);
+            for (bool symred : {false, true}) {
+                std::map<size_t, std::vector<std::vector<size_t>>> emptySymmetry;
+                storm::storage::DFTIndependentSymmetries symmetries(emptySymmetry);
+                if (symred) {
+                    auto colouring = dft->colourDFT();
+                    symmetries = dft->findSymmetries(colouring);
+                }
+
+                // Build model sequentially
+                storm::builder::ExplicitDFTModelBuilder<double> builder(*dft, symmetries);
+                builder.buildModel(0, 0.0);
+                std::shared_ptr<storm::models::sparse::Model<double>> model = builder.getModel();
+
+                // Build model with parallel exploration
+                auto& ftSettings = dynamic_cast<storm::settings::modules::FaultTreeSettings&>(storm::settings::mutableManager().getModule(storm::settings::modules::FaultTreeSettings::moduleName));
+                std::unique_ptr<storm::settings::SettingMemento> parallelExploration = ftSettings.overrideParallelExplorationSet(true);
+                storm::builder::ExplicitDFTModelBuilder<double> parallelBuilder(*dft, symmetries);
+                parallelBuilder.buildModel(0, 0.0);
+                std::shared_ptr<storm::models::sparse::Model<double>> parallelModel = parallelBuilder.getModel();
+                parallelExploration.reset();
+
+                // Models coincide up to renumbering of the states
+                EXPECT_EQ(model->getType(), parallelModel->getType()) << name;
+                EXPECT_EQ(model->getNumberOfStates(), parallelModel->getNumberOfStates()) << name;
+                EXPECT_EQ(model->getNumberOfTransitions(), parallelModel->getNumberOfTransitions()) << name;
+                EXPECT_EQ(model->getNumberOfChoices(), parallelModel->getNumberOfChoices()) << name;
+                EXPECT_EQ(model->getStateLabeling().getLabels(), parallelModel->getStateLabeling().getLabels()) << name;
+                for (std::string const& label : model->getStateLabeling().getLabels()) {
+                    EXPECT_EQ(model->getStates(label).getNumberOfSetBits(), parallelModel->getStates(label).getNumberOfSetBits()) << name << ", label " << label;
+                }
+
+                // The models yield the same results
+                for (std::string const& property : {"Tmin=? [F \"failed\"]", "Pmin=? [F<=1 \"failed\"]", "Pmax=? [F<=1 \"failed\"]"}) {
+                    double result = checkInitialState(model, property);
+                    double parallelResult = checkInitialState(parallelModel, property);
+                    if (std::isinf(result)) {
+                        EXPECT_EQ(result, parallelResult) << name << ", " << property;
+                    } else {
+                        EXPECT_NEAR(result, parallelResult, 1e-8 * std::max(1.0, std::abs(result))) << name << ", " << property;
+                    }
+                }
+            }
+        }
+    }
+
 }
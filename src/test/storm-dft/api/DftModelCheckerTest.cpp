@@ -245,4 +245,15 @@ namespace {
         double result = this->analyzeReliability(STORM_TEST_RESOURCES_DIR "/dft/hecs_2_2.dft", 1.0);
         EXPECT_FLOAT_EQ(result, 0.00021997582);
     }
+
+    TEST(DftModelCheckerReuseTest, DifferentProperties) {
+        std::shared_ptr<storm::storage::DFT<double>> dft = storm::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/symmetry6.dft");
+        storm::modelchecker::DFTModelChecker<double> modelChecker(false);
+        // The models of the modules built for the first property are reused for the second one
+        auto properties = storm::api::extractFormulasFromProperties(storm::api::parseProperties("Pmin=? [F<=0.5 \"failed\"]"));
+        modelChecker.check(*dft, properties, false, true);
+        properties = storm::api::extractFormulasFromProperties(storm::api::parseProperties("Pmin=? [F<=1 \"failed\"]"));
+        storm::modelchecker::DFTModelChecker<double>::dft_results results = modelChecker.check(*dft, properties, false, true);
+        EXPECT_FLOAT_EQ(boost::get<double>(results[0]), 0.3421934224);
+    }
 }
@@ -0,0 +1,86 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <cmath>
+
+#include "storm-dft/api/storm-dft.h"
+#include "storm-dft/transformations/DftTransformator.h"
+#include "storm-dft/simulator/DFTMonteCarloSimulator.h"
+#include "storm-dft/storage/dft/SymmetricUnits.h"
+
+
+namespace {
+
+    // Helper function
+    storm::dft::simulator::UnreliabilityEstimate estimateDft(std::string const& file, std::vector<double> const& timebounds, double precision, storm::dft::simulator::StoppingCriterion criterion, uint64_t batchSize = 1000) {
+        // Load, build and prepare DFT
+        storm::transformations::dft::DftTransformator<double> dftTransformator = storm::transformations::dft::DftTransformator<double>();
+        std::shared_ptr<storm::storage::DFT<double>> dft = dftTransformator.transformBinaryFDEPs(*(storm::api::loadDFTGalileoFile<double>(file)));
+        EXPECT_TRUE(storm::api::isWellFormed(*dft).first);
+
+        // Set relevant events
+        storm::utility::RelevantEvents relevantEvents = storm::api::computeRelevantEvents<double>(*dft, {}, {});
+        dft->setRelevantEvents(relevantEvents, false);
+
+        std::map<size_t, std::vector<std::vector<size_t>>> emptySymmetry;
+        storm::storage::DFTIndependentSymmetries symmetries(emptySymmetry);
+        storm::storage::DFTStateGenerationInfo stateGenerationInfo(dft->buildStateGenerationInfo(symmetries));
+
+        storm::dft::simulator::DFTMonteCarloSimulator<double> simulator(*dft, stateGenerationInfo, 5u);
+        simulator.setBatchSize(batchSize);
+        return simulator.estimateUnreliability(timebounds, precision, 0.95, criterion);
+    }
+
+    TEST(DftMonteCarloSimulatorTest, AndUnreliability) {
+        storm::dft::simulator::UnreliabilityEstimate result = estimateDft(STORM_TEST_RESOURCES_DIR "/dft/and.dft", {2}, 0.01, storm::dft::simulator::StoppingCriterion::CLOPPER_PEARSON);
+        ASSERT_EQ(result.unreliabilities.size(), 1ul);
+        EXPECT_NEAR(result.unreliabilities[0], 0.3995764009, 0.02);
+        EXPECT_LE(result.confidenceIntervals[0].first, result.unreliabilities[0]);
+        EXPECT_GE(result.confidenceIntervals[0].second, result.unreliabilities[0]);
+        EXPECT_LE(result.confidenceIntervals[0].second - result.confidenceIntervals[0].first, 0.02);
+        // The criterion is checked repeatedly, so the reported interval is wider than a single interval with the same confidence
+        uint64_t successes = std::llround(result.unreliabilities[0] * result.nrTraces);
+        std::pair<double, double> uncorrected = storm::dft::simulator::DFTMonteCarloSimulator<double>::getClopperPearsonInterval(successes, result.nrTraces, 0.95);
+        EXPECT_GT(result.confidenceIntervals[0].second - result.confidenceIntervals[0].first, uncorrected.second - uncorrected.first);
+    }
+
+    TEST(DftMonteCarloSimulatorTest, MultipleTimebounds) {
+        // Timebounds are given in arbitrary order
+        storm::dft::simulator::UnreliabilityEstimate result = estimateDft(STORM_TEST_RESOURCES_DIR "/dft/or.dft", {2, 0.5, 1}, 0.01, storm::dft::simulator::StoppingCriterion::CHERNOFF);
+        ASSERT_EQ(result.unreliabilities.size(), 3ul);
+        EXPECT_GE(result.nrTraces, storm::dft::simulator::DFTMonteCarloSimulator<double>::getChernoffBound(0.01, 0.95));
+        EXPECT_NEAR(result.unreliabilities[0], 0.8646647168, 0.02);
+        EXPECT_NEAR(result.unreliabilities[1], 0.3934693403, 0.02);
+        EXPECT_NEAR(result.unreliabilities[2], 0.6321205588, 0.02);
+        EXPECT_LE(result.unreliabilities[1], result.unreliabilities[2]);
+        EXPECT_LE(result.unreliabilities[2], result.unreliabilities[0]);
+    }
+
+    TEST(DftMonteCarloSimulatorTest, Reproducibility) {
+        // Results only depend on the seed and the batch size
+        storm::dft::simulator::UnreliabilityEstimate result1 = estimateDft(STORM_TEST_RESOURCES_DIR "/dft/pand.dft", {1}, 0.01, storm::dft::simulator::StoppingCriterion::CHERNOFF, 500);
+        storm::dft::simulator::UnreliabilityEstimate result2 = estimateDft(STORM_TEST_RESOURCES_DIR "/dft/pand.dft", {1}, 0.01, storm::dft::simulator::StoppingCriterion::CHERNOFF, 500);
+        EXPECT_EQ(result1.nrTraces, result2.nrTraces);
+        EXPECT_EQ(result1.unreliabilities[0], result2.unreliabilities[0]);
+        EXPECT_NEAR(result1.unreliabilities[0], 0.03087312562, 0.02);
+    }
+
+    TEST(DftMonteCarloSimulatorTest, Api) {
+        std::shared_ptr<storm::storage::DFT<double>> dft = storm::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/and.dft");
+        dft = storm::api::applyTransformations(*dft, false, true);
+        storm::dft::simulator::UnreliabilityEstimate result = storm::api::simulateDFT<double>(*dft, {2}, 0.01, 0.95, 5u);
+        ASSERT_EQ(result.unreliabilities.size(), 1ul);
+        EXPECT_NEAR(result.unreliabilities[0], 0.3995764009, 0.02);
+        EXPECT_LE(result.confidenceIntervals[0].second - result.confidenceIntervals[0].first, 0.02);
+    }
+
+    TEST(DftMonteCarloSimulatorTest, Bounds) {
+        EXPECT_EQ(storm::dft::simulator::DFTMonteCarloSimulator<double>::getChernoffBound(0.01, 0.95), 18445ul);
+        std::pair<double, double> interval = storm::dft::simulator::DFTMonteCarloSimulator<double>::getClopperPearsonInterval(50, 100, 0.95);
+        EXPECT_NEAR(interval.first, 0.3983, 1e-4);
+        EXPECT_NEAR(interval.second, 0.6017, 1e-4);
+        interval = storm::dft::simulator::DFTMonteCarloSimulator<double>::getClopperPearsonInterval(0, 100, 0.95);
+        EXPECT_EQ(interval.first, 0);
+        EXPECT_NEAR(interval.second, 0.0362, 1e-4);
+    }
+}
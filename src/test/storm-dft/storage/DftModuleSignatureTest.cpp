@@ -0,0 +1,69 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm-dft/builder/DFTBuilder.h"
+#include "storm-dft/utility/ModuleSignature.h"
+
+namespace {
+
+    storm::storage::DFT<double> buildModule(std::string const& prefix, bool swapChildren, double rate) {
+        storm::builder::DFTBuilder<double> builder;
+        builder.addBasicElementExponential(prefix + "A", rate, 1);
+        builder.addBasicElementExponential(prefix + "B", 2, 0.5);
+        builder.addBasicElementExponential(prefix + "C", 3, 1);
+        builder.addPandElement(prefix + "P", {prefix + "A", prefix + "B"});
+        if (swapChildren) {
+            builder.addOrElement(prefix + "Top", {prefix + "C", prefix + "P"});
+        } else {
+            builder.addOrElement(prefix + "Top", {prefix + "P", prefix + "C"});
+        }
+        builder.setTopLevel(prefix + "Top");
+        return builder.build();
+    }
+
+    TEST(DftModuleSignatureTest, Isomorphic) {
+        storm::storage::DFT<double> dft1 = buildModule("X", false, 1);
+        storm::storage::DFT<double> dft2 = buildModule("Y", true, 1);
+        boost::optional<std::string> signature1 = storm::dft::utility::ModuleSignature<double>::getCanonicalSignature(dft1);
+        boost::optional<std::string> signature2 = storm::dft::utility::ModuleSignature<double>::getCanonicalSignature(dft2);
+        ASSERT_TRUE(signature1.is_initialized());
+        ASSERT_TRUE(signature2.is_initialized());
+        EXPECT_EQ(*signature1, *signature2);
+    }
+
+    TEST(DftModuleSignatureTest, NonIsomorphic) {
+        // Different rate
+        storm::storage::DFT<double> dft1 = buildModule("X", false, 1);
+        storm::storage::DFT<double> dft2 = buildModule("X", false, 4);
+        boost::optional<std::string> signature1 = storm::dft::utility::ModuleSignature<double>::getCanonicalSignature(dft1);
+        boost::optional<std::string> signature2 = storm::dft::utility::ModuleSignature<double>::getCanonicalSignature(dft2);
+        ASSERT_TRUE(signature1.is_initialized());
+        ASSERT_TRUE(signature2.is_initialized());
+        EXPECT_NE(*signature1, *signature2);
+
+        // Order of children of dynamic gate matters
+        storm::builder::DFTBuilder<double> builder;
+        builder.addBasicElementExponential("A", 1, 1);
+        builder.addBasicElementExponential("B", 2, 0.5);
+        builder.addBasicElementExponential("C", 3, 1);
+        builder.addPandElement("P", {"B", "A"});
+        builder.addOrElement("Top", {"P", "C"});
+        builder.setTopLevel("Top");
+        storm::storage::DFT<double> dft3 = builder.build();
+        boost::optional<std::string> signature3 = storm::dft::utility::ModuleSignature<double>::getCanonicalSignature(dft3);
+        ASSERT_TRUE(signature3.is_initialized());
+        EXPECT_NE(*signature1, *signature3);
+    }
+
+    TEST(DftModuleSignatureTest, SharedElements) {
+        storm::builder::DFTBuilder<double> builder;
+        builder.addBasicElementExponential("A", 1, 1);
+        builder.addBasicElementExponential("B", 2, 1);
+        builder.addAndElement("G1", {"A", "B"});
+        builder.addOrElement("G2", {"A", "B"});
+        builder.addOrElement("Top", {"G1", "G2"});
+        builder.setTopLevel("Top");
+        storm::storage::DFT<double> dft = builder.build();
+        EXPECT_FALSE(storm::dft::utility::ModuleSignature<double>::getCanonicalSignature(dft).is_initialized());
+    }
+}
@@ -0,0 +1,99 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/solver/stateelimination/ParallelStateEliminator.h"
+#include "storm/solver/stateelimination/StatePriorityQueue.h"
+#include "storm/storage/FlexibleSparseMatrix.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/stateelimination.h"
+
+namespace {
+
+    // Computes the probability to reach the target states from the initial state by eliminating all other states
+    // either sequentially or in parallel.
+    storm::RationalFunction computeReachabilityProbability(storm::models::sparse::Dtmc<storm::RationalFunction> const& dtmc, std::string const& targetLabel, bool parallel, uint64_t& numberOfRounds) {
+        storm::storage::BitVector const& psiStates = dtmc.getStates(targetLabel);
+        std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 = storm::utility::graph::performProb01(dtmc, storm::storage::BitVector(dtmc.getNumberOfStates(), true), psiStates);
+        storm::storage::BitVector maybeStates = ~(statesWithProbability01.first | statesWithProbability01.second);
+        uint64_t initialState = *dtmc.getInitialStates().begin();
+        if (!maybeStates.get(initialState)) {
+            return statesWithProbability01.second.get(initialState) ? storm::utility::one<storm::RationalFunction>() : storm::utility::zero<storm::RationalFunction>();
+        }
+
+        std::vector<storm::RationalFunction> values = dtmc.getTransitionMatrix().getConstrainedRowSumVector(maybeStates, statesWithProbability01.second);
+        storm::storage::SparseMatrix<storm::RationalFunction> submatrix = dtmc.getTransitionMatrix().getSubmatrix(false, maybeStates, maybeStates);
+        storm::storage::FlexibleSparseMatrix<storm::RationalFunction> flexibleMatrix(submatrix);
+        storm::storage::FlexibleSparseMatrix<storm::RationalFunction> flexibleBackwardTransitions(submatrix.transpose(), true);
+
+        uint64_t initialStateInSubmatrix = maybeStates.getNumberOfSetBitsBeforeIndex(initialState);
+        storm::storage::BitVector statesToEliminate(submatrix.getRowCount(), true);
+        statesToEliminate.set(initialStateInSubmatrix, false);
+
+        auto priorityQueue = storm::utility::stateelimination::createStatePriorityQueue<storm::RationalFunction>(storm::settings::modules::EliminationSettings::EliminationOrder::DynamicPenalty, boost::none, flexibleMatrix, flexibleBackwardTransitions, values, statesToEliminate);
+        if (parallel) {
+            storm::solver::stateelimination::ParallelStateEliminator<storm::RationalFunction> eliminator(flexibleMatrix, flexibleBackwardTransitions, priorityQueue, values);
+            // Rational functions share coefficients that must not be used from several threads.
+            EXPECT_FALSE(eliminator.isConcurrent());
+            eliminator.eliminateAll();
+            eliminator.eliminateState(initialStateInSubmatrix, false);
+            numberOfRounds = eliminator.getNumberOfRounds();
+        } else {
+            storm::solver::stateelimination::PrioritizedStateEliminator<storm::RationalFunction> eliminator(flexibleMatrix, flexibleBackwardTransitions, priorityQueue, values);
+            eliminator.eliminateAll();
+            eliminator.eliminateState(initialStateInSubmatrix, false);
+            numberOfRounds = statesToEliminate.getNumberOfSetBits();
+        }
+        return storm::utility::simplify(values[initialStateInSubmatrix]);
+    }
+
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> buildModel(std::string const& path) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(path);
+        std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> model = storm::builder::ExplicitModelBuilder<storm::RationalFunction>(program).build();
+        return model->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    }
+
+    std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> getInstantiation(storm::models::sparse::Dtmc<storm::RationalFunction> const& dtmc, std::string const& value) {
+        std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> instantiation;
+        for (auto const& variable : storm::models::sparse::getProbabilityParameters(dtmc)) {
+            instantiation.emplace(variable, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(value));
+        }
+        return instantiation;
+    }
+
+}
+
+TEST(ParallelStateEliminationTest, Die) {
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc = buildModel(STORM_TEST_RESOURCES_DIR "/pdtmc/parametric_die.pm");
+
+    uint64_t sequentialRounds = 0;
+    uint64_t parallelRounds = 0;
+    storm::RationalFunction sequentialResult = computeReachabilityProbability(*dtmc, "one", false, sequentialRounds);
+    storm::RationalFunction parallelResult = computeReachabilityProbability(*dtmc, "one", true, parallelRounds);
+    EXPECT_LT(parallelRounds, sequentialRounds);
+
+    auto instantiation = getInstantiation(*dtmc, "1/2");
+    EXPECT_EQ(storm::utility::convertNumber<storm::RationalFunctionCoefficient>(std::string("1/6")), parallelResult.evaluate(instantiation));
+    instantiation = getInstantiation(*dtmc, "1/3");
+    EXPECT_EQ(sequentialResult.evaluate(instantiation), parallelResult.evaluate(instantiation));
+}
+
+TEST(ParallelStateEliminationTest, Brp) {
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc = buildModel(STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm");
+
+    uint64_t sequentialRounds = 0;
+    uint64_t parallelRounds = 0;
+    storm::RationalFunction sequentialResult = computeReachabilityProbability(*dtmc, "error", false, sequentialRounds);
+    storm::RationalFunction parallelResult = computeReachabilityProbability(*dtmc, "error", true, parallelRounds);
+    EXPECT_LT(parallelRounds, sequentialRounds);
+
+    for (auto const& value : {"1/3", "9/10"}) {
+        auto instantiation = getInstantiation(*dtmc, value);
+        EXPECT_EQ(sequentialResult.evaluate(instantiation), parallelResult.evaluate(instantiation)) << value;
+    }
+}
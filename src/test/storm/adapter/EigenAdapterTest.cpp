@@ -0,0 +1,65 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/adapters/EigenAdapter.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+    void expectSameMatrix(storm::storage::SparseMatrix<double> const& matrix) {
+        std::unique_ptr<Eigen::SparseMatrix<double>> eigenMatrix = storm::adapters::EigenAdapter::toEigenSparseMatrix(matrix);
+        ASSERT_EQ(static_cast<uint64_t>(eigenMatrix->rows()), matrix.getRowCount());
+        ASSERT_EQ(static_cast<uint64_t>(eigenMatrix->cols()), matrix.getColumnCount());
+        EXPECT_EQ(static_cast<uint64_t>(eigenMatrix->nonZeros()), matrix.getEntryCount());
+
+        for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+            std::vector<double> denseRow(matrix.getColumnCount(), 0.0);
+            for (auto const& entry : matrix.getRow(row)) {
+                denseRow[entry.getColumn()] = entry.getValue();
+            }
+            for (uint64_t column = 0; column < matrix.getColumnCount(); ++column) {
+                EXPECT_EQ(eigenMatrix->coeff(row, column), denseRow[column]) << "row " << row << ", column " << column;
+            }
+        }
+    }
+
+    TEST(EigenAdapterTest, SquareMatrix) {
+        storm::storage::SparseMatrixBuilder<double> builder(3, 3, 6);
+        builder.addNextValue(0, 0, 0.2);
+        builder.addNextValue(0, 2, 0.8);
+        builder.addNextValue(1, 0, 0.5);
+        builder.addNextValue(1, 1, 0.25);
+        builder.addNextValue(1, 2, 0.25);
+        builder.addNextValue(2, 1, 1.0);
+        expectSameMatrix(builder.build());
+    }
+
+    TEST(EigenAdapterTest, EmptyRowsAndColumns) {
+        // Rows 0 and 3 as well as columns 0 and 2 are empty
+        storm::storage::SparseMatrixBuilder<double> builder(4, 4, 3);
+        builder.addNextValue(1, 1, -1.5);
+        builder.addNextValue(1, 3, 2.0);
+        builder.addNextValue(2, 3, 0.125);
+        expectSameMatrix(builder.build());
+    }
+
+    TEST(EigenAdapterTest, NonSquareMatrix) {
+        storm::storage::SparseMatrixBuilder<double> builder(2, 5, 4);
+        builder.addNextValue(0, 0, 1.0);
+        builder.addNextValue(0, 4, 3.0);
+        builder.addNextValue(1, 1, 0.5);
+        builder.addNextValue(1, 3, 7.0);
+        expectSameMatrix(builder.build());
+
+        storm::storage::SparseMatrixBuilder<double> tallBuilder(5, 2, 3);
+        tallBuilder.addNextValue(0, 1, 4.0);
+        tallBuilder.addNextValue(3, 0, 2.0);
+        tallBuilder.addNextValue(3, 1, 6.0);
+        expectSameMatrix(tallBuilder.build());
+    }
+
+    TEST(EigenAdapterTest, EmptyMatrix) {
+        storm::storage::SparseMatrixBuilder<double> builder(3, 2, 0);
+        expectSameMatrix(builder.build());
+    }
+}
@@ -319,6 +319,44 @@ TEST(DdPrismModelBuilderTest_Cudd, Composition) {
     EXPECT_EQ(21ul, mdp->getNumberOfChoices());
 }
 
+TEST(DdPrismModelBuilderTest, ForceOrder) {
+    // Variables 0 and 2 as well as 1 and 3 interact, so they are to be placed next to each other.
+    std::vector<std::vector<uint64_t>> hyperedges = {{0, 2}, {1, 3}};
+    std::vector<uint64_t> order = storm::builder::computeForceOrder(4, hyperedges);
+    EXPECT_EQ(std::vector<uint64_t>({0, 2, 1, 3}), order);
+    
+    // Without interactions, the order is kept.
+    order = storm::builder::computeForceOrder(3, {});
+    EXPECT_EQ(std::vector<uint64_t>({0, 1, 2}), order);
+}
+
+TEST(DdPrismModelBuilderTest_Sylvan, ForceVariableOrdering) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    typename storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>::Options options;
+    options.buildAllLabels = true;
+    options.variableOrdering = storm::builder::DdVariableOrdering::Force;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program, options);
+    EXPECT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+    std::shared_ptr<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>> mdp = model->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>>();
+    
+    EXPECT_EQ(364ul, mdp->getNumberOfStates());
+    EXPECT_EQ(654ul, mdp->getNumberOfTransitions());
+    EXPECT_EQ(573ul, mdp->getNumberOfChoices());
+    EXPECT_LT(0ul, model->getManager().getPeakNumberOfNodes());
+}
+
+TEST(DdPrismModelBuilderTest_Cudd, ForceVariableOrdering) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    typename storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>::Options options;
+    options.variableOrdering = storm::builder::DdVariableOrdering::Force;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().build(program, options);
+    EXPECT_EQ(8607ul, model->getNumberOfStates());
+    EXPECT_EQ(15113ul, model->getNumberOfTransitions());
+    EXPECT_LT(0ul, model->getManager().getPeakNumberOfNodes());
+}
+
 TEST(UnboundedTest_Sylvan, Mdp) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/unbounded.nm");
     storm::prism::Program program = modelDescription.preprocess("N=1").asPrismProgram();
@@ -156,3 +156,16 @@ TEST(ExplicitJaniModelBuilderTest, unassignedVariables) {
     EXPECT_EQ(25ul, model->getNumberOfStates());
     EXPECT_EQ(81ul, model->getNumberOfTransitions());
 }
+
+TEST(ExplicitJaniModelBuilderTest, CompiledExpressions) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm");
+    storm::jani::Model janiModel = program.toJani().substituteConstantsFunctions();
+
+    storm::builder::BuilderOptions options;
+    options.setBuildAllRewardModels().setCompileExpressions(true);
+    std::shared_ptr<storm::models::sparse::Model<double>> compiledModel = storm::builder::ExplicitModelBuilder<double>(janiModel, options).build();
+    options.setCompileExpressions(false);
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(janiModel, options).build();
+    EXPECT_EQ(1038ul, model->getNumberOfStates());
+    EXPECT_TRUE(compiledModel->getTransitionMatrix() == model->getTransitionMatrix());
+}
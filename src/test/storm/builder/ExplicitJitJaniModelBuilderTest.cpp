@@ -9,6 +9,8 @@
 
 #include "storm/settings/SettingsManager.h"
 
+#include <boost/filesystem.hpp>
+
 TEST(ExplicitJitJaniModelBuilderTest, Dtmc) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
     storm::jani::Model janiModel = program.toJani().substituteConstantsFunctions();
@@ -115,6 +117,68 @@ TEST(ExplicitJitJaniModelBuilderTest, Mdp) {
     EXPECT_EQ(59ul, model->getNumberOfTransitions());
 }
 
+TEST(ExplicitJitJaniModelBuilderTest, ChoiceLabelsAndStateValuations) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/die_selection.nm");
+    storm::jani::Model janiModel = program.toJani().substituteConstantsFunctions();
+    storm::builder::BuilderOptions options;
+    options.setBuildChoiceLabels().setBuildStateValuations();
+    
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::jit::ExplicitJitJaniModelBuilder<double>(janiModel, options).build();
+    EXPECT_EQ(13ul, model->getNumberOfStates());
+    EXPECT_EQ(27ul, model->getNumberOfChoices());
+    ASSERT_TRUE(model->hasChoiceLabeling());
+    ASSERT_TRUE(model->hasStateValuations());
+    
+    storm::expressions::Variable s = program.getManager().getVariable("s");
+    storm::storage::SparseMatrix<double> const& transitionMatrix = model->getTransitionMatrix();
+    for (uint64_t state = 0; state < model->getNumberOfStates(); ++state) {
+        int64_t valueOfS = model->getStateValuations().getIntegerValue(state, s);
+        EXPECT_LE(0, valueOfS);
+        EXPECT_GE(7, valueOfS);
+        if (valueOfS < 7) {
+            // Every action is enabled exactly once in the states in which the coins are flipped.
+            std::set<std::string> actions;
+            for (uint64_t choice = transitionMatrix.getRowGroupIndices()[state]; choice < transitionMatrix.getRowGroupIndices()[state + 1]; ++choice) {
+                std::set<std::string> labels = model->getChoiceLabeling().getLabelsOfChoice(choice);
+                EXPECT_EQ(1ul, labels.size());
+                actions.insert(labels.begin(), labels.end());
+            }
+            EXPECT_EQ(std::set<std::string>({"fair", "ufair1", "ufair2"}), actions);
+        } else {
+            EXPECT_EQ(1ul, transitionMatrix.getRowGroupSize(state));
+            EXPECT_TRUE(model->getChoiceLabeling().getLabelsOfChoice(transitionMatrix.getRowGroupIndices()[state]).empty());
+        }
+    }
+}
+
+TEST(ExplicitJitJaniModelBuilderTest, LibraryCache) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::jani::Model janiModel = program.toJani().substituteConstantsFunctions();
+    boost::filesystem::path cacheDirectory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("storm-jit-cache-%%%%-%%%%");
+    
+    storm::builder::jit::ExplicitJitJaniModelBuilder<double> firstBuilder(janiModel);
+    firstBuilder.setCacheDirectory(cacheDirectory.string());
+    std::shared_ptr<storm::models::sparse::Model<double>> model = firstBuilder.build();
+    EXPECT_FALSE(firstBuilder.isLibraryReusedFromCache());
+    EXPECT_EQ(13ul, model->getNumberOfStates());
+    
+    // The cache holds exactly the library of the first build.
+    uint64_t numberOfCachedLibraries = std::distance(boost::filesystem::directory_iterator(cacheDirectory), boost::filesystem::directory_iterator());
+    EXPECT_EQ(1ul, numberOfCachedLibraries);
+    
+    storm::builder::jit::ExplicitJitJaniModelBuilder<double> secondBuilder(janiModel);
+    secondBuilder.setCacheDirectory(cacheDirectory.string());
+    model = secondBuilder.build();
+    EXPECT_TRUE(secondBuilder.isLibraryReusedFromCache());
+    EXPECT_EQ(13ul, model->getNumberOfStates());
+    EXPECT_EQ(20ul, model->getNumberOfTransitions());
+    
+    numberOfCachedLibraries = std::distance(boost::filesystem::directory_iterator(cacheDirectory), boost::filesystem::directory_iterator());
+    EXPECT_EQ(1ul, numberOfCachedLibraries);
+    
+    boost::filesystem::remove_all(cacheDirectory);
+}
+
 TEST(ExplicitJitJaniModelBuilderTest, Ma) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ma/simple.ma");
     storm::jani::Model janiModel = program.toJani().substituteConstantsFunctions();
@@ -213,3 +213,30 @@ TEST(ExplicitPrismModelBuilderTest, CallbackActionMask) {
     EXPECT_EQ(13ul, model->getNumberOfStates());
     EXPECT_EQ(20ul, model->getNumberOfTransitions());
 }
+
+TEST(ExplicitPrismModelBuilderTest, CompiledExpressions) {
+    for (std::string const& file : {"/dtmc/crowds-5-5.pm", "/mdp/coin2-2.nm", "/mdp/csma2-2.nm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file);
+        storm::builder::BuilderOptions options;
+        options.setBuildAllRewardModels().setBuildAllLabels().setCompileExpressions(true);
+        std::shared_ptr<storm::models::sparse::Model<double>> compiledModel = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+        options.setCompileExpressions(false);
+        std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+
+        // Evaluating the expressions on the compressed states has to yield exactly the same model.
+        EXPECT_TRUE(compiledModel->getTransitionMatrix() == model->getTransitionMatrix()) << file;
+        EXPECT_TRUE(compiledModel->getStateLabeling() == model->getStateLabeling()) << file;
+        ASSERT_EQ(model->getNumberOfRewardModels(), compiledModel->getNumberOfRewardModels());
+        for (auto const& rewardModel : model->getRewardModels()) {
+            auto const& compiledRewardModel = compiledModel->getRewardModel(rewardModel.first);
+            ASSERT_EQ(rewardModel.second.hasStateRewards(), compiledRewardModel.hasStateRewards());
+            if (rewardModel.second.hasStateRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateRewardVector(), compiledRewardModel.getStateRewardVector());
+            }
+            ASSERT_EQ(rewardModel.second.hasStateActionRewards(), compiledRewardModel.hasStateActionRewards());
+            if (rewardModel.second.hasStateActionRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), compiledRewardModel.getStateActionRewardVector());
+            }
+        }
+    }
+}
@@ -0,0 +1,52 @@
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+#include <random>
+
+#include "storm/generator/GuardIndex.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/storage/expressions/SimpleValuation.h"
+#include "storm/storage/prism/Program.h"
+
+TEST(GuardIndexTest, Crowds) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm").substituteConstantsFormulas();
+    storm::generator::VariableInformation variableInformation(program, 32);
+    storm::prism::Module const& module = program.getModule(0);
+    std::vector<storm::expressions::Expression> guards;
+    for (auto const& command : module.getCommands()) {
+        guards.push_back(command.getGuardExpression());
+    }
+    storm::generator::GuardIndex guardIndex(variableInformation, guards);
+    EXPECT_LT(1ul, guardIndex.getNumberOfNodes());
+
+    std::mt19937 randomGenerator(42);
+    storm::expressions::SimpleValuation valuation(program.getManager().getSharedPointer());
+    uint64_t numberOfCandidates = 0;
+    uint64_t const numberOfSamples = 1000;
+    for (uint64_t sample = 0; sample < numberOfSamples; ++sample) {
+        storm::generator::CompressedState state(variableInformation.getTotalBitOffset(true));
+        for (auto const& booleanVariable : variableInformation.booleanVariables) {
+            bool value = std::uniform_int_distribution<int>(0, 1)(randomGenerator) == 1;
+            state.set(booleanVariable.bitOffset, value);
+            valuation.setBooleanValue(booleanVariable.variable, value);
+        }
+        for (auto const& integerVariable : variableInformation.integerVariables) {
+            int64_t value = std::uniform_int_distribution<int64_t>(integerVariable.lowerBound, integerVariable.upperBound)(randomGenerator);
+            state.setFromInt(integerVariable.bitOffset, integerVariable.bitWidth, static_cast<uint64_t>(value - integerVariable.lowerBound));
+            valuation.setIntegerValue(integerVariable.variable, value);
+        }
+
+        // Every satisfied guard has to be a candidate.
+        std::vector<uint64_t> const& candidates = guardIndex.getCandidates(state);
+        numberOfCandidates += candidates.size();
+        EXPECT_TRUE(std::is_sorted(candidates.begin(), candidates.end()));
+        for (uint64_t guardIndexInModule = 0; guardIndexInModule < guards.size(); ++guardIndexInModule) {
+            if (guards[guardIndexInModule].evaluateAsBool(&valuation)) {
+                EXPECT_TRUE(std::binary_search(candidates.begin(), candidates.end(), guardIndexInModule));
+            }
+        }
+    }
+    // All guards constrain the phase, so only a few guards remain per state.
+    EXPECT_LT(numberOfCandidates, numberOfSamples * guards.size() / 2);
+}
@@ -0,0 +1,85 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/models/symbolic/Dtmc.h"
+#include "storm/models/symbolic/Mdp.h"
+#include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/models/symbolic/ExplicitSubmatrixCache.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/DdPrismModelBuilder.h"
+
+TEST(ExplicitSubmatrixCacheTest_Sylvan, Dtmc) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program);
+
+    storm::models::symbolic::ExplicitSubmatrixCache<storm::dd::DdType::Sylvan, double>& cache = model->getExplicitSubmatrixCache();
+    storm::dd::Odd odd = model->getReachableStates().createOdd();
+    storm::storage::SparseMatrix<double> expected = model->getTransitionMatrix().toMatrix(odd, odd);
+
+    auto first = cache.getMatrix(model->getTransitionMatrix(), model->getReachableStates());
+    EXPECT_EQ(expected, *first);
+    EXPECT_EQ(0ul, cache.getNumberOfMatrixHits());
+    auto second = cache.getMatrix(model->getTransitionMatrix(), model->getReachableStates());
+    EXPECT_EQ(expected, *second);
+    EXPECT_EQ(1ul, cache.getNumberOfMatrixHits());
+    // A hit does not copy the matrix.
+    EXPECT_EQ(first.get(), second.get());
+
+    // The cache is shared by all copies of the model.
+    storm::models::symbolic::Model<storm::dd::DdType::Sylvan> copy(*model);
+    EXPECT_EQ(expected, *copy.getExplicitSubmatrixCache().getMatrix(model->getTransitionMatrix(), model->getReachableStates()));
+    EXPECT_EQ(2ul, cache.getNumberOfMatrixHits());
+
+    // A different set of states must not be answered from the cache.
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> states = model->getReachableStates() && !model->getStates("done");
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> submatrix = model->getTransitionMatrix() * states.template toAdd<double>() * states.swapVariables(model->getRowColumnMetaVariablePairs()).template toAdd<double>();
+    storm::dd::Odd subOdd = states.createOdd();
+    EXPECT_EQ(submatrix.toMatrix(subOdd, subOdd), *cache.getMatrix(submatrix, states));
+    EXPECT_EQ(2ul, cache.getNumberOfMatrixHits());
+}
+
+TEST(ExplicitSubmatrixCacheTest_Cudd, Mdp) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().build(program);
+    std::shared_ptr<storm::models::symbolic::Mdp<storm::dd::DdType::CUDD>> mdp = model->as<storm::models::symbolic::Mdp<storm::dd::DdType::CUDD>>();
+
+    storm::dd::Add<storm::dd::DdType::CUDD, double> const& matrix = mdp->getTransitionMatrix();
+    storm::dd::Bdd<storm::dd::DdType::CUDD> enabledChoices = matrix.notZero().existsAbstract(mdp->getColumnVariables());
+    storm::dd::Add<storm::dd::DdType::CUDD, double> firstVector = mdp->getStates("done").template toAdd<double>() * enabledChoices.template toAdd<double>();
+    storm::dd::Add<storm::dd::DdType::CUDD, double> secondVector = enabledChoices.template toAdd<double>();
+
+    storm::dd::Odd odd = mdp->getReachableStates().createOdd();
+    auto& cache = mdp->getExplicitSubmatrixCache();
+    auto first = cache.getMatrixVector(matrix, firstVector, enabledChoices, mdp->getRowVariables(), mdp->getColumnVariables(), mdp->getNondeterminismVariables(), mdp->getReachableStates());
+    EXPECT_EQ(0ul, cache.getNumberOfMatrixHits());
+    auto second = cache.getMatrixVector(matrix, secondVector, enabledChoices, mdp->getRowVariables(), mdp->getColumnVariables(), mdp->getNondeterminismVariables(), mdp->getReachableStates());
+    EXPECT_EQ(1ul, cache.getNumberOfMatrixHits());
+
+    EXPECT_EQ(first.first.get(), second.first.get());
+    EXPECT_EQ(first.first->getRowCount(), second.second.size());
+    EXPECT_EQ(firstVector.toVector(matrix, first.first->getRowGroupIndices(), mdp->getRowVariables(), mdp->getColumnVariables(), mdp->getNondeterminismVariables(), odd), first.second);
+    for (auto const& value : second.second) {
+        EXPECT_EQ(1.0, value);
+    }
+}
+
+TEST(ExplicitSubmatrixCacheTest_Sylvan, Disabled) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program);
+
+    storm::models::symbolic::ExplicitSubmatrixCache<storm::dd::DdType::Sylvan, double> cache(0);
+    storm::dd::Odd odd = model->getReachableStates().createOdd();
+    storm::storage::SparseMatrix<double> expected = model->getTransitionMatrix().toMatrix(odd, odd);
+
+    auto first = cache.getMatrix(model->getTransitionMatrix(), model->getReachableStates());
+    auto second = cache.getMatrix(model->getTransitionMatrix(), model->getReachableStates());
+    EXPECT_EQ(expected, *first);
+    EXPECT_EQ(expected, *second);
+    EXPECT_EQ(0ul, cache.getNumberOfMatrixHits());
+    // Without a cache, the caller is the only owner of the matrix.
+    EXPECT_EQ(1, first.use_count());
+}
@@ -3,6 +3,8 @@
 
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
+#include "storm/modelchecker/exploration/PartialMatrix.h"
+#include "storm/modelchecker/exploration/UnexploredStateTable.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm-parsers/parser/FormulaParser.h"
@@ -86,3 +88,107 @@ TEST(SparseExplorationModelCheckerTest, AsynchronousLeader) {
     
     EXPECT_NEAR(1, quantitativeResult2[0], storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision());
 }
+
+TEST(SparseExplorationModelCheckerTest, ConcurrentDice) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+    
+    storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Mdp<double>, uint32_t> checker(program);
+    checker.setNumberOfThreads(4);
+    
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("Pmin=? [F \"two\"]");
+    
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult1 = result->asExplicitQuantitativeCheckResult<double>();
+    
+    EXPECT_NEAR(0.0277777612209320068, quantitativeResult1[0], storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision());
+    
+    formula = formulaParser.parseSingleFormulaFromString("Pmax=? [F \"four\"]");
+    
+    result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult2 = result->asExplicitQuantitativeCheckResult<double>();
+    
+    EXPECT_NEAR(0.083333283662796020508, quantitativeResult2[0], storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision());
+}
+
+TEST(SparseExplorationModelCheckerTest, ConcurrentAsynchronousLeader) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader4.nm");
+    
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+    
+    storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Mdp<double>, uint32_t> checker(program);
+    checker.setNumberOfThreads(4);
+    
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("Pmax=? [F \"elected\"]");
+    
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult = result->asExplicitQuantitativeCheckResult<double>();
+    
+    EXPECT_NEAR(1, quantitativeResult[0], storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision());
+}
+
+TEST(SparseExplorationModelCheckerTest, PartialMatrix) {
+    // Use tiny chunks to force rows to be moved to new chunks while they are built.
+    storm::modelchecker::exploration_detail::PartialMatrix<uint32_t, double> matrix(3);
+    
+    EXPECT_EQ(0ul, matrix.addRow());
+    matrix.addEntryToLastRow(1, 0.5);
+    matrix.addEntryToLastRow(2, 0.5);
+    EXPECT_EQ(1ul, matrix.addRow());
+    EXPECT_EQ(2ul, matrix.addRow());
+    for (uint32_t column = 0; column < 5; ++column) {
+        matrix.addEntryToLastRow(column, 0.2);
+    }
+    EXPECT_EQ(3ul, matrix.copyRowToBack(0));
+    
+    ASSERT_EQ(4ul, matrix.getRowCount());
+    EXPECT_EQ(9ul, matrix.getEntryCount());
+    
+    ASSERT_EQ(2ul, matrix.getRow(0).size());
+    EXPECT_EQ(1ul, matrix.getRow(0)[0].getColumn());
+    EXPECT_EQ(2ul, matrix.getRow(0)[1].getColumn());
+    EXPECT_TRUE(matrix.getRow(1).empty());
+    ASSERT_EQ(5ul, matrix.getRow(2).size());
+    for (uint32_t column = 0; column < 5; ++column) {
+        EXPECT_EQ(column, matrix.getRow(2)[column].getColumn());
+        EXPECT_EQ(0.2, matrix.getRow(2)[column].getValue());
+    }
+    ASSERT_EQ(2ul, matrix.getRow(3).size());
+    EXPECT_EQ(1ul, matrix.getRow(3)[0].getColumn());
+    EXPECT_EQ(0.5, matrix.getRow(3)[1].getValue());
+}
+
+TEST(SparseExplorationModelCheckerTest, UnexploredStateTable) {
+    storm::modelchecker::exploration_detail::UnexploredStateTable<uint32_t> table;
+    
+    auto compressedState = [] (uint32_t state) {
+        storm::generator::CompressedState result(128);
+        result.setFromInt(0, 32, state);
+        result.setFromInt(96, 32, 3 * state);
+        return result;
+    };
+    
+    // Insert and remove enough states to trigger rehashing with deleted slots.
+    for (uint32_t state = 0; state < 1000; ++state) {
+        table.insert(state, compressedState(state));
+        if (state % 2 == 1) {
+            boost::optional<storm::generator::CompressedState> removed = table.remove(state - 1);
+            ASSERT_TRUE(static_cast<bool>(removed));
+            EXPECT_EQ(compressedState(state - 1), removed.get());
+        }
+    }
+    EXPECT_EQ(500ul, table.size());
+    
+    for (uint32_t state = 0; state < 1000; ++state) {
+        EXPECT_EQ(state % 2 == 1, table.contains(state));
+    }
+    EXPECT_FALSE(static_cast<bool>(table.remove(0)));
+    
+    boost::optional<storm::generator::CompressedState> removed = table.remove(999);
+    ASSERT_TRUE(static_cast<bool>(removed));
+    EXPECT_EQ(compressedState(999), removed.get());
+    EXPECT_EQ(499ul, table.size());
+}
@@ -0,0 +1,47 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/api/builder.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm/api/properties.h"
+#include "storm-parsers/api/properties.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace {
+
+    TEST(QuotientViewDtmcPrctlModelCheckerTest, Crowds) {
+        std::string formulasString = "P=? [F observe0>1]";
+        formulasString += "; P=? [F \"observeIGreater1\"]";
+        formulasString += "; P=? [!\"observeIGreater1\" U observe0>1]";
+
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-4-3.pm");
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+        auto model = storm::api::buildSparseModel<double>(program, formulas)->template as<storm::models::sparse::Dtmc<double>>();
+        uint64_t initialState = *model->getInitialStates().begin();
+
+        storm::Environment env;
+        storm::Environment quotientEnv;
+        quotientEnv.modelchecker().setUseQuotientView(true);
+        storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> checker(*model);
+
+        std::vector<double> expectedInitialValues = {78686542099694893.0 / 1268858272000000000.0, 40300855878315123.0 / 1268858272000000000.0};
+        for (uint64_t formula = 0; formula < formulas.size(); ++formula) {
+            std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, storm::modelchecker::CheckTask<>(*formulas[formula]));
+            std::unique_ptr<storm::modelchecker::CheckResult> quotientResult = checker.check(quotientEnv, storm::modelchecker::CheckTask<>(*formulas[formula]));
+            std::vector<double> const& values = result->asExplicitQuantitativeCheckResult<double>().getValueVector();
+            std::vector<double> const& quotientValues = quotientResult->asExplicitQuantitativeCheckResult<double>().getValueVector();
+            ASSERT_EQ(values.size(), quotientValues.size());
+            for (uint64_t state = 0; state < values.size(); ++state) {
+                EXPECT_NEAR(values[state], quotientValues[state], 1e-5) << "formula " << formula << ", state " << state;
+            }
+            if (formula < expectedInitialValues.size()) {
+                EXPECT_NEAR(expectedInitialValues[formula], quotientValues[initialState], 1e-5);
+            }
+        }
+    }
+}
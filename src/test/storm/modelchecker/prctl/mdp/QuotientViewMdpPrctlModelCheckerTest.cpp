@@ -0,0 +1,51 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/api/builder.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm/api/properties.h"
+#include "storm-parsers/api/properties.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace {
+
+    void expectSameResults(std::string const& file, std::string const& formulasString, std::vector<double> const& expectedInitialValues) {
+        storm::prism::Program program = storm::api::parseProgram(file);
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+        auto model = storm::api::buildSparseModel<double>(program, formulas)->template as<storm::models::sparse::Mdp<double>>();
+        uint64_t initialState = *model->getInitialStates().begin();
+
+        storm::Environment env;
+        storm::Environment quotientEnv;
+        quotientEnv.modelchecker().setUseQuotientView(true);
+        storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*model);
+
+        ASSERT_EQ(formulas.size(), expectedInitialValues.size());
+        for (uint64_t formula = 0; formula < formulas.size(); ++formula) {
+            std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, storm::modelchecker::CheckTask<>(*formulas[formula]));
+            std::unique_ptr<storm::modelchecker::CheckResult> quotientResult = checker.check(quotientEnv, storm::modelchecker::CheckTask<>(*formulas[formula]));
+            std::vector<double> const& values = result->asExplicitQuantitativeCheckResult<double>().getValueVector();
+            std::vector<double> const& quotientValues = quotientResult->asExplicitQuantitativeCheckResult<double>().getValueVector();
+            ASSERT_EQ(values.size(), quotientValues.size());
+            for (uint64_t state = 0; state < values.size(); ++state) {
+                EXPECT_NEAR(values[state], quotientValues[state], 1e-5) << "formula " << formula << ", state " << state;
+            }
+            EXPECT_NEAR(expectedInitialValues[formula], quotientValues[initialState], 1e-5);
+        }
+    }
+
+    TEST(QuotientViewMdpPrctlModelCheckerTest, Dice) {
+        std::string formulasString = "Pmin=? [F \"two\"]";
+        formulasString += "; Pmax=? [F \"two\"]";
+        formulasString += "; Pmin=? [F \"three\"]";
+        formulasString += "; Pmax=? [F \"three\"]";
+        formulasString += "; Pmin=? [F \"four\"]";
+        formulasString += "; Pmax=? [F \"four\"]";
+        expectSameResults(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm", formulasString, {1.0 / 36, 1.0 / 36, 2.0 / 36, 2.0 / 36, 3.0 / 36, 3.0 / 36});
+    }
+}
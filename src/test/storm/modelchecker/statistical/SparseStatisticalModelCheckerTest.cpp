@@ -0,0 +1,98 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/api/builder.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm/api/properties.h"
+#include "storm-parsers/api/properties.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/statistical/SparseStatisticalModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/StatisticalSettings.h"
+
+namespace {
+
+    double getPrecision() {
+        return storm::settings::getModule<storm::settings::modules::StatisticalSettings>().getPrecision();
+    }
+
+    TEST(SparseStatisticalModelCheckerTest, Die) {
+        std::string formulasString = "P=? [F \"one\"]";
+        formulasString += "; P=? [F<=3 \"done\"]";
+        formulasString += "; R{\"coin_flips\"}=? [C<=3]";
+        formulasString += "; R{\"coin_flips\"}=? [C<=5]";
+        formulasString += "; P>=0.1 [F \"one\"]";
+        formulasString += "; P>=0.3 [F \"one\"]";
+        formulasString += "; P<0.1 [F \"two\"]";
+
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+        auto model = storm::api::buildSparseModel<double>(program, formulas)->template as<storm::models::sparse::Dtmc<double>>();
+        uint64_t initialState = *model->getInitialStates().begin();
+
+        storm::modelchecker::SparseStatisticalModelChecker<storm::models::sparse::Dtmc<double>> checker(*model);
+
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(storm::modelchecker::CheckTask<>(*formulas[0], true));
+        EXPECT_NEAR(1.0 / 6, result->asExplicitQuantitativeCheckResult<double>()[initialState], getPrecision());
+
+        result = checker.check(storm::modelchecker::CheckTask<>(*formulas[1], true));
+        EXPECT_NEAR(0.75, result->asExplicitQuantitativeCheckResult<double>()[initialState], getPrecision());
+
+        result = checker.check(storm::modelchecker::CheckTask<>(*formulas[2], true));
+        EXPECT_NEAR(3.0, result->asExplicitQuantitativeCheckResult<double>()[initialState], getPrecision());
+
+        result = checker.check(storm::modelchecker::CheckTask<>(*formulas[3], true));
+        EXPECT_NEAR(3.5, result->asExplicitQuantitativeCheckResult<double>()[initialState], getPrecision());
+
+        result = checker.check(storm::modelchecker::CheckTask<>(*formulas[4], true));
+        EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[initialState]);
+
+        result = checker.check(storm::modelchecker::CheckTask<>(*formulas[5], true));
+        EXPECT_FALSE(result->asExplicitQualitativeCheckResult()[initialState]);
+
+        result = checker.check(storm::modelchecker::CheckTask<>(*formulas[6], true));
+        EXPECT_FALSE(result->asExplicitQualitativeCheckResult()[initialState]);
+    }
+
+    TEST(SparseStatisticalModelCheckerTest, Reproducibility) {
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P=? [F \"two\"]", program));
+        auto model = storm::api::buildSparseModel<double>(program, formulas)->template as<storm::models::sparse::Dtmc<double>>();
+        uint64_t initialState = *model->getInitialStates().begin();
+
+        // Results only depend on the seed, not on the number of threads.
+        storm::modelchecker::SparseStatisticalModelChecker<storm::models::sparse::Dtmc<double>> checker1(*model);
+        storm::modelchecker::SparseStatisticalModelChecker<storm::models::sparse::Dtmc<double>> checker2(*model);
+        std::unique_ptr<storm::modelchecker::CheckResult> result1 = checker1.check(storm::modelchecker::CheckTask<>(*formulas[0], true));
+        std::unique_ptr<storm::modelchecker::CheckResult> result2 = checker2.check(storm::modelchecker::CheckTask<>(*formulas[0], true));
+        EXPECT_EQ(result1->asExplicitQuantitativeCheckResult<double>()[initialState], result2->asExplicitQuantitativeCheckResult<double>()[initialState]);
+    }
+
+    TEST(SparseStatisticalModelCheckerTest, DieSelection) {
+        std::string formulasString = "Pmin=? [F s=7&d=2]";
+        formulasString += "; Pmax=? [F s=7&d=2]";
+
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/die_selection.nm");
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+        auto model = storm::api::buildSparseModel<double>(program, formulas)->template as<storm::models::sparse::Mdp<double>>();
+        uint64_t initialState = *model->getInitialStates().begin();
+
+        storm::modelchecker::SparseStatisticalModelChecker<storm::models::sparse::Mdp<double>> checker(*model);
+
+        // Sampled schedulers only yield values between the true minimum and maximum.
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(storm::modelchecker::CheckTask<>(*formulas[0], true));
+        double minResult = result->asExplicitQuantitativeCheckResult<double>()[initialState];
+        result = checker.check(storm::modelchecker::CheckTask<>(*formulas[1], true));
+        double maxResult = result->asExplicitQuantitativeCheckResult<double>()[initialState];
+        EXPECT_LE(minResult, maxResult);
+        EXPECT_GE(minResult, 0.1154 - getPrecision());
+        EXPECT_LE(maxResult, 0.3769 + getPrecision());
+    }
+
+    TEST(SparseStatisticalModelCheckerTest, OkamotoBound) {
+        EXPECT_EQ(18445ul, storm::modelchecker::SparseStatisticalModelChecker<storm::models::sparse::Dtmc<double>>::getOkamotoBound(0.01, 0.95));
+    }
+}
@@ -0,0 +1,90 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storm-parsers/parser/ChunkedBuffer.h"
+#include "storm-parsers/util/cstring.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+TEST(ChunkedBufferTest, SplitAtLineBoundaries) {
+    std::string content;
+    for (uint64_t line = 0; line < 1000; ++line) {
+        content += std::to_string(line) + " " + std::to_string(line * 0.25) + "\n";
+        if (line % 7 == 0) {
+            // Add some empty lines.
+            content += " \t\n\n";
+        }
+    }
+    char const* begin = content.c_str();
+    char const* end = begin + content.size();
+
+    storm::parser::ChunkedBuffer buffer(begin, end, 64);
+    EXPECT_EQ(begin, buffer.getChunkBegin(0));
+    EXPECT_EQ(end, buffer.getChunkEnd(buffer.getNumberOfChunks() - 1));
+    for (uint64_t chunk = 1; chunk < buffer.getNumberOfChunks(); ++chunk) {
+        EXPECT_EQ(buffer.getChunkEnd(chunk - 1), buffer.getChunkBegin(chunk));
+        if (buffer.getChunkBegin(chunk) != end) {
+            EXPECT_EQ('\n', buffer.getChunkBegin(chunk)[-1]);
+        }
+    }
+
+    std::vector<uint64_t> offsets = buffer.getRecordOffsets();
+    EXPECT_EQ(1000ul, offsets.back());
+
+    std::vector<std::pair<uint_fast64_t, double>> records = buffer.parseRecords<std::pair<uint_fast64_t, double>>([] (char const*& position) {
+        uint_fast64_t index = storm::utility::cstring::checked_strtol(position, &position);
+        double value = storm::utility::cstring::checked_strtod(position, &position);
+        return std::make_pair(index, value);
+    });
+    ASSERT_EQ(1000ul, records.size());
+    for (uint64_t line = 0; line < 1000; ++line) {
+        EXPECT_EQ(line, records[line].first);
+        EXPECT_EQ(line * 0.25, records[line].second);
+    }
+}
+
+TEST(ChunkedBufferTest, MalformedRecord) {
+    // The second line contains two records.
+    std::string content = "0 1.5\n1 2.5 2 3.5\n3 4.5\n";
+    storm::parser::ChunkedBuffer buffer(content.c_str(), content.c_str() + content.size());
+    STORM_SILENT_EXPECT_THROW(buffer.parseRecords<double>([] (char const*& position) {
+        storm::utility::cstring::checked_strtol(position, &position);
+        return storm::utility::cstring::checked_strtod(position, &position);
+    }), storm::exceptions::WrongFormatException);
+}
+
+TEST(ChunkedBufferTest, FastNumberParsing) {
+    // The results have to coincide with the ones of strtod/strtol, regardless of whether the fast path is taken.
+    std::vector<std::string> numbers = {"0", "-0", "1", "0.5", ".5", "1.", "+3.25", "-17.125", "0.1", "0.3333333333333333", "0.333333333333333314829616256247",
+                                        "123456789012345678", "1234567890123456789", "12345678901234567890", "9007199254740993", "1e22", "1e23", "1.5e-7",
+                                        "2.5E+3", "1e", "1e+", "7e-400", "4.9e-324", "1.7976931348623157e308", "0.000000000000000000000000123", "0x1p3", "inf", "nan"};
+    for (auto const& number : numbers) {
+        std::string input = "  " + number + " rest";
+        char const* expectedEnd;
+        double expected = strtod(input.c_str(), const_cast<char**>(&expectedEnd));
+        char const* actualEnd;
+        double actual = storm::utility::cstring::checked_strtod(input.c_str(), &actualEnd);
+        EXPECT_EQ(expectedEnd, actualEnd) << number;
+        if (expected == expected) {
+            EXPECT_EQ(expected, actual) << number;
+            EXPECT_EQ(std::signbit(expected), std::signbit(actual)) << number;
+        } else {
+            EXPECT_NE(actual, actual) << number;
+        }
+    }
+
+    for (std::string const& number : {"0", "42", "000123", "123456789012345678", "1234567890123456789", "-5", "+5"}) {
+        std::string input = "\t" + number + "\n";
+        char const* expectedEnd;
+        uint_fast64_t expected = strtol(input.c_str(), const_cast<char**>(&expectedEnd), 10);
+        char const* actualEnd;
+        uint_fast64_t actual = storm::utility::cstring::checked_strtol(input.c_str(), &actualEnd);
+        EXPECT_EQ(expectedEnd, actualEnd) << number;
+        EXPECT_EQ(expected, actual) << number;
+    }
+}
@@ -5,6 +5,47 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Ctmc.h"
+
+namespace {
+
+    template<typename ValueType>
+    void checkConcurrentParsing(std::string const& filename) {
+        storm::parser::DirectEncodingParserOptions sequentialOptions;
+        sequentialOptions.concurrentParsing = false;
+        storm::parser::DirectEncodingParserOptions concurrentOptions;
+        // Use small chunks such that the files are split.
+        concurrentOptions.minimalChunkSize = 512;
+        auto sequential = storm::parser::DirectEncodingParser<ValueType>::parseModel(filename, sequentialOptions);
+        auto concurrent = storm::parser::DirectEncodingParser<ValueType>::parseModel(filename, concurrentOptions);
+
+        ASSERT_EQ(sequential->getType(), concurrent->getType());
+        EXPECT_TRUE(sequential->getTransitionMatrix() == concurrent->getTransitionMatrix());
+        EXPECT_TRUE(sequential->getStateLabeling() == concurrent->getStateLabeling());
+        ASSERT_EQ(sequential->getNumberOfRewardModels(), concurrent->getNumberOfRewardModels());
+        for (auto const& rewardModel : sequential->getRewardModels()) {
+            ASSERT_TRUE(concurrent->hasRewardModel(rewardModel.first));
+            auto const& concurrentRewardModel = concurrent->getRewardModel(rewardModel.first);
+            ASSERT_EQ(rewardModel.second.hasStateRewards(), concurrentRewardModel.hasStateRewards());
+            if (rewardModel.second.hasStateRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateRewardVector(), concurrentRewardModel.getStateRewardVector());
+            }
+            ASSERT_EQ(rewardModel.second.hasStateActionRewards(), concurrentRewardModel.hasStateActionRewards());
+            if (rewardModel.second.hasStateActionRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), concurrentRewardModel.getStateActionRewardVector());
+            }
+        }
+        if (sequential->isOfType(storm::models::ModelType::MarkovAutomaton)) {
+            auto sequentialMa = sequential->template as<storm::models::sparse::MarkovAutomaton<ValueType>>();
+            auto concurrentMa = concurrent->template as<storm::models::sparse::MarkovAutomaton<ValueType>>();
+            EXPECT_EQ(sequentialMa->getMarkovianStates(), concurrentMa->getMarkovianStates());
+            EXPECT_EQ(sequentialMa->getExitRates(), concurrentMa->getExitRates());
+        } else if (sequential->isOfType(storm::models::ModelType::Ctmc)) {
+            EXPECT_EQ(sequential->template as<storm::models::sparse::Ctmc<ValueType>>()->getExitRateVector(), concurrent->template as<storm::models::sparse::Ctmc<ValueType>>()->getExitRateVector());
+        }
+    }
+
+}
 
 TEST(DirectEncodingParserTest, DtmcParsing) {
     std::shared_ptr<storm::models::sparse::Model<double>> modelPtr = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
@@ -84,3 +125,10 @@ TEST(DirectEncodingParserTest, MarkovAutomatonParsing) {
     ASSERT_EQ(6ul, modelPtr->getStates("one_job_finished").getNumberOfSetBits());
 }
 
+
+TEST(DirectEncodingParserTest, ConcurrentParsing) {
+    for (std::string const& filename : {"/dtmc/crowds-5-5.drn", "/mdp/two_dice.drn", "/ctmc/cluster2.drn", "/ma/jobscheduler.drn", "/ma/chain_elimination1.drn"}) {
+        checkConcurrentParsing<double>(STORM_TEST_RESOURCES_DIR + filename);
+        checkConcurrentParsing<storm::RationalNumber>(STORM_TEST_RESOURCES_DIR + filename);
+    }
+}
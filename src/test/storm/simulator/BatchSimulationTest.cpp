@@ -0,0 +1,35 @@
+#include "test/storm_gtest.h"
+#include "storm/simulator/BatchSimulation.h"
+
+#include <vector>
+
+TEST(BatchSimulationTest, BatchSeeds) {
+    EXPECT_EQ(storm::simulator::getBatchSeed(42, 3), storm::simulator::getBatchSeed(42, 3));
+    EXPECT_NE(storm::simulator::getBatchSeed(42, 3), storm::simulator::getBatchSeed(42, 4));
+    EXPECT_NE(storm::simulator::getBatchSeed(42, 3), storm::simulator::getBatchSeed(43, 3));
+    // The upper halves of seed and batch index are not ignored
+    EXPECT_NE(storm::simulator::getBatchSeed(42, 3), storm::simulator::getBatchSeed(42, 3 + (1ull << 32)));
+}
+
+TEST(BatchSimulationTest, SimulateBatches) {
+    std::vector<uint64_t> counts(200, 0);
+    storm::simulator::simulateBatches(50, 100, [&counts] (uint64_t batchIndex) { ++counts[batchIndex]; });
+    for (uint64_t batch = 0; batch < counts.size(); ++batch) {
+        EXPECT_EQ(counts[batch], (batch >= 50 && batch < 150) ? 1ul : 0ul);
+    }
+}
+
+TEST(BatchSimulationTest, PathStatistics) {
+    storm::simulator::PathStatistics first;
+    first.addPath(1.0, false);
+    first.addPath(2.0, true);
+    storm::simulator::PathStatistics second;
+    second.addPath(3.0, false);
+    first.add(second);
+    EXPECT_EQ(first.numberOfPaths, 3ul);
+    EXPECT_EQ(first.numberOfTruncatedPaths, 1ul);
+    EXPECT_NEAR(first.getMean(), 2.0, 1e-12);
+    EXPECT_NEAR(first.getVariance(), 1.0, 1e-12);
+    EXPECT_EQ(storm::simulator::PathStatistics().getMean(), 0.0);
+    EXPECT_EQ(second.getVariance(), 0.0);
+}
@@ -0,0 +1,65 @@
+#include "test/storm_gtest.h"
+#include "storm/simulator/DiscreteTimeOnTheFlySimulator.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/prism/Program.h"
+
+TEST(DiscreteTimeOnTheFlySimulatorTest, DieProgram) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::builder::BuilderOptions options;
+    options.setBuildAllRewardModels();
+
+    storm::simulator::DiscreteTimeOnTheFlySimulator<double> simulator(program, options);
+    simulator.setSeed(42);
+    auto const& manager = program.getManager();
+    storm::expressions::Expression s = manager.getVariableExpression("s");
+    storm::expressions::Expression d = manager.getVariableExpression("d");
+
+    auto result = simulator.estimateUntilProbability(manager.boolean(true), s == manager.integer(7) && d == manager.integer(1), boost::none, 20000);
+    EXPECT_EQ(20000ul, result.numberOfPaths);
+    EXPECT_EQ(0ul, result.numberOfTruncatedPaths);
+    EXPECT_NEAR(1.0 / 6.0, result.getMean(), 0.02);
+
+    result = simulator.estimateUntilProbability(manager.boolean(true), s == manager.integer(7), 3, 20000);
+    EXPECT_NEAR(0.75, result.getMean(), 0.02);
+
+    result = simulator.estimateCumulativeReward("coin_flips", 3, 1000);
+    EXPECT_NEAR(3.0, result.getMean(), 1e-9);
+    result = simulator.estimateCumulativeReward("coin_flips", 5, 20000);
+    EXPECT_NEAR(3.5, result.getMean(), 0.05);
+
+    // The die has only 13 states, so almost every expansion is answered from the cache.
+    EXPECT_GT(simulator.getNumberOfCacheHits(), simulator.getNumberOfCacheMisses());
+}
+
+TEST(DiscreteTimeOnTheFlySimulatorTest, DieJani) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::jani::Model janiModel = program.toJani().substituteConstantsFunctions();
+    storm::simulator::DiscreteTimeOnTheFlySimulator<double> simulator(janiModel, storm::builder::BuilderOptions());
+    simulator.setSeed(42);
+    auto const& manager = janiModel.getManager();
+
+    auto result = simulator.estimateUntilProbability(manager.boolean(true), manager.getVariableExpression("s") == manager.integer(7) && manager.getVariableExpression("d") == manager.integer(2), boost::none, 20000);
+    EXPECT_NEAR(1.0 / 6.0, result.getMean(), 0.02);
+}
+
+TEST(DiscreteTimeOnTheFlySimulatorTest, Reproducibility) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/die_c1.nm");
+    storm::builder::BuilderOptions options;
+    auto const& manager = program.getManager();
+    storm::expressions::Expression target = manager.getVariableExpression("s") == manager.integer(7);
+
+    storm::simulator::DiscreteTimeOnTheFlySimulator<double> simulator(program, options);
+    simulator.setSeed(7);
+    simulator.setBatchSize(100);
+    auto first = simulator.estimateUntilProbability(manager.boolean(true), target, 4, 5000);
+    // The result does not depend on the contents of the caches.
+    simulator.setCacheSize(2);
+    auto second = simulator.estimateUntilProbability(manager.boolean(true), target, 4, 5000);
+    EXPECT_EQ(first.sum, second.sum);
+    EXPECT_EQ(first.sumOfSquares, second.sumOfSquares);
+
+    simulator.setSeed(8);
+    auto third = simulator.estimateUntilProbability(manager.boolean(true), target, 4, 5000);
+    EXPECT_EQ(5000ul, third.numberOfPaths);
+}
@@ -3,6 +3,7 @@
 #include "test/storm_gtest.h"
 
 #include "storm/solver/LinearEquationSolver.h"
+#include "storm/solver/NativeLinearEquationSolver.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/EigenSolverEnvironment.h"
@@ -122,6 +123,35 @@ namespace {
         }
     };
     
+    class NativeDoubleBicgstabEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Bicgstab);
+            env.solver().native().setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner::Diagonal);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-8"));
+            return env;
+        }
+    };
+    
+    class NativeDoubleGmresEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Gmres);
+            env.solver().native().setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner::None);
+            env.solver().native().setRestartThreshold(50);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-8"));
+            return env;
+        }
+    };
+    
     class NativeRationalRationalSearchEnvironment {
     public:
         typedef storm::RationalNumber ValueType;
@@ -315,6 +345,8 @@ namespace {
             NativeDoubleGaussSeidelEnvironment,
             NativeDoubleSorEnvironment,
             NativeDoubleWalkerChaeEnvironment,
+            NativeDoubleBicgstabEnvironment,
+            NativeDoubleGmresEnvironment,
             NativeRationalRationalSearchEnvironment,
             EliminationRationalEnvironment,
             GmmGmresIluEnvironment,
@@ -369,4 +401,77 @@ namespace {
         EXPECT_NEAR(x[1], this->parseNumber("457/9"), this->precision());
         EXPECT_NEAR(x[2], this->parseNumber("875/18"), this->precision());
     }
+
+    TYPED_TEST(LinearEquationSolverTest, solveEquationSystemMovedMatrix) {
+        typedef typename TestFixture::ValueType ValueType;
+        // Same as above, but the solver takes ownership of the matrix (and converts it in place where applicable)
+        storm::storage::SparseMatrixBuilder<ValueType> builder;
+        builder.addNextValue(0, 0, this->parseNumber("1/5"));
+        builder.addNextValue(0, 1, this->parseNumber("2/5"));
+        builder.addNextValue(0, 2, this->parseNumber("2/5"));
+        builder.addNextValue(1, 0, this->parseNumber("1/50"));
+        builder.addNextValue(1, 1, this->parseNumber("48/50"));
+        builder.addNextValue(1, 2, this->parseNumber("1/50"));
+        builder.addNextValue(2, 0, this->parseNumber("4/10"));
+        builder.addNextValue(2, 1, this->parseNumber("3/10"));
+        builder.addNextValue(2, 2, this->parseNumber("0"));
+        storm::storage::SparseMatrix<ValueType> A = builder.build();
+
+        std::vector<ValueType> x(3);
+        std::vector<ValueType> b = {this->parseNumber("3"), this->parseNumber("-0.01"), this->parseNumber("12")};
+
+        auto factory = storm::solver::GeneralLinearEquationSolverFactory<ValueType>();
+        if (factory.getEquationProblemFormat(this->env()) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem) {
+            A.convertToEquationSystem();
+        }
+
+        auto solver = factory.create(this->env(), std::move(A));
+        solver->setBounds(this->parseNumber("-100"), this->parseNumber("100"));
+        ASSERT_NO_THROW(solver->solveEquations(this->env(), x, b));
+        EXPECT_NEAR(x[0], this->parseNumber("481/9"), this->precision());
+        EXPECT_NEAR(x[1], this->parseNumber("457/9"), this->precision());
+        EXPECT_NEAR(x[2], this->parseNumber("875/18"), this->precision());
+
+        // Solving a second time reuses the converted matrix
+        std::vector<ValueType> x2(3);
+        ASSERT_NO_THROW(solver->solveEquations(this->env(), x2, b));
+        EXPECT_NEAR(x2[0], this->parseNumber("481/9"), this->precision());
+        EXPECT_NEAR(x2[1], this->parseNumber("457/9"), this->precision());
+        EXPECT_NEAR(x2[2], this->parseNumber("875/18"), this->precision());
+    }
+
+    TEST(NativeLinearEquationSolverTest, BicgstabBreakdown) {
+        // For a skew-symmetric matrix, the first search direction is orthogonal to the shadow residual.
+        storm::storage::SparseMatrixBuilder<double> builder(2, 2);
+        builder.addNextValue(0, 1, 1.0);
+        builder.addNextValue(1, 0, -1.0);
+        storm::storage::SparseMatrix<double> A = builder.build();
+        
+        std::vector<double> x(2);
+        std::vector<double> b = {1.0, 0.0};
+        
+        storm::Environment env;
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Bicgstab);
+        storm::solver::NativeLinearEquationSolver<double> solver(A);
+        bool result = true;
+        ASSERT_NO_THROW(result = solver.solveEquations(env, x, b));
+        EXPECT_FALSE(result);
+    }
+    
+    TEST(NativeLinearEquationSolverTest, GmresStagnation) {
+        // The system is inconsistent, so the Krylov subspace collapses without reducing the residual.
+        storm::storage::SparseMatrixBuilder<double> builder(2, 2);
+        builder.addNextValue(0, 0, 1.0);
+        storm::storage::SparseMatrix<double> A = builder.build();
+        
+        std::vector<double> x(2);
+        std::vector<double> b = {0.0, 1.0};
+        
+        storm::Environment env;
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Gmres);
+        storm::solver::NativeLinearEquationSolver<double> solver(A);
+        bool result = true;
+        ASSERT_NO_THROW(result = solver.solveEquations(env, x, b));
+        EXPECT_FALSE(result);
+    }
 }
\ No newline at end of file
@@ -101,6 +101,31 @@ namespace {
             return env;
         }
     };
+    class DoubleTopologicalPIEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::PolicyIteration);
+            env.solver().minMax().setTopologicalPolicyIteration(true);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Jacobi);
+            env.solver().setLinearEquationSolverPrecision(env.solver().minMax().getPrecision());
+            return env;
+        }
+    };
+    class DoubleLpEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::LinearProgramming);
+            return env;
+        }
+    };
     class RationalPIEnvironment {
     public:
         typedef storm::RationalNumber ValueType;
@@ -111,6 +136,17 @@ namespace {
             return env;
         }
     };
+    class RationalTopologicalPIEnvironment {
+    public:
+        typedef storm::RationalNumber ValueType;
+        static const bool isExact = true;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::PolicyIteration);
+            env.solver().minMax().setTopologicalPolicyIteration(true);
+            return env;
+        }
+    };
     class RationalRationalSearchEnvironment {
     public:
         typedef storm::RationalNumber ValueType;
@@ -142,7 +178,10 @@ namespace {
             DoubleTopologicalViEnvironment,
             DoubleTopologicalCudaViEnvironment,
             DoublePIEnvironment,
+            DoubleTopologicalPIEnvironment,
+            DoubleLpEnvironment,
             RationalPIEnvironment,
+            RationalTopologicalPIEnvironment,
             RationalRationalSearchEnvironment
     > TestingTypes;
     
@@ -175,7 +214,42 @@ namespace {
         ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
         EXPECT_NEAR(x[0], this->parseNumber("0.99"), this->precision());
     }
+    
+    TYPED_TEST(MinMaxLinearEquationSolverTest, SolveEquationsWithSeveralSccs) {
+        typedef typename TestFixture::ValueType ValueType;
+        
+        // State 0 has a self-loop and reaches the SCC consisting of states 1 and 2.
+        storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+        ASSERT_NO_THROW(builder.newRowGroup(0));
+        ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("0.5")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("0.5")));
+        ASSERT_NO_THROW(builder.newRowGroup(2));
+        ASSERT_NO_THROW(builder.addNextValue(2, 2, this->parseNumber("0.5")));
+        ASSERT_NO_THROW(builder.newRowGroup(3));
+        ASSERT_NO_THROW(builder.addNextValue(3, 1, this->parseNumber("0.5")));
+        
+        storm::storage::SparseMatrix<ValueType> A;
+        ASSERT_NO_THROW(A = builder.build(5, 3, 3));
+        
+        std::vector<ValueType> x(3);
+        std::vector<ValueType> b = {this->parseNumber("0"), this->parseNumber("0.2"), this->parseNumber("0.25"), this->parseNumber("0.25"), this->parseNumber("0.1")};
+        
+        auto factory = storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType>();
+        auto solver = factory.create(this->env(), A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(this->parseNumber("0"), this->parseNumber("1"));
+        storm::solver::MinMaxLinearEquationSolverRequirements req = solver->getRequirements(this->env());
+        req.clearBounds();
+        ASSERT_FALSE(req.hasEnabledRequirement());
+        ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Minimize, x, b));
+        EXPECT_NEAR(x[0], this->parseNumber("0.2"), this->precision());
+        EXPECT_NEAR(x[1], this->parseNumber("0.3"), this->precision());
+        EXPECT_NEAR(x[2], this->parseNumber("0.1"), this->precision());
+        
+        ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
+        EXPECT_NEAR(x[0], this->parseNumber("0.5"), this->precision());
+        EXPECT_NEAR(x[1], this->parseNumber("0.5"), this->precision());
+        EXPECT_NEAR(x[2], this->parseNumber("0.5"), this->precision());
+    }
 }
-
-
-
@@ -0,0 +1,163 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <chrono>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/AutoParser.h"
+#include "storm/api/builder.h"
+#include "storm/api/properties.h"
+#include "storm/storage/jani/Property.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/solver/stateelimination/PrioritizedStateEliminator.h"
+#include "storm/solver/stateelimination/StatePriorityQueue.h"
+#include "storm/storage/FlexibleSparseMatrix.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/prism.h"
+#include "storm/utility/stateelimination.h"
+
+namespace {
+
+    typedef storm::settings::modules::EliminationSettings::EliminationOrder EliminationOrder;
+
+    // An eliminator that counts the number of transitions of the predecessors after each elimination step, which is
+    // a measure for the work (and the fill-in) of the elimination.
+    template<typename ValueType>
+    class CountingStateEliminator : public storm::solver::stateelimination::PrioritizedStateEliminator<ValueType> {
+    public:
+        typedef typename storm::solver::stateelimination::PrioritizedStateEliminator<ValueType>::PriorityQueuePointer PriorityQueuePointer;
+
+        CountingStateEliminator(storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, PriorityQueuePointer priorityQueue, std::vector<ValueType>& stateValues) : storm::solver::stateelimination::PrioritizedStateEliminator<ValueType>(transitionMatrix, backwardTransitions, priorityQueue, stateValues), work(0) {
+            // Intentionally left empty.
+        }
+
+        virtual void updatePredecessor(storm::storage::sparse::state_type const& predecessor, ValueType const& probability, storm::storage::sparse::state_type const& state) override {
+            storm::solver::stateelimination::PrioritizedStateEliminator<ValueType>::updatePredecessor(predecessor, probability, state);
+            work += this->matrix.getRow(predecessor).size();
+        }
+
+        uint64_t work;
+    };
+
+    template<typename ValueType>
+    struct EliminationResult {
+        ValueType probability;
+        uint64_t work;
+    };
+
+    // Computes the probability to reach the target states from the initial state by eliminating all other states in
+    // the given order.
+    template<typename ValueType>
+    EliminationResult<ValueType> computeReachabilityProbability(storm::models::sparse::Dtmc<ValueType> const& dtmc, std::string const& targetLabel, EliminationOrder order) {
+        storm::storage::BitVector const& psiStates = dtmc.getStates(targetLabel);
+        std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 = storm::utility::graph::performProb01(dtmc, storm::storage::BitVector(dtmc.getNumberOfStates(), true), psiStates);
+        storm::storage::BitVector maybeStates = ~(statesWithProbability01.first | statesWithProbability01.second);
+        uint64_t initialState = *dtmc.getInitialStates().begin();
+        if (!maybeStates.get(initialState)) {
+            return {statesWithProbability01.second.get(initialState) ? storm::utility::one<ValueType>() : storm::utility::zero<ValueType>(), 0};
+        }
+
+        std::vector<ValueType> values = dtmc.getTransitionMatrix().getConstrainedRowSumVector(maybeStates, statesWithProbability01.second);
+        storm::storage::SparseMatrix<ValueType> submatrix = dtmc.getTransitionMatrix().getSubmatrix(false, maybeStates, maybeStates);
+        storm::storage::FlexibleSparseMatrix<ValueType> flexibleMatrix(submatrix);
+        storm::storage::FlexibleSparseMatrix<ValueType> flexibleBackwardTransitions(submatrix.transpose(), true);
+
+        uint64_t initialStateInSubmatrix = maybeStates.getNumberOfSetBitsBeforeIndex(initialState);
+        storm::storage::BitVector statesToEliminate(submatrix.getRowCount(), true);
+        statesToEliminate.set(initialStateInSubmatrix, false);
+
+        auto priorityQueue = storm::utility::stateelimination::createStatePriorityQueue<ValueType>(order, boost::none, flexibleMatrix, flexibleBackwardTransitions, values, statesToEliminate);
+        EXPECT_EQ(statesToEliminate.getNumberOfSetBits(), priorityQueue->size());
+        CountingStateEliminator<ValueType> eliminator(flexibleMatrix, flexibleBackwardTransitions, priorityQueue, values);
+        eliminator.eliminateAll();
+        eliminator.eliminateState(initialStateInSubmatrix, false);
+        return {values[initialStateInSubmatrix], eliminator.work};
+    }
+
+    std::vector<std::pair<std::string, EliminationOrder>> getOrders() {
+        return {{"dpen", EliminationOrder::DynamicPenalty}, {"regex", EliminationOrder::RegularExpression}, {"amd", EliminationOrder::MinimumDegree}, {"markowitz", EliminationOrder::Markowitz}, {"nd", EliminationOrder::NestedDissection}};
+    }
+
+    void expectSameProbability(double const& expected, double const& actual, std::string const& message) {
+        EXPECT_NEAR(expected, actual, 1e-8) << message;
+    }
+
+    // Rational functions obtained with different orders need not be syntactically equal, so they are compared at a
+    // parameter valuation.
+    void expectSameProbability(storm::RationalFunction const& expected, storm::RationalFunction const& actual, std::string const& message) {
+        std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> valuation;
+        for (auto const& variable : expected.gatherVariables()) {
+            valuation.emplace(variable, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.3));
+        }
+        for (auto const& variable : actual.gatherVariables()) {
+            valuation.emplace(variable, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.3));
+        }
+        EXPECT_EQ(expected.evaluate(valuation), actual.evaluate(valuation)) << message;
+    }
+
+    // Prints the work and the runtime of all elimination orders on the given model and checks that they agree.
+    template<typename ValueType>
+    void benchmarkEliminationOrders(std::string const& name, storm::models::sparse::Dtmc<ValueType> const& dtmc, std::string const& targetLabel) {
+        STORM_PRINT(name << " (" << dtmc.getNumberOfStates() << " states, " << dtmc.getNumberOfTransitions() << " transitions):" << std::endl);
+        boost::optional<ValueType> referenceProbability;
+        for (auto const& order : getOrders()) {
+            auto start = std::chrono::high_resolution_clock::now();
+            EliminationResult<ValueType> result = computeReachabilityProbability(dtmc, targetLabel, order.second);
+            auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start);
+            STORM_PRINT("    " << order.first << ": work " << result.work << ", time " << duration.count() << "ms" << std::endl);
+            if (referenceProbability) {
+                expectSameProbability(referenceProbability.get(), result.probability, name + " " + order.first);
+            } else {
+                referenceProbability = result.probability;
+            }
+        }
+    }
+
+}
+
+TEST(StateEliminationOrderTest, Die) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/die.tra", STORM_TEST_RESOURCES_DIR "/lab/die.lab", "", "");
+    ASSERT_EQ(abstractModel->getType(), storm::models::ModelType::Dtmc);
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+
+    for (auto const& order : getOrders()) {
+        EXPECT_NEAR(1.0 / 6.0, computeReachabilityProbability(*dtmc, "one", order.second).probability, 1e-10) << order.first;
+        EXPECT_NEAR(1.0 / 6.0, computeReachabilityProbability(*dtmc, "three", order.second).probability, 1e-10) << order.first;
+    }
+}
+
+TEST(StateEliminationOrderTest, Crowds) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/crowds5_5.tra", STORM_TEST_RESOURCES_DIR "/lab/crowds5_5.lab", "", "");
+    ASSERT_EQ(abstractModel->getType(), storm::models::ModelType::Dtmc);
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+
+    for (auto const& order : getOrders()) {
+        EXPECT_NEAR(0.3328800375801578281, computeReachabilityProbability(*dtmc, "observe0Greater1", order.second).probability, 1e-10) << order.first;
+        EXPECT_NEAR(0.32153724292835045, computeReachabilityProbability(*dtmc, "observeOnlyTrueSender", order.second).probability, 1e-10) << order.first;
+    }
+}
+
+// Compares the work and the runtime of the elimination orders on the test models. This is not run by default; use
+// --gtest_also_run_disabled_tests --gtest_filter=*EliminationOrderBenchmark* to run it.
+TEST(StateEliminationOrderTest, DISABLED_EliminationOrderBenchmark) {
+    std::vector<std::pair<std::string, std::string>> benchmarks = {{"die", "one"}, {"crowds5_5", "observe0Greater1"}, {"leader4_8", "elected"}};
+    for (auto const& benchmark : benchmarks) {
+        std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/" + benchmark.first + ".tra", STORM_TEST_RESOURCES_DIR "/lab/" + benchmark.first + ".lab", "", "");
+        ASSERT_EQ(abstractModel->getType(), storm::models::ModelType::Dtmc);
+        benchmarkEliminationOrders(benchmark.first, *abstractModel->as<storm::models::sparse::Dtmc<double>>(), benchmark.second);
+    }
+
+    // Parametric models, where the fill-in also determines the size of the rational functions.
+    std::vector<std::pair<std::string, std::string>> parametricBenchmarks = {{"brp16_2", "error"}, {"crowds3_5", "observe0Greater1"}};
+    for (auto const& benchmark : parametricBenchmarks) {
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/pdtmc/" + benchmark.first + ".pm");
+        program = storm::utility::prism::preprocess(program, "");
+        std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P=? [F \"" + benchmark.second + "\"]", program));
+        std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas);
+        ASSERT_EQ(model->getType(), storm::models::ModelType::Dtmc);
+        benchmarkEliminationOrders(benchmark.first, *model->as<storm::models::sparse::Dtmc<storm::RationalFunction>>(), benchmark.second);
+    }
+}
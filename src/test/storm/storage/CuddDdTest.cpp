@@ -716,6 +716,41 @@ TEST(CuddDd, AddOddTest) {
     EXPECT_EQ(106ul, matrix.getNonzeroEntryCount());
 }
 
+TEST(CuddDd, AddLargeMatrixTest) {
+    // The matrix is large enough to be converted concurrently (if possible).
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    uint_fast64_t numberOfStates = 50000;
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, numberOfStates - 1);
+
+    // The diagonal holds the index of the row, the first column and the eighth row are filled.
+    storm::dd::Add<storm::dd::DdType::CUDD, double> dd = manager->getIdentity(x.first, x.second).template toAdd<double>() * manager->template getIdentity<double>(x.first);
+    dd += manager->getEncoding(x.second, 0).template toAdd<double>() * manager->getRange(x.first).template toAdd<double>();
+    dd += manager->getEncoding(x.first, 7).template toAdd<double>() * manager->getRange(x.second).template toAdd<double>() * manager->template getConstant<double>(0.5);
+
+    storm::dd::Odd rowOdd = manager->getRange(x.first).createOdd();
+    storm::dd::Odd columnOdd = manager->getRange(x.second).createOdd();
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd));
+    ASSERT_EQ(numberOfStates, matrix.getRowCount());
+    EXPECT_EQ(numberOfStates, matrix.getColumnCount());
+    EXPECT_EQ(1 + 2 * (numberOfStates - 2) + numberOfStates, matrix.getNonzeroEntryCount());
+
+    for (uint_fast64_t row = 0; row < numberOfStates; ++row) {
+        uint_fast64_t expectedNumberOfEntries = row == 7 ? numberOfStates : (row == 0 ? 1 : 2);
+        ASSERT_EQ(expectedNumberOfEntries, matrix.getRow(row).getNumberOfEntries()) << row;
+        uint_fast64_t expectedColumn = 0;
+        for (auto const& entry : matrix.getRow(row)) {
+            if (row != 7 && expectedColumn > 0) {
+                expectedColumn = row;
+            }
+            double expectedValue = (row == entry.getColumn() ? static_cast<double>(row) : 0.0) + (entry.getColumn() == 0 ? 1.0 : 0.0) + (row == 7 ? 0.5 : 0.0);
+            EXPECT_EQ(expectedColumn, entry.getColumn()) << row;
+            EXPECT_EQ(expectedValue, entry.getValue()) << row;
+            ++expectedColumn;
+        }
+    }
+}
+
 TEST(CuddDd, BddOddTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> a = manager->addMetaVariable("a");
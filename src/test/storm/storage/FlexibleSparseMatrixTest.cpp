@@ -0,0 +1,96 @@
+#include "test/storm_gtest.h"
+
+#include "storm/solver/stateelimination/StateEliminator.h"
+#include "storm/storage/FlexibleSparseMatrix.h"
+#include "storm/storage/RowPool.h"
+#include "storm/storage/SparseMatrix.h"
+
+TEST(FlexibleSparseMatrixTest, RowPoolReuse) {
+    storm::storage::RowPool pool(1024);
+
+    void* first = pool.allocate(48);
+    void* second = pool.allocate(64);
+    EXPECT_EQ(1ul, pool.getNumberOfSlabs());
+    EXPECT_EQ(0ul, pool.getNumberOfReusedBlocks());
+
+    // Both requests fall into the same size class, so the block is handed out again.
+    pool.deallocate(first, 48);
+    EXPECT_EQ(first, pool.allocate(64));
+    EXPECT_EQ(1ul, pool.getNumberOfReusedBlocks());
+
+    // Large requests bypass the slabs.
+    void* large = pool.allocate(512);
+    pool.deallocate(large, 512);
+    EXPECT_EQ(1ul, pool.getNumberOfSlabs());
+
+    pool.deallocate(second, 64);
+    pool.deallocate(first, 64);
+}
+
+TEST(FlexibleSparseMatrixTest, CopyAndConvert) {
+    storm::storage::SparseMatrixBuilder<double> builder(3, 3, 5);
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 0, 0.25));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, 0.75));
+    ASSERT_NO_THROW(builder.addNextValue(2, 2, 1.0));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = builder.build());
+
+    storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(matrix);
+    EXPECT_EQ(5ul, flexibleMatrix.getNonzeroEntryCount());
+    EXPECT_TRUE(flexibleMatrix.rowHasDiagonalElement(2));
+    EXPECT_FALSE(flexibleMatrix.rowHasDiagonalElement(0));
+
+    // Changing a copy must not affect the original matrix.
+    storm::storage::FlexibleSparseMatrix<double> copy(flexibleMatrix);
+    copy.getRow(0).clear();
+    copy.getRow(1).emplace_back(3, 0.0);
+    EXPECT_EQ(2ul, flexibleMatrix.getRow(0).size());
+    EXPECT_EQ(2ul, flexibleMatrix.getRow(1).size());
+    EXPECT_TRUE(matrix == flexibleMatrix.createSparseMatrix());
+
+    // Moving a matrix keeps its rows valid.
+    storm::storage::FlexibleSparseMatrix<double> moved(std::move(copy));
+    EXPECT_TRUE(moved.getRow(0).empty());
+    moved = flexibleMatrix;
+    EXPECT_TRUE(matrix == moved.createSparseMatrix());
+}
+
+TEST(FlexibleSparseMatrixTest, EliminateStateInPlace) {
+    storm::storage::SparseMatrixBuilder<double> builder(6, 6, 6);
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 0.2));
+    ASSERT_NO_THROW(builder.addNextValue(0, 3, 0.3));
+    ASSERT_NO_THROW(builder.addNextValue(0, 5, 0.1));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 3, 0.25));
+    ASSERT_NO_THROW(builder.addNextValue(1, 4, 0.25));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = builder.build(6, 6));
+
+    storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(matrix);
+    storm::storage::FlexibleSparseMatrix<double> flexibleBackwardTransitions(matrix.transpose(), true);
+    storm::solver::stateelimination::StateEliminator<double> eliminator(flexibleMatrix, flexibleBackwardTransitions);
+    eliminator.eliminateState(1, true);
+
+    // The successors of the eliminated state are merged into the row of its predecessor.
+    auto const& row = flexibleMatrix.getRow(0);
+    ASSERT_EQ(4ul, row.size());
+    EXPECT_EQ(2ul, row[0].getColumn());
+    EXPECT_NEAR(0.1, row[0].getValue(), 1e-12);
+    EXPECT_EQ(3ul, row[1].getColumn());
+    EXPECT_NEAR(0.35, row[1].getValue(), 1e-12);
+    EXPECT_EQ(4ul, row[2].getColumn());
+    EXPECT_NEAR(0.05, row[2].getValue(), 1e-12);
+    EXPECT_EQ(5ul, row[3].getColumn());
+    EXPECT_NEAR(0.1, row[3].getValue(), 1e-12);
+    EXPECT_TRUE(flexibleMatrix.getRow(1).empty());
+
+    // The predecessor lists of the successors only contain the predecessor of the eliminated state.
+    for (uint64_t successor = 2; successor < 6; ++successor) {
+        auto const& backwardRow = flexibleBackwardTransitions.getRow(successor);
+        ASSERT_EQ(1ul, backwardRow.size()) << successor;
+        EXPECT_EQ(0ul, backwardRow[0].getColumn()) << successor;
+    }
+    EXPECT_TRUE(flexibleBackwardTransitions.getRow(1).empty());
+}
@@ -12,6 +12,7 @@
 #include "storm/builder/DdPrismModelBuilder.h"
 #include "storm/builder/ExplicitModelBuilder.h"
 #include "storm/utility/graph.h"
+#include "storm/utility/dd.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
@@ -668,3 +669,28 @@ TEST(GraphTest, ExplicitProb01MinMax) {
     EXPECT_EQ(993ull, statesWithProbability01.first.getNumberOfSetBits());
     EXPECT_EQ(16ull, statesWithProbability01.second.getNumberOfSetBits());
 }
+
+TEST(GraphTest, SymbolicPartitionedReachability_Sylvan) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program);
+    
+    ASSERT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+    
+    {
+        // This block is necessary, so the BDDs get disposed before the manager (contained in the model).
+        storm::dd::Bdd<storm::dd::DdType::Sylvan> transitions = model->getQualitativeTransitionMatrix(false);
+        
+        // Split the transitions by each of the variables they change.
+        std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> identities;
+        for (auto const& variablePair : model->getRowColumnMetaVariablePairs()) {
+            identities.push_back(model->getManager().getIdentity(variablePair.first, variablePair.second));
+        }
+        std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> partitions = storm::utility::dd::splitTransitionsByChangedVariables(transitions, identities);
+        EXPECT_EQ(identities.size() + 1, partitions.size());
+        
+        storm::dd::Bdd<storm::dd::DdType::Sylvan> reachableStates = storm::utility::dd::computeReachableStates(model->getInitialStates(), partitions, model->getRowVariables(), model->getColumnVariables(), model->getRowColumnMetaVariablePairs()).first;
+        EXPECT_TRUE(model->getReachableStates() == reachableStates);
+        EXPECT_TRUE(storm::utility::dd::computeReachableStates(model->getInitialStates(), transitions, model->getRowVariables(), model->getColumnVariables()).first == reachableStates);
+    }
+}